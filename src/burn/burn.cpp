@@ -25,6 +25,18 @@ bool bBurnUseMMX;
 #if defined BUILD_A68K
 bool bBurnUseASMCPUEmulation = false;
 #endif
+#if defined M68K_X64_DRC
+bool bBurnUseM68KRecompiler = false;	// run 68000s on the x86-64 recompiler (read at SekInit()), off until checked on real games
+#endif
+#if defined SH2_X64_DRC
+bool bBurnUseSh2Recompiler = false;	// run SH-2s on the x86-64 recompiler (read at Sh2Init()), off until checked on real games
+#endif
+#if defined ARM7_X64_DRC
+bool bBurnUseArm7Recompiler = false;	// run ARM7s on the x86-64 recompiler (read at Arm7Init()), off until checked on real games
+#endif
+#if defined E132XS_X64_DRC
+bool bBurnUseE132XSRecompiler = false;	// run Hyperstones on the x86-64 recompiler (read at E132XSInit()), off until checked on real games
+#endif
 
 // Just so we can start using FBNEO_DEBUG and keep backwards compatablity should whatever is left of FB Alpha rise from it's grave.
 #if defined (FBNEO_DEBUG) && (!defined FBA_DEBUG)
@@ -85,6 +97,7 @@ extern "C" INT32 BurnLibInit()
 	nBurnDrvCount = sizeof(pDriver) / sizeof(pDriver[0]);	// count available drivers
 
 	cmc_4p_Precalc();
+	BurnSoundKernelsInit();
 	bBurnUseMMX = BurnCheckMMXSupport();
 
 	return 0;
@@ -94,6 +107,8 @@ extern "C" INT32 BurnLibExit()
 {
 	nBurnDrvCount = 0;
 
+	BurnThreadExit();
+
 	return 0;
 }
 
@@ -645,7 +660,9 @@ extern "C" INT32 BurnDrvInit()
 
 	CheatInit();
 	HiscoreInit();
+	BurnIdleInit();
 	BurnStateInit();
+	BurnStateCacheInit();
 	BurnInitMemoryManager();
 	BurnRandomInit();
 	BurnSoundDCFilterReset();
@@ -689,7 +706,10 @@ extern "C" INT32 BurnDrvExit()
 	HiscoreExit(); // must come before CheatExit() (uses cheat cpu-registry)
 	CheatExit();
 	CheatSearchExit();
+	BurnIdleExit();
 	BurnStateExit();
+	BurnStateDeltaExit();
+	BurnStateCacheExit();
 
 	nBurnCPUSpeedAdjust = 0x0100;
 
@@ -699,6 +719,11 @@ extern "C" INT32 BurnDrvExit()
 
 	BurnExitMemoryManager();
 #if defined FBNEO_DEBUG
+	{
+		struct BurnMemoryStats ms;
+		BurnGetMemoryStats(&ms);
+		bprintf(PRINT_IMPORTANT, _T("    Memory: peak %d KB in %d blocks (%d allocations).\n"), (INT32)(ms.nPeakBytes / 1024), ms.nPeakBlocks, ms.nAllocCount);
+	}
 	DebugTrackerExit();
 #endif
 
@@ -743,14 +768,23 @@ extern "C" INT32 BurnDrvFrame()
 {
 	CheatApply();									// Apply cheats (if any)
 	HiscoreApply();
-	return pDriver[nBurnDrvActive]->Frame();		// Forward to drivers function
+
+	BurnTransferDirtyStart();
+	INT32 nRet = pDriver[nBurnDrvActive]->Frame();	// Forward to drivers function
+	BurnTransferDirtyEnd();
+
+	return nRet;
 }
 
 // Force redraw of the screen
 extern "C" INT32 BurnDrvRedraw()
 {
 	if (pDriver[nBurnDrvActive]->Redraw) {
-		return pDriver[nBurnDrvActive]->Redraw();	// Forward to drivers function
+		BurnTransferDirtyStart();
+		INT32 nRet = pDriver[nBurnDrvActive]->Redraw();	// Forward to drivers function
+		BurnTransferDirtyEnd();
+
+		return nRet;
 	}
 
 	return 1;										// No funtion provide, so simply return
@@ -29,6 +29,7 @@ extern TCHAR szAppSamplesPath[MAX_PATH];
 extern TCHAR szAppHDDPath[MAX_PATH];
 extern TCHAR szAppBlendPath[MAX_PATH];
 extern TCHAR szAppEEPROMPath[MAX_PATH];
+extern TCHAR szBurnRomCachePath[MAX_PATH];	// decoded rom region cache (rom_cache.cpp), empty = disabled
 
 // Macro to determine the size of a struct up to and including "member"
 #define STRUCT_SIZE_HELPER(type, member) offsetof(type, member) + sizeof(((type*)0)->member)
@@ -234,18 +235,63 @@ struct BurnDIPInfo {
 	MemIndex();                                 				\
 	INT32 nLen = MemEnd - (UINT8 *)0;           				\
 	if ((AllMem = (UINT8 *)BurnMalloc(nLen)) == NULL) return 1;	\
-	memset(AllMem, 0, nLen);                       				\
 	MemIndex();                                 				\
 } while (0)
 
 #define BurnFreeMemIndex() do { BurnFree(AllMem); } while (0)
 
+// Where BurnMalloc gets large blocks (64 KB and up) from, see burn_memory.cpp
+#define BURN_ARENA_OFF		0		// always malloc + memset
+#define BURN_ARENA_PAGES	1		// anonymous pages (already zero), 2 MB aligned + huge page hint
+#define BURN_ARENA_HUGETLB	2		// as above, but try reserved huge pages (MAP_HUGETLB) first
+
+extern INT32 nBurnArenaMode;
+
+// Worker thread pool, see burn_thread.cpp
+typedef void (*BurnThreadJob)(void* pParam, INT32 nIndex);
+
+extern INT32 nBurnThreadMax;			// 0 = one thread per cpu core, 1 = no worker threads
+
+struct BurnJobQueue;					// one per client, jobs are numbered from 0 after each BurnThreadWait()
+
+INT32 BurnThreadCount();
+INT32 BurnThreadRun(BurnThreadJob pJob, void* pParam, INT32 nCount);
+struct BurnJobQueue* BurnThreadQueueInit(BurnThreadJob pJob, void* pParam);
+void BurnThreadQueueExit(struct BurnJobQueue* pQueue);
+INT32 BurnThreadQueue(struct BurnJobQueue* pQueue, INT32 nCount);
+void BurnThreadWait(struct BurnJobQueue* pQueue);
+void BurnThreadExit();
+
+// Frame time breakdown, see burn_profile.cpp
+#define BURN_PROFILE_CPU		0
+#define BURN_PROFILE_SOUND		1
+#define BURN_PROFILE_DRAW		2
+#define BURN_PROFILE_PALETTE	3
+#define BURN_PROFILE_COUNT		4
+
+extern bool bBurnProfile;
+
+void BurnProfileReset();
+void BurnProfileGet(double* pdSeconds);	// seconds spent in each section since the reset
+
 // ---------------------------------------------------------------------------
 
 extern bool bBurnUseMMX;
 #ifdef BUILD_A68K
 extern bool bBurnUseASMCPUEmulation;
 #endif
+#ifdef M68K_X64_DRC
+extern bool bBurnUseM68KRecompiler;
+#endif
+#ifdef SH2_X64_DRC
+extern bool bBurnUseSh2Recompiler;
+#endif
+#ifdef ARM7_X64_DRC
+extern bool bBurnUseArm7Recompiler;
+#endif
+#ifdef E132XS_X64_DRC
+extern bool bBurnUseE132XSRecompiler;
+#endif
 
 extern UINT32 nFramesEmulated;
 extern UINT32 nFramesRendered;
@@ -267,6 +313,9 @@ extern UINT8 *pBurnDraw;			// Pointer to correctly sized bitmap
 extern INT32 nBurnPitch;						// Pitch between each line
 extern INT32 nBurnBpp;						// Bytes per pixel (2, 3, or 4)
 
+extern bool bBurnDirtyRows;					// Set if pBurnDraw keeps its contents between frames
+INT32 BurnTransferGetDirtyRows(INT32 *pnFirst, INT32 *pnLast, UINT8 **ppRows);	// 1 = unknown, redraw everything
+
 extern UINT8 nBurnLayer;			// Can be used externally to select which layers to show
 extern UINT8 nSpriteEnable;			// Can be used externally to select which Sprites to show
 
@@ -322,6 +371,30 @@ void BurnRandomScan(INT32 nAction);                 // Must be called in driver'
 void BurnRandomInit();                              // Called automatically in BurnDrvInit() / Internal use only
 void BurnRandomSetSeed(UINT64 nSeed);               // Set the seed - useful for netgames / input recordings
 
+// Memory manager statistics for the running driver (reset on BurnDrvInit, kept after BurnDrvExit)
+struct BurnMemoryStats {
+	INT64 nCurrentBytes;			// allocated right now
+	INT64 nPeakBytes;				// highest nCurrentBytes seen
+	INT32 nAllocCount;				// total number of BurnMalloc calls
+	INT32 nLiveBlocks;				// blocks allocated right now
+	INT32 nPeakBlocks;				// highest nLiveBlocks seen
+};
+
+void BurnGetMemoryStats(struct BurnMemoryStats* pStats);
+INT32 BurnGetMemorySite(INT32 i, char** pszFile, INT32* pnLine, INT32* pnCount, INT64* pnPeakBytes);
+
+// Idle loop skipping, see burn_idle.cpp (statistics are reset on BurnDrvInit and kept after BurnDrvExit)
+extern bool bBurnIdleSkip;				// cpu cores that support it skip wait loops, off by default (read at BurnDrvInit())
+
+struct BurnIdleStats {
+	INT32 nLoops;					// loops skipped at least once
+	INT32 nSkips;					// times a loop was skipped
+	INT64 nSkipped;					// cycles skipped, in each core's own units
+};
+
+void BurnGetIdleStats(struct BurnIdleStats* pStats);
+INT32 BurnGetIdleLoop(INT32 i, char** pszCpu, INT32* pnCpu, UINT32* pnPC, INT32* pnSkips, INT64* pnSkipped);
+
 // Handy FM default callbacks
 INT32 BurnSynchroniseStream(INT32 nSoundRate);
 double BurnGetTime();
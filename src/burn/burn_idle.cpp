@@ -0,0 +1,303 @@
+// Burn - Idle loop detection
+//
+// Cpu cores that opt in with BurnIdleRegister() call BurnIdleBranch() for taken branches
+// that go no more than BURN_IDLE_MAX_LOOP bytes back. A loop whose iterations all take
+// the same number of cycles, write nothing and leave the registers (as hashed by the core)
+// as they were is polling memory or a status bit: it can't see anything new until an
+// interrupt, a timer or another cpu gets to run. Once a loop has gone round like that
+// IDLE_CONFIRM times BurnIdleBranch() returns its cycles per iteration, and the core skips
+// whole iterations up to the end of the slice or its own next internal event, then tells
+// us how much it skipped with BurnIdleSkip(). Only an iteration that ran entirely inside the
+// current slice counts: one that straddles the start of it may have read memory before the
+// other cpus got to change it.
+//
+// Loops can be denied (never skipped) or allowed (skipped even though they write, e.g. a
+// watchdog kick in the wait loop) per driver in IdleRules[] below, or by the driver itself
+// with BurnIdleSetRule() after its cpus are initialised.
+
+#include "burnint.h"
+
+#define IDLE_MAX_CORES		8
+#define IDLE_LOOPS			256			// loop table entries, direct mapped
+#define IDLE_MAX_ITERATION	512			// cycles, anything slower isn't a wait loop
+#define IDLE_CONFIRM		3			// identical iterations seen before skipping
+#define IDLE_MAX_FAILS		8			// iterations that didn't match before the loop is left alone for a while
+#define IDLE_MAX_RULES		32
+
+bool bBurnIdleSkip = false;
+
+struct IdleRule {
+	const char *szDriver;				// romset, clones match on their parent
+	const char *szCpu;					// cpu_core_config::cpu_name, NULL for every cpu
+	UINT32 nPC;							// address of the branch, ~0 for every loop
+	INT32 nMode;						// BURN_IDLE_DENY / BURN_IDLE_ALLOW
+};
+
+static const IdleRule IdleRules[] = {
+	{ "galpanis",	"SH-2",		~0U,	BURN_IDLE_DENY	},	// sound drops out when the sh2 skips its wait loops (see d_suprnova.cpp)
+
+	{ NULL,			NULL,		0,		0				}
+};
+
+struct IdleCore {
+	cpu_core_config *pConfig;
+	UINT32 (*pState)();
+};
+
+struct IdleLoop {
+	UINT32 nFrom;						// branch
+	UINT32 nTo;							// target
+	INT32 nCore;						// -1 = unused entry
+	INT32 nCpu;
+	INT32 nMode;						// rule for this loop
+
+	INT32 bValid;						// nLast* hold a sample
+	UINT32 nLastCycles;
+	UINT32 nLastState;
+	UINT32 nLastWrites;
+	UINT32 nIteration;
+	INT32 nSeen;
+	INT32 nFails;
+	INT32 nCooldown;					// branches to let by before sampling again
+	INT32 nBackoff;
+
+	INT32 nSkips;
+	INT64 nSkipped;
+};
+
+UINT32 nBurnIdleWrites = 0;
+
+static IdleCore Cores[IDLE_MAX_CORES];
+static INT32 nCores = 0;
+static IdleLoop Loops[IDLE_LOOPS];
+static IdleLoop *pLastLoop = NULL;		// loop BurnIdleBranch() last said could be skipped
+
+static IdleRule Rules[IDLE_MAX_RULES];
+static INT32 nRules = 0;
+
+static struct BurnIdleStats stats;
+
+static INT32 IdleRuleFor(INT32 nCore, UINT32 nPC)
+{
+	const char *szCpu = Cores[nCore].pConfig->cpu_name;
+
+	for (INT32 i = nRules - 1; i >= 0; i--) {
+		if (Rules[i].szCpu && strcmp(Rules[i].szCpu, szCpu)) continue;
+		if (Rules[i].nPC != ~0U && Rules[i].nPC != nPC) continue;
+
+		return Rules[i].nMode;
+	}
+
+	return 0;
+}
+
+static INT32 IdleAddRule(const char *szCpu, UINT32 nPC, INT32 nMode)
+{
+	if (nRules >= IDLE_MAX_RULES) {
+		return 1;
+	}
+
+	Rules[nRules].szDriver = NULL;
+	Rules[nRules].szCpu = szCpu;
+	Rules[nRules].nPC = nPC;
+	Rules[nRules].nMode = nMode;
+	nRules++;
+
+	return 0;
+}
+
+void BurnIdleInit()
+{
+	nCores = 0;
+	nRules = 0;
+	nBurnIdleWrites = 0;
+	pLastLoop = NULL;
+	memset(&stats, 0, sizeof(stats));
+
+	for (INT32 i = 0; i < IDLE_LOOPS; i++) {
+		Loops[i].nCore = -1;
+	}
+
+	const char *szName = BurnDrvGetTextA(DRV_NAME);
+	const char *szParent = BurnDrvGetTextA(DRV_PARENT);
+
+	for (INT32 i = 0; IdleRules[i].szDriver; i++) {
+		if (strcmp(IdleRules[i].szDriver, szName) && (szParent == NULL || strcmp(IdleRules[i].szDriver, szParent))) continue;
+
+		IdleAddRule(IdleRules[i].szCpu, IdleRules[i].nPC, IdleRules[i].nMode);
+	}
+}
+
+void BurnIdleExit()
+{
+#if defined FBNEO_DEBUG
+	if (stats.nSkips) {
+		bprintf(PRINT_IMPORTANT, _T("    Idle loops: %d found, %d skips, %d k cycles skipped.\n"), stats.nLoops, stats.nSkips, (INT32)(stats.nSkipped / 1000));
+
+		for (INT32 i = 0; i < IDLE_LOOPS; i++) {
+			IdleLoop *pLoop = &Loops[i];
+			if (pLoop->nCore < 0 || pLoop->nSkips == 0) continue;
+#ifndef __LIBRETRO__
+			bprintf(PRINT_NORMAL, _T("      %S #%d %08x -> %08x: %d cycles, %d skips, %d k cycles skipped\n"),
+#else
+			bprintf(PRINT_NORMAL, _T("      %s #%d %08x -> %08x: %d cycles, %d skips, %d k cycles skipped\n"),
+#endif
+				Cores[pLoop->nCore].pConfig->cpu_name, pLoop->nCpu, pLoop->nFrom, pLoop->nTo, pLoop->nIteration, pLoop->nSkips, (INT32)(pLoop->nSkipped / 1000));
+		}
+	}
+#endif
+
+	nRules = 0;
+	pLastLoop = NULL;
+}
+
+// returns the handle the core passes to BurnIdleBranch(), or -1 if loops aren't to be skipped
+INT32 BurnIdleRegister(cpu_core_config *pConfig, UINT32 (*pState)())
+{
+	if (!bBurnIdleSkip) {
+		return -1;
+	}
+
+	for (INT32 i = 0; i < nCores; i++) {
+		if (Cores[i].pConfig == pConfig) {
+			return i;
+		}
+	}
+
+	if (nCores >= IDLE_MAX_CORES) {
+		return -1;
+	}
+
+	Cores[nCores].pConfig = pConfig;
+	Cores[nCores].pState = pState;
+
+	return nCores++;
+}
+
+// drivers can add to IdleRules[] at init, later rules take precedence
+INT32 BurnIdleSetRule(const char *szCpu, UINT32 nPC, INT32 nMode)
+{
+	for (INT32 i = 0; i < IDLE_LOOPS; i++) {
+		Loops[i].nCore = -1;			// rules are looked up once per loop
+	}
+
+	return IdleAddRule(szCpu, nPC, nMode);
+}
+
+// non-zero if translated code may skip the loop whose branch is at nPC
+INT32 BurnIdleAllowed(INT32 nCore, UINT32 nPC)
+{
+	return nCore >= 0 && IdleRuleFor(nCore, nPC) != BURN_IDLE_DENY;
+}
+
+// nCycles is the core's cycle count, in the units it will skip in
+INT32 BurnIdleBranch(INT32 nCore, UINT32 nFrom, UINT32 nTo, UINT32 nCycles)
+{
+	INT32 nCpu = Cores[nCore].pConfig->active();
+	IdleLoop *pLoop = &Loops[((nFrom >> 1) ^ (nFrom >> 9) ^ (nCpu << 5) ^ (nCore << 6)) & (IDLE_LOOPS - 1)];
+
+	if (pLoop->nFrom != nFrom || pLoop->nTo != nTo || pLoop->nCore != nCore || pLoop->nCpu != nCpu) {
+		memset(pLoop, 0, sizeof(IdleLoop));
+		pLoop->nFrom = nFrom;
+		pLoop->nTo = nTo;
+		pLoop->nCore = nCore;
+		pLoop->nCpu = nCpu;
+		pLoop->nMode = IdleRuleFor(nCore, nFrom);
+	}
+
+	if (pLoop->nMode == BURN_IDLE_DENY) {
+		return 0;
+	}
+
+	if (pLoop->nCooldown) {
+		pLoop->nCooldown--;
+		return 0;
+	}
+
+	UINT32 nState = Cores[nCore].pState();
+	UINT32 nIteration = nCycles - pLoop->nLastCycles;
+	INT32 bSame = pLoop->bValid && nIteration > 0 && nIteration <= IDLE_MAX_ITERATION && nState == pLoop->nLastState;
+
+	if (nBurnIdleWrites != pLoop->nLastWrites && pLoop->nMode != BURN_IDLE_ALLOW) {
+		bSame = 0;
+	}
+
+	pLoop->bValid = 1;
+	pLoop->nLastCycles = nCycles;
+	pLoop->nLastState = nState;
+	pLoop->nLastWrites = nBurnIdleWrites;
+
+	if (bSame && nIteration == pLoop->nIteration) {
+		if (pLoop->nSeen < IDLE_CONFIRM) {
+			pLoop->nSeen++;
+		}
+
+		if (pLoop->nSeen >= IDLE_CONFIRM) {
+			pLoop->nFails = 0;
+			pLoop->nBackoff = 0;
+			pLastLoop = pLoop;
+			return nIteration;
+		}
+
+		return 0;
+	}
+
+	pLoop->nIteration = bSame ? nIteration : 0;
+	pLoop->nSeen = bSame ? 1 : 0;
+
+	if (!bSame && ++pLoop->nFails >= IDLE_MAX_FAILS) {
+		// a counted loop or one that does real work, look again later
+		pLoop->nFails = 0;
+		pLoop->bValid = 0;
+		pLoop->nCooldown = 64 << pLoop->nBackoff;
+		if (pLoop->nBackoff < 10) pLoop->nBackoff++;
+	}
+
+	return 0;
+}
+
+// the core skipped nCycles worth of iterations of the loop BurnIdleBranch() just returned
+void BurnIdleSkip(INT32 nCycles)
+{
+	if (pLastLoop == NULL || nCycles <= 0) {
+		return;
+	}
+
+	if (pLastLoop->nSkips == 0) {
+		stats.nLoops++;
+	}
+
+	pLastLoop->nLastCycles += nCycles;	// so the next iteration still matches
+	pLastLoop->nSkips++;
+	pLastLoop->nSkipped += nCycles;
+
+	stats.nSkips++;
+	stats.nSkipped += nCycles;
+}
+
+void BurnGetIdleStats(struct BurnIdleStats *pStats)
+{
+	if (pStats) {
+		memcpy(pStats, &stats, sizeof(BurnIdleStats));
+	}
+}
+
+// Get the cpu, branch address and skip counts for loop table entry i
+// returns 1 if i is out of range, 0 with *pnSkips = 0 for entries with no skips
+INT32 BurnGetIdleLoop(INT32 i, char **pszCpu, INT32 *pnCpu, UINT32 *pnPC, INT32 *pnSkips, INT64 *pnSkipped)
+{
+	if (i < 0 || i >= IDLE_LOOPS) {
+		return 1;
+	}
+
+	IdleLoop *pLoop = &Loops[i];
+	INT32 bUsed = pLoop->nCore >= 0 && pLoop->nCore < nCores;
+
+	if (pszCpu)    *pszCpu = bUsed ? Cores[pLoop->nCore].pConfig->cpu_name : NULL;
+	if (pnCpu)     *pnCpu = pLoop->nCpu;
+	if (pnPC)      *pnPC = pLoop->nFrom;
+	if (pnSkips)   *pnSkips = bUsed ? pLoop->nSkips : 0;
+	if (pnSkipped) *pnSkipped = bUsed ? pLoop->nSkipped : 0;
+
+	return 0;
+}
@@ -1,95 +1,455 @@
 // FB Neo memory management module
 
-// The purpose of this module is to offer replacement functions for standard C/C++ ones 
+// The purpose of this module is to offer replacement functions for standard C/C++ ones
 // that allocate and free memory.  This should help deal with the problem of memory
 // leaks and non-null pointers on game exit.
 
+// Allocations are tracked in an open-addressed (linear probing) hash table keyed by
+// pointer, so BurnMalloc/BurnRealloc/BurnFree are O(1) and there is no limit on the
+// number of blocks.  Statistics (current/peak bytes, counts and the call site of each
+// BurnMalloc) are kept per driver and can be read with BurnGetMemoryStats() and
+// BurnGetMemorySite().
+
+// Large blocks (the MemIndex() arena of most drivers, big ROM regions) are taken directly
+// from the OS as anonymous pages when nBurnArenaMode is set.  Fresh pages are already
+// zero, so they don't need a memset (and are only touched once the driver uses them),
+// blocks of 2 MB or more are aligned and flagged for huge pages on Linux to cut down on
+// TLB misses in the renderers, and each one is given back with a single call on exit.
+
 #include "burnint.h"
 
+#if defined(_WIN32)
+ #include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+ #include <sys/mman.h>
+ #define ARENA_MMAP
+#endif
+
 #define LOG_MEMORY_USAGE 0
 
-#define MAX_MEM_PTR	0x400 // more than 1024 malloc calls should be insane...
+#define MEM_TABLE_MIN	0x400 // initial table size, grows when 1/2 full
+
+#define MEM_TYPE_HEAP		0 // malloc
+#define MEM_TYPE_PAGES		1 // mmap / VirtualAlloc
+#define MEM_TYPE_HUGETLB	2 // mmap with MAP_HUGETLB
+
+#define ARENA_MIN_SIZE		0x10000  // smaller blocks always come from the heap
+#define ARENA_HUGE_SIZE		0x200000 // 2 MB huge page
+
+INT32 nBurnArenaMode = BURN_ARENA_PAGES;
+
+struct MemEntry { UINT8 *ptr; INT32 size; INT32 site; INT32 type; };
+struct MemSite  { char *file; INT32 line; INT32 count; INT32 live; INT64 bytes; INT64 peak; };
+
+static MemEntry *memtable = NULL; // pointer to allocated memory -> size / call site
+static UINT32 memtable_size = 0;
+static UINT32 memtable_used = 0;
+
+static MemSite *memsite = NULL;   // call sites (file/line of each BurnMalloc)
+static UINT32 memsite_size = 0;
+static UINT32 memsite_used = 0;
+
+static BurnMemoryStats memstats;
+
+static inline UINT32 MemHash(UINT64 key, UINT32 mask)
+{
+	return (UINT32)((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+}
+
+static inline UINT32 MemPtrHash(void *ptr, UINT32 mask)
+{
+	return MemHash((UINT64)(size_t)ptr >> 4, mask);
+}
+
+static inline UINT32 MemSiteHash(char *file, INT32 line, UINT32 mask)
+{
+	return MemHash(((UINT64)(size_t)file << 16) ^ (UINT32)line, mask);
+}
+
+static INT32 MemTableResize(UINT32 size)
+{
+	MemEntry *newtable = (MemEntry*)calloc(size, sizeof(MemEntry));
+	if (newtable == NULL) {
+		return 1;
+	}
+
+	for (UINT32 i = 0; i < memtable_size; i++) {
+		if (memtable[i].ptr) {
+			UINT32 j = MemPtrHash(memtable[i].ptr, size - 1);
+			while (newtable[j].ptr) j = (j + 1) & (size - 1);
+			newtable[j] = memtable[i];
+		}
+	}
+
+	free(memtable);
+	memtable = newtable;
+	memtable_size = size;
+
+	return 0;
+}
+
+static INT32 MemSiteResize(UINT32 size)
+{
+	// site indexes are stored in memtable, so keep them stable while growing
+	MemSite *newsite = (MemSite*)realloc(memsite, size * sizeof(MemSite));
+	if (newsite == NULL) {
+		return 1;
+	}
+
+	memsite = newsite;
+	memsite_size = size;
+
+	return 0;
+}
+
+// sites are appended in order, with a small hash index on top for lookups
+static INT32 *memsite_index = NULL;
+static UINT32 memsite_index_size = 0;
+
+static INT32 MemSiteIndexResize(UINT32 size)
+{
+	INT32 *newindex = (INT32*)malloc(size * sizeof(INT32));
+	if (newindex == NULL) {
+		return 1;
+	}
+
+	memset(newindex, 0xff, size * sizeof(INT32));
+
+	for (UINT32 i = 0; i < memsite_used; i++) {
+		UINT32 j = MemSiteHash(memsite[i].file, memsite[i].line, size - 1);
+		while (newindex[j] != -1) j = (j + 1) & (size - 1);
+		newindex[j] = i;
+	}
+
+	free(memsite_index);
+	memsite_index = newindex;
+	memsite_index_size = size;
+
+	return 0;
+}
+
+static INT32 MemSiteFind(char *file, INT32 line)
+{
+	if (memsite_used >= memsite_size && MemSiteResize(memsite_size ? (memsite_size * 2) : 0x100)) {
+		return -1;
+	}
+
+	if ((memsite_used + 1) * 2 > memsite_index_size && MemSiteIndexResize(memsite_index_size ? (memsite_index_size * 2) : 0x200)) {
+		return -1;
+	}
+
+	UINT32 mask = memsite_index_size - 1;
+	UINT32 j = MemSiteHash(file, line, mask);
+
+	while (memsite_index[j] != -1) {
+		MemSite *site = &memsite[memsite_index[j]];
+		if (site->file == file && site->line == line) {
+			return memsite_index[j];
+		}
+		j = (j + 1) & mask;
+	}
+
+	INT32 i = memsite_used++;
+	memset(&memsite[i], 0, sizeof(MemSite));
+	memsite[i].file = file;
+	memsite[i].line = line;
+	memsite_index[j] = i;
+
+	return i;
+}
+
+static MemEntry *MemFind(void *ptr)
+{
+	if (ptr == NULL || memtable == NULL) {
+		return NULL;
+	}
+
+	UINT32 mask = memtable_size - 1;
+	UINT32 j = MemPtrHash(ptr, mask);
+
+	while (memtable[j].ptr) {
+		if (memtable[j].ptr == ptr) {
+			return &memtable[j];
+		}
+		j = (j + 1) & mask;
+	}
+
+	return NULL;
+}
+
+static INT32 MemInsert(UINT8 *ptr, INT32 size, INT32 site, INT32 type)
+{
+	if ((memtable_used + 1) * 2 > memtable_size && MemTableResize(memtable_size ? (memtable_size * 2) : MEM_TABLE_MIN)) {
+		return 1;
+	}
+
+	UINT32 mask = memtable_size - 1;
+	UINT32 j = MemPtrHash(ptr, mask);
+	while (memtable[j].ptr) j = (j + 1) & mask;
+
+	memtable[j].ptr = ptr;
+	memtable[j].size = size;
+	memtable[j].site = site;
+	memtable[j].type = type;
+	memtable_used++;
+
+	return 0;
+}
+
+// remove an entry, shifting back any entries in the same probe run (no tombstones needed)
+static void MemRemove(MemEntry *entry)
+{
+	UINT32 mask = memtable_size - 1;
+	UINT32 i = entry - memtable;
+	UINT32 j = i;
+
+	memtable[i].ptr = NULL;
+	memtable_used--;
 
-static UINT8 *memptr[MAX_MEM_PTR]; // pointer to allocated memory
-static INT32 memsize[MAX_MEM_PTR];
-static INT32 mem_allocated;
+	while (1) {
+		j = (j + 1) & mask;
+		if (memtable[j].ptr == NULL) break;
+
+		UINT32 k = MemPtrHash(memtable[j].ptr, mask);
+
+		// move entry j into the hole at i, if its home slot k doesn't lie in (i, j]
+		if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j))) continue;
+
+		memtable[i] = memtable[j];
+		memtable[j].ptr = NULL;
+		i = j;
+	}
+}
+
+static void MemStatsAdd(INT32 site, INT64 size, INT32 count)
+{
+	memstats.nCurrentBytes += size;
+	memstats.nLiveBlocks += count;
+	if (count > 0) memstats.nAllocCount += count;
+
+	if (memstats.nCurrentBytes > memstats.nPeakBytes) memstats.nPeakBytes = memstats.nCurrentBytes;
+	if (memstats.nLiveBlocks > memstats.nPeakBlocks) memstats.nPeakBlocks = memstats.nLiveBlocks;
+
+	if (site >= 0) {
+		MemSite *s = &memsite[site];
+		s->bytes += size;
+		s->live += count;
+		if (count > 0) s->count += count;
+		if (s->bytes > s->peak) s->peak = s->bytes;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Page backed blocks
+
+#if defined(ARENA_MMAP)
+static inline size_t ArenaHugeLen(INT32 size)
+{
+	return ((size_t)size + ARENA_HUGE_SIZE - 1) & ~(size_t)(ARENA_HUGE_SIZE - 1);
+}
+#endif
+
+static UINT8 *ArenaAlloc(INT32 size, INT32 *type)
+{
+	*type = MEM_TYPE_PAGES;
+
+#if defined(_WIN32)
+	return (UINT8*)VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#elif defined(ARENA_MMAP)
+	void *ptr;
+
+#if defined(MAP_HUGETLB)
+	if (nBurnArenaMode >= BURN_ARENA_HUGETLB && size >= ARENA_HUGE_SIZE) {
+		// reserved huge pages (hugetlbfs), only works if the system has some set aside
+		ptr = mmap(NULL, ArenaHugeLen(size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (ptr != MAP_FAILED) {
+			*type = MEM_TYPE_HUGETLB;
+			return (UINT8*)ptr;
+		}
+	}
+#endif
+
+	if (size < ARENA_HUGE_SIZE) {
+		ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		return (ptr == MAP_FAILED) ? NULL : (UINT8*)ptr;
+	}
+
+	// map an extra huge page and trim it, so the block starts on a 2 MB boundary
+	size_t len = ArenaHugeLen(size);
+	ptr = mmap(NULL, len + ARENA_HUGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ptr == MAP_FAILED) {
+		return NULL;
+	}
+
+	UINT8 *base = (UINT8*)ptr;
+	UINT8 *aligned = (UINT8*)(((size_t)base + ARENA_HUGE_SIZE - 1) & ~(size_t)(ARENA_HUGE_SIZE - 1));
+
+	if (aligned > base) munmap(base, aligned - base);
+	if (aligned + len < base + len + ARENA_HUGE_SIZE) munmap(aligned + len, (base + len + ARENA_HUGE_SIZE) - (aligned + len));
+
+#if defined(MADV_HUGEPAGE)
+	madvise(aligned, len, MADV_HUGEPAGE);
+#endif
+
+	return aligned;
+#else
+	return NULL;
+#endif
+}
+
+static void ArenaFree(UINT8 *ptr, INT32 size, INT32 type)
+{
+#if defined(_WIN32)
+	(void)size; (void)type;
+	VirtualFree(ptr, 0, MEM_RELEASE);
+#elif defined(ARENA_MMAP)
+	munmap(ptr, (type == MEM_TYPE_HUGETLB || size >= ARENA_HUGE_SIZE) ? ArenaHugeLen(size) : (size_t)size);
+#else
+	(void)ptr; (void)size; (void)type;
+#endif
+}
+
+// allocate a zeroed block, from the OS if it's big enough and the arena is enabled
+static UINT8 *MemAlloc(INT32 size, INT32 *type, bool zero)
+{
+	if (nBurnArenaMode != BURN_ARENA_OFF && size >= ARENA_MIN_SIZE) {
+		UINT8 *ptr = ArenaAlloc(size, type);
+		if (ptr) {
+			return ptr; // already zero
+		}
+	}
+
+	*type = MEM_TYPE_HEAP;
+
+	UINT8 *ptr = (UINT8*)malloc(size);
+	if (ptr && zero) {
+		memset (ptr, 0, size);
+	}
+
+	return ptr;
+}
+
+static void MemRelease(UINT8 *ptr, INT32 size, INT32 type)
+{
+	if (type == MEM_TYPE_HEAP) {
+		free (ptr);
+	} else {
+		ArenaFree(ptr, size, type);
+	}
+}
 
 // this should be called early on... BurnDrvInit?
 
 void BurnInitMemoryManager()
 {
-	memset (memptr, 0, sizeof(memptr));
-	memset (memsize, 0, sizeof(memsize));
-	mem_allocated = 0;
+	if (memtable) {
+		memset (memtable, 0, memtable_size * sizeof(MemEntry));
+	}
+	memtable_used = 0;
+
+	if (memsite_index) {
+		memset (memsite_index, 0xff, memsite_index_size * sizeof(INT32));
+	}
+	memsite_used = 0;
+
+	memset (&memstats, 0, sizeof(memstats));
 }
 
 // call BurnMalloc() instead of 'malloc' (see macro in burnint.h)
 UINT8 *_BurnMalloc(INT32 size, char *file, INT32 line)
 {
-	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
-	{
-		if (memptr[i] == NULL) {
-			memptr[i] = (UINT8*)malloc(size);
+	INT32 type;
+	UINT8 *ptr = MemAlloc(size, &type, true); // contents are set to 0
+
+	if (ptr == NULL) {
+		bprintf (0, _T("BurnMalloc failed to allocate %d bytes of memory!\n"), size);
+		return NULL;
+	}
 
-			if (memptr[i] == NULL) {
-				bprintf (0, _T("BurnMalloc failed to allocate %d bytes of memory!\n"), size);
-				return NULL;
-			}
+	INT32 site = MemSiteFind(file, line);
 
-			memset (memptr[i], 0, size); // set contents to 0
+	if (MemInsert(ptr, size, site, type)) {
+		bprintf (0, _T("BurnMalloc failed to track %d bytes of memory!\n"), size);
+		MemRelease(ptr, size, type);
+		return NULL;
+	}
 
-			mem_allocated += size;
-			memsize[i] = size;
+	MemStatsAdd(site, size, 1);
 
 #if LOG_MEMORY_USAGE
-			bprintf (0, _T("(%S:%d) BurnMalloc(%d): index %d.  %d total!\n"), file, line, size, i, mem_allocated);
+	bprintf (0, _T("(%S:%d) BurnMalloc(%d): %d blocks.  %d total!\n"), file, line, size, memstats.nLiveBlocks, (INT32)memstats.nCurrentBytes);
 #endif
 
-			return memptr[i];
-		}
-	}
-
-	bprintf (0, _T("BurnMalloc called too many times!\n"));
-
-	return NULL; // Freak out!
+	return ptr;
 }
 
 UINT8 *BurnRealloc(void *ptr, INT32 size)
 {
-	UINT8 *mptr = (UINT8*)ptr;
+	INT32 type;
 
-	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
-	{
-		if (memptr[i] == mptr) {
-			memptr[i] = (UINT8*)realloc(ptr, size);
-			mem_allocated -= memsize[i];
-			mem_allocated += size;
-			memsize[i] = size;
-			return memptr[i];
+	if (ptr == NULL) { // behaves like an un-zeroed BurnMalloc
+		UINT8 *mptr = MemAlloc(size, &type, false);
+		if (mptr == NULL) {
+			return NULL;
+		}
+		if (MemInsert(mptr, size, -1, type)) {
+			MemRelease(mptr, size, type);
+			return NULL;
 		}
+		MemStatsAdd(-1, size, 1);
+		return mptr;
 	}
 
-	return NULL;
+	MemEntry *entry = MemFind(ptr);
+	if (entry == NULL) {
+		return NULL;
+	}
+
+	INT32 site = entry->site;
+	INT32 oldsize = entry->size;
+	UINT8 *mptr;
+
+	if (entry->type == MEM_TYPE_HEAP) {
+		mptr = (UINT8*)realloc(ptr, size);
+		type = MEM_TYPE_HEAP;
+	} else {
+		mptr = MemAlloc(size, &type, false);
+		if (mptr) {
+			memcpy (mptr, ptr, (size < oldsize) ? size : oldsize);
+			MemRelease(entry->ptr, oldsize, entry->type);
+		}
+	}
+
+	if (mptr == NULL) {
+		return NULL;
+	}
+
+	if (mptr == ptr) {
+		entry->size = size;
+	} else {
+		MemRemove(entry);
+		MemInsert(mptr, size, site, type); // can't fail, we just freed a slot
+	}
+
+	MemStatsAdd(site, (INT64)size - oldsize, 0);
+
+	return mptr;
 }
 
 // call BurnFree() instead of "free" (see macro in burnint.h)
 void _BurnFree(void *ptr)
 {
-	UINT8 *mptr = (UINT8*)ptr;
+	MemEntry *entry = MemFind(ptr);
 
-	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
-	{
-		if (mptr != NULL && memptr[i] == mptr) {
-			free (memptr[i]);
-			memptr[i] = NULL;
+	if (entry) {
+		MemStatsAdd(entry->site, -(INT64)entry->size, -1);
+
+		MemRelease(entry->ptr, entry->size, entry->type);
+		MemRemove(entry);
 
-			mem_allocated -= memsize[i];
-			memsize[i] = 0;
 #if LOG_MEMORY_USAGE
-			bprintf(0, _T("BurnFree(): index %d.  %d total!\n"), i, mem_allocated);
+		bprintf(0, _T("BurnFree(): %d blocks.  %d total!\n"), memstats.nLiveBlocks, (INT32)memstats.nCurrentBytes);
 #endif
-			break;
-		}
 	}
 }
 
@@ -97,19 +457,60 @@ void _BurnFree(void *ptr)
 
 void BurnExitMemoryManager()
 {
-	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
+	for (UINT32 i = 0; i < memtable_size; i++)
 	{
-		if (memptr[i] != NULL) {
+		if (memtable[i].ptr != NULL) {
 #if defined FBNEO_DEBUG
-			bprintf(PRINT_ERROR, _T("BurnExitMemoryManager had to free mem pointer %i (%d bytes)\n"), i, memsize[i]);
+			MemSite *site = (memtable[i].site >= 0) ? &memsite[memtable[i].site] : NULL;
+			bprintf(PRINT_ERROR, _T("BurnExitMemoryManager had to free mem pointer (%d bytes, %S:%d)\n"), memtable[i].size, site ? site->file : "BurnRealloc", site ? site->line : 0);
 #endif
-			free (memptr[i]);
-			memptr[i] = NULL;
+			MemRelease(memtable[i].ptr, memtable[i].size, memtable[i].type);
+			memtable[i].ptr = NULL;
 
-			mem_allocated -= memsize[i];
-			memsize[i] = 0;
+			MemStatsAdd(memtable[i].site, -(INT64)memtable[i].size, -1);
 		}
 	}
 
-	mem_allocated = 0;
+	memtable_used = 0;
+
+	// the statistics are kept until the next BurnInitMemoryManager(), so they can be read after exit
+}
+
+// returns 1 if ptr is the start of an mmap'ed (non hugetlb) block of at least size bytes,
+// so a file can be mapped over it with MAP_FIXED and it is still released by BurnFree()
+INT32 BurnMemoryCanMap(void *ptr, INT32 size)
+{
+#if defined(ARENA_MMAP)
+	MemEntry *entry = MemFind(ptr);
+
+	return (entry && entry->type == MEM_TYPE_PAGES && size <= entry->size) ? 1 : 0;
+#else
+	return 0;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Statistics
+
+void BurnGetMemoryStats(BurnMemoryStats *pStats)
+{
+	if (pStats) {
+		memcpy(pStats, &memstats, sizeof(BurnMemoryStats));
+	}
+}
+
+// Get the allocation statistics for call site i (in order of first use)
+// returns 1 if i is out of range
+INT32 BurnGetMemorySite(INT32 i, char **pszFile, INT32 *pnLine, INT32 *pnCount, INT64 *pnPeakBytes)
+{
+	if (i < 0 || i >= (INT32)memsite_used) {
+		return 1;
+	}
+
+	if (pszFile)     *pszFile = memsite[i].file;
+	if (pnLine)      *pnLine = memsite[i].line;
+	if (pnCount)     *pnCount = memsite[i].count;
+	if (pnPeakBytes) *pnPeakBytes = memsite[i].peak;
+
+	return 0;
 }
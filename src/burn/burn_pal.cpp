@@ -23,6 +23,8 @@ static inline UINT32 PaletteWrite4Bit(INT32 offset, INT32 rshift, INT32 gshift,
 
 static inline void PaletteUpdate4Bit(INT32 rshift, INT32 gshift, INT32 bshift)
 {
+	BURN_PROFILE(BURN_PROFILE_PALETTE);
+
 	if (BurnPalette == NULL) return;
 
 	for (INT32 i = 0; i < BurnDrvGetPaletteEntries(); i++)
@@ -89,6 +91,8 @@ static inline UINT32 PaletteWrite5Bit(INT32 offset, INT32 rshift, INT32 gshift,
 
 static inline void PaletteUpdate5Bit(INT32 rshift, INT32 gshift, INT32 bshift)
 {
+	BURN_PROFILE(BURN_PROFILE_PALETTE);
+
 	if (BurnPalette == NULL) return;
 
 	for (INT32 i = 0; i < BurnDrvGetPaletteEntries(); i++)
@@ -171,6 +175,8 @@ void BurnPaletteWrite_GGGGGRRRRRBBBBBx(INT32 offset)
 
 void BurnPaletteUpdate_RRRRGGGGBBBBRGBx()
 {
+	BURN_PROFILE(BURN_PROFILE_PALETTE);
+
 	if (BurnPalRAM == NULL || BurnPalette == NULL) return;
 
 	UINT16 *pal = (UINT16*)BurnPalRAM;
@@ -215,6 +221,8 @@ void BurnPaletteWrite_RRRRGGGGBBBBRGBx(INT32 offset)
 
 static inline void palette_update_8bit(INT32 r_mask, INT32 g_mask, INT32 b_mask, INT32 r_shift, INT32 g_shift, INT32 b_shift, INT32 invert)
 {
+	BURN_PROFILE(BURN_PROFILE_PALETTE);
+
 	if (BurnPalRAM == NULL || BurnPalette == NULL) return;
 
 	r_mask = (1 << r_mask) - 1;
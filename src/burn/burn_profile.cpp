@@ -0,0 +1,98 @@
+// Burn - Frame time breakdown
+//
+// While bBurnProfile is set, the cpu cores, sound chips, transfer/tilemap code and
+// palette updates mark the time they spend with BURN_PROFILE(section). Sections can
+// nest (a sound chip syncing its cpu, a cpu core calling into a sound write handler),
+// the time is always given to the innermost one. Only the emulation thread should
+// enter sections, BurnThreadRun() jobs are counted as part of whoever started them.
+
+#include "burnint.h"
+
+#if defined(_WIN32)
+ #include <windows.h>
+#else
+ #include <time.h>
+#endif
+
+#define PROFILE_DEPTH	32
+
+bool bBurnProfile = false;
+
+static UINT64 nSectionTicks[BURN_PROFILE_COUNT];
+static INT32 nStack[PROFILE_DEPTH];
+static INT32 nDepth = 0;
+static INT32 nCurrent = -1;			// section being timed, -1 = none
+static UINT64 nLastTicks = 0;
+
+static inline UINT64 ProfileTicks()
+{
+#if defined(_WIN32)
+	LARGE_INTEGER t;
+	QueryPerformanceCounter(&t);
+	return t.QuadPart;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (UINT64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static double ProfileTicksPerSecond()
+{
+#if defined(_WIN32)
+	LARGE_INTEGER f;
+	QueryPerformanceFrequency(&f);
+	return (double)f.QuadPart;
+#else
+	return 1000000000.0;
+#endif
+}
+
+void BurnProfileEnter(INT32 nSection)
+{
+	UINT64 nTicks = ProfileTicks();
+
+	if (nCurrent >= 0) {
+		nSectionTicks[nCurrent] += nTicks - nLastTicks;
+	}
+
+	if (nDepth < PROFILE_DEPTH) {
+		nStack[nDepth] = nCurrent;
+	}
+	nDepth++;
+
+	nCurrent = nSection;
+	nLastTicks = nTicks;
+}
+
+void BurnProfileLeave()
+{
+	UINT64 nTicks = ProfileTicks();
+
+	if (nCurrent >= 0) {
+		nSectionTicks[nCurrent] += nTicks - nLastTicks;
+	}
+
+	if (nDepth > 0) {
+		nDepth--;
+		nCurrent = (nDepth < PROFILE_DEPTH) ? nStack[nDepth] : nCurrent;
+	}
+
+	nLastTicks = nTicks;
+}
+
+void BurnProfileReset()
+{
+	memset(nSectionTicks, 0, sizeof(nSectionTicks));
+	nDepth = 0;
+	nCurrent = -1;
+}
+
+void BurnProfileGet(double *pdSeconds)
+{
+	double dScale = 1.0 / ProfileTicksPerSecond();
+
+	for (INT32 i = 0; i < BURN_PROFILE_COUNT; i++) {
+		pdSeconds[i] = nSectionTicks[i] * dScale;
+	}
+}
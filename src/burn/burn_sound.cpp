@@ -42,8 +42,12 @@ void BurnSoundDCFilter()
 		INT16 r = pBurnSoundOut[i*2+0];
 		INT16 l = pBurnSoundOut[i*2+1];
 
-		INT16 outr = r - dac_lastin_r + 0.995 * dac_lastout_r;
-		INT16 outl = l - dac_lastin_l + 0.995 * dac_lastout_l;
+		// 0.995 in .15 fixed point, the recursion is what keeps this scalar
+		INT32 outr = r - dac_lastin_r + (dac_lastout_r * 32604) / 32768;
+		INT32 outl = l - dac_lastin_l + (dac_lastout_l * 32604) / 32768;
+
+		outr = BURN_SND_CLIP(outr);
+		outl = BURN_SND_CLIP(outl);
 
 		dac_lastin_r = r;
 		dac_lastout_r = outr;
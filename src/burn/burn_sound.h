@@ -30,6 +30,28 @@ void BurnSoundCopyClamp_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Add_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Mono_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Mono_Add_C(INT32* Src, INT16* Dest, INT32 Len);
+void BurnSoundCopy_FM_C(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR);
+void BurnSoundCopy_FM_Add_C(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR);
+
+// The same kernels for SSE2/AVX2/NEON, see burn_sound_simd.cpp. BurnSoundKernel is the
+// fastest set the cpu supports (BurnSoundKernelsInit() is called by BurnLibInit()).
+#ifndef BURN_SOUND_KERNELS
+#define BURN_SOUND_KERNELS
+struct BurnSoundKernels {
+	const char* szName;
+	void (*CopyClamp)(INT32* Src, INT16* Dest, INT32 Len);
+	void (*CopyClamp_Add)(INT32* Src, INT16* Dest, INT32 Len);
+	void (*CopyClamp_Mono)(INT32* Src, INT16* Dest, INT32 Len);
+	void (*CopyClamp_Mono_Add)(INT32* Src, INT16* Dest, INT32 Len);
+	void (*Copy_FM)(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR);
+	void (*Copy_FM_Add)(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR);
+};
+#endif
+
+extern struct BurnSoundKernels BurnSoundKernel;
+
+void BurnSoundKernelsInit();
+const struct BurnSoundKernels* BurnSoundKernelsGet(INT32 nIndex);	// supported sets, C first, NULL after the last
 
 extern INT32 cmc_4p_Precalc();
 
@@ -43,4 +43,33 @@ void BurnSoundCopyClamp_Mono_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 	}
 }
 
+// Same as BurnSoundCopy_FM_A (pmulhw): volumes are 16-bit, the result is the high word of the product
+void BurnSoundCopy_FM_C(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR)
+{
+	VolL = CLIP(VolL);
+	VolR = CLIP(VolR);
+
+	while (Len--) {
+		Dest[0] = (*SrcL * VolL) >> 16;
+		Dest[1] = (*SrcR * VolR) >> 16;
+		SrcL++;
+		SrcR++;
+		Dest += 2;
+	}
+}
+
+void BurnSoundCopy_FM_Add_C(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR)
+{
+	VolL = CLIP(VolL);
+	VolR = CLIP(VolR);
+
+	while (Len--) {
+		Dest[0] = CLIP(((*SrcL * VolL) >> 16) + Dest[0]);
+		Dest[1] = CLIP(((*SrcR * VolR) >> 16) + Dest[1]);
+		SrcL++;
+		SrcR++;
+		Dest += 2;
+	}
+}
+
 #undef CLIP
@@ -0,0 +1,434 @@
+// Sound mixing kernels - SSE2, AVX2 and NEON versions of the ones in burn_sound_c.cpp
+//
+// The results are bit-exact with the C versions (the _Add kernels widen to 32-bit
+// before adding, as the C code does, rather than using saturating 16-bit adds).
+// Every set is made of complete kernels, anything a set doesn't do better comes
+// from the set below it. x86 picks SSE2/AVX2 at runtime, NEON is used whenever the
+// compiler targets it.
+
+#include "burnint.h"
+#include "burn_sound.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+ #define SOUND_X86
+ #include <emmintrin.h>
+ #if defined(__GNUC__)
+  #define SOUND_AVX2
+  #include <immintrin.h>
+  #define TARGET_SSE2	__attribute__((target("sse2")))
+  #define TARGET_AVX2	__attribute__((target("avx2")))
+ #else
+  #if defined(_MSC_VER) && _MSC_VER >= 1800
+   #define SOUND_AVX2
+   #include <immintrin.h>
+  #endif
+  #include <intrin.h>
+  #define TARGET_SSE2
+  #define TARGET_AVX2
+ #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+ #define SOUND_NEON
+ #include <arm_neon.h>
+#endif
+
+#define CLIP(A) ((A) < -0x8000 ? -0x8000 : (A) > 0x7fff ? 0x7fff : (A))
+
+static struct BurnSoundKernels KernelsC = {
+	"C",
+	BurnSoundCopyClamp_C, BurnSoundCopyClamp_Add_C, BurnSoundCopyClamp_Mono_C, BurnSoundCopyClamp_Mono_Add_C,
+	BurnSoundCopy_FM_C, BurnSoundCopy_FM_Add_C
+};
+
+struct BurnSoundKernels BurnSoundKernel = KernelsC;
+
+// ---------------------------------------------------------------------------
+// SSE2
+
+#if defined SOUND_X86
+
+TARGET_SSE2 static inline __m128i Sse2Widen(__m128i v, INT32 bHigh)
+{
+	// sign extend 4 of the 8 words to dwords
+	return _mm_srai_epi32(bHigh ? _mm_unpackhi_epi16(v, v) : _mm_unpacklo_epi16(v, v), 16);
+}
+
+TARGET_SSE2 static void CopyClamp_SSE2(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 n = Len * 2, i = 0;
+
+	for (; i + 8 <= n; i += 8) {
+		__m128i a = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + i + 0)), 8);
+		__m128i b = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + i + 4)), 8);
+		_mm_storeu_si128((__m128i*)(Dest + i), _mm_packs_epi32(a, b));
+	}
+
+	for (; i < n; i++) {
+		Dest[i] = CLIP(Src[i] >> 8);
+	}
+}
+
+TARGET_SSE2 static void CopyClamp_Add_SSE2(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 n = Len * 2, i = 0;
+
+	for (; i + 8 <= n; i += 8) {
+		__m128i d = _mm_loadu_si128((__m128i*)(Dest + i));
+		__m128i a = _mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + i + 0)), 8), Sse2Widen(d, 0));
+		__m128i b = _mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + i + 4)), 8), Sse2Widen(d, 1));
+		_mm_storeu_si128((__m128i*)(Dest + i), _mm_packs_epi32(a, b));
+	}
+
+	for (; i < n; i++) {
+		Dest[i] = CLIP((Src[i] >> 8) + Dest[i]);
+	}
+}
+
+TARGET_SSE2 static void CopyClamp_Mono_SSE2(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 i = 0;
+
+	for (; i + 8 <= Len; i += 8) {
+		__m128i a = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + i + 0)), 8);
+		__m128i b = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + i + 4)), 8);
+		__m128i p = _mm_packs_epi32(a, b);
+		_mm_storeu_si128((__m128i*)(Dest + i * 2 + 0), _mm_unpacklo_epi16(p, p));
+		_mm_storeu_si128((__m128i*)(Dest + i * 2 + 8), _mm_unpackhi_epi16(p, p));
+	}
+
+	for (; i < Len; i++) {
+		Dest[i * 2 + 0] = Dest[i * 2 + 1] = CLIP(Src[i] >> 8);
+	}
+}
+
+TARGET_SSE2 static void CopyClamp_Mono_Add_SSE2(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 i = 0;
+
+	for (; i + 4 <= Len; i += 4) {
+		__m128i s = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + i)), 8);
+		__m128i d = _mm_loadu_si128((__m128i*)(Dest + i * 2));
+		__m128i a = _mm_add_epi32(_mm_unpacklo_epi32(s, s), Sse2Widen(d, 0));
+		__m128i b = _mm_add_epi32(_mm_unpackhi_epi32(s, s), Sse2Widen(d, 1));
+		_mm_storeu_si128((__m128i*)(Dest + i * 2), _mm_packs_epi32(a, b));
+	}
+
+	for (; i < Len; i++) {
+		Dest[i * 2 + 0] = CLIP((Src[i] >> 8) + Dest[i * 2 + 0]);
+		Dest[i * 2 + 1] = CLIP((Src[i] >> 8) + Dest[i * 2 + 1]);
+	}
+}
+
+TARGET_SSE2 static void Copy_FM_SSE2(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR)
+{
+	VolL = CLIP(VolL);
+	VolR = CLIP(VolR);
+
+	__m128i v = _mm_set_epi16(VolR, VolL, VolR, VolL, VolR, VolL, VolR, VolL);
+	INT32 i = 0;
+
+	for (; i + 8 <= Len; i += 8) {
+		__m128i l = _mm_loadu_si128((__m128i*)(SrcL + i));
+		__m128i r = _mm_loadu_si128((__m128i*)(SrcR + i));
+		_mm_storeu_si128((__m128i*)(Dest + i * 2 + 0), _mm_mulhi_epi16(_mm_unpacklo_epi16(l, r), v));
+		_mm_storeu_si128((__m128i*)(Dest + i * 2 + 8), _mm_mulhi_epi16(_mm_unpackhi_epi16(l, r), v));
+	}
+
+	BurnSoundCopy_FM_C(SrcL + i, SrcR + i, Dest + i * 2, Len - i, VolL, VolR);
+}
+
+TARGET_SSE2 static void Copy_FM_Add_SSE2(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR)
+{
+	VolL = CLIP(VolL);
+	VolR = CLIP(VolR);
+
+	__m128i v = _mm_set_epi16(VolR, VolL, VolR, VolL, VolR, VolL, VolR, VolL);
+	INT32 i = 0;
+
+	// the products fit in 16 bits, so a saturating add is the same as widening
+	for (; i + 8 <= Len; i += 8) {
+		__m128i l = _mm_loadu_si128((__m128i*)(SrcL + i));
+		__m128i r = _mm_loadu_si128((__m128i*)(SrcR + i));
+		__m128i* d = (__m128i*)(Dest + i * 2);
+		_mm_storeu_si128(d + 0, _mm_adds_epi16(_mm_loadu_si128(d + 0), _mm_mulhi_epi16(_mm_unpacklo_epi16(l, r), v)));
+		_mm_storeu_si128(d + 1, _mm_adds_epi16(_mm_loadu_si128(d + 1), _mm_mulhi_epi16(_mm_unpackhi_epi16(l, r), v)));
+	}
+
+	BurnSoundCopy_FM_Add_C(SrcL + i, SrcR + i, Dest + i * 2, Len - i, VolL, VolR);
+}
+
+static struct BurnSoundKernels KernelsSSE2 = {
+	"SSE2",
+	CopyClamp_SSE2, CopyClamp_Add_SSE2, CopyClamp_Mono_SSE2, CopyClamp_Mono_Add_SSE2,
+	Copy_FM_SSE2, Copy_FM_Add_SSE2
+};
+
+static INT32 CpuHasSSE2()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	return 1;
+#elif defined(__GNUC__)
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("sse2");
+#else
+	int nInfo[4];
+	__cpuid(nInfo, 1);
+	return (nInfo[3] >> 26) & 1;
+#endif
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// AVX2 - the stereo kernels, mono comes from SSE2
+
+#if defined SOUND_AVX2
+
+TARGET_AVX2 static void CopyClamp_AVX2(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 n = Len * 2, i = 0;
+
+	for (; i + 16 <= n; i += 16) {
+		__m256i a = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)(Src + i + 0)), 8);
+		__m256i b = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)(Src + i + 8)), 8);
+		// packs works within each 128-bit lane, put the quadwords back in order
+		_mm256_storeu_si256((__m256i*)(Dest + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8));
+	}
+
+	for (; i < n; i++) {
+		Dest[i] = CLIP(Src[i] >> 8);
+	}
+}
+
+TARGET_AVX2 static void CopyClamp_Add_AVX2(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 n = Len * 2, i = 0;
+
+	for (; i + 16 <= n; i += 16) {
+		__m256i a = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)(Src + i + 0)), 8);
+		__m256i b = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)(Src + i + 8)), 8);
+		a = _mm256_add_epi32(a, _mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i*)(Dest + i + 0))));
+		b = _mm256_add_epi32(b, _mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i*)(Dest + i + 8))));
+		_mm256_storeu_si256((__m256i*)(Dest + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8));
+	}
+
+	for (; i < n; i++) {
+		Dest[i] = CLIP((Src[i] >> 8) + Dest[i]);
+	}
+}
+
+TARGET_AVX2 static void Copy_FM_AVX2(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR)
+{
+	VolL = CLIP(VolL);
+	VolR = CLIP(VolR);
+
+	__m256i v = _mm256_set1_epi32((VolR << 16) | (VolL & 0xffff));
+	INT32 i = 0;
+
+	for (; i + 16 <= Len; i += 16) {
+		// the lane split of unpack lo/hi is undone by storing the lanes crosswise
+		__m256i l = _mm256_permute4x64_epi64(_mm256_loadu_si256((__m256i*)(SrcL + i)), 0xd8);
+		__m256i r = _mm256_permute4x64_epi64(_mm256_loadu_si256((__m256i*)(SrcR + i)), 0xd8);
+		_mm256_storeu_si256((__m256i*)(Dest + i * 2 + 0), _mm256_mulhi_epi16(_mm256_unpacklo_epi16(l, r), v));
+		_mm256_storeu_si256((__m256i*)(Dest + i * 2 + 16), _mm256_mulhi_epi16(_mm256_unpackhi_epi16(l, r), v));
+	}
+
+	Copy_FM_SSE2(SrcL + i, SrcR + i, Dest + i * 2, Len - i, VolL, VolR);
+}
+
+TARGET_AVX2 static void Copy_FM_Add_AVX2(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR)
+{
+	VolL = CLIP(VolL);
+	VolR = CLIP(VolR);
+
+	__m256i v = _mm256_set1_epi32((VolR << 16) | (VolL & 0xffff));
+	INT32 i = 0;
+
+	for (; i + 16 <= Len; i += 16) {
+		__m256i l = _mm256_permute4x64_epi64(_mm256_loadu_si256((__m256i*)(SrcL + i)), 0xd8);
+		__m256i r = _mm256_permute4x64_epi64(_mm256_loadu_si256((__m256i*)(SrcR + i)), 0xd8);
+		__m256i* d = (__m256i*)(Dest + i * 2);
+		_mm256_storeu_si256(d + 0, _mm256_adds_epi16(_mm256_loadu_si256(d + 0), _mm256_mulhi_epi16(_mm256_unpacklo_epi16(l, r), v)));
+		_mm256_storeu_si256(d + 1, _mm256_adds_epi16(_mm256_loadu_si256(d + 1), _mm256_mulhi_epi16(_mm256_unpackhi_epi16(l, r), v)));
+	}
+
+	Copy_FM_Add_SSE2(SrcL + i, SrcR + i, Dest + i * 2, Len - i, VolL, VolR);
+}
+
+static struct BurnSoundKernels KernelsAVX2 = {
+	"AVX2",
+	CopyClamp_AVX2, CopyClamp_Add_AVX2, CopyClamp_Mono_SSE2, CopyClamp_Mono_Add_SSE2,
+	Copy_FM_AVX2, Copy_FM_Add_AVX2
+};
+
+static INT32 CpuHasAVX2()
+{
+#if defined(__GNUC__)
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#else
+	int nInfo[4];
+	__cpuid(nInfo, 1);
+	if (((nInfo[2] >> 27) & 1) == 0) return 0;				// no osxsave
+	if ((_xgetbv(0) & 6) != 6) return 0;					// ymm state not enabled by the os
+	__cpuidex(nInfo, 7, 0);
+	return (nInfo[1] >> 5) & 1;
+#endif
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// NEON
+
+#if defined SOUND_NEON
+
+static void CopyClamp_NEON(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 n = Len * 2, i = 0;
+
+	for (; i + 8 <= n; i += 8) {
+		int16x4_t a = vqmovn_s32(vshrq_n_s32(vld1q_s32(Src + i + 0), 8));
+		int16x4_t b = vqmovn_s32(vshrq_n_s32(vld1q_s32(Src + i + 4), 8));
+		vst1q_s16(Dest + i, vcombine_s16(a, b));
+	}
+
+	for (; i < n; i++) {
+		Dest[i] = CLIP(Src[i] >> 8);
+	}
+}
+
+static void CopyClamp_Add_NEON(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 n = Len * 2, i = 0;
+
+	for (; i + 8 <= n; i += 8) {
+		int16x8_t d = vld1q_s16(Dest + i);
+		int32x4_t a = vaddq_s32(vshrq_n_s32(vld1q_s32(Src + i + 0), 8), vmovl_s16(vget_low_s16(d)));
+		int32x4_t b = vaddq_s32(vshrq_n_s32(vld1q_s32(Src + i + 4), 8), vmovl_s16(vget_high_s16(d)));
+		vst1q_s16(Dest + i, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+	}
+
+	for (; i < n; i++) {
+		Dest[i] = CLIP((Src[i] >> 8) + Dest[i]);
+	}
+}
+
+static void CopyClamp_Mono_NEON(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 i = 0;
+
+	for (; i + 8 <= Len; i += 8) {
+		int16x4_t a = vqmovn_s32(vshrq_n_s32(vld1q_s32(Src + i + 0), 8));
+		int16x4_t b = vqmovn_s32(vshrq_n_s32(vld1q_s32(Src + i + 4), 8));
+		int16x8x2_t p;
+		p.val[0] = p.val[1] = vcombine_s16(a, b);
+		vst2q_s16(Dest + i * 2, p);
+	}
+
+	for (; i < Len; i++) {
+		Dest[i * 2 + 0] = Dest[i * 2 + 1] = CLIP(Src[i] >> 8);
+	}
+}
+
+static void CopyClamp_Mono_Add_NEON(INT32* Src, INT16* Dest, INT32 Len)
+{
+	INT32 i = 0;
+
+	for (; i + 4 <= Len; i += 4) {
+		int32x4_t s = vshrq_n_s32(vld1q_s32(Src + i), 8);
+		int16x4x2_t d = vld2_s16(Dest + i * 2);
+		d.val[0] = vqmovn_s32(vaddq_s32(s, vmovl_s16(d.val[0])));
+		d.val[1] = vqmovn_s32(vaddq_s32(s, vmovl_s16(d.val[1])));
+		vst2_s16(Dest + i * 2, d);
+	}
+
+	for (; i < Len; i++) {
+		Dest[i * 2 + 0] = CLIP((Src[i] >> 8) + Dest[i * 2 + 0]);
+		Dest[i * 2 + 1] = CLIP((Src[i] >> 8) + Dest[i * 2 + 1]);
+	}
+}
+
+static void Copy_FM_NEON(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR)
+{
+	VolL = CLIP(VolL);
+	VolR = CLIP(VolR);
+
+	int16x4_t vl = vdup_n_s16(VolL);
+	int16x4_t vr = vdup_n_s16(VolR);
+	INT32 i = 0;
+
+	for (; i + 4 <= Len; i += 4) {
+		int16x4x2_t d;
+		d.val[0] = vshrn_n_s32(vmull_s16(vld1_s16(SrcL + i), vl), 16);
+		d.val[1] = vshrn_n_s32(vmull_s16(vld1_s16(SrcR + i), vr), 16);
+		vst2_s16(Dest + i * 2, d);
+	}
+
+	BurnSoundCopy_FM_C(SrcL + i, SrcR + i, Dest + i * 2, Len - i, VolL, VolR);
+}
+
+static void Copy_FM_Add_NEON(INT16* SrcL, INT16* SrcR, INT16* Dest, INT32 Len, INT32 VolL, INT32 VolR)
+{
+	VolL = CLIP(VolL);
+	VolR = CLIP(VolR);
+
+	int16x4_t vl = vdup_n_s16(VolL);
+	int16x4_t vr = vdup_n_s16(VolR);
+	INT32 i = 0;
+
+	for (; i + 4 <= Len; i += 4) {
+		int16x4x2_t d = vld2_s16(Dest + i * 2);
+		d.val[0] = vqadd_s16(d.val[0], vshrn_n_s32(vmull_s16(vld1_s16(SrcL + i), vl), 16));
+		d.val[1] = vqadd_s16(d.val[1], vshrn_n_s32(vmull_s16(vld1_s16(SrcR + i), vr), 16));
+		vst2_s16(Dest + i * 2, d);
+	}
+
+	BurnSoundCopy_FM_Add_C(SrcL + i, SrcR + i, Dest + i * 2, Len - i, VolL, VolR);
+}
+
+static struct BurnSoundKernels KernelsNEON = {
+	"NEON",
+	CopyClamp_NEON, CopyClamp_Add_NEON, CopyClamp_Mono_NEON, CopyClamp_Mono_Add_NEON,
+	Copy_FM_NEON, Copy_FM_Add_NEON
+};
+
+#endif
+
+// ---------------------------------------------------------------------------
+
+static struct BurnSoundKernels* pKernels[4];
+static INT32 nKernels = 0;
+
+void BurnSoundKernelsInit()
+{
+	nKernels = 0;
+	pKernels[nKernels++] = &KernelsC;
+
+#if defined SOUND_X86
+	if (CpuHasSSE2()) {
+		pKernels[nKernels++] = &KernelsSSE2;
+#if defined SOUND_AVX2
+		if (CpuHasAVX2()) {
+			pKernels[nKernels++] = &KernelsAVX2;
+		}
+#endif
+	}
+#endif
+
+#if defined SOUND_NEON
+	pKernels[nKernels++] = &KernelsNEON;
+#endif
+
+	BurnSoundKernel = *pKernels[nKernels - 1];
+}
+
+const struct BurnSoundKernels* BurnSoundKernelsGet(INT32 nIndex)
+{
+	if (nKernels == 0) {
+		BurnSoundKernelsInit();
+	}
+
+	return (nIndex >= 0 && nIndex < nKernels) ? pKernels[nIndex] : NULL;
+}
+
+#undef CLIP
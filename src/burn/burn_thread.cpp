@@ -0,0 +1,381 @@
+// Burn - Worker thread pool
+//
+// BurnThreadRun() calls pJob(pParam, i) for every i in [0, nCount), spread over
+// the worker threads and the calling thread, and returns once all of them are
+// done. Jobs must be independent of each other. The workers are started on the
+// first call and sleep between runs.
+//
+// To run jobs alongside the emulation a client makes its own queue with
+// BurnThreadQueueInit(). BurnThreadQueue() hands jobs to the workers without waiting
+// for them, the index passed to the job counts up from 0 over every call since the
+// queue's last BurnThreadWait(), which helps with what is left of that queue and
+// returns once all of it is done. Queues (and BurnThreadRun() calls, from a job or
+// from another thread) share the workers but never wait on each other.
+
+#include "burnint.h"
+
+#if defined(_WIN32)
+ #include <windows.h>
+ #define THREAD_WIN32
+#elif defined(__unix__) || defined(__APPLE__)
+ #include <pthread.h>
+ #include <unistd.h>
+ #define THREAD_PTHREAD
+#endif
+
+#define THREAD_MAX	16
+
+INT32 nBurnThreadMax = 0;			// 0 = one thread per cpu core, 1 = don't use worker threads
+
+struct BurnJobQueue {
+	BurnThreadJob pJob;
+	void *pParam;
+	INT32 nCount;					// jobs queued since the last BurnThreadWait()
+	INT32 nNext;					// next job to hand out
+	INT32 nDone;
+	BurnJobQueue *pNextActive;		// queues with jobs left to hand out
+	INT32 bActive;
+#if defined(THREAD_WIN32)
+	HANDLE hDone;					// auto-reset event, last job finished
+#elif defined(THREAD_PTHREAD)
+	pthread_cond_t condDone;
+#endif
+};
+
+static INT32 nWorkers = 0;			// running worker threads (not counting the caller)
+static INT32 bStarted = 0;
+static INT32 bQuit = 0;
+
+static BurnJobQueue *pActive = NULL;	// oldest first
+
+#if defined(THREAD_WIN32)
+
+static HANDLE hThreads[THREAD_MAX];
+static CRITICAL_SECTION csLock;
+static HANDLE hStart = NULL;			// semaphore, one count per worker for each run
+
+static inline void ThreadLock()		{ EnterCriticalSection(&csLock); }
+static inline void ThreadUnlock()		{ LeaveCriticalSection(&csLock); }
+static inline void ThreadSignalStart(INT32 nCount)	{ ReleaseSemaphore(hStart, (nCount < nWorkers) ? nCount : nWorkers, NULL); }
+static inline void ThreadSignalDone(BurnJobQueue *pQueue)	{ SetEvent(pQueue->hDone); }
+
+static inline void ThreadWaitStart()
+{
+	ThreadUnlock();
+	WaitForSingleObject(hStart, INFINITE);
+	ThreadLock();
+}
+
+static inline void ThreadWaitDone(BurnJobQueue *pQueue)
+{
+	ThreadUnlock();
+	WaitForSingleObject(pQueue->hDone, INFINITE);
+	ThreadLock();
+}
+
+static INT32 QueueCreate(BurnJobQueue *pQueue)
+{
+	pQueue->hDone = CreateEvent(NULL, FALSE, FALSE, NULL);
+	return (pQueue->hDone == NULL);
+}
+
+static void QueueDestroy(BurnJobQueue *pQueue)
+{
+	CloseHandle(pQueue->hDone);
+}
+
+#elif defined(THREAD_PTHREAD)
+
+static pthread_t hThreads[THREAD_MAX];
+static pthread_mutex_t mtxLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t condStart = PTHREAD_COND_INITIALIZER;
+
+static inline void ThreadLock()		{ pthread_mutex_lock(&mtxLock); }
+static inline void ThreadUnlock()		{ pthread_mutex_unlock(&mtxLock); }
+static inline void ThreadSignalStart(INT32)	{ pthread_cond_broadcast(&condStart); }
+static inline void ThreadSignalDone(BurnJobQueue *pQueue)	{ pthread_cond_signal(&pQueue->condDone); }
+static inline void ThreadWaitStart()	{ pthread_cond_wait(&condStart, &mtxLock); }
+static inline void ThreadWaitDone(BurnJobQueue *pQueue)	{ pthread_cond_wait(&pQueue->condDone, &mtxLock); }
+
+static INT32 QueueCreate(BurnJobQueue *pQueue)
+{
+	return pthread_cond_init(&pQueue->condDone, NULL) != 0;
+}
+
+static void QueueDestroy(BurnJobQueue *pQueue)
+{
+	pthread_cond_destroy(&pQueue->condDone);
+}
+
+#else
+
+static INT32 QueueCreate(BurnJobQueue *)	{ return 0; }
+static void QueueDestroy(BurnJobQueue *)	{ }
+
+#endif
+
+#if defined(THREAD_WIN32) || defined(THREAD_PTHREAD)
+
+// called with the lock held, returns with the lock held
+static void ThreadRunJob(BurnJobQueue *pQueue)
+{
+	INT32 i = pQueue->nNext++;
+
+	if (pQueue->nNext == pQueue->nCount) {
+		// everything's handed out, take it off the list
+		BurnJobQueue **ppQueue = &pActive;
+		while (*ppQueue != pQueue) ppQueue = &(*ppQueue)->pNextActive;
+		*ppQueue = pQueue->pNextActive;
+		pQueue->bActive = 0;
+	}
+
+	ThreadUnlock();
+	pQueue->pJob(pQueue->pParam, i);
+	ThreadLock();
+
+	if (++pQueue->nDone == pQueue->nCount) {
+		ThreadSignalDone(pQueue);
+	}
+}
+
+static void ThreadWorker()
+{
+	ThreadLock();
+
+	while (!bQuit) {
+		if (pActive) {
+			ThreadRunJob(pActive);
+		} else {
+			ThreadWaitStart();
+		}
+	}
+
+	ThreadUnlock();
+}
+
+#if defined(THREAD_WIN32)
+static DWORD WINAPI ThreadProc(LPVOID)
+{
+	ThreadWorker();
+	return 0;
+}
+#else
+static void *ThreadProc(void *)
+{
+	ThreadWorker();
+	return NULL;
+}
+#endif
+
+static INT32 ThreadCpuCount()
+{
+#if defined(THREAD_WIN32)
+	SYSTEM_INFO si;
+	GetSystemInfo(&si);
+	return si.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+	return sysconf(_SC_NPROCESSORS_ONLN);
+#else
+	return 1;
+#endif
+}
+
+static void ThreadStart()
+{
+	bStarted = 1;
+	bQuit = 0;
+	nWorkers = 0;
+
+	INT32 nCount = (nBurnThreadMax > 0) ? nBurnThreadMax : ThreadCpuCount();
+	if (nCount > THREAD_MAX + 1) nCount = THREAD_MAX + 1;
+	if (nCount <= 1) return;
+
+#if defined(THREAD_WIN32)
+	InitializeCriticalSection(&csLock);
+	hStart = CreateSemaphore(NULL, 0, 0x7fffffff, NULL);
+	if (hStart == NULL) return;
+
+	for (INT32 i = 0; i < nCount - 1; i++) {
+		if ((hThreads[nWorkers] = CreateThread(NULL, 0, ThreadProc, NULL, 0, NULL)) == NULL) break;
+		nWorkers++;
+	}
+#else
+	for (INT32 i = 0; i < nCount - 1; i++) {
+		if (pthread_create(&hThreads[nWorkers], NULL, ThreadProc, NULL) != 0) break;
+		nWorkers++;
+	}
+#endif
+
+	bprintf(PRINT_NORMAL, _T("*** Started %d worker threads\n"), nWorkers);
+}
+
+#endif
+
+INT32 BurnThreadCount()
+{
+#if defined(THREAD_WIN32) || defined(THREAD_PTHREAD)
+	if (!bStarted) ThreadStart();
+#endif
+
+	return nWorkers + 1;
+}
+
+// pJob is called with pParam and the job's index in the batch, NULL on error
+BurnJobQueue *BurnThreadQueueInit(BurnThreadJob pJob, void *pParam)
+{
+	if (pJob == NULL) return NULL;
+
+	BurnJobQueue *pQueue = (BurnJobQueue*)malloc(sizeof(BurnJobQueue));
+	if (pQueue == NULL) return NULL;
+
+	memset(pQueue, 0, sizeof(BurnJobQueue));
+	pQueue->pJob = pJob;
+	pQueue->pParam = pParam;
+
+	if (QueueCreate(pQueue)) {
+		free(pQueue);
+		return NULL;
+	}
+
+	return pQueue;
+}
+
+// waits for anything still queued
+void BurnThreadQueueExit(BurnJobQueue *pQueue)
+{
+	if (pQueue == NULL) return;
+
+	BurnThreadWait(pQueue);
+	QueueDestroy(pQueue);
+	free(pQueue);
+}
+
+INT32 BurnThreadQueue(BurnJobQueue *pQueue, INT32 nCount)
+{
+	if (pQueue == NULL) return 1;
+
+#if defined(THREAD_WIN32) || defined(THREAD_PTHREAD)
+	if (!bStarted) ThreadStart();
+
+	if (nWorkers && nCount > 0) {
+		ThreadLock();
+
+		if (!pQueue->bActive) {
+			BurnJobQueue **ppQueue = &pActive;
+			while (*ppQueue) ppQueue = &(*ppQueue)->pNextActive;
+			*ppQueue = pQueue;
+			pQueue->pNextActive = NULL;
+			pQueue->bActive = 1;
+		}
+
+		pQueue->nCount += nCount;
+		ThreadSignalStart(nCount);
+		ThreadUnlock();
+
+		return 0;
+	}
+#endif
+
+	for (INT32 i = 0; i < nCount; i++) {
+		INT32 nIndex = pQueue->nCount++;
+		pQueue->nNext = pQueue->nDone = pQueue->nCount;
+
+		pQueue->pJob(pQueue->pParam, nIndex);
+	}
+
+	return 0;
+}
+
+void BurnThreadWait(BurnJobQueue *pQueue)
+{
+	if (pQueue == NULL) return;
+
+#if defined(THREAD_WIN32) || defined(THREAD_PTHREAD)
+	if (nWorkers) {
+		ThreadLock();
+
+		while (pQueue->nNext < pQueue->nCount) {
+			ThreadRunJob(pQueue);
+		}
+
+		while (pQueue->nDone < pQueue->nCount) {
+			ThreadWaitDone(pQueue);
+		}
+
+		pQueue->nCount = pQueue->nNext = pQueue->nDone = 0;
+		ThreadUnlock();
+
+		return;
+	}
+#endif
+
+	pQueue->nCount = pQueue->nNext = pQueue->nDone = 0;
+}
+
+INT32 BurnThreadRun(BurnThreadJob pFunc, void *pParam, INT32 nCount)
+{
+	if (pFunc == NULL) return 1;
+
+#if defined(THREAD_WIN32) || defined(THREAD_PTHREAD)
+	if (!bStarted) ThreadStart();
+
+	if (nWorkers && nCount > 1) {
+		BurnJobQueue Queue;
+
+		memset(&Queue, 0, sizeof(Queue));
+		Queue.pJob = pFunc;
+		Queue.pParam = pParam;
+
+		if (QueueCreate(&Queue) == 0) {
+			BurnThreadQueue(&Queue, nCount);
+			BurnThreadWait(&Queue);
+			QueueDestroy(&Queue);
+
+			return 0;
+		}
+	}
+#endif
+
+	for (INT32 i = 0; i < nCount; i++) {
+		pFunc(pParam, i);
+	}
+
+	return 0;
+}
+
+// the clients should have waited for their queues, anything left is run here
+void BurnThreadExit()
+{
+#if defined(THREAD_WIN32) || defined(THREAD_PTHREAD)
+	if (!bStarted) return;
+
+	if (nWorkers) {
+		ThreadLock();
+		while (pActive) {
+			ThreadRunJob(pActive);
+		}
+		bQuit = 1;
+		ThreadSignalStart(nWorkers);
+		ThreadUnlock();
+
+		for (INT32 i = 0; i < nWorkers; i++) {
+#if defined(THREAD_WIN32)
+			WaitForSingleObject(hThreads[i], INFINITE);
+			CloseHandle(hThreads[i]);
+#else
+			pthread_join(hThreads[i], NULL);
+#endif
+		}
+	}
+
+#if defined(THREAD_WIN32)
+	if (hStart) CloseHandle(hStart);
+	hStart = NULL;
+	DeleteCriticalSection(&csLock);
+#endif
+
+	nWorkers = 0;
+	bStarted = 0;
+	bQuit = 0;
+#endif
+}
@@ -163,6 +163,22 @@ struct cpu_core_config {
 
 void CpuCheatRegister(INT32 type, cpu_core_config *config);
 
+// burn_idle.cpp
+#define BURN_IDLE_MAX_LOOP		64		// bytes a branch may go back for BurnIdleBranch() to look at it
+
+#define BURN_IDLE_DENY			1		// never skip the loop
+#define BURN_IDLE_ALLOW			2		// skip it even though it writes
+
+extern UINT32 nBurnIdleWrites;			// bumped by the opted in cores for every write they make
+
+void BurnIdleInit();
+void BurnIdleExit();
+INT32 BurnIdleRegister(cpu_core_config *pConfig, UINT32 (*pState)());
+INT32 BurnIdleSetRule(const char *szCpu, UINT32 nPC, INT32 nMode);
+INT32 BurnIdleAllowed(INT32 nCore, UINT32 nPC);
+INT32 BurnIdleBranch(INT32 nCore, UINT32 nFrom, UINT32 nTo, UINT32 nCycles);
+void BurnIdleSkip(INT32 nCycles);
+
 // burn_memory.cpp
 void BurnInitMemoryManager();
 UINT8 *_BurnMalloc(INT32 size, char *file, INT32 line); // internal use only :)
@@ -171,6 +187,27 @@ void _BurnFree(void *ptr); // internal use only :)
 #define BurnFree(x) do {_BurnFree(x); x = NULL; } while (0)
 #define BurnMalloc(x) _BurnMalloc(x, __FILE__, __LINE__)
 void BurnExitMemoryManager();
+INT32 BurnMemoryCanMap(void *ptr, INT32 size);
+
+// rom_cache.cpp
+INT32 BurnRomCacheLoad(const TCHAR *szRegion, UINT8 *pDest, INT32 nLen);
+INT32 BurnRomCacheSave(const TCHAR *szRegion, UINT8 *pSrc, INT32 nLen);
+
+// tiles_generic.cpp
+void BurnTransferDirtyStart();
+void BurnTransferDirtyEnd();
+
+// burn_profile.cpp
+void BurnProfileEnter(INT32 nSection);
+void BurnProfileLeave();
+
+struct BurnProfileScope {
+	bool bActive;
+	BurnProfileScope(INT32 nSection) : bActive(bBurnProfile) { if (bActive) BurnProfileEnter(nSection); }
+	~BurnProfileScope() { if (bActive) BurnProfileLeave(); }
+};
+
+#define BURN_PROFILE(section)	BurnProfileScope BurnProfileScope_(section)
 
 // ---------------------------------------------------------------------------
 // Sound clipping macro
@@ -7,6 +7,9 @@
 ***************************************************************************/
 
 #include <math.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #include "burnint.h"
 #include "poly.h"
 
@@ -139,7 +142,7 @@ struct polygon_info
 struct poly_manager
 {
 	/* queue management */
-//	osd_work_queue *    queue;                  /* work queue */
+	BurnJobQueue *      queue;                  /* units go to the BurnThreadQueue() workers */
 
 	/* triangle work units */
 	work_unit **        unit;                   /* array of work unit pointers */
@@ -197,12 +200,22 @@ static void free_array(void **array);
 static void *poly_item_callback(void *param, int threadid);
 //static void poly_state_presave(poly_manager *poly);
 
+/* units are handed to the workers as they are queued, so this has to be a real atomic */
 static INT32 compare_exchange32(volatile INT32 *ptr, INT32 compare, INT32 exchange)
 {
-	INT32 prev = *ptr;
-	if (*ptr == compare)
-		*ptr = exchange;
-	return prev;
+#if defined(_MSC_VER)
+	return _InterlockedCompareExchange((volatile long *)ptr, exchange, compare);
+#else
+	return __sync_val_compare_and_swap(ptr, compare, exchange);
+#endif
+}
+
+/* BurnThreadQueue() job, the job index is the unit index (units are queued in order, from 0 after each poly_wait()) */
+static void poly_work_job(void *param, INT32 index)
+{
+	poly_manager *poly = (poly_manager *)param;
+
+	poly_item_callback(poly->unit[index], 0);
 }
 
 #define INLINE static inline
@@ -345,9 +358,9 @@ poly_manager *poly_alloc(int max_polys, size_t extra_data_size, UINT8 flags)
 	poly->unit_next = 0;
 	poly->unit = (work_unit **)allocate_array(&poly->unit_size, poly->unit_count);
 
-	/* create the work queue */
-//	if (!(flags & POLYFLAG_NO_WORK_QUEUE))
-//		poly->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	/* use the worker threads, unless there's only the one */
+	if (!(flags & POLYFLAG_NO_WORK_QUEUE) && BurnThreadCount() > 1)
+		poly->queue = BurnThreadQueueInit(poly_work_job, poly);
 
 	/* request a pre-save callback for synchronization */
 	//machine.save().register_presave(save_prepost_delegate(FUNC(poly_state_presave), poly));
@@ -361,6 +374,10 @@ poly_manager *poly_alloc(int max_polys, size_t extra_data_size, UINT8 flags)
 
 void poly_free(poly_manager *poly)
 {
+	/* the workers may still be drawing */
+	poly_wait(poly, "poly_free");
+	BurnThreadQueueExit(poly->queue);
+
 #if KEEP_STATISTICS
 {
 	int i, conflicts = 0, resolved = 0;
@@ -412,11 +429,11 @@ void poly_wait(poly_manager *poly, const char *debug_reason)
 	//	time = get_profile_ticks();
 
 	/* wait for all pending work items to complete */
-	//if (poly->queue != NULL)
-	//osd_work_queue_wait(poly->queue, osd_ticks_per_second() * 100);
+	if (poly->queue)
+		BurnThreadWait(poly->queue);
 
 	/* if we don't have a queue, just run the whole list now */
-	//else
+	else
 	{
 		int unitnum;
 		for (unitnum = 0; unitnum < poly->unit_next; unitnum++)
@@ -644,8 +661,8 @@ UINT32 poly_render_triangle(poly_manager *poly, void *dest, const rectangle &cli
 	}
 
 	/* enqueue the work items */
-	//if (poly->queue != NULL)
-	//osd_work_item_queue_multiple(poly->queue, poly_item_callback, poly->unit_next - startunit, poly->unit[startunit], poly->unit_size, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (poly->queue)
+		BurnThreadQueue(poly->queue, poly->unit_next - startunit);
 
 	/* return the total number of pixels in the triangle */
 	poly->triangles++;
@@ -752,8 +769,8 @@ UINT32 poly_render_triangle_custom(poly_manager *poly, void *dest, const rectang
 #endif
 
 	/* enqueue the work items */
-	//if (poly->queue != NULL)
-	//	osd_work_item_queue_multiple(poly->queue, poly_item_callback, poly->unit_next - startunit, poly->unit[startunit], poly->unit_size, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (poly->queue)
+		BurnThreadQueue(poly->queue, poly->unit_next - startunit);
 
 	/* return the total number of pixels in the object */
 	poly->triangles++;
@@ -977,8 +994,8 @@ UINT32 poly_render_quad(poly_manager *poly, void *dest, const rectangle &cliprec
 #endif
 
 	/* enqueue the work items */
-	//if (poly->queue != NULL)
-	//	osd_work_item_queue_multiple(poly->queue, poly_item_callback, poly->unit_next - startunit, poly->unit[startunit], poly->unit_size, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (poly->queue)
+		BurnThreadQueue(poly->queue, poly->unit_next - startunit);
 
 	/* return the total number of pixels in the triangle */
 	poly->quads++;
@@ -1209,8 +1226,8 @@ UINT32 poly_render_polygon(poly_manager *poly, void *dest, const rectangle &clip
 #endif
 
 	/* enqueue the work items */
-	//if (poly->queue != NULL)
-	//	osd_work_item_queue_multiple(poly->queue, poly_item_callback, poly->unit_next - startunit, poly->unit[startunit], poly->unit_size, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (poly->queue)
+		BurnThreadQueue(poly->queue, poly->unit_next - startunit);
 
 	/* return the total number of pixels in the triangle */
 	poly->quads++;
@@ -1324,7 +1341,9 @@ static void *poly_item_callback(void *param, int threadid)
 		if (unit->shared.previtem != 0xffff)
 		{
 			work_unit *prevunit = polygon->poly->unit[unit->shared.previtem];
-			if (prevunit->shared.count_next != 0)
+
+			/* read through the atomic, a finished unit's pixels have to be visible to us */
+			if (compare_exchange32((volatile INT32 *)&prevunit->shared.count_next, 0, 0) != 0)
 			{
 				UINT32 unitnum = ((UINT8 *)unit - (UINT8 *)polygon->poly->unit[0]) / polygon->poly->unit_size;
 				UINT32 new_count_next;
@@ -111,9 +111,13 @@ void x2212_scan(INT32 nAction, INT32 *pnMin)
 		}
 
 		if (nAction & ACB_NVRAM) {
-			if ((nAction & ACB_READ) && (x2212_chips[i].mode & X2212_AUTOSTORE)) {
-				if (X2212_DEBUG) bprintf(0, _T("X2212 chip %d: NVRAM Write Auto-Store.\n"), i);
-				store_internal(i);
+			if (nAction & ACB_READ) {
+				BurnStateCacheScanOnSave();
+
+				if (x2212_chips[i].mode & X2212_AUTOSTORE) {
+					if (X2212_DEBUG) bprintf(0, _T("X2212 chip %d: NVRAM Write Auto-Store.\n"), i);
+					store_internal(i);
+				}
 			}
 
 			if (X2212_DEBUG) bprintf(0, _T("X2212 chip %d: scan NVRAM.\n"), i);
@@ -808,6 +808,8 @@ UINT8 QscRead()
 
 INT32 QscUpdate(INT32 nEnd)
 {
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 nLen;
 
 	if (nEnd > nBurnSoundLen) {
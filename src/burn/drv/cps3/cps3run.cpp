@@ -1153,6 +1153,7 @@ INT32 cps3Init()
 	}
 	
 	// CHD games 
+	INT32 bUserRoms = (cps3_data_rom_size != 0);
 	if (cps3_data_rom_size == 0) cps3_data_rom_size = 0x5000000;	
 	
 	Mem = NULL;
@@ -1181,54 +1182,62 @@ INT32 cps3Init()
 #endif
 	cps3_decrypt_bios();
 
-	// load and decode sh-2 program roms
-	ii = 0;	offset = 0;
-	while (BurnDrvGetRomInfo(&pri, ii) == 0) {
-		if (pri.nType & BRF_PRG) {
-			if (pri.nLen == 0x800000) // sfiii4n
-			{
-				nRet = BurnLoadRom(RomGame + offset, ii, 1); if (nRet != 0) return 1;
-				offset += pri.nLen;
+	// load and decode sh-2 program roms, RomGame_D follows RomGame so the cache keeps both
+	if (BurnRomCacheLoad(_T("prg"), RomGame, 0x2000000)) {
+		ii = 0;	offset = 0;
+		while (BurnDrvGetRomInfo(&pri, ii) == 0) {
+			if (pri.nType & BRF_PRG) {
+				if (pri.nLen == 0x800000) // sfiii4n
+				{
+					nRet = BurnLoadRom(RomGame + offset, ii, 1); if (nRet != 0) return 1;
+					offset += pri.nLen;
+					ii++;
+				}
+				else
+				{
+					nRet = BurnLoadRom(RomGame + offset + 0, ii + 0, 4); if (nRet != 0) return 1;
+					nRet = BurnLoadRom(RomGame + offset + 1, ii + 1, 4); if (nRet != 0) return 1;
+					nRet = BurnLoadRom(RomGame + offset + 2, ii + 2, 4); if (nRet != 0) return 1;
+					nRet = BurnLoadRom(RomGame + offset + 3, ii + 3, 4); if (nRet != 0) return 1;
+					offset += pri.nLen * 4;
+					ii += 4;
+				}
+			} else {
 				ii++;
 			}
-			else
-			{
-				nRet = BurnLoadRom(RomGame + offset + 0, ii + 0, 4); if (nRet != 0) return 1;
-				nRet = BurnLoadRom(RomGame + offset + 1, ii + 1, 4); if (nRet != 0) return 1;
-				nRet = BurnLoadRom(RomGame + offset + 2, ii + 2, 4); if (nRet != 0) return 1;
-				nRet = BurnLoadRom(RomGame + offset + 3, ii + 3, 4); if (nRet != 0) return 1;
-				offset += pri.nLen * 4;
-				ii += 4;
-			}
-		} else {
-			ii++;
 		}
-	}
 #ifdef LSB_FIRST
-	be_to_le( RomGame, 0x1000000 );
+		be_to_le( RomGame, 0x1000000 );
 #endif
-	cps3_decrypt_game();
+		cps3_decrypt_game();
+
+		BurnRomCacheSave(_T("prg"), RomGame, 0x2000000);
+	}
 	
 	// load graphic and sound roms
-	ii = 0;	offset = 0;
-	while (BurnDrvGetRomInfo(&pri, ii) == 0) {
-		if (pri.nType & (BRF_GRA | BRF_SND)) {
-			if (pri.nLen == 0x800000) // sfiii4n
-			{
-				BurnLoadRom(RomUser + offset, ii, 1);
-				offset += pri.nLen;
+	if (!bUserRoms || BurnRomCacheLoad(_T("user"), RomUser, cps3_data_rom_size)) {
+		ii = 0;	offset = 0;
+		while (BurnDrvGetRomInfo(&pri, ii) == 0) {
+			if (pri.nType & (BRF_GRA | BRF_SND)) {
+				if (pri.nLen == 0x800000) // sfiii4n
+				{
+					BurnLoadRom(RomUser + offset, ii, 1);
+					offset += pri.nLen;
+					ii++;
+				}
+				else
+				{
+					BurnLoadRom(RomUser + offset + 0, ii + 0, 2);
+					BurnLoadRom(RomUser + offset + 1, ii + 1, 2);
+					offset += pri.nLen * 2;
+					ii += 2;
+				}
+			} else {
 				ii++;
 			}
-			else
-			{
-				BurnLoadRom(RomUser + offset + 0, ii + 0, 2);
-				BurnLoadRom(RomUser + offset + 1, ii + 1, 2);
-				offset += pri.nLen * 2;
-				ii += 2;
-			}
-		} else {
-			ii++;
 		}
+
+		if (bUserRoms) BurnRomCacheSave(_T("user"), RomUser, cps3_data_rom_size);
 	}
 
 	{
@@ -598,6 +598,9 @@ static INT32 DrvGfxRamDecode()
 
 	GfxDecode(0x0100, 3, 16, 16, Plane, XOffs, YOffs, 0x100, DrvGfxRAM, DrvGfxROM2);
 
+	GenericTilemapAllGfxTilesDirty(1);
+	GenericTilemapAllGfxTilesDirty(2);
+
 	return 0;
 }
 
@@ -2014,6 +2014,8 @@ static inline void decode_chars_one(INT32 offset)
 
 		d[bit ^ 7] = p;
 	}
+
+	GenericTilemapSetGfxTileDirty(1, offset >> 3);
 }
 
 static inline void decode_tiles_one(INT32 offset)
@@ -136,6 +136,8 @@ static void charram_write(INT32 offset, UINT8 data) // to do - simplify this so
 				DrvFgBuffer[offset + i] = data & (1<<(7-i)) ? (DrvFgBuffer[offset + i] | char_pen) : DrvFgBuffer[offset + i];
 		}
 	}
+
+	GenericTilemapSetGfxTileDirty(1, offset / 64);
 }
 
 static void bankswitch()
@@ -269,6 +271,8 @@ static INT32 DrvDoReset()
 {
 	memset (AllRam, 0, RamEnd - AllRam);
 
+	GenericTilemapAllGfxTilesDirty(1);
+
 	M6502Open(0);
 	M6502Reset();
 	M6502Close();
@@ -526,6 +530,10 @@ static INT32 DrvScan(INT32 nAction, INT32 *pnMin)
 		ba.szName = "All Ram";
 		BurnAcb(&ba);
 
+		if (nAction & ACB_WRITE) {
+			GenericTilemapAllGfxTilesDirty(1); // fg buffer
+		}
+
 		M6502Scan(nAction);
 		AY8910Scan(nAction, pnMin);
 
@@ -568,6 +568,7 @@ static INT32 DrvScan(INT32 nAction,INT32 *pnMin)
 
 	// Read and write irq vectors
 	if (nAction & ACB_READ) {
+		BurnStateCacheScanOnSave();
 		memcpy (DrvM6809RAM + 0x1000, DrvM6809ROM + 0xfff2, 0x0c);
 	}
 
@@ -718,8 +718,19 @@ static INT32 LoadRoms()
 		BurnSetProgressRange(1.0 / pInfo->nSpriteNum);
 	}
 
+	// Decoded sprites (and the text layer extracted from them) can come from the rom cache,
+	// unless the driver's initialise callback still has to modify the data before decoding
+	INT32 bSpriteCache = (NeoCallbackActive == NULL || NeoCallbackActive->pInitialise == NULL);
+	INT32 bSpriteCached = 0;
+
+	if (bSpriteCache) {
+		bSpriteCached = (BurnRomCacheLoad(_T("spr"), NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]) == 0);
+	}
+
 	// Load sprite data
-	NeoLoadSprites(pInfo->nSpriteOffset, pInfo->nSpriteNum, NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+	if (!bSpriteCached) {
+		NeoLoadSprites(pInfo->nSpriteOffset, pInfo->nSpriteNum, NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+	}
 
 	NeoTextROM[nNeoActiveSlot] = (UINT8*)BurnMalloc(nNeoTextROMSize[nNeoActiveSlot]);
 	if (NeoTextROM[nNeoActiveSlot] == NULL) {
@@ -731,7 +742,13 @@ static INT32 LoadRoms()
 		if (pInfo->nTextOffset != -1) {
 			// Load S ROM data
 			BurnLoadRom(NeoTextROM[nNeoActiveSlot], pInfo->nTextOffset, 1);
-		} else {
+		} else if (bSpriteCached && BurnRomCacheLoad(_T("fix"), NeoTextROM[nNeoActiveSlot], nNeoTextROMSize[nNeoActiveSlot]) != 0) {
+			// The sprites are already decoded, so load everything again
+			bSpriteCached = 0;
+			NeoLoadSprites(pInfo->nSpriteOffset, pInfo->nSpriteNum, NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+		}
+
+		if (pInfo->nTextOffset == -1 && !bSpriteCached) {
 			// Extract data from the end of C ROMS
 			BurnUpdateProgress(0.0, _T("Decrypting text layer graphics...")/*, BST_DECRYPT_TXT*/, 0);
 			NeoCMCExtractSData(NeoSpriteROM[nNeoActiveSlot], NeoTextROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot], nNeoTextROMSize[nNeoActiveSlot]);
@@ -741,6 +758,10 @@ static INT32 LoadRoms()
 					NeoTextROM[nNeoActiveSlot][i] = BITSWAP08(NeoTextROM[nNeoActiveSlot][i] ^ 0xd2, 4, 0, 7, 2, 5, 1, 6, 3);
 				}
 			}
+
+			if (bSpriteCache) {
+				BurnRomCacheSave(_T("fix"), NeoTextROM[nNeoActiveSlot], nNeoTextROMSize[nNeoActiveSlot]);
+			}
 		}
 	}
 
@@ -779,7 +800,13 @@ static INT32 LoadRoms()
 	NeoDecodeText(0, nNeoTextROMSize[nNeoActiveSlot], NeoTextROM[nNeoActiveSlot], NeoTextROM[nNeoActiveSlot]);
 
 	// Decode sprite data
-	NeoDecodeSprites(NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+	if (!bSpriteCached) {
+		NeoDecodeSprites(NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+
+		if (bSpriteCache) {
+			BurnRomCacheSave(_T("spr"), NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+		}
+	}
 
 	if (pInfo->nADPCMANum) {
 		char* pName;
@@ -1123,6 +1150,9 @@ static void NeoMapActiveCartridge()
 
 	neogeoSynchroniseZ80(0);
 
+	// the new slot's areas and scan callback are different
+	BurnStateCacheInvalidate();
+
 	if (NeoCallbackActive && NeoCallbackActive->pRemoveHandlers) {
 		NeoCallbackActive->pRemoveHandlers();
 	}
@@ -4329,6 +4359,9 @@ INT32 NeoInit()
 		return 1;
 	}
 
+	// the cartridge slots only change areas in NeoMapActiveCartridge(), which invalidates the list
+	BurnStateCacheAllow();
+
 	return NeoInitCommon();
 }
 
@@ -589,6 +589,11 @@ static void expand_colourdata()
 		nPGMSPRColMaskLen -= 1;
 	}
 
+	// loaded, decrypted and expanded on an earlier boot
+	if (BurnRomCacheLoad(_T("sprcol"), PGMSPRColROM, (nPGMSPRColROMLen / 2) * 3) == 0) {
+		return;
+	}
+
 	UINT8 *tmp = (UINT8*)BurnMalloc(nPGMSPRColROMLen);
 	if (tmp == NULL) return;
 
@@ -634,6 +639,8 @@ static void expand_colourdata()
 	}
 
 	BurnFree (tmp);
+
+	BurnRomCacheSave(_T("sprcol"), PGMSPRColROM, (nPGMSPRColROMLen / 2) * 3);
 }
 
 static void ics2115_sound_irq(INT32 nState)
@@ -1079,6 +1079,8 @@ static inline void expand_chars(UINT16 offset)
 
 	DrvCharExp[offset * 2 + 1] = DrvCharRAM[offset] & 0xf;
 	DrvCharExp[offset * 2 + 0] = DrvCharRAM[offset] >> 4;
+
+	GenericTilemapSetGfxTileDirty(1, offset >> 5);
 }
 
 static void __fastcall main_write(UINT32 address, UINT8 data)
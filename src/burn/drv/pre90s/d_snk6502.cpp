@@ -527,6 +527,8 @@ static inline void character_write(INT32 offset)
 	{
 		d[i ^ 7] = (((a >> i) & 1) << 1) | ((b >> i) & 1);
 	}
+
+	GenericTilemapSetGfxTileDirty(0, offset >> 3);
 }	
 
 static void sasuke_main_write(UINT16 address, UINT8 data)
@@ -69,6 +69,8 @@ static void decode_char(INT32 offset, UINT8 data)
 	for (INT32 i = 0; i < 8; i++) {
 		DrvCharExp[(offset * 8) + i] = (data >> (7 - i)) & 1;
 	}
+
+	GenericTilemapSetGfxTileDirty(0, offset >> 3);
 }
 
 static void usgames_write(UINT16 address, UINT8 data)
@@ -129,6 +131,7 @@ static INT32 DrvDoReset()
 {
 	memset (AllRam, 0, RamEnd - AllRam);
 	memset (DrvCharExp, 0, 0x4000);
+	GenericTilemapAllGfxTilesDirty(0);
 
 	M6809Open(0);
 	M6809Reset();
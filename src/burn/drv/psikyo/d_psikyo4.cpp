@@ -713,7 +713,7 @@ static INT32 DrvInit(INT32 (*LoadCallback)(), INT32 gfx_len)
 	Sh2SetWriteWordHandler(0,		ps4_write_word);
 	Sh2SetWriteLongHandler(0,		ps4_write_long);
 
-	Sh2MapHandler(1, 0x06000000 | speedhack_address, 0x0600ffff | speedhack_address, MAP_ROM);
+	Sh2MapHandler(1, 0x06000000 | speedhack_address, 0x0600ffff | speedhack_address, MAP_READ); // reads only, code is still fetched straight from ram
 	Sh2SetReadByteHandler (1,		ps4hack_read_byte);
 	Sh2SetReadWordHandler (1,		ps4hack_read_word);
 	Sh2SetReadLongHandler (1,		ps4hack_read_long);
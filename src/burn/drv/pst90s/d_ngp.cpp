@@ -847,6 +847,8 @@ static INT32 DrvScan(INT32 nAction, INT32 *pnMin)
 
 		if (nAction & ACB_READ) // read from game -> write to state
 		{
+			BurnStateCacheScanOnSave();
+
 			for (INT32 i = 0; i < 0x400000; i++) {
 				if (DrvCartROM[i] != DrvCartBak[i]) {
 					DrvCartTmp[size + 0] = DrvCartROM[i];
@@ -1116,7 +1116,7 @@ static INT32 DrvInit(INT32 bios)
 	Sh2SetWriteWordHandler(0,		suprnova_write_word);
 	Sh2SetWriteLongHandler(0,		suprnova_write_long);
 
-	Sh2MapHandler(1,			0x06000000, 0x060fffff, MAP_ROM);
+	Sh2MapHandler(1,			0x06000000, 0x060fffff, MAP_READ); // reads only, code is still fetched straight from ram
 	Sh2SetReadByteHandler (1,		suprnova_hack_read_byte);
 	Sh2SetReadWordHandler (1,		suprnova_hack_read_word);
 	Sh2SetReadLongHandler (1,		suprnova_hack_read_long);
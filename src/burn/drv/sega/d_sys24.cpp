@@ -1808,6 +1808,9 @@ static inline void character_update(UINT32 i)
 	DrvCharExp[i*2+1] = DrvCharRAM[i+1] & 0xf;
 	DrvCharExp[i*2+2] = DrvCharRAM[i+0] >> 4;
 	DrvCharExp[i*2+3] = DrvCharRAM[i+0] & 0xf;
+
+	GenericTilemapSetGfxTileDirty(0, i >> 5);
+	GenericTilemapSetGfxTileDirty(1, i >> 5);
 }
 
 static void __fastcall character_write_word(UINT32 address, UINT16 data)
@@ -2868,6 +2871,9 @@ static void DrvCharExpand()
 		DrvCharExp[i*2+0] = DrvCharRAM[i^1] >> 4;
 		DrvCharExp[i*2+1] = DrvCharRAM[i^1] & 0xf;
 	}
+
+	GenericTilemapAllGfxTilesDirty(0);
+	GenericTilemapAllGfxTilesDirty(1);
 }
 
 static INT32 DrvScan(INT32 nAction, INT32 *pnMin)
@@ -210,6 +210,9 @@ static inline void character_expand(INT32 offset)
 		d3 >>= 1;
 		d++;
 	}
+
+	GenericTilemapSetGfxTileDirty(0, offset >> 3);
+	GenericTilemapSetGfxTileDirty(1, offset >> 3);
 }
 
 static void sync_cpus()
@@ -19,6 +19,8 @@ static poly_manager *poly;
 struct poly_extra_data
 {
 	UINT16 *texbase;
+	INT32 width;		// the scanlines are drawn by the worker threads while
+	INT32 height;		// DrvDraw() changes nScreenWidth/Height
 };
 
 static INT32 sprite_count = 0;
@@ -399,6 +401,8 @@ static INT32 DrvInit()
 
 static INT32 DrvExit()
 {
+	poly_free(poly);
+
 	GenericTilesExit();
 
 	SekExit();
@@ -408,8 +412,6 @@ static INT32 DrvExit()
 	TaitoF3SoundExit();
 	TaitoICExit();
 
-	poly_free(poly);
-
 	BurnFree(TaitoMem);
 
 	return 0;
@@ -541,7 +543,9 @@ static void draw_sprites(INT32 priority)
 static void tc0610_draw_scanline(void *dest, INT32 scan_line, const poly_extent *extent, const void *extradata, INT32 threadid)
 {
 	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	UINT16 *framebuffer = ((UINT16*)dest) + scan_line * nScreenWidth;
+	INT32 width = extra->width;
+	INT32 height = extra->height;
+	UINT16 *framebuffer = ((UINT16*)dest) + scan_line * width;
 	UINT16 *texbase = extra->texbase;
 	INT32 startx = extent->startx;
 	INT32 stopx = extent->stopx;
@@ -555,9 +559,9 @@ static void tc0610_draw_scanline(void *dest, INT32 scan_line, const poly_extent
 		INT32 srcy = (v >> 16);
 		INT32 srcx = (u >> 16);
 
-		if (x >= 0 && x < nScreenWidth) {
-			if (srcy >= 0 && srcy < nScreenHeight && srcx >= 0 && srcx < nScreenWidth) {
-				framebuffer[x] = texbase[srcy * nScreenWidth + srcx];
+		if (x >= 0 && x < width) {
+			if (srcy >= 0 && srcy < height && srcx >= 0 && srcx < width) {
+				framebuffer[x] = texbase[srcy * width + srcx];
 			}
 		}
 		u += dudx;
@@ -745,10 +749,12 @@ static void tc0610_rotate_draw()
 	vert[3].p[1] = 0.0;
 
 	extra->texbase = BurnBitmapGetBitmap(1);
+	extra->width = nScreenWidth;
+	extra->height = nScreenHeight;
 	callback = tc0610_draw_scanline;
 
+	// the result isn't used until the next DrvDraw(), let it render during the next frame
 	poly_render_quad(poly, (void*)BurnBitmapGetBitmap(2), clip, callback, 2, &vert[0], &vert[1], &vert[2], &vert[3]);
-	poly_wait(poly, NULL);
 }
 
 static INT32 DrvDraw()
@@ -758,6 +764,8 @@ static INT32 DrvDraw()
 		DrvRecalc = 0;
 	}
 
+	poly_wait(poly, NULL); // last frame's rotation, reads bitmap 1 and draws to bitmap 2
+
 	BurnTransferClear();
 
 	UINT8 Layer[5];
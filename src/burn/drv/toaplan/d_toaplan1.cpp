@@ -2421,7 +2421,10 @@ static INT32 RallybikDraw()
 		GenericTilemapSetScrollY(i, (scroll[1+i*2] >> 7) - tiles_offsets_y);
 	}
 
-	BurnTransferClear();
+	// the opaque pass of layer 0 usually covers the whole screen
+	if ((nBurnLayer & 8) == 0 || GenericTilemapCoversClip(0, TMAP_FORCEOPAQUE) == 0) {
+		BurnTransferClear();
+	}
 
 	if (nBurnLayer & 8) GenericTilemapDraw(0, pTransDraw, TMAP_FORCEOPAQUE);
 
@@ -2601,7 +2604,10 @@ static INT32 DrvDraw()
 		GenericTilemapSetScrollY(i, (scroll[1+i*2] >> 7) - tiles_offsets_y);
 	}
 
-	BurnTransferClear();
+	// the opaque pass of layer 0 usually covers the whole screen
+	if ((nBurnLayer & 8) == 0 || GenericTilemapCoversClip(0, TMAP_FORCEOPAQUE) == 0) {
+		BurnTransferClear();
+	}
 
 	if (nBurnLayer & 8) GenericTilemapDraw(0, pTransDraw, TMAP_FORCEOPAQUE);
 
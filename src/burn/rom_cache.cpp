@@ -0,0 +1,195 @@
+// Burn - Decoded rom region cache
+//
+// Drivers that spend a long time loading / decrypting / decoding graphics can
+// store the finished region on disk and restore it on the next boot:
+//
+//	if (BurnRomCacheLoad(_T("gfx"), DrvGfxROM, nGfxLen)) {
+//		... load + decode ...
+//		BurnRomCacheSave(_T("gfx"), DrvGfxROM, nGfxLen);
+//	}
+//
+// Entries are keyed by driver name, region name, region length and the crc /
+// length of every rom in the set, so a different romset never hits a stale
+// entry. The data starts on a 64k boundary in the file; if the destination is a
+// page backed BurnMalloc block, the data is mmap'ed (private / copy-on-write)
+// straight over it and only paged in when touched, otherwise it's fread.
+
+#if !defined(_WIN32) && (defined(__linux__) || defined(__APPLE__))
+ #include <sys/mman.h>
+ #include <fcntl.h>
+ #include <unistd.h>
+ #define ROMCACHE_MMAP
+#endif
+
+#include "burnint.h"
+
+#ifndef _trename
+#define _trename rename
+#endif
+#ifndef _tremove
+#define _tremove remove
+#endif
+
+#define ROMCACHE_MAGIC		0x43524246 // "FBRC"
+#define ROMCACHE_VERSION	1
+#define ROMCACHE_DATA_OFFSET	0x10000    // data is page aligned for 4k / 16k / 64k pages
+
+TCHAR szBurnRomCachePath[MAX_PATH] = _T(""); // empty disables the cache
+
+struct RomCacheHeader {
+	UINT32 nMagic;
+	UINT32 nVersion;
+	UINT32 nKey;
+	UINT32 nLen;
+};
+
+static inline UINT32 RomCacheHash(UINT32 nHash, const void *pData, INT32 nLen)
+{
+	const UINT8 *p = (const UINT8*)pData;
+
+	for (INT32 i = 0; i < nLen; i++) {
+		nHash = (nHash ^ p[i]) * 0x01000193;
+	}
+
+	return nHash;
+}
+
+static UINT32 RomCacheKey(const TCHAR *szRegion, INT32 nLen)
+{
+	UINT32 nHash = 0x811c9dc5;
+	const char *szName = BurnDrvGetTextA(DRV_NAME);
+
+	nHash = RomCacheHash(nHash, szName, strlen(szName));
+	nHash = RomCacheHash(nHash, szRegion, _tcslen(szRegion) * sizeof(TCHAR));
+	nHash = RomCacheHash(nHash, &nLen, sizeof(nLen));
+
+	struct BurnRomInfo ri;
+	for (INT32 i = 0; BurnDrvGetRomInfo(&ri, i) == 0; i++) {
+		if (ri.nType == 0) continue;
+
+		nHash = RomCacheHash(nHash, &ri.nCrc, sizeof(ri.nCrc));
+		nHash = RomCacheHash(nHash, &ri.nLen, sizeof(ri.nLen));
+	}
+
+	return nHash;
+}
+
+static INT32 RomCacheEnabled()
+{
+	// ips patches change the rom data without changing the crcs
+	return (szBurnRomCachePath[0] != 0 && !bDoIpsPatch);
+}
+
+static void RomCacheName(TCHAR *szFilename, const TCHAR *szRegion)
+{
+	_stprintf(szFilename, _T("%s%s_%s.fbc"), szBurnRomCachePath, BurnDrvGetText(DRV_NAME), szRegion);
+}
+
+// returns 0 if pDest was filled from the cache, 1 if the region must be loaded normally
+INT32 BurnRomCacheLoad(const TCHAR *szRegion, UINT8 *pDest, INT32 nLen)
+{
+	if (!RomCacheEnabled() || pDest == NULL || nLen <= 0) return 1;
+
+	TCHAR szFilename[MAX_PATH];
+	RomCacheName(szFilename, szRegion);
+
+	FILE *fp = _tfopen(szFilename, _T("rb"));
+	if (fp == NULL) return 1;
+
+	RomCacheHeader hdr;
+	if (fread(&hdr, 1, sizeof(hdr), fp) != sizeof(hdr) || hdr.nMagic != ROMCACHE_MAGIC || hdr.nVersion != ROMCACHE_VERSION || hdr.nKey != RomCacheKey(szRegion, nLen) || hdr.nLen != (UINT32)nLen) {
+		fclose(fp);
+		return 1;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	if (ftell(fp) < (long)ROMCACHE_DATA_OFFSET + nLen) { // truncated
+		fclose(fp);
+		return 1;
+	}
+
+	INT32 nMapped = 0;
+
+#if defined(ROMCACHE_MMAP)
+	INT32 nPage = sysconf(_SC_PAGESIZE);
+
+	if (nPage > 0 && (ROMCACHE_DATA_OFFSET % nPage) == 0 && BurnMemoryCanMap(pDest, nLen)) {
+		size_t nMapLen = (size_t)nLen & ~(size_t)(nPage - 1);
+
+		// FILE can be a frontend stream (libretro vfs), so map through a plain descriptor
+		INT32 fd = (nMapLen) ? open(szFilename, O_RDONLY) : -1;
+
+		if (fd != -1) {
+			void *ptr = mmap(pDest, nMapLen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, ROMCACHE_DATA_OFFSET);
+
+			if (ptr == (void*)pDest) {
+				nMapped = nMapLen;
+			} else {
+				// a failed MAP_FIXED can leave the range unmapped, put anonymous pages back
+				mmap(pDest, nMapLen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+			}
+
+			close(fd);
+		}
+	}
+#endif
+
+	INT32 nRet = 0;
+
+	if (nMapped < nLen) {
+		fseek(fp, ROMCACHE_DATA_OFFSET + nMapped, SEEK_SET);
+		if (fread(pDest + nMapped, 1, nLen - nMapped, fp) != (size_t)(nLen - nMapped)) {
+			nRet = 1;
+		}
+	}
+
+	fclose(fp);
+
+	if (nRet == 0) {
+		bprintf(PRINT_NORMAL, _T("*   Rom cache: %s restored (%d bytes, %d mapped)\n"), szRegion, nLen, nMapped);
+	}
+
+	return nRet;
+}
+
+INT32 BurnRomCacheSave(const TCHAR *szRegion, UINT8 *pSrc, INT32 nLen)
+{
+	if (!RomCacheEnabled() || pSrc == NULL || nLen <= 0) return 1;
+
+	TCHAR szFilename[MAX_PATH];
+	TCHAR szTemp[MAX_PATH];
+	RomCacheName(szFilename, szRegion);
+	_stprintf(szTemp, _T("%s.tmp"), szFilename);
+
+	FILE *fp = _tfopen(szTemp, _T("wb"));
+	if (fp == NULL) return 1;
+
+	RomCacheHeader hdr;
+	hdr.nMagic = ROMCACHE_MAGIC;
+	hdr.nVersion = ROMCACHE_VERSION;
+	hdr.nKey = RomCacheKey(szRegion, nLen);
+	hdr.nLen = nLen;
+
+	INT32 nRet = 0;
+
+	if (fwrite(&hdr, 1, sizeof(hdr), fp) != sizeof(hdr)) nRet = 1;
+	if (nRet == 0 && fseek(fp, ROMCACHE_DATA_OFFSET, SEEK_SET) != 0) nRet = 1;
+	if (nRet == 0 && fwrite(pSrc, 1, nLen, fp) != (size_t)nLen) nRet = 1;
+	if (fclose(fp) != 0) nRet = 1;
+
+	if (nRet) {
+		_tremove(szTemp);
+		return 1;
+	}
+
+	// write + rename, so a running instance that has the old file mapped keeps its copy
+#if defined(_WIN32)
+	_tremove(szFilename); // rename doesn't replace on windows
+#endif
+	if (_trename(szTemp, szFilename) != 0) {
+		_tremove(szTemp);
+		return 1;
+	}
+
+	return 0;
+}
@@ -46,6 +46,8 @@ static void MD2612Render(INT32 nSegmentLength)
 	if (!DebugSnd_YM2612Initted) bprintf(PRINT_ERROR, _T("MD2612Render called without init\n"));
 #endif
 	
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nMD2612Position >= nSegmentLength) {
 		return;
 	}
@@ -86,6 +88,8 @@ static void MD2612UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (!DebugSnd_YM2612Initted) bprintf(PRINT_ERROR, _T("MD2612UpdateResample called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 nSegmentLength = nSegmentEnd;
 	INT32 nSamplesNeeded = nSegmentEnd * nBurnMD2612SoundRate / nBurnSoundRate + 1;
 
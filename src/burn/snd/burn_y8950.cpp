@@ -237,6 +237,8 @@ static void Y8950Render(INT32 nSegmentLength)
 	if (!DebugSnd_Y8950Initted) bprintf(PRINT_ERROR, _T("Y8950Render called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nY8950Position >= nSegmentLength) {
 		return;
 	}
@@ -261,6 +263,8 @@ static void Y8950UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (!DebugSnd_Y8950Initted) bprintf(PRINT_ERROR, _T("Y8950UpdateResample called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 nSegmentLength = nSegmentEnd;
 	INT32 nSamplesNeeded = nSegmentEnd * nBurnY8950SoundRate / nBurnSoundRate + 1;
 
@@ -353,6 +357,8 @@ static void Y8950UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (!DebugSnd_Y8950Initted) bprintf(PRINT_ERROR, _T("Y8950UpdateNormal called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 nSegmentLength = nSegmentEnd;
 
 	if (nSegmentEnd < nY8950Position) {
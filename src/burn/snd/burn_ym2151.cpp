@@ -1,6 +1,7 @@
 // FBAlpha YM-2151 sound core interface
 #include "burnint.h"
 #include "burn_ym2151.h"
+#include "stream.h"
 
 // Irq Callback timing notes..
 // Due to the way the internal timing of the ym2151 works, BurnYM2151Render()
@@ -11,18 +12,28 @@ UINT32 nBurnCurrentYM2151Register;
 
 static INT32 nBurnYM2151SoundRate;
 
-static INT16* pBuffer;
-static INT16* pYM2151Buffer[2];
+static Stream stream;
 
-static INT32 nBurnPosition;
-static UINT32 nSampleSize;
-static UINT32 nFractionalPosition;
-static UINT32 nSamplesRendered;
+static INT32 YM2151BurnTimer = 0;
 
-static double YM2151Volumes[2];
-static INT32 YM2151RouteDirs[2];
+static void YM2151StreamUpdate(INT16** ppStreams, INT32 nSamples)
+{
+	YM2151UpdateOne(0, ppStreams, nSamples);
+}
 
-static INT32 YM2151BurnTimer = 0;
+static INT32 YM2151SynchroniseStream(INT32 nSoundRate)
+{
+	// the cpu isn't attached until after BurnYM2151Init()
+	if (BurnTimerCPUClockspeed == 0) return 0;
+
+	return BurnSynchroniseStream(nSoundRate);
+}
+
+// called before register writes, so the samples before the write are made with the old values
+void BurnYM2151UpdateRequest()
+{
+	stream.update();
+}
 
 void BurnYM2151Render(INT16* pSoundBuf, INT32 nSegmentLength)
 {
@@ -30,81 +41,9 @@ void BurnYM2151Render(INT16* pSoundBuf, INT32 nSegmentLength)
 	if (!DebugSnd_YM2151Initted) bprintf(PRINT_ERROR, _T("YM2151Render called without init\n"));
 #endif
 	
-	nBurnPosition += nSegmentLength;
-
-	if (nBurnPosition >= nBurnSoundRate) {
-		nBurnPosition = nSegmentLength;
-
-		pYM2151Buffer[0][1] = pYM2151Buffer[0][(nFractionalPosition >> 16) - 3];
-		pYM2151Buffer[0][2] = pYM2151Buffer[0][(nFractionalPosition >> 16) - 2];
-		pYM2151Buffer[0][3] = pYM2151Buffer[0][(nFractionalPosition >> 16) - 1];
-
-		pYM2151Buffer[1][1] = pYM2151Buffer[1][(nFractionalPosition >> 16) - 3];
-		pYM2151Buffer[1][2] = pYM2151Buffer[1][(nFractionalPosition >> 16) - 2];
-		pYM2151Buffer[1][3] = pYM2151Buffer[1][(nFractionalPosition >> 16) - 1];
+	BURN_PROFILE(BURN_PROFILE_SOUND);
 
-		nSamplesRendered -= (nFractionalPosition >> 16) - 4;
-
-		for (UINT32 i = 0; i <= nSamplesRendered; i++) {
-			pYM2151Buffer[0][4 + i] = pYM2151Buffer[0][(nFractionalPosition >> 16) + i];
-			pYM2151Buffer[1][4 + i] = pYM2151Buffer[1][(nFractionalPosition >> 16) + i];
-		}
-
-		nFractionalPosition &= 0x0000FFFF;
-		nFractionalPosition |= 4 << 16;
-	}
-
-	pYM2151Buffer[0] = pBuffer + 4 + nSamplesRendered;
-	pYM2151Buffer[1] = pBuffer + 4 + nSamplesRendered + 65536;
-
-	YM2151UpdateOne(0, pYM2151Buffer, (UINT32)(nBurnPosition + 1) * nBurnYM2151SoundRate / nBurnSoundRate - nSamplesRendered);
-	nSamplesRendered += (UINT32)(nBurnPosition + 1) * nBurnYM2151SoundRate / nBurnSoundRate - nSamplesRendered;
-
-	pYM2151Buffer[0] = pBuffer;
-	pYM2151Buffer[1] = pBuffer + 65536;
-
-	nSegmentLength <<= 1;
-	
-	for (INT32 i = 0; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
-		INT32 nLeftSample[4] = {0, 0, 0, 0};
-		INT32 nRightSample[4] = {0, 0, 0, 0};
-		INT32 nTotalLeftSample, nTotalRightSample;
-		
-		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample[0] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 3] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nLeftSample[1] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 2] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nLeftSample[2] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 1] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nLeftSample[3] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 0] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-		}
-		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample[0] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 3] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nRightSample[1] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 2] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nRightSample[2] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 1] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nRightSample[3] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 0] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-		}
-		
-		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample[0] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 3] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nLeftSample[1] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 2] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nLeftSample[2] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 1] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nLeftSample[3] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 0] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-		}
-		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample[0] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 3] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nRightSample[1] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 2] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nRightSample[2] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 1] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nRightSample[3] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 0] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-		}
-		
-		nTotalLeftSample = INTERPOLATE4PS_CUSTOM((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3], 16384.0);
-		nTotalRightSample = INTERPOLATE4PS_CUSTOM((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3], 16384.0);
-		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		pSoundBuf[i + 0] = nTotalLeftSample;
-		pSoundBuf[i + 1] = nTotalRightSample;
-	}
+	stream.render(pSoundBuf, nSegmentLength);
 }
 
 void BurnYM2151Reset()
@@ -137,7 +76,7 @@ void BurnYM2151Exit()
 		YM2151BurnTimer = 0;
 	}
 
-	BurnFree(pBuffer);
+	stream.exit();
 	
 	DebugSnd_YM2151Initted = 0;
 }
@@ -172,19 +111,13 @@ INT32 BurnYM2151Init(INT32 nClockFrequency, INT32 use_timer)
 
 	YM2151Init(1, nClockFrequency, nBurnYM2151SoundRate, (YM2151BurnTimer) ? BurnOPMTimerCallback : NULL);
 
-	pBuffer = (INT16*)BurnMalloc(65536 * 2 * sizeof(INT16));
-	memset(pBuffer, 0, 65536 * 2 * sizeof(INT16));
+	// default routes are both outputs to both sides at 1.00
+	stream.init(nBurnYM2151SoundRate, nBurnSoundRate, 2, 0, YM2151StreamUpdate);
 
-	nSampleSize = (UINT32)nBurnYM2151SoundRate * (1 << 16) / nBurnSoundRate;
-	nFractionalPosition = 4 << 16;
-	nSamplesRendered = 0;
-	nBurnPosition = 0;
-
-	// default routes
-	YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1] = 1.00;
-	YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2] = 1.00;
-	YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_1] = BURN_SND_ROUTE_BOTH;
-	YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_2] = BURN_SND_ROUTE_BOTH;
+	if (YM2151BurnTimer) {
+		// the timer needs the cpu attached, so register writes can be synced to it
+		stream.set_sync(YM2151SynchroniseStream);
+	}
 
 	return 0;
 }
@@ -208,8 +141,7 @@ void BurnYM2151SetRoute(INT32 nIndex, double nVolume, INT32 nRouteDir)
 	if (nIndex < 0 || nIndex > 1) bprintf(PRINT_ERROR, _T("BurnYM2151SetRoute called with invalid index %i\n"), nIndex);
 #endif
 	
-	YM2151Volumes[nIndex] = nVolume;
-	YM2151RouteDirs[nIndex] = nRouteDir;
+	stream.set_route(nIndex, nVolume, nRouteDir);
 }
 
 void BurnYM2151Scan(INT32 nAction, INT32 *pnMin)
@@ -14,6 +14,7 @@ void BurnYM2151Exit();
 void BurnYM2151Render(INT16* pSoundBuf, INT32 nSegmentLength);
 void BurnYM2151Scan(INT32 nAction, INT32 *pnMin);
 void BurnYM2151SetInterleave(INT32 nInterleave);
+void BurnYM2151UpdateRequest();
 
 inline static void BurnYM2151Write(INT32 offset, const UINT8 nData)
 {
@@ -24,6 +25,7 @@ inline static void BurnYM2151Write(INT32 offset, const UINT8 nData)
 	extern UINT32 nBurnCurrentYM2151Register;
 
 	if (offset & 1) {
+		BurnYM2151UpdateRequest();
 		YM2151WriteReg(0, nBurnCurrentYM2151Register, nData);
 	} else {
 		nBurnCurrentYM2151Register = nData;
@@ -49,6 +51,7 @@ static inline void BurnYM2151WriteRegister(const UINT8 nValue)
 
 	extern UINT32 nBurnCurrentYM2151Register;
 
+	BurnYM2151UpdateRequest();
 	YM2151WriteReg(0, nBurnCurrentYM2151Register, nValue);
 }
 
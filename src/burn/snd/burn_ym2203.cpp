@@ -52,6 +52,8 @@ static void AY8910Render(INT32 nSegmentLength)
 	if (!DebugSnd_YM2203Initted) bprintf(PRINT_ERROR, _T("BurnYM2203 AY8910Render called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nAY8910Position >= nSegmentLength) {
 		return;
 	}
@@ -89,6 +91,8 @@ static void YM2203Render(INT32 nSegmentLength)
 	if (!DebugSnd_YM2203Initted) bprintf(PRINT_ERROR, _T("YM2203Render called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nYM2203Position >= nSegmentLength) {
 		return;
 	}
@@ -151,6 +155,8 @@ static void YM2203UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (!DebugSnd_YM2203Initted) bprintf(PRINT_ERROR, _T("YM2203UpdateResample called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 nSegmentLength = nSegmentEnd;
 	INT32 nSamplesNeeded = nSegmentEnd * nBurnYM2203SoundRate / nBurnSoundRate + 1;
 
@@ -317,6 +323,8 @@ static void YM2203UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (!DebugSnd_YM2203Initted) bprintf(PRINT_ERROR, _T("YM2203UpdateNormal called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 nSegmentLength = nSegmentEnd;
 	INT32 i;
 
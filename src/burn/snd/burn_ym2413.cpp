@@ -34,6 +34,8 @@ static void YM2413RenderNormal(INT16* pSoundBuf, INT32 nSegmentLength)
 	if (!DebugSnd_YM2413Initted) bprintf(PRINT_ERROR, _T("YM2413RenderNormal called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	nBurnPosition += nSegmentLength;
 
 	pYM2413Buffer[0] = pBuffer;
@@ -45,6 +45,8 @@ static void AY8910Render(INT32 nSegmentLength)
 	if (!DebugSnd_YM2608Initted) bprintf(PRINT_ERROR, _T("BurnYM2608 AY8910Render called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nAY8910Position >= nSegmentLength) {
 		return;
 	}
@@ -66,6 +68,8 @@ static void YM2608Render(INT32 nSegmentLength)
 	if (!DebugSnd_YM2608Initted) bprintf(PRINT_ERROR, _T("YM2608Render called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nYM2608Position >= nSegmentLength) {
 		return;
 	}
@@ -89,6 +93,8 @@ static void YM2608UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (!DebugSnd_YM2608Initted) bprintf(PRINT_ERROR, _T("YM2608UpdateResample called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 nSegmentLength = nSegmentEnd;
 	INT32 nSamplesNeeded = nSegmentEnd * nBurnYM2608SoundRate / nBurnSoundRate + 1;
 
@@ -203,6 +209,8 @@ static void YM2608UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (!DebugSnd_YM2608Initted) bprintf(PRINT_ERROR, _T("YM2608UpdateNormal called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 nSegmentLength = nSegmentEnd;
 
 	if (nSegmentEnd < nAY8910Position) {
@@ -1,5 +1,6 @@
 #include "burnint.h"
 #include "burn_ym3812.h"
+#include "stream.h"
 
 #define MAX_YM3812	2
 
@@ -198,23 +199,11 @@ static INT32 YM3812SynchroniseStream(INT32 nSoundRate)
 
 void (*BurnYM3812Update)(INT16* pSoundBuf, INT32 nSegmentEnd);
 
-static INT32 (*BurnYM3812StreamCallback)(INT32 nSoundRate);
-
 static INT32 nBurnYM3812SoundRate;
 
-static INT16* pBuffer;
-static INT16* pYM3812Buffer[2 * MAX_YM3812];
-
-static INT32 nYM3812Position;
-
-static UINT32 nSampleSize;
-static INT32 nFractionalPosition;
+static Stream stream;
 
 static INT32 nNumChips = 0;
-static INT32 bYM3812AddSignal;
-
-static double YM3812Volumes[1 * MAX_YM3812];
-static INT32 YM3812RouteDirs[1 * MAX_YM3812];
 
 // ----------------------------------------------------------------------------
 // Dummy functions
@@ -224,196 +213,36 @@ static void YM3812UpdateDummy(INT16* , INT32)
 	return;
 }
 
-static INT32 YM3812StreamCallbackDummy(INT32)
-{
-	return 0;
-}
-
 // ----------------------------------------------------------------------------
 // Execute YM3812 for part of a frame
 
-static void YM3812Render(INT32 nSegmentLength)
+static void YM3812StreamUpdate(INT16** ppStreams, INT32 nSamples)
 {
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_YM3812Initted) bprintf(PRINT_ERROR, _T("YM3812Render called without init\n"));
 #endif
 
-	if (nYM3812Position >= nSegmentLength) {
-		return;
-	}
+	BURN_PROFILE(BURN_PROFILE_SOUND);
 
-	nSegmentLength -= nYM3812Position;
+	YM3812UpdateOne(0, ppStreams[0], nSamples);
 
-	YM3812UpdateOne(0, pBuffer + 0 * 4096 + 4 + nYM3812Position, nSegmentLength);
-	
 	if (nNumChips > 1) {
-		YM3812UpdateOne(1, pBuffer + 1 * 4096 + 4 + nYM3812Position, nSegmentLength);
+		YM3812UpdateOne(1, ppStreams[1], nSamples);
 	}
-
-	nYM3812Position += nSegmentLength;
 }
 
 // ----------------------------------------------------------------------------
 // Update the sound buffer
 
-static void YM3812UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
+static void YM3812UpdateStream(INT16* pSoundBuf, INT32 nSegmentEnd)
 {
 #if defined FBNEO_DEBUG
-	if (!DebugSnd_YM3812Initted) bprintf(PRINT_ERROR, _T("YM3812UpdateResample called without init\n"));
+	if (!DebugSnd_YM3812Initted) bprintf(PRINT_ERROR, _T("YM3812UpdateStream called without init\n"));
 #endif
 
-	INT32 nSegmentLength = nSegmentEnd;
-	INT32 nSamplesNeeded = nSegmentEnd * nBurnYM3812SoundRate / nBurnSoundRate + 1;
-
-	if (nSamplesNeeded < nYM3812Position) {
-		nSamplesNeeded = nYM3812Position;
-	}
-
-	if (nSegmentLength > nBurnSoundLen) {
-		nSegmentLength = nBurnSoundLen;
-	}
-	nSegmentLength <<= 1;
-
-	YM3812Render(nSamplesNeeded);
-
-	pYM3812Buffer[0] = pBuffer + 0 * 4096 + 4;
-	if (nNumChips > 1) {
-		pYM3812Buffer[1] = pBuffer + 1 * 4096 + 4;
-	}
-
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
-		INT32 nLeftSample[4] = {0, 0, 0, 0};
-		INT32 nRightSample[4] = {0, 0, 0, 0};
-		INT32 nTotalLeftSample, nTotalRightSample;
-		
-		if ((YM3812RouteDirs[0 + BURN_SND_YM3812_ROUTE] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample[0] += (INT32)(pYM3812Buffer[0][(nFractionalPosition >> 16) - 3] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-			nLeftSample[1] += (INT32)(pYM3812Buffer[0][(nFractionalPosition >> 16) - 2] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-			nLeftSample[2] += (INT32)(pYM3812Buffer[0][(nFractionalPosition >> 16) - 1] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-			nLeftSample[3] += (INT32)(pYM3812Buffer[0][(nFractionalPosition >> 16) - 0] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-		}
-		if ((YM3812RouteDirs[0 + BURN_SND_YM3812_ROUTE] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample[0] += (INT32)(pYM3812Buffer[0][(nFractionalPosition >> 16) - 3] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-			nRightSample[1] += (INT32)(pYM3812Buffer[0][(nFractionalPosition >> 16) - 2] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-			nRightSample[2] += (INT32)(pYM3812Buffer[0][(nFractionalPosition >> 16) - 1] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-			nRightSample[3] += (INT32)(pYM3812Buffer[0][(nFractionalPosition >> 16) - 0] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-		}
-		
-		if (nNumChips > 1) {
-			if ((YM3812RouteDirs[1 + BURN_SND_YM3812_ROUTE] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample[0] += (INT32)(pYM3812Buffer[1][(nFractionalPosition >> 16) - 3] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-				nLeftSample[1] += (INT32)(pYM3812Buffer[1][(nFractionalPosition >> 16) - 2] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-				nLeftSample[2] += (INT32)(pYM3812Buffer[1][(nFractionalPosition >> 16) - 1] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-				nLeftSample[3] += (INT32)(pYM3812Buffer[1][(nFractionalPosition >> 16) - 0] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-			}
-			if ((YM3812RouteDirs[1 + BURN_SND_YM3812_ROUTE] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample[0] += (INT32)(pYM3812Buffer[1][(nFractionalPosition >> 16) - 3] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-				nRightSample[1] += (INT32)(pYM3812Buffer[1][(nFractionalPosition >> 16) - 2] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-				nRightSample[2] += (INT32)(pYM3812Buffer[1][(nFractionalPosition >> 16) - 1] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-				nRightSample[3] += (INT32)(pYM3812Buffer[1][(nFractionalPosition >> 16) - 0] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-			}
-		}
-		
-		nTotalLeftSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
-		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
-		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM3812AddSignal) {
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
-		}
-	}
-
-	if (nSegmentEnd >= nBurnSoundLen) {
-		INT32 nExtraSamples = nSamplesNeeded - (nFractionalPosition >> 16);
+	BURN_PROFILE(BURN_PROFILE_SOUND);
 
-		for (INT32 i = -4; i < nExtraSamples; i++) {
-			pYM3812Buffer[0][i] = pYM3812Buffer[0][(nFractionalPosition >> 16) + i];
-			if (nNumChips > 1) {
-				pYM3812Buffer[1][i] = pYM3812Buffer[1][(nFractionalPosition >> 16) + i];
-			}
-		}
-
-		nFractionalPosition &= 0xFFFF;
-
-		nYM3812Position = nExtraSamples;
-	}
-}
-
-static void YM3812UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
-{
-#if defined FBNEO_DEBUG
-	if (!DebugSnd_YM3812Initted) bprintf(PRINT_ERROR, _T("YM3812UpdateNormal called without init\n"));
-#endif
-
-	INT32 nSegmentLength = nSegmentEnd;
-
-	if (nSegmentEnd < nYM3812Position) {
-		nSegmentEnd = nYM3812Position;
-	}
-
-	if (nSegmentLength > nBurnSoundLen) {
-		nSegmentLength = nBurnSoundLen;
-	}
-
-	YM3812Render(nSegmentEnd);
-
-	pYM3812Buffer[0] = pBuffer + 4 + 0 * 4096;
-	pYM3812Buffer[1] = pBuffer + 4 + 1 * 4096;
-
-	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
-		INT32 nLeftSample = 0, nRightSample = 0;
-		
-		if ((YM3812RouteDirs[0 + BURN_SND_YM3812_ROUTE] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)(pYM3812Buffer[0][n] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-		}
-		if ((YM3812RouteDirs[0 + BURN_SND_YM3812_ROUTE] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)(pYM3812Buffer[0][n] * YM3812Volumes[0 + BURN_SND_YM3812_ROUTE]);
-		}
-		
-		if (nNumChips > 1) {
-			if ((YM3812RouteDirs[1 + BURN_SND_YM3812_ROUTE] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)(pYM3812Buffer[1][n] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-			}
-			if ((YM3812RouteDirs[1 + BURN_SND_YM3812_ROUTE] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)(pYM3812Buffer[1][n] * YM3812Volumes[1 + BURN_SND_YM3812_ROUTE]);
-			}
-		}
-		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM3812AddSignal) {
-			pSoundBuf[(n << 1) + 0] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 0] + nLeftSample);
-			pSoundBuf[(n << 1) + 1] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 1] + nRightSample);
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
-		}
-	}
-
-	nFractionalPosition = nSegmentLength;
-
-	if (nSegmentEnd >= nBurnSoundLen) {
-		INT32 nExtraSamples = nSegmentEnd - nBurnSoundLen;
-
-		for (INT32 i = 0; i < nExtraSamples; i++) {
-			pYM3812Buffer[0][i] = pYM3812Buffer[0][nBurnSoundLen + i];
-			if (nNumChips > 1) {
-				pYM3812Buffer[1][i] = pYM3812Buffer[1][nBurnSoundLen + i];
-			}
-		}
-
-		nFractionalPosition = 0;
-
-		nYM3812Position = nExtraSamples;
-
-	}
+	stream.render_to(pSoundBuf, nSegmentEnd);
 }
 
 // ----------------------------------------------------------------------------
@@ -425,7 +254,7 @@ void BurnYM3812UpdateRequest(INT32, INT32)
 	if (!DebugSnd_YM3812Initted) bprintf(PRINT_ERROR, _T("BurnYM3812UpdateRequest called without init\n"));
 #endif
 
-	YM3812Render(BurnYM3812StreamCallback(nBurnYM3812SoundRate));
+	stream.update();
 }
 
 // ----------------------------------------------------------------------------
@@ -456,10 +285,9 @@ void BurnYM3812Exit()
 
 	BurnTimerExitYM3812();
 
-	BurnFree(pBuffer);
+	stream.exit();
 	
 	nNumChips = 0;
-	bYM3812AddSignal = 0;
 	
 	DebugSnd_YM3812Initted = 0;
 }
@@ -478,16 +306,12 @@ INT32 BurnYM3812Init(INT32 num, INT32 nClockFrequency, OPL_IRQHANDLER IRQCallbac
 	BurnTimerInitYM3812(&YM3812TimerOver, NULL);
 
 	if (nBurnSoundRate <= 0) {
-		BurnYM3812StreamCallback = YM3812StreamCallbackDummy;
-
 		BurnYM3812Update = YM3812UpdateDummy;
 
 		YM3812Init(num, nClockFrequency, 11025);
 		return 0;
 	}
 
-	BurnYM3812StreamCallback = StreamCallback;
-
 	if (nFMInterpolation == 3) {
 		// Set YM3812 core samplerate to match the hardware
 		nBurnYM3812SoundRate = nClockFrequency / 72;
@@ -495,40 +319,22 @@ INT32 BurnYM3812Init(INT32 num, INT32 nClockFrequency, OPL_IRQHANDLER IRQCallbac
 		while (nBurnYM3812SoundRate > nBurnSoundRate * 3) {
 			nBurnYM3812SoundRate >>= 1;
 		}
-
-		BurnYM3812Update = YM3812UpdateResample;
-
-		nSampleSize = (UINT32)nBurnYM3812SoundRate * (1 << 16) / nBurnSoundRate;
-		nFractionalPosition = 0;
 	} else {
 		nBurnYM3812SoundRate = nBurnSoundRate;
-
-		BurnYM3812Update = YM3812UpdateNormal;
 	}
 
+	BurnYM3812Update = YM3812UpdateStream;
+
 	YM3812Init(num, nClockFrequency, nBurnYM3812SoundRate);
 	YM3812SetIRQHandler(0, IRQCallback, 0);
 	YM3812SetTimerHandler(0, &BurnOPLTimerCallbackYM3812, 0);
 	YM3812SetUpdateHandler(0, &BurnYM3812UpdateRequest, 0);
 
-	pBuffer = (INT16*)BurnMalloc(4096 * num * sizeof(INT16));
-	memset(pBuffer, 0, 4096 * num * sizeof(INT16));
-
-	nYM3812Position = 0;
-
-	nFractionalPosition = 0;
-	
 	nNumChips = num;
-	bYM3812AddSignal = bAddSignal;
-	
-	// default routes
-	YM3812Volumes[BURN_SND_YM3812_ROUTE] = 1.00;
-	YM3812RouteDirs[BURN_SND_YM3812_ROUTE] = BURN_SND_ROUTE_BOTH;
-	
-	if (nNumChips > 0) {
-		YM3812Volumes[1 + BURN_SND_YM3812_ROUTE] = 1.00;
-		YM3812RouteDirs[1 + BURN_SND_YM3812_ROUTE] = BURN_SND_ROUTE_BOTH;
-	}
+
+	// one mono channel per chip, routed to both sides at 1.00
+	stream.init(nBurnYM3812SoundRate, nBurnSoundRate, nNumChips, bAddSignal, YM3812StreamUpdate);
+	stream.set_sync(StreamCallback);
 
 	return 0;
 }
@@ -541,15 +347,7 @@ void BurnYM3812SetRoute(INT32 nChip, INT32 nIndex, double nVolume, INT32 nRouteD
 	if (nChip >= nNumChips) bprintf(PRINT_ERROR, _T("BurnYM3812SetRoute called with invalid chip %i\n"), nChip);
 #endif
 	
-	if (nChip == 0) {
-		YM3812Volumes[nIndex] = nVolume;
-		YM3812RouteDirs[nIndex] = nRouteDir;
-	}
-	
-	if (nChip == 1) {
-		YM3812Volumes[1 + nIndex] = nVolume;
-		YM3812RouteDirs[1 + nIndex] = nRouteDir;
-	}
+	stream.set_route(nChip + nIndex, nVolume, nRouteDir);
 }
 
 void BurnYM3812Scan(INT32 nAction, INT32* pnMin)
@@ -561,7 +359,5 @@ void BurnYM3812Scan(INT32 nAction, INT32* pnMin)
 	BurnTimerScanYM3812(nAction, pnMin);
 	FMOPLScan(FM_OPL_SAVESTATE_YM3812, 0, nAction, pnMin);
 	
-	if (nAction & ACB_DRIVER_DATA) {
-		SCAN_VAR(nYM3812Position);
-	}
+	stream.scan(nAction, pnMin);
 }
@@ -37,6 +37,8 @@ static void YMF262Render(INT32 nSegmentLength)
 	if (!DebugSnd_YMF262Initted) bprintf(PRINT_ERROR, _T("YMF262Render called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nYMF262Position >= nSegmentLength) {
 		return;
 	}
@@ -78,6 +80,8 @@ void BurnYMF262Update(INT32 nSegmentEnd)
 	if (!DebugSnd_YMF262Initted) bprintf(PRINT_ERROR, _T("BurnYMF262Update called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT16* pSoundBuf = pBurnSoundOut;
 
 	if (nBurnSoundRate == 0 || pBurnSoundOut == NULL) {
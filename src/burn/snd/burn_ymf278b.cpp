@@ -37,6 +37,8 @@ static void YMF278BRender(INT32 nSegmentLength)
 	if (!DebugSnd_YMF278BInitted) bprintf(PRINT_ERROR, _T("YMF278BRender called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nYMF278BPosition >= nSegmentLength) {
 		return;
 	}
@@ -78,6 +80,8 @@ void BurnYMF278BUpdate(INT32 nSegmentEnd)
 	if (!DebugSnd_YMF278BInitted) bprintf(PRINT_ERROR, _T("BurnYMF278BUpdate called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT16* pSoundBuf = pBurnSoundOut;
 
 	if (nBurnSoundRate == 0 || pBurnSoundOut == NULL) {
@@ -219,6 +219,8 @@ void c140_scan(INT32 nAction, INT32 *)
 
 void c140_update(INT16 *outputs, INT32 samples_len)
 {
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32   rvol,lvol;
 	INT32   dt;
 	INT32   sdt;
@@ -396,6 +396,8 @@ void c6280_update(INT16 *pBuffer, INT32 samples)
 	if (!DebugSnd_C6280Initted) bprintf(PRINT_ERROR, _T("c6280_update called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	c6280_t *p = &chip[0];
 
 	c6280_stream_update();
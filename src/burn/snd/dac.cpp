@@ -120,6 +120,8 @@ void DACUpdate(INT16* Buffer, INT32 Length)
 	if (!DebugSnd_DACInitted) bprintf(PRINT_ERROR, _T("DACUpdate called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	struct dac_info *ptr;
 
 	for (INT32 i = 0; i < NumChips; i++) {
@@ -875,6 +875,8 @@ void ES5506Update(INT16 *outputs, INT32 samples_len)
 	if (!DebugSnd_ES5506Initted) bprintf(PRINT_ERROR, _T("ES5506Update called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (samples_len != nBurnSoundLen) {
 		bprintf(0, _T("ES550XUpdate(): once per frame, please!\n"));
 		return;
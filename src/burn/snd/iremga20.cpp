@@ -77,6 +77,8 @@ void iremga20_update(INT32 device, INT16 *buffer, INT32 length)
 	if (device > nNumChips) bprintf(PRINT_ERROR, _T("iremga20_update called with invalid chip %x\n"), device);
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	chip = &chips[device];
 	UINT32 rate[4], pos[4], frac[4], end[4], vol[4], play[4];
 	UINT8 *pSamples;
@@ -74,6 +74,8 @@ void K007232Update(INT32 chip, INT16* pSoundBuf, INT32 nLength)
 	if (chip >nNumChips) bprintf(PRINT_ERROR, _T("K007232Update called with invalid chip %x\n"), chip);
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	INT32 i;
 
 	Chip = &Chips[chip];
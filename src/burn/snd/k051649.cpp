@@ -89,6 +89,8 @@ void K051649Update(INT16 *pBuf, INT32 samples)
 	if (!DebugSnd_K051649Initted) bprintf(PRINT_ERROR, _T("K051649Update called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	info = &Chips[0];
 	k051649_sound_channel *voice=info->channel_list;
 	INT16 *mix;
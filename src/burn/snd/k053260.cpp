@@ -159,6 +159,8 @@ void K053260Update(INT32 chip, INT16 *pBuf, INT32 length)
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("K053260Update called with invalid chip %x\n"), chip);
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	static const INT8 dpcmcnv[] = { 0,1,2,4,8,16,32,64, -128, -64, -32, -16, -8, -4, -2, -1};
 	// Pan multipliers.  Set according to integer angles in degrees, amusingly.
 	// Exact precision hard to know, the floating point-ish output format makes
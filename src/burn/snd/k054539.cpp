@@ -522,6 +522,8 @@ void K054539Update(INT32 chip, INT16 *outputs, INT32 samples_len)
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("K054539Update called with invalid chip %x\n"), chip);
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	info = &Chips[chip];
 #define VOL_CAP 1.80
 
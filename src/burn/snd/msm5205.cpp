@@ -189,6 +189,8 @@ void MSM5205Render(INT32 chip, INT16 *buffer, INT32 len)
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("MSM5205Render called with invalid chip %x\n"), chip);
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	voice = &chips[chip];
 	INT16 *source = stream[chip];
 
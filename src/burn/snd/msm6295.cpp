@@ -102,8 +102,7 @@ static INT32 MSM6295StepShift[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
 
 static INT32* MSM6295ChannelData[MAX_MSM6295][4];
 
-static INT32* pLeftBuffer = NULL;
-static INT32* pRightBuffer = NULL;
+static INT32* pBuffer = NULL;				// both sides, interleaved
 
 static INT32 nPreviousSample[MAX_MSM6295], nCurrentSample[MAX_MSM6295];
 
@@ -160,7 +159,7 @@ void MSM6295Scan(INT32 , INT32 *)
 	}
 }
 
-static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf, INT32 nSegmentLength)
+static void MSM6295Render_Linear(INT32 nChip, INT32* pBuf, INT32 nSegmentLength)
 {
 	INT32 nVolume = MSM6295[nChip].nVolume;
 	INT32 nFractionalPosition = MSM6295[nChip].nFractionalPosition;
@@ -243,11 +242,12 @@ static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf,
 		nSample *= nVolume;
 
 		if ((MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			*pLeftBuf++ += nSample;
+			pBuf[0] += nSample;
 		}
 		if ((MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			*pRightBuf++ += nSample;
+			pBuf[1] += nSample;
 		}
+		pBuf += 2;
 
 		nFractionalPosition += MSM6295[nChip].nSampleSize;
 	}
@@ -256,7 +256,7 @@ static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf,
 }
 
 #if CUBIC_ENABLED
-static void MSM6295Render_Cubic(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf, INT32 nSegmentLength)
+static void MSM6295Render_Cubic(INT32 nChip, INT32* pBuf, INT32 nSegmentLength)
 {
 	INT32 nVolume = MSM6295[nChip].nVolume;
 	INT32 nFractionalPosition;
@@ -364,13 +364,13 @@ static void MSM6295Render_Cubic(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf,
 
 		nOutput *= nVolume;
 
-		//*pLeftBuf++ += nOutput;
 		if ((MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			*pLeftBuf++ += nOutput;
+			pBuf[0] += nOutput;
 		}
 		if ((MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			*pRightBuf++ += nOutput;
+			pBuf[1] += nOutput;
 		}
+		pBuf += 2;
 
 		MSM6295[nChip].nFractionalPosition = (MSM6295[nChip].nFractionalPosition & 0x0FFF) + MSM6295[nChip].nSampleSize;
 	}
@@ -384,31 +384,27 @@ INT32 MSM6295Render(INT32 nChip, INT16* pSoundBuf, INT32 nSegmentLength) // rend
 	if (nChip > nLastMSM6295Chip) bprintf(PRINT_ERROR, _T("MSM6295Render called with invalid chip number %x\n"), nChip);
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (nChip == 0) {
-		memset(pLeftBuffer, 0, nSegmentLength * sizeof(INT32));
-		memset(pRightBuffer, 0, nSegmentLength * sizeof(INT32));
+		memset(pBuffer, 0, nSegmentLength * 2 * sizeof(INT32));
 	}
 
 #if CUBIC_ENABLED
 	if (nInterpolation >= 3) {
-		MSM6295Render_Cubic(nChip, pLeftBuffer, pRightBuffer, nSegmentLength);
+		MSM6295Render_Cubic(nChip, pBuffer, nSegmentLength);
 	} else {
-		MSM6295Render_Linear(nChip, pLeftBuffer, pRightBuffer, nSegmentLength);
+		MSM6295Render_Linear(nChip, pBuffer, nSegmentLength);
 	}
 #else
-	MSM6295Render_Linear(nChip, pLeftBuffer, pRightBuffer, nSegmentLength);
+	MSM6295Render_Linear(nChip, pBuffer, nSegmentLength);
 #endif
 
 	if (nChip == nLastMSM6295Chip)	{
-		for (INT32 i = 0; i < nSegmentLength; i++) {
-			if (bAdd) {
-				pSoundBuf[0] = BURN_SND_CLIP(pSoundBuf[0] + (pLeftBuffer[i] >> 8));
-				pSoundBuf[1] = BURN_SND_CLIP(pSoundBuf[1] + (pRightBuffer[i] >> 8));
-			} else {
-				pSoundBuf[0] = BURN_SND_CLIP(pLeftBuffer[i] >> 8);
-				pSoundBuf[1] = BURN_SND_CLIP(pRightBuffer[i] >> 8);
-			}
-			pSoundBuf += 2;
+		if (bAdd) {
+			BurnSoundKernel.CopyClamp_Add(pBuffer, pSoundBuf, nSegmentLength);
+		} else {
+			BurnSoundKernel.CopyClamp(pBuffer, pSoundBuf, nSegmentLength);
 		}
 	}
 
@@ -515,10 +511,8 @@ void MSM6295Exit(INT32 nChip)
 
 	if (!DebugSnd_MSM6295Initted) return;
 
-	if (pLeftBuffer) BurnFree(pLeftBuffer);
-	if (pRightBuffer) BurnFree(pRightBuffer);
-	pLeftBuffer = NULL;
-	pRightBuffer = NULL;
+	if (pBuffer) BurnFree(pBuffer);
+	pBuffer = NULL;
 
 	for (INT32 nChannel = 0; nChannel < 4; nChannel++) {
 		BurnFree(MSM6295ChannelData[nChip][nChannel]);
@@ -553,11 +547,8 @@ INT32 MSM6295Init(INT32 nChip, INT32 nSamplerate, bool bAddSignal)
 	DebugSnd_MSM6295Initted = 1;
 	
 	if (nBurnSoundRate > 0) {
-		if (pLeftBuffer == NULL) {
-			pLeftBuffer = (INT32*)BurnMalloc(nBurnSoundRate * sizeof(INT32));
-		}
-		if (pRightBuffer == NULL) {
-			pRightBuffer = (INT32*)BurnMalloc(nBurnSoundRate * sizeof(INT32));
+		if (pBuffer == NULL) {
+			pBuffer = (INT32*)BurnMalloc(nBurnSoundRate * 2 * sizeof(INT32));
 		}
 	}
 
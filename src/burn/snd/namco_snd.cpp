@@ -116,6 +116,8 @@ void NamcoSoundUpdate(INT16* pSoundBuf, INT32 Length)
 	if (!DebugSnd_NamcoSndInitted) bprintf(PRINT_ERROR, _T("NamcoSoundUpdate called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (namco_buffered) {
 		if (Length != nBurnSoundLen) {
 			bprintf(0, _T("NamcoSoundUpdate() in buffered mode must be called once per frame!\n"));
@@ -836,6 +836,8 @@ void nesapuUpdate(INT32 chip, INT16 *buffer, INT32 samples)
 	if (!DebugSnd_NESAPUSndInitted) bprintf(PRINT_ERROR, _T("nesapuUpdate called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	struct nesapu_info *info = &nesapu_chips[chip];
 
 	if (pBurnSoundOut == NULL) {
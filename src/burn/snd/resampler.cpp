@@ -0,0 +1,162 @@
+// Polyphase resampler
+//
+// For frontends that run the core at a fixed internal rate (where the chips don't
+// need to interpolate, or do it once to a high rate) and convert to the host rate
+// at the end of the chain. A Kaiser windowed sinc with RESAMPLER_TAPS taps, the
+// coefficients for RESAMPLER_PHASES positions between two input samples are
+// precalculated and the output is interpolated between the two nearest phases, so
+// the ratio can be changed on the fly for dynamic rate control without rebuilding
+// the table.
+
+#include "burnint.h"
+#include "resampler.h"
+#include <math.h>
+
+#define RESAMPLER_BUFFER	2048			// input samples per pass, plus the taps
+#define RESAMPLER_BETA		8.0
+
+static double BesselI0(double x)
+{
+	double dSum = 1.0, dTerm = 1.0;
+
+	for (INT32 k = 1; k < 32; k++) {
+		dTerm *= (x / (2.0 * k)) * (x / (2.0 * k));
+		dSum += dTerm;
+		if (dTerm < dSum * 1e-12) break;
+	}
+
+	return dSum;
+}
+
+void Resampler::init(INT32 nRateIn_, INT32 nRateOut_)
+{
+	nRateIn = nRateIn_;
+	nRateOut = nRateOut_;
+
+	// below the lower of the two nyquist frequencies, with room for the transition band
+	double dCutoff = 0.90 * ((nRateOut < nRateIn) ? (double)nRateOut / nRateIn : 1.0);
+	double dNorm = BesselI0(RESAMPLER_BETA);
+
+	pTable = (INT16*)BurnMalloc((RESAMPLER_PHASES + 1) * RESAMPLER_TAPS * sizeof(INT16));
+
+	for (INT32 p = 0; p <= RESAMPLER_PHASES; p++) {
+		double dTap[RESAMPLER_TAPS];
+		double dSum = 0.0;
+
+		for (INT32 k = 0; k < RESAMPLER_TAPS; k++) {
+			// distance from the output position, which is p / RESAMPLER_PHASES after the centre tap
+			double d = k - (RESAMPLER_TAPS / 2 - 1) - (double)p / RESAMPLER_PHASES;
+			double t = d / (RESAMPLER_TAPS / 2);
+			double x = M_PI * d * dCutoff;
+
+			double dSinc = (x == 0.0) ? 1.0 : sin(x) / x;
+			double dWindow = (t * t < 1.0) ? BesselI0(RESAMPLER_BETA * sqrt(1.0 - t * t)) / dNorm : 0.0;
+
+			dTap[k] = dSinc * dWindow;
+			dSum += dTap[k];
+		}
+
+		// unity gain for every phase, so there's no ripple on a dc offset
+		for (INT32 k = 0; k < RESAMPLER_TAPS; k++) {
+			pTable[p * RESAMPLER_TAPS + k] = (INT16)floor(dTap[k] / dSum * 16384.0 + 0.5);
+		}
+	}
+
+	nBufferLen = RESAMPLER_BUFFER + RESAMPLER_TAPS;
+	pBuffer = (INT16*)BurnMalloc(nBufferLen * 2 * sizeof(INT16));
+
+	set_ratio(1.0);
+	reset();
+}
+
+void Resampler::exit()
+{
+	BurnFree(pTable);
+	BurnFree(pBuffer);
+}
+
+void Resampler::reset()
+{
+	if (pBuffer == NULL) return;
+
+	// silence up to the centre tap, so the first output sample is the first input sample
+	memset(pBuffer, 0, nBufferLen * 2 * sizeof(INT16));
+	nBuffered = RESAMPLER_TAPS / 2 - 1;
+	nFractional = 0;
+}
+
+void Resampler::set_ratio(double dRatio)
+{
+	if (nRateOut <= 0 || dRatio <= 0.0) return;
+
+	nStep = (UINT64)((double)nRateIn / (nRateOut * dRatio) * 4294967296.0);
+
+	// a step past the end of the taps would need samples that aren't buffered yet
+	if (nStep >= ((UINT64)RESAMPLER_TAPS << 32)) {
+		nStep = ((UINT64)RESAMPLER_TAPS << 32) - 1;
+	}
+}
+
+INT32 Resampler::max_output(INT32 nIn, double dMaxRatio)
+{
+	if (nRateIn <= 0) return 0;
+
+	return (INT32)((double)(nIn + RESAMPLER_TAPS) * nRateOut * dMaxRatio / nRateIn) + 1;
+}
+
+INT32 Resampler::process(const INT16* pIn, INT32 nIn, INT16* pOut, INT32 nOutMax)
+{
+	if (pTable == NULL || pBuffer == NULL) return 0;
+
+	INT32 nOut = 0;
+
+	while (1) {
+		INT32 nCopy = nBufferLen - nBuffered;
+		if (nCopy > nIn) nCopy = nIn;
+
+		memcpy(pBuffer + nBuffered * 2, pIn, nCopy * 2 * sizeof(INT16));
+		pIn += nCopy * 2;
+		nIn -= nCopy;
+		nBuffered += nCopy;
+
+		INT32 nRead = 0;
+
+		while (nRead + RESAMPLER_TAPS <= nBuffered && nOut < nOutMax) {
+			const INT16* pSrc = pBuffer + nRead * 2;
+			const INT16* pTap0 = pTable + (nFractional >> 24) * RESAMPLER_TAPS;
+			const INT16* pTap1 = pTap0 + RESAMPLER_TAPS;
+
+			INT32 nLeft0 = 0, nRight0 = 0, nLeft1 = 0, nRight1 = 0;
+
+			for (INT32 k = 0; k < RESAMPLER_TAPS; k++) {
+				nLeft0  += pSrc[k * 2 + 0] * pTap0[k];
+				nRight0 += pSrc[k * 2 + 1] * pTap0[k];
+				nLeft1  += pSrc[k * 2 + 0] * pTap1[k];
+				nRight1 += pSrc[k * 2 + 1] * pTap1[k];
+			}
+
+			INT32 nSub = (nFractional >> 16) & 0xff;
+			INT32 nLeft  = (INT32)((nLeft0  + ((((INT64)nLeft1  - nLeft0)  * nSub) >> 8)) >> 14);
+			INT32 nRight = (INT32)((nRight0 + ((((INT64)nRight1 - nRight0) * nSub) >> 8)) >> 14);
+
+			pOut[nOut * 2 + 0] = BURN_SND_CLIP(nLeft);
+			pOut[nOut * 2 + 1] = BURN_SND_CLIP(nRight);
+			nOut++;
+
+			UINT64 nPos = (UINT64)nFractional + nStep;
+			nRead += (INT32)(nPos >> 32);
+			nFractional = (UINT32)nPos;
+		}
+
+		if (nRead > nBuffered) nRead = nBuffered;
+
+		memmove(pBuffer, pBuffer + nRead * 2, (nBuffered - nRead) * 2 * sizeof(INT16));
+		nBuffered -= nRead;
+
+		if (nIn <= 0 || nOut >= nOutMax) {
+			break;
+		}
+	}
+
+	return nOut;
+}
@@ -0,0 +1,33 @@
+// Polyphase resampler, see resampler.cpp
+
+#define RESAMPLER_TAPS			32
+#define RESAMPLER_PHASES		256
+
+class Resampler
+{
+public:
+	void init(INT32 nRateIn, INT32 nRateOut);
+	void exit();
+	void reset();
+
+	// output rate multiplier for dynamic rate control, > 1.0 gives more samples per input sample
+	void set_ratio(double dRatio);
+
+	// stereo in, stereo out, returns the number of samples written to pOut
+	INT32 process(const INT16* pIn, INT32 nIn, INT16* pOut, INT32 nOutMax);
+
+	// the most samples process() can give back for nIn input samples at a ratio up to dMaxRatio
+	INT32 max_output(INT32 nIn, double dMaxRatio);
+
+private:
+	INT32 nRateIn;
+	INT32 nRateOut;
+
+	INT16* pTable;						// (RESAMPLER_PHASES + 1) * RESAMPLER_TAPS, .14 fixed point
+	INT16* pBuffer;						// input waiting to be filtered, stereo
+	INT32 nBufferLen;
+	INT32 nBuffered;
+
+	UINT32 nFractional;					// position between pBuffer[0] and pBuffer[1], .32
+	UINT64 nStep;						// nRateIn / nRateOut, 32.32
+};
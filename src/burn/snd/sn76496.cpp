@@ -90,6 +90,8 @@ void SN76496Update(INT32 Num, INT16* pSoundBuf, INT32 Length)
 	if (Num > NumChips) bprintf(PRINT_ERROR, _T("SN76496Update called with invalid chip %x\n"), Num);
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	if (Num >= MAX_SN76496_CHIPS) return;
 
 	struct SN76496 *R = Chips[Num];
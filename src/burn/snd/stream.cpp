@@ -0,0 +1,243 @@
+// Shared sound stream
+//
+// A chip renders into the stream at its own rate, either lazily (update() from
+// the register write handlers, synced to the cpu with the same callback the FM
+// wrappers use) or on demand when the frame's sound is rendered. The channels are
+// routed and mixed as they come in (summed at 32 bits, then clamped with
+// BurnSoundKernel), so render() only has one interleaved stereo pair to run
+// through the 4-point resampler no matter how many outputs the chip has.
+//
+// The position pSync returns starts again from 0 every frame, so the stream
+// moves its own frame base on the first update() or render() of each new
+// nCurrentFrame. Whatever a frame rendered and nobody read (sound off, or a
+// frame run without output) is dropped then, rather than piling up in pMix.
+
+#include "burnint.h"
+#include "burn_sound.h"
+#include "stream.h"
+
+#define STREAM_HISTORY		3			// samples before the read position the resampler needs
+#define STREAM_CHUNK		256
+
+void Stream::init(INT32 nRateFrom_, INT32 nRateTo, INT32 nChannels_, INT32 bAddSignal_, void (*pUpdate_)(INT16** ppStreams, INT32 nSamples))
+{
+	if (nChannels_ > STREAM_MAX_CHANNELS) nChannels_ = STREAM_MAX_CHANNELS;
+
+	nRateFrom = nRateFrom_;
+	nChannels = nChannels_;
+	bAddSignal = bAddSignal_;
+	pUpdate = pUpdate_;
+	pSync = NULL;
+
+	nStep = (UINT32)((UINT64)nRateFrom * 0x10000 / nRateTo);
+
+	// room for a frame of 100ms, plus the resampler's history
+	nBufferLen = nRateFrom / 10 + 64;
+
+	pMem = (INT16*)BurnMalloc((nChannels + 2) * nBufferLen * sizeof(INT16));
+	memset(pMem, 0, (nChannels + 2) * nBufferLen * sizeof(INT16));
+
+	for (INT32 i = 0; i < nChannels; i++) {
+		pChannel[i] = pMem + (2 + i) * nBufferLen;
+		set_route(i, 1.00, BURN_SND_ROUTE_BOTH);
+	}
+	pMix = pMem;
+
+	nPosition = STREAM_HISTORY;
+	nFractional = STREAM_HISTORY << 16;
+	nOutputPos = 0;
+	nFrameSamples = 0;
+	nFrame = nCurrentFrame;
+	bRead = 0;
+}
+
+void Stream::exit()
+{
+	BurnFree(pMem);
+
+	for (INT32 i = 0; i < STREAM_MAX_CHANNELS; i++) {
+		pChannel[i] = NULL;
+	}
+	pMix = NULL;
+
+	pUpdate = NULL;
+	pSync = NULL;
+}
+
+void Stream::set_sync(INT32 (*pSync_)(INT32 nSoundRate))
+{
+	pSync = pSync_;
+}
+
+void Stream::set_route(INT32 nChannel, double nVolume, INT32 nRouteDir)
+{
+	if (nChannel < 0 || nChannel >= nChannels) return;
+
+	INT32 nVol = (INT32)(nVolume * 256.0 + 0.5);
+
+	nGain[nChannel][0] = (nRouteDir & BURN_SND_ROUTE_LEFT) ? nVol : 0;
+	nGain[nChannel][1] = (nRouteDir & BURN_SND_ROUTE_RIGHT) ? nVol : 0;
+}
+
+void Stream::new_frame()
+{
+	if (nFrame == nCurrentFrame) {
+		return;
+	}
+
+	nFrame = nCurrentFrame;
+
+	if (bRead == 0) {
+		// last frame's samples were never output, don't play them late
+		nPosition = nFractional >> 16;
+	}
+
+	// anything rendered past the end of the last frame belongs to this one
+	nFrameSamples = nPosition - (nFractional >> 16);
+	nOutputPos = 0;
+	bRead = 0;
+}
+
+void Stream::render_native(INT32 nSamples)
+{
+	if (nPosition + nSamples > nBufferLen) {
+		nSamples = nBufferLen - nPosition;
+	}
+	if (nSamples <= 0 || pUpdate == NULL) {
+		return;
+	}
+
+	pUpdate(pChannel, nSamples);
+
+	// route and mix, a chunk at a time so the loops stay simple enough to vectorise
+	for (INT32 nDone = 0; nDone < nSamples; nDone += STREAM_CHUNK) {
+		INT32 nLen = nSamples - nDone;
+		if (nLen > STREAM_CHUNK) nLen = STREAM_CHUNK;
+
+		INT32 nSum[STREAM_CHUNK * 2];
+
+		memset(nSum, 0, nLen * 2 * sizeof(INT32));
+
+		for (INT32 c = 0; c < nChannels; c++) {
+			const INT16* pSrc = pChannel[c] + nDone;
+			const INT32 nGainL = nGain[c][0];
+			const INT32 nGainR = nGain[c][1];
+
+			for (INT32 i = 0; i < nLen; i++) {
+				nSum[i * 2 + 0] += pSrc[i] * nGainL;
+				nSum[i * 2 + 1] += pSrc[i] * nGainR;
+			}
+		}
+
+		BurnSoundKernel.CopyClamp(nSum, pMix + (nPosition + nDone) * 2, nLen);
+	}
+
+	nPosition += nSamples;
+	nFrameSamples += nSamples;
+}
+
+void Stream::update()
+{
+	if (pSync == NULL || pMem == NULL) {
+		return;
+	}
+
+	new_frame();
+
+	render_native(pSync(nRateFrom) - nFrameSamples);
+}
+
+void Stream::render(INT16* pSoundBuf, INT32 nSamples)
+{
+	if (pMem == NULL || nSamples <= 0) {
+		return;
+	}
+
+	new_frame();
+	bRead = 1;
+
+	// everything up to the last output sample's newest tap
+	INT32 nNeeded = ((nFractional + (UINT32)(nSamples - 1) * nStep) >> 16) + 1;
+
+	if (nNeeded > nBufferLen && nSamples > 1) {
+		INT32 nHalf = nSamples / 2;
+
+		render(pSoundBuf, nHalf);
+		render(pSoundBuf + nHalf * 2, nSamples - nHalf);
+		return;
+	}
+
+	render_native(nNeeded - nPosition);
+
+	if (nPosition < nNeeded) {
+		// no update callback, hold the last sample
+		for (INT32 i = nPosition; i < nNeeded; i++) {
+			pMix[i * 2 + 0] = pMix[(nPosition - 1) * 2 + 0];
+			pMix[i * 2 + 1] = pMix[(nPosition - 1) * 2 + 1];
+		}
+		nPosition = nNeeded;
+	}
+
+	if (nStep == 0x10000 && (nFractional & 0xffff) == 0) {
+		// same rate, the interpolation would give back the sample two behind the read position
+		const INT16* pSrc = pMix + ((nFractional >> 16) - 2) * 2;
+
+		if (bAddSignal) {
+			for (INT32 i = 0; i < nSamples * 2; i++) {
+				pSoundBuf[i] = BURN_SND_CLIP(pSoundBuf[i] + pSrc[i]);
+			}
+		} else {
+			memcpy(pSoundBuf, pSrc, nSamples * 2 * sizeof(INT16));
+		}
+
+		nFractional += nSamples << 16;
+	} else {
+		UINT32 nPos = nFractional;
+
+		for (INT32 i = 0; i < nSamples; i++, nPos += nStep) {
+			const INT16* pTable = Precalc + ((nPos >> 4) & 0x0fff) * 4;
+			const INT16* pSrc = pMix + ((nPos >> 16) - 3) * 2;
+
+			INT32 nSampleL = (pSrc[0] * pTable[0] + pSrc[2] * pTable[1] + pSrc[4] * pTable[2] + pSrc[6] * pTable[3]) / 16384;
+			INT32 nSampleR = (pSrc[1] * pTable[0] + pSrc[3] * pTable[1] + pSrc[5] * pTable[2] + pSrc[7] * pTable[3]) / 16384;
+
+			if (bAddSignal) {
+				nSampleL += pSoundBuf[i * 2 + 0];
+				nSampleR += pSoundBuf[i * 2 + 1];
+			}
+
+			pSoundBuf[i * 2 + 0] = BURN_SND_CLIP(nSampleL);
+			pSoundBuf[i * 2 + 1] = BURN_SND_CLIP(nSampleR);
+		}
+
+		nFractional = nPos;
+	}
+
+	// keep the history and whatever was rendered ahead, drop the rest
+	INT32 nDrop = (nFractional >> 16) - STREAM_HISTORY;
+
+	if (nDrop > 0) {
+		memmove(pMix, pMix + nDrop * 2, (nPosition - nDrop) * 2 * sizeof(INT16));
+
+		nPosition -= nDrop;
+		nFractional -= nDrop << 16;
+	}
+
+	nOutputPos += nSamples;
+}
+
+void Stream::render_to(INT16* pSoundBuf, INT32 nSegmentEnd)
+{
+	if (nSegmentEnd > nBurnSoundLen) {
+		nSegmentEnd = nBurnSoundLen;
+	}
+
+	render(pSoundBuf + nOutputPos * 2, nSegmentEnd - nOutputPos);
+}
+
+void Stream::scan(INT32 nAction, INT32*)
+{
+	if (nAction & ACB_DRIVER_DATA) {
+		SCAN_VAR(nFrameSamples);
+	}
+}
@@ -0,0 +1,50 @@
+// Shared sound stream, see stream.cpp
+
+#define STREAM_MAX_CHANNELS		8
+
+class Stream
+{
+public:
+	// pUpdate renders nSamples at nRateFrom into each of the nChannels buffers
+	void init(INT32 nRateFrom, INT32 nRateTo, INT32 nChannels, INT32 bAddSignal, void (*pUpdate)(INT16** ppStreams, INT32 nSamples));
+	void exit();
+
+	// same as the FM wrappers' StreamCallback, returns the position in the frame at nSoundRate
+	void set_sync(INT32 (*pSync)(INT32 nSoundRate));
+	void set_route(INT32 nChannel, double nVolume, INT32 nRouteDir);
+
+	// bring the stream up to the current cpu position, call before changing the chip's registers
+	void update();
+
+	// resample and mix nSamples into pSoundBuf (stereo, at nBurnSoundRate)
+	void render(INT16* pSoundBuf, INT32 nSamples);
+	// same, for wrappers whose update takes the end of the segment in pBurnSoundOut
+	void render_to(INT16* pSoundBuf, INT32 nSegmentEnd);
+
+	void scan(INT32 nAction, INT32* pnMin);
+
+private:
+	void new_frame();
+	void render_native(INT32 nSamples);
+
+	INT32 nRateFrom;
+	INT32 nChannels;
+	INT32 bAddSignal;
+	void (*pUpdate)(INT16** ppStreams, INT32 nSamples);
+	INT32 (*pSync)(INT32 nSoundRate);
+
+	INT32 nGain[STREAM_MAX_CHANNELS][2];	// .8 fixed point, 0 if not routed to that side
+
+	INT16* pMem;
+	INT16* pChannel[STREAM_MAX_CHANNELS];	// chip output, before routing
+	INT16* pMix;				// routed and mixed, interleaved stereo at nRateFrom
+	INT32 nBufferLen;
+
+	INT32 nPosition;				// samples in pMix
+	UINT32 nFractional;			// read position in pMix, 16.16
+	UINT32 nStep;				// nRateFrom / nBurnSoundRate, 16.16
+	INT32 nOutputPos;				// output samples done this frame
+	INT32 nFrameSamples;			// samples rendered this frame, for pSync
+	UINT32 nFrame;				// nCurrentFrame the above are for
+	INT32 bRead;				// render() was called this frame
+};
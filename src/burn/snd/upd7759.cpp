@@ -321,6 +321,8 @@ void UPD7759Update(INT32 chip, INT16 *pSoundBuf, INT32 nLength)
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("UPD7759Update called with invalid chip %x\n"), chip);
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	Chip = Chips[chip];
 
 	INT32 ClocksLeft = Chip->clocks_left;
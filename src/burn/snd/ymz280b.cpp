@@ -506,6 +506,8 @@ INT32 YMZ280BRender(INT16* pSoundBuf, INT32 nSegmentLength)
 	if (!DebugSnd_YMZ280BInitted) bprintf(PRINT_ERROR, _T("YMZ280BRender called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_SOUND);
+
 	memset(pBuffer, 0, nSegmentLength * 2 * sizeof(INT32));
 
 	for (nActiveChannel = 0; nActiveChannel < 8; nActiveChannel++) {
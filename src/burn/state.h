@@ -15,6 +15,24 @@
 /* Scan driver data */
 INT32 BurnAreaScan(INT32 nAction, INT32* pnMin);
 
+/* Delta states - only the blocks changed since the reference snapshot (state_delta.cpp) */
+INT32 BurnStateDeltaInit(INT32 nAction);
+INT32 BurnStateDeltaSave(UINT8** ppDelta, INT32* pnDeltaLen);
+INT32 BurnStateDeltaApply(UINT8* pDelta, INT32 nDeltaLen, INT32 bLoad);
+INT32 BurnStateDeltaGetReference(UINT8** ppRef, INT32* pnRefLen);
+void BurnStateDeltaExit();
+
+/* Cached area list - saves copy straight from the areas the last scan found (state_cache.cpp) */
+INT32 BurnStateCacheSave(INT32 nAction, UINT8* pDest, INT32 nLen);
+INT32 BurnStateCacheLoad(INT32 nAction, const UINT8* pSrc, INT32 nLen);
+INT32 BurnStateCacheLen(INT32 nAction);
+void BurnStateCacheAllow();
+void BurnStateCacheInvalidate();
+void BurnStateCacheScanOnSave();
+void BurnStateCacheInit();
+void BurnStateCacheExit();
+void BurnStateScanOff(void** ppPointer, void* pBase, INT32 nElementSize, char* szName, INT32 nAction);
+
 /* flags to use for nAction */
 #define ACB_READ		 ( 1)
 #define ACB_WRITE		 ( 2)
@@ -52,7 +70,7 @@ C_INLINE static void ScanVar(void* pv, INT32 nSize, char* szName)
 // scan a variable, chunk of memory, pointerless struct, etc.
 #define SCAN_VAR(x) ScanVar(&x, sizeof(x), #x)
 // scan a memory offset - to safely state-ify pointers (see burn/drv/neogeo/neo_run.cpp or cpu/tlcs900/tlcs900.cpp)
-#define SCAN_OFF(x, y, a) { INT32 n = x - y; ScanVar(&n, sizeof(n), #x); if (a & ACB_WRITE) { x = y + n; } }
+#define SCAN_OFF(x, y, a) BurnStateScanOff((void**)&(x), (y), sizeof(*(x)), #x, (a))
 
 #ifdef OSD_CPU_H
  /* wrappers for the MAME savestate functions (used by the FM sound cores) */
@@ -0,0 +1,341 @@
+// State cache - the driver's area list recorded once, for fast saves
+//
+// The first BurnStateCacheSave() goes through BurnAreaScan() like any other save and
+// records the (Data, nLen) of every area in scan order as it goes. Later saves copy
+// the areas straight from that list without calling into the driver at all, which
+// is what run-ahead, rewind and netplay do every frame.
+//
+// Only drivers that call BurnStateCacheAllow() in their init use the list, for all
+// the others every BurnStateCacheSave() is a plain BurnAreaScan(). Debug builds scan
+// the driver after each cached save as well and complain if the two differ.
+//
+// Loads always go through BurnAreaScan(), the drivers have to see ACB_WRITE to
+// bankswitch, recalculate palettes and so on. BurnStateCacheLoad() checks the list
+// on the way, if the layout doesn't match anymore the next save records it again.
+//
+// Areas on the stack (temporaries) only hold the right value while the driver's
+// scan is running, a driver with any of those keeps scanning for every save. The
+// offset SCAN_OFF() saves is one of those, but the cache keeps the pointer and its
+// base for it and works the offset out itself.
+//
+// A driver whose areas move or change while it runs (a different set of handlers
+// for another cartridge slot, say) calls BurnStateCacheInvalidate(). A scan that
+// does work of its own on ACB_READ (packing a cpu context into a buffer, an
+// autostore, copying vectors out of rom) calls BurnStateCacheScanOnSave() there,
+// so its saves keep going through the driver.
+
+#include "burnint.h"
+
+struct CacheArea {
+	UINT8* pData;
+	UINT32 nLen;
+	void** ppPointer;						// SCAN_OFF(), pData is NULL
+	UINT8* pBase;
+	INT32 nElementSize;
+};
+
+static INT32 nCacheAction = 0;
+static INT32 bCacheAllowed = 0;				// the driver opted in with BurnStateCacheAllow()
+
+static CacheArea* pCacheArea = NULL;		// area list, in scan order
+static INT32 nCacheAreaCount = 0;
+static INT32 nCacheAreaAlloc = 0;
+static UINT32 nCacheLen = 0;				// all areas together
+
+static INT32 bCacheValid = 0;				// the list can be used for saves
+static INT32 bCacheStack = 0;				// an area was on the stack while recording
+static INT32 bCacheScanOnSave = 0;			// a scan asked to be called for every save
+
+static UINT8* pCacheBuf = NULL;				// save/load position while scanning
+static UINT8* pCacheBufEnd = NULL;
+static UINT8* pCacheStackTop = NULL;		// a local in the function that started the scan
+static INT32 nCacheScanPos = 0;
+static INT32 bCacheMismatch = 0;
+
+static void** ppCacheOffPointer = NULL;		// the SCAN_OFF() being scanned
+static UINT8* pCacheOffBase = NULL;
+static INT32 nCacheOffSize = 0;
+
+static INT32 CacheIsOnStack(void* pData)
+{
+	UINT8 nHere = 0;						// deeper than any of the driver's locals
+	UINT8* pLow = &nHere;
+	UINT8* pHigh = pCacheStackTop;
+
+	if (pLow > pHigh) {
+		UINT8* pTemp = pLow; pLow = pHigh; pHigh = pTemp;
+	}
+
+	return ((UINT8*)pData >= pLow && (UINT8*)pData <= pHigh);
+}
+
+static INT32 __cdecl CacheRecordAcb(struct BurnArea* pba)
+{
+	if (pCacheBuf + pba->nLen > pCacheBufEnd) {
+		bCacheMismatch = 1;
+		return 1;
+	}
+
+	memcpy(pCacheBuf, pba->Data, pba->nLen);
+	pCacheBuf += pba->nLen;
+
+	if (nCacheAreaCount >= nCacheAreaAlloc) {
+		INT32 nNewAlloc = nCacheAreaAlloc ? (nCacheAreaAlloc * 2) : 256;
+		CacheArea* pNew = (CacheArea*)realloc(pCacheArea, nNewAlloc * sizeof(CacheArea));
+		if (pNew == NULL) {
+			bCacheStack = 1;				// can't record, just carry on saving
+			return 0;
+		}
+		pCacheArea = pNew;
+		nCacheAreaAlloc = nNewAlloc;
+	}
+
+	CacheArea* pArea = &pCacheArea[nCacheAreaCount++];
+
+	pArea->pData = (UINT8*)pba->Data;
+	pArea->nLen = pba->nLen;
+	pArea->ppPointer = ppCacheOffPointer;
+	pArea->pBase = pCacheOffBase;
+	pArea->nElementSize = nCacheOffSize;
+
+	if (ppCacheOffPointer) {
+		pArea->pData = NULL;
+	} else if (CacheIsOnStack(pba->Data)) {
+		bCacheStack = 1;
+	}
+
+	return 0;
+}
+
+#if defined FBNEO_DEBUG
+static INT32 __cdecl CacheCheckAcb(struct BurnArea* pba)
+{
+	if (pCacheBuf + pba->nLen > pCacheBufEnd) {
+		bCacheMismatch = 1;
+		return 1;
+	}
+
+	memcpy(pCacheBuf, pba->Data, pba->nLen);
+	pCacheBuf += pba->nLen;
+
+	return 0;
+}
+
+// scan the driver into a second buffer and compare it with what the list gave
+static void CacheCheck(INT32 nAction, UINT8* pDest, INT32 nLen)
+{
+	UINT8* pScan = (UINT8*)malloc(nLen);
+	if (pScan == NULL) {
+		return;
+	}
+
+	INT32 (__cdecl *pOldAcb)(struct BurnArea* pba) = BurnAcb;
+
+	pCacheBuf = pScan;
+	pCacheBufEnd = pScan + nLen;
+	bCacheMismatch = 0;
+
+	BurnAcb = CacheCheckAcb;
+	BurnAreaScan(nAction | ACB_READ, NULL);
+	BurnAcb = pOldAcb;
+
+	if (bCacheMismatch || pCacheBuf != pCacheBufEnd || memcmp(pScan, pDest, nLen)) {
+		INT32 nPos = 0;
+		while (nPos < nLen && pScan[nPos] == pDest[nPos]) nPos++;
+
+		bprintf(PRINT_ERROR, _T("*** State cache: cached save differs from the driver's scan at offset 0x%x, caching disabled.\n"), nPos);
+
+		memcpy(pDest, pScan, nLen);
+		bCacheAllowed = 0;
+		bCacheValid = 0;
+	}
+
+	free(pScan);
+}
+#endif
+
+static INT32 __cdecl CacheLoadAcb(struct BurnArea* pba)
+{
+	if (pCacheBuf + pba->nLen > pCacheBufEnd) {
+		bCacheMismatch = 1;
+		return 1;
+	}
+
+	memcpy(pba->Data, pCacheBuf, pba->nLen);
+	pCacheBuf += pba->nLen;
+
+	if (nCacheScanPos >= nCacheAreaCount) {
+		bCacheValid = 0;
+	} else {
+		CacheArea* pArea = &pCacheArea[nCacheScanPos];
+
+		if (pArea->nLen != pba->nLen || pArea->ppPointer != ppCacheOffPointer || pArea->pBase != pCacheOffBase) {
+			bCacheValid = 0;
+		}
+		if (pArea->ppPointer == NULL && pArea->pData != (UINT8*)pba->Data) {
+			bCacheValid = 0;
+		}
+	}
+	nCacheScanPos++;
+
+	return 0;
+}
+
+// SCAN_OFF() - scan a pointer as an offset from pBase
+void BurnStateScanOff(void** ppPointer, void* pBase, INT32 nElementSize, char* szName, INT32 nAction)
+{
+	INT32 n = (INT32)(((UINT8*)*ppPointer - (UINT8*)pBase) / nElementSize);
+
+	ppCacheOffPointer = ppPointer;
+	pCacheOffBase = (UINT8*)pBase;
+	nCacheOffSize = nElementSize;
+
+	ScanVar(&n, sizeof(n), szName);
+
+	ppCacheOffPointer = NULL;
+	pCacheOffBase = NULL;
+	nCacheOffSize = 0;
+
+	if (nAction & ACB_WRITE) {
+		*ppPointer = (UINT8*)pBase + n * nElementSize;
+	}
+}
+
+// Called from a driver's init: its areas stay where they are (or it calls
+// BurnStateCacheInvalidate() when they move) and its scan does nothing of its own on
+// ACB_READ, so its saves can be copied from the list
+void BurnStateCacheAllow()
+{
+	bCacheAllowed = 1;
+}
+
+// The driver's areas have changed, record them again on the next save
+void BurnStateCacheInvalidate()
+{
+	bCacheValid = 0;
+}
+
+// Called from a scan's ACB_READ path when the scan has to run for the save to be right
+void BurnStateCacheScanOnSave()
+{
+	bCacheScanOnSave = 1;
+}
+
+// Size of the state the list describes, or -1 if the next save has to scan anyway
+INT32 BurnStateCacheLen(INT32 nAction)
+{
+	if (!bCacheValid || (nAction & ACB_TYPEMASK) != nCacheAction) {
+		return -1;
+	}
+
+	return nCacheLen;
+}
+
+// Called before the driver's init, saves scan the driver until it opts in
+void BurnStateCacheInit()
+{
+	BurnStateCacheExit();
+
+	bCacheAllowed = 0;
+}
+
+// Forget the list, the next save scans the driver again
+void BurnStateCacheExit()
+{
+	if (pCacheArea) {
+		free(pCacheArea);
+		pCacheArea = NULL;
+	}
+
+	nCacheAreaCount = nCacheAreaAlloc = 0;
+	nCacheLen = 0;
+	nCacheAction = 0;
+	bCacheValid = 0;
+	bCacheStack = 0;
+	bCacheScanOnSave = 0;
+}
+
+// Save the areas covered by nAction (ACB_* type mask) to pDest, nLen must be the size
+// of the state (see BurnAreaScan() with a callback adding up nLen)
+INT32 BurnStateCacheSave(INT32 nAction, UINT8* pDest, INT32 nLen)
+{
+	nAction &= ACB_TYPEMASK;
+
+	if (nAction != nCacheAction) {
+		BurnStateCacheExit();
+		nCacheAction = nAction;
+	}
+
+	if (bCacheValid && nCacheLen == (UINT32)nLen) {
+		for (INT32 i = 0; i < nCacheAreaCount; i++) {
+			CacheArea* pArea = &pCacheArea[i];
+
+			if (pArea->pData) {
+				memcpy(pDest, pArea->pData, pArea->nLen);
+			} else {
+				INT32 n = (INT32)(((UINT8*)*pArea->ppPointer - pArea->pBase) / pArea->nElementSize);
+				memcpy(pDest, &n, sizeof(n));
+			}
+			pDest += pArea->nLen;
+		}
+
+#if defined FBNEO_DEBUG
+		CacheCheck(nAction, pDest - nLen, nLen);
+#endif
+
+		return 0;
+	}
+
+	UINT8 nStackTop = 0;
+
+	INT32 (__cdecl *pOldAcb)(struct BurnArea* pba) = BurnAcb;
+
+	pCacheBuf = pDest;
+	pCacheBufEnd = pDest + nLen;
+	pCacheStackTop = &nStackTop;
+	nCacheAreaCount = 0;
+	bCacheMismatch = 0;
+
+	BurnAcb = CacheRecordAcb;
+	BurnAreaScan(nAction | ACB_READ, NULL);
+	BurnAcb = pOldAcb;
+
+	nCacheLen = pCacheBuf - pDest;
+
+	if (bCacheMismatch || nCacheLen != (UINT32)nLen) {
+		BurnStateCacheExit();
+		return 1;
+	}
+
+	bCacheValid = bCacheAllowed && !bCacheStack && !bCacheScanOnSave;
+
+	return 0;
+}
+
+// Load a state saved by BurnStateCacheSave(), this always scans the driver
+INT32 BurnStateCacheLoad(INT32 nAction, const UINT8* pSrc, INT32 nLen)
+{
+	nAction &= ACB_TYPEMASK;
+
+	INT32 (__cdecl *pOldAcb)(struct BurnArea* pba) = BurnAcb;
+
+	pCacheBuf = (UINT8*)pSrc;
+	pCacheBufEnd = (UINT8*)pSrc + nLen;
+	nCacheScanPos = 0;
+	bCacheMismatch = 0;
+
+	BurnAcb = CacheLoadAcb;
+	BurnAreaScan(nAction | ACB_WRITE, NULL);
+	BurnAcb = pOldAcb;
+
+	if (nAction != nCacheAction || nCacheScanPos != nCacheAreaCount) {
+		bCacheValid = 0;
+	}
+
+	if (bCacheMismatch || pCacheBuf != pCacheBufEnd) {
+		bCacheValid = 0;
+		return 1;
+	}
+
+	return 0;
+}
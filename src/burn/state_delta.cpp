@@ -0,0 +1,391 @@
+// Delta state module - incremental savestates on top of BurnAreaScan()
+//
+// A reference copy of every area is kept (keyed by scan order, name and length).
+// BurnStateDeltaSave() compares the driver's areas against the reference in
+// DELTA_BLOCK_SIZE chunks and only emits the chunks which changed, stored as
+// (new ^ reference).  Because the chunks are xor'ed, the same delta can be applied
+// to step the reference forwards (old -> new) or backwards (new -> old), which
+// makes it usable for both rewind and run-ahead.
+//
+// Delta layout:
+//   header  - UINT32 nAreaCount, UINT32 nRefLen, UINT32 nRecordCount
+//   records - UINT32 nOffset (into reference), UINT32 nLen, nLen bytes of xor data
+
+#include "burnint.h"
+
+#define DELTA_BLOCK_SIZE	256
+#define DELTA_HEADER_SIZE	(3 * sizeof(UINT32))
+#define DELTA_RECORD_SIZE	(2 * sizeof(UINT32))
+
+struct DeltaArea { UINT32 nOffset; UINT32 nLen; UINT32 nNameHash; };
+
+static INT32 nDeltaAction = 0;				// areas covered (ACB_* type mask)
+
+static DeltaArea* pDeltaArea = NULL;		// area table, in scan order
+static INT32 nDeltaAreaCount = 0;
+static INT32 nDeltaAreaAlloc = 0;
+
+static UINT8* pDeltaRef = NULL;				// reference snapshot
+static UINT32 nDeltaRefLen = 0;
+static UINT32 nDeltaRefAlloc = 0;
+
+static UINT8* pDeltaOut = NULL;				// output buffer (worst case sized)
+static UINT32 nDeltaOutLen = 0;
+static UINT32 nDeltaOutFill = 0;
+static UINT32 nDeltaRecords = 0;
+static UINT32 nDeltaLastRecord = 0;			// offset of the last record header in pDeltaOut
+static UINT32 nDeltaLastEnd = 0;			// reference offset the last record ends at
+
+static INT32 nDeltaScanPos = 0;				// area index while scanning
+static INT32 bDeltaMismatch = 0;
+
+static UINT32 DeltaNameHash(const char* szName)
+{
+	UINT32 nHash = 2166136261U;				// FNV-1a
+
+	if (szName == NULL) {
+		return 0;
+	}
+
+	while (*szName) {
+		nHash ^= (UINT8)*szName++;
+		nHash *= 16777619U;
+	}
+
+	return nHash;
+}
+
+static inline void DeltaPut32(UINT8* pDest, UINT32 nValue)
+{
+	memcpy(pDest, &nValue, sizeof(nValue));
+}
+
+static inline UINT32 DeltaGet32(const UINT8* pSrc)
+{
+	UINT32 nValue;
+	memcpy(&nValue, pSrc, sizeof(nValue));
+	return nValue;
+}
+
+// -----------------------------------------------------------------------------
+// Reference snapshot
+
+static INT32 __cdecl DeltaLenAcb(struct BurnArea* pba)
+{
+	if (nDeltaAreaCount >= nDeltaAreaAlloc) {
+		INT32 nNewAlloc = nDeltaAreaAlloc ? (nDeltaAreaAlloc * 2) : 256;
+		DeltaArea* pNew = (DeltaArea*)realloc(pDeltaArea, nNewAlloc * sizeof(DeltaArea));
+		if (pNew == NULL) {
+			bDeltaMismatch = 1;
+			return 1;
+		}
+		pDeltaArea = pNew;
+		nDeltaAreaAlloc = nNewAlloc;
+	}
+
+	pDeltaArea[nDeltaAreaCount].nOffset = nDeltaRefLen;
+	pDeltaArea[nDeltaAreaCount].nLen = pba->nLen;
+	pDeltaArea[nDeltaAreaCount].nNameHash = DeltaNameHash(pba->szName);
+
+	nDeltaAreaCount++;
+	nDeltaRefLen += pba->nLen;
+
+	return 0;
+}
+
+static INT32 __cdecl DeltaCaptureAcb(struct BurnArea* pba)
+{
+	if (nDeltaScanPos >= nDeltaAreaCount || pDeltaArea[nDeltaScanPos].nLen != pba->nLen) {
+		bDeltaMismatch = 1;
+		return 1;
+	}
+
+	memcpy(pDeltaRef + pDeltaArea[nDeltaScanPos].nOffset, pba->Data, pba->nLen);
+	nDeltaScanPos++;
+
+	return 0;
+}
+
+// Build the area table and take a new reference snapshot of the driver's areas
+INT32 BurnStateDeltaInit(INT32 nAction)
+{
+	nDeltaAction = nAction & ACB_TYPEMASK;
+	if (nDeltaAction == 0) {
+		nDeltaAction = ACB_FULLSCAN;
+	}
+
+	nDeltaAreaCount = 0;
+	nDeltaRefLen = 0;
+	bDeltaMismatch = 0;
+
+	BurnAcb = DeltaLenAcb;
+	BurnAreaScan(nDeltaAction, NULL);
+
+	if (bDeltaMismatch) {
+		BurnStateDeltaExit();
+		return 1;
+	}
+
+	// Worst case output: every block changed and each one needs its own record
+	UINT32 nOutLen = DELTA_HEADER_SIZE + nDeltaRefLen + ((nDeltaRefLen / DELTA_BLOCK_SIZE) + nDeltaAreaCount) * DELTA_RECORD_SIZE;
+
+	if (nDeltaRefLen > nDeltaRefAlloc) {
+		UINT8* pNew = (UINT8*)realloc(pDeltaRef, nDeltaRefLen);
+		if (pNew == NULL) {
+			BurnStateDeltaExit();
+			return 1;
+		}
+		pDeltaRef = pNew;
+		nDeltaRefAlloc = nDeltaRefLen;
+	}
+
+	if (nOutLen > nDeltaOutLen) {
+		UINT8* pNew = (UINT8*)realloc(pDeltaOut, nOutLen);
+		if (pNew == NULL) {
+			BurnStateDeltaExit();
+			return 1;
+		}
+		pDeltaOut = pNew;
+		nDeltaOutLen = nOutLen;
+	}
+
+	nDeltaScanPos = 0;
+	BurnAcb = DeltaCaptureAcb;
+	BurnAreaScan(nDeltaAction | ACB_READ, NULL);
+
+	if (bDeltaMismatch || nDeltaScanPos != nDeltaAreaCount) {
+		bprintf(PRINT_ERROR, _T("BurnStateDeltaInit() area layout changed while scanning!\n"));
+		BurnStateDeltaExit();
+		return 1;
+	}
+
+	return 0;
+}
+
+void BurnStateDeltaExit()
+{
+	if (pDeltaArea) {
+		free(pDeltaArea);
+		pDeltaArea = NULL;
+	}
+	if (pDeltaRef) {
+		free(pDeltaRef);
+		pDeltaRef = NULL;
+	}
+	if (pDeltaOut) {
+		free(pDeltaOut);
+		pDeltaOut = NULL;
+	}
+
+	nDeltaAreaCount = nDeltaAreaAlloc = 0;
+	nDeltaRefLen = nDeltaRefAlloc = 0;
+	nDeltaOutLen = nDeltaOutFill = 0;
+	nDeltaAction = 0;
+}
+
+// Get the current reference snapshot (all areas concatenated in scan order)
+INT32 BurnStateDeltaGetReference(UINT8** ppRef, INT32* pnRefLen)
+{
+	if (pDeltaRef == NULL) {
+		return 1;
+	}
+
+	if (ppRef) {
+		*ppRef = pDeltaRef;
+	}
+	if (pnRefLen) {
+		*pnRefLen = nDeltaRefLen;
+	}
+
+	return 0;
+}
+
+// Walk the records of a delta, checking each one fits the reference.
+// With bApply set, the records are also xor'ed into the reference.
+static INT32 DeltaXor(UINT8* pDelta, INT32 nDeltaLen, INT32 bApply)
+{
+	if (nDeltaLen < (INT32)DELTA_HEADER_SIZE) {
+		return 1;
+	}
+
+	if (DeltaGet32(pDelta + 0) != (UINT32)nDeltaAreaCount || DeltaGet32(pDelta + 4) != nDeltaRefLen) {
+		return 1;
+	}
+
+	UINT32 nRecords = DeltaGet32(pDelta + 8);
+	UINT8* pEnd = pDelta + nDeltaLen;
+
+	pDelta += DELTA_HEADER_SIZE;
+
+	for (UINT32 i = 0; i < nRecords; i++) {
+		if (pEnd - pDelta < (INT32)DELTA_RECORD_SIZE) {
+			return 1;
+		}
+
+		UINT32 nOffset = DeltaGet32(pDelta + 0);
+		UINT32 nLen = DeltaGet32(pDelta + 4);
+		pDelta += DELTA_RECORD_SIZE;
+
+		if ((UINT32)(pEnd - pDelta) < nLen || nOffset > nDeltaRefLen || nLen > nDeltaRefLen - nOffset) {
+			return 1;
+		}
+
+		if (bApply) {
+			UINT8* pRef = pDeltaRef + nOffset;
+			for (UINT32 j = 0; j < nLen; j++) {
+				pRef[j] ^= pDelta[j];
+			}
+		}
+
+		pDelta += nLen;
+	}
+
+	return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Save
+
+static INT32 __cdecl DeltaSaveAcb(struct BurnArea* pba)
+{
+	if (bDeltaMismatch) {
+		return 1;
+	}
+
+	if (nDeltaScanPos >= nDeltaAreaCount) {
+		bDeltaMismatch = 1;
+		return 1;
+	}
+
+	DeltaArea* pArea = &pDeltaArea[nDeltaScanPos++];
+
+	if (pArea->nLen != pba->nLen || pArea->nNameHash != DeltaNameHash(pba->szName)) {
+		bDeltaMismatch = 1;
+		return 1;
+	}
+
+	UINT8* pSrc = (UINT8*)pba->Data;
+	UINT8* pRef = pDeltaRef + pArea->nOffset;
+
+	for (UINT32 nPos = 0; nPos < pba->nLen; nPos += DELTA_BLOCK_SIZE) {
+		UINT32 nBlock = pba->nLen - nPos;
+		if (nBlock > DELTA_BLOCK_SIZE) {
+			nBlock = DELTA_BLOCK_SIZE;
+		}
+
+		if (memcmp(pSrc + nPos, pRef + nPos, nBlock) == 0) {
+			continue;
+		}
+
+		UINT32 nRefOffset = pArea->nOffset + nPos;
+
+		if (nDeltaRecords == 0 || nDeltaLastEnd != nRefOffset) {
+			// start a new record
+			nDeltaLastRecord = nDeltaOutFill;
+			DeltaPut32(pDeltaOut + nDeltaOutFill + 0, nRefOffset);
+			DeltaPut32(pDeltaOut + nDeltaOutFill + 4, 0);
+			nDeltaOutFill += DELTA_RECORD_SIZE;
+			nDeltaRecords++;
+		}
+
+		// the reference is only moved forwards once every area has matched, see BurnStateDeltaSave()
+		UINT8* pDest = pDeltaOut + nDeltaOutFill;
+		for (UINT32 j = 0; j < nBlock; j++) {
+			pDest[j] = pSrc[nPos + j] ^ pRef[nPos + j];
+		}
+
+		nDeltaOutFill += nBlock;
+		nDeltaLastEnd = nRefOffset + nBlock;
+		DeltaPut32(pDeltaOut + nDeltaLastRecord + 4, DeltaGet32(pDeltaOut + nDeltaLastRecord + 4) + nBlock);
+	}
+
+	return 0;
+}
+
+// Compare the driver's areas against the reference, emit the changed blocks and
+// move the reference to the current state.  The returned buffer is owned by this
+// module and is valid until the next call.  The reference is left as it was if
+// the layout changed part way through the scan.
+// Returns 1 if the area layout changed - call BurnStateDeltaInit() to take a new reference
+INT32 BurnStateDeltaSave(UINT8** ppDelta, INT32* pnDeltaLen)
+{
+	if (pDeltaOut == NULL) {
+		return 1;
+	}
+
+	nDeltaOutFill = DELTA_HEADER_SIZE;
+	nDeltaRecords = 0;
+	nDeltaLastRecord = 0;
+	nDeltaLastEnd = 0;
+	nDeltaScanPos = 0;
+	bDeltaMismatch = 0;
+
+	BurnAcb = DeltaSaveAcb;
+	BurnAreaScan(nDeltaAction | ACB_READ, NULL);
+
+	if (bDeltaMismatch || nDeltaScanPos != nDeltaAreaCount) {
+		return 1;
+	}
+
+	DeltaPut32(pDeltaOut + 0, nDeltaAreaCount);
+	DeltaPut32(pDeltaOut + 4, nDeltaRefLen);
+	DeltaPut32(pDeltaOut + 8, nDeltaRecords);
+
+	DeltaXor(pDeltaOut, nDeltaOutFill, 1);
+
+	if (ppDelta) {
+		*ppDelta = pDeltaOut;
+	}
+	if (pnDeltaLen) {
+		*pnDeltaLen = nDeltaOutFill;
+	}
+
+	return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Apply
+
+static INT32 __cdecl DeltaLoadAcb(struct BurnArea* pba)
+{
+	if (nDeltaScanPos >= nDeltaAreaCount || pDeltaArea[nDeltaScanPos].nLen != pba->nLen) {
+		bDeltaMismatch = 1;
+		return 1;
+	}
+
+	memcpy(pba->Data, pDeltaRef + pDeltaArea[nDeltaScanPos].nOffset, pba->nLen);
+	nDeltaScanPos++;
+
+	return 0;
+}
+
+// Xor a delta into the reference (this steps the reference in either direction).
+// If bLoad is set, the resulting reference is then written back to the driver.
+// pDelta can be NULL to only load the current reference.
+INT32 BurnStateDeltaApply(UINT8* pDelta, INT32 nDeltaLen, INT32 bLoad)
+{
+	if (pDeltaOut == NULL) {
+		return 1;
+	}
+
+	if (pDelta) {
+		// check every record before touching the reference, so a bad delta leaves it as it was
+		if (DeltaXor(pDelta, nDeltaLen, 0) || DeltaXor(pDelta, nDeltaLen, 1)) {
+			return 1;
+		}
+	}
+
+	if (bLoad) {
+		nDeltaScanPos = 0;
+		bDeltaMismatch = 0;
+
+		BurnAcb = DeltaLoadAcb;
+		BurnAreaScan(nDeltaAction | ACB_WRITE, NULL);
+
+		if (bDeltaMismatch || nDeltaScanPos != nDeltaAreaCount) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -33,6 +33,113 @@ static GenericTilemap maps[MAX_TILEMAPS];
 static GenericTilemap *cur_map;
 GenericTilesGfx GenericGfxData[MAX_TILEMAPS];
 
+// Tile classification
+// Every tile gets a bitmask of the pens it uses the first time it is drawn. Held
+// against the transparent pens of the tilemap / category it tells us the tile is
+// fully transparent (skip it) or fully opaque (draw it without the per-pixel test).
+// Drivers that write to their tile data at run time must call
+// GenericTilemapSetGfxTileDirty() / GenericTilemapAllGfxTilesDirty().
+static UINT64 *gfx_pens[MAX_GFX];			// all 0 = not classified yet
+static INT32 gfx_pen_words[MAX_GFX];		// UINT64s per tile, 0 = don't classify this gfx
+
+static UINT64 trans_pens[256][4];			// transparent pens of each category (this draw)
+static UINT8 trans_pens_valid[256];
+
+static UINT64 *TilemapTilePens(INT32 num, UINT32 code)
+{
+	INT32 words = gfx_pen_words[num];
+
+	if (words == 0) return NULL;
+
+	GenericTilesGfx *gfx = &GenericGfxData[num];
+
+	if (gfx_pens[num] == NULL) {
+		gfx_pens[num] = (UINT64*)BurnMalloc(gfx->code_mask * words * sizeof(UINT64));
+
+		if (gfx_pens[num] == NULL) {
+			gfx_pen_words[num] = 0;
+			return NULL;
+		}
+	}
+
+	UINT64 *pens = gfx_pens[num] + code * words;
+
+	for (INT32 i = 0; i < words; i++) {
+		if (pens[i]) return pens;
+	}
+
+	INT32 one_tile = gfx->width * gfx->height;
+	INT32 maxpen = words * 64;
+	UINT8 *src = gfx->gfxbase + code * one_tile;
+
+	for (INT32 i = 0; i < one_tile; i++) {
+		if (src[i] >= maxpen) { // tile data doesn't match the depth, leave this gfx alone
+			gfx_pen_words[num] = 0;
+			return NULL;
+		}
+
+		pens[src[i] >> 6] |= (UINT64)1 << (src[i] & 0x3f);
+	}
+
+	return pens;
+}
+
+// returns the renderer a tile needs: TMAP_TRANSPARENT (transcolor), TMAP_TRANSMASK (category
+// table), 0 (opaque) or -1 (fully transparent, nothing to draw)
+static INT32 TilemapTileDrawMode(GenericTilemapCallbackStruct *sTile, UINT32 category, INT32 opaque)
+{
+	INT32 mode;
+
+	if (opaque || (sTile->flags & TILE_OPAQUE)) return 0;
+
+	if (cur_map->flags & TMAP_TRANSPARENT) {
+		mode = TMAP_TRANSPARENT;
+		category = 0;
+	} else if (cur_map->flags & TMAP_TRANSMASK) {
+		mode = TMAP_TRANSMASK;
+	} else {
+		return 0;
+	}
+
+	GenericTilesGfx *gfx = &GenericGfxData[sTile->gfx];
+
+	if ((UINT32)gfx->width != cur_map->twidth || (UINT32)gfx->height != cur_map->theight) return mode;
+
+	UINT64 *pens = TilemapTilePens(sTile->gfx, sTile->code);
+
+	if (pens == NULL) return mode;
+
+	INT32 words = gfx_pen_words[sTile->gfx];
+	UINT64 *trans = trans_pens[category];
+
+	if (trans_pens_valid[category] == 0) {
+		trans_pens_valid[category] = 1;
+		memset (trans, 0, sizeof(trans_pens[0]));
+
+		if (mode == TMAP_TRANSPARENT) {
+			if (cur_map->transcolor >= 0 && cur_map->transcolor < 256) {
+				trans[cur_map->transcolor >> 6] = (UINT64)1 << (cur_map->transcolor & 0x3f);
+			}
+		} else {
+			for (INT32 i = 0; i < 256; i++) {
+				if (cur_map->transparent[category][i]) trans[i >> 6] |= (UINT64)1 << (i & 0x3f);
+			}
+		}
+	}
+
+	UINT64 drawn = 0, hidden = 0;
+
+	for (INT32 i = 0; i < words; i++) {
+		drawn |= pens[i] & ~trans[i];
+		hidden |= pens[i] & trans[i];
+	}
+
+	if (drawn == 0) return -1;
+	if (hidden == 0) return 0;
+
+	return mode;
+}
+
 void GenericTilemapInit(INT32 which, INT32 (*pScan)(INT32 col, INT32 row), void (*pTile)(INT32 offs, GenericTilemapCallbackStruct *sTile), UINT32 tile_width, UINT32 tile_height, UINT32 map_width, UINT32 map_height)
 {
 #if defined FBNEO_DEBUG
@@ -124,6 +231,9 @@ void GenericTilemapSetGfx(INT32 num, UINT8 *gfxbase, INT32 depth, INT32 tile_wid
 
 	GenericTilesGfx *ptr = &GenericGfxData[num];
 
+	// same tiles, only the colours differ
+	INT32 same_tiles = (ptr->gfxbase == gfxbase && ptr->depth == depth && ptr->width == tile_width && ptr->height == tile_height && ptr->gfx_len == gfxlen);
+
 	ptr->gfxbase = gfxbase;
 	ptr->depth = depth;
 	ptr->width = tile_width;
@@ -147,6 +257,45 @@ void GenericTilemapSetGfx(INT32 num, UINT8 *gfxbase, INT32 depth, INT32 tile_wid
 	// we're using much safer modulos for limiting the tile number
 	ptr->code_mask = gfxlen / (tile_width * tile_height);
 #endif
+
+	if (same_tiles) return;
+
+	// tiles are classified the first time they're drawn (the data might not be decoded yet)
+	if (gfx_pens[num]) {
+		BurnFree(gfx_pens[num]);
+	}
+
+	gfx_pen_words[num] = (depth >= 1 && depth <= 8) ? (((1 << depth) + 63) / 64) : 0;
+}
+
+void GenericTilemapSetGfxTileDirty(INT32 num, UINT32 code)
+{
+#if defined FBNEO_DEBUG
+	if (num < 0 || num >= MAX_GFX) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapSetGfxTileDirty(%d, 0x%x); called with impossible gfx number!\n"), num, code);
+		return;
+	}
+#endif
+
+	if (gfx_pens[num] == NULL || GenericGfxData[num].code_mask == 0) return;
+
+	INT32 words = gfx_pen_words[num];
+
+	memset (gfx_pens[num] + (code % GenericGfxData[num].code_mask) * words, 0, words * sizeof(UINT64));
+}
+
+void GenericTilemapAllGfxTilesDirty(INT32 num)
+{
+#if defined FBNEO_DEBUG
+	if (num < 0 || num >= MAX_GFX) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapAllGfxTilesDirty(%d); called with impossible gfx number!\n"), num);
+		return;
+	}
+#endif
+
+	if (gfx_pens[num] == NULL) return;
+
+	memset (gfx_pens[num], 0, GenericGfxData[num].code_mask * gfx_pen_words[num] * sizeof(UINT64));
 }
 
 void GenericTilemapExit()
@@ -166,6 +315,11 @@ void GenericTilemapExit()
 		}
 	}
 
+	for (INT32 i = 0; i < MAX_GFX; i++) {
+		if (gfx_pens[i]) BurnFree(gfx_pens[i]);
+		gfx_pen_words[i] = 0;
+	}
+
 	// wipe everything else out
 	memset (maps, 0, sizeof(maps));
 	memset (GenericGfxData, 0, sizeof(GenericGfxData));
@@ -854,6 +1008,112 @@ INT32 GenericTilemapGetTileDirty(INT32 which, UINT32 offset)
 	return cur_map->dirty_tiles[offset % (cur_map->mwidth * cur_map->mheight)];
 }
 
+INT32 GenericTilemapCoversClip(INT32 which, INT32 priority)
+{
+#if defined FBNEO_DEBUG
+	if (which < 0 || which >= MAX_TILEMAPS) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapCoversClip(%d, %d); called with impossible tilemap!\n"), which, priority);
+		return 0;
+	}
+#endif
+
+	cur_map = &maps[which];
+
+	if (cur_map->initialized == 0 || cur_map->enable == 0) return 0;
+
+	// only the single scroll row / column path, unflipped, redrawing everything
+	if (cur_map->dirty_tiles_enable || cur_map->scroll_rows > 1 || cur_map->scroll_cols > 1 || (cur_map->flags & TMAP_FLIPXY)) return 0;
+
+	INT32 minx, maxx, miny, maxy;
+	GenericTilesGetClip(&minx, &maxx, &miny, &maxy);
+
+	if (minx < 0) minx = 0;
+	if (maxx > nScreenWidth) maxx = nScreenWidth;
+	if (miny < 0) miny = 0;
+	if (maxy > nScreenHeight) maxy = nScreenHeight;
+
+	memset (trans_pens_valid, 0, sizeof(trans_pens_valid));
+
+	INT32 category_or = (priority & TMAP_DRAWLAYER1) ? 2 : 0;
+	INT32 opaque = priority & TMAP_FORCEOPAQUE;
+	INT32 opaque2 = priority & TMAP_DRAWOPAQUE;
+	INT32 tgroup = (priority >> 8) & 0xff;
+
+	INT32 syshift = ((cur_map->scrolly - cur_map->yoffset[0]) % cur_map->theight);
+	INT32 scrolly = ((cur_map->scrolly - cur_map->yoffset[0]) / cur_map->theight) * cur_map->theight;
+
+	INT32 sxshift = ((cur_map->scrollx - cur_map->xoffset[0]) % cur_map->twidth);
+	INT32 scrollx = ((cur_map->scrollx - cur_map->xoffset[0]) / cur_map->twidth) * cur_map->twidth;
+
+	INT32 starty = miny - (miny % cur_map->theight);
+	INT32 startx = minx - (minx % cur_map->twidth);
+	INT32 endx = maxx + cur_map->twidth;
+	INT32 endy = maxy + cur_map->theight;
+
+	// a negative shift leaves a gap at the top / left edge
+	if ((startx - sxshift) > minx || (starty - syshift) > miny) return 0;
+
+	struct GenericTilemapCallbackStruct sTileData;
+
+	for (INT32 y = starty; y < endy; y += cur_map->theight)
+	{
+		INT32 syy = (y + scrolly) % (cur_map->theight * cur_map->mheight);
+		INT32 sy = y - syshift;
+
+		if ((sy >= maxy) || (sy < (INT32)(miny - (cur_map->theight - 1)))) continue;
+
+		for (INT32 x = startx; x < endx; x += cur_map->twidth)
+		{
+			INT32 sx = x - sxshift;
+
+			if ((sx >= maxx) || (sx < (INT32)(minx - (cur_map->twidth - 1)))) continue;
+
+			INT32 sxx = (x + scrollx) % (cur_map->twidth * cur_map->mwidth);
+
+			INT32 offset = cur_map->pScan(sxx/cur_map->twidth,syy/cur_map->theight);
+
+			sTileData.category = 0;
+
+			cur_map->pTile(offset, &sTileData);
+
+			UINT32 category = sTileData.category | category_or;
+
+			if (category && (cur_map->flags & TMAP_TRANSMASK)) {
+				if (cur_map->transparent[category] == NULL) {
+					category = 0;
+				}
+			}
+
+			GenericTilesGfx *gfx = &GenericGfxData[sTileData.gfx];
+
+			if (gfx->gfxbase == NULL || (UINT32)gfx->width != cur_map->twidth || (UINT32)gfx->height != cur_map->theight) return 0;
+
+			sTileData.code %= gfx->code_mask;
+
+			if (opaque == 0)
+			{
+				if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT)) {
+					if (cur_map->skip_tiles[sTileData.gfx][sTileData.code]) {
+						return 0;
+					}
+				}
+
+				if (sTileData.flags & TILE_SKIP) return 0;
+
+				if (sTileData.flags & TILE_GROUP_ENABLE) {
+					if (((sTileData.flags >> 16) & 0xff) != (UINT32)tgroup) {
+						return 0;
+					}
+				}
+			}
+
+			if (TilemapTileDrawMode(&sTileData, category, opaque | opaque2) != 0) return 0;
+		}
+	}
+
+	return 1;
+}
+
 void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 priority_mask)
 {
 #if defined FBNEO_DEBUG
@@ -863,6 +1123,8 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 	}
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_DRAW);
+
 	cur_map = &maps[which];
 
 #if defined FBNEO_DEBUG
@@ -892,6 +1154,8 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 
 	GenericTilesPRIMASK = priority_mask;
 
+	memset (trans_pens_valid, 0, sizeof(trans_pens_valid));
+
 	INT32 category_or = (priority & TMAP_DRAWLAYER1) ? 2 : 0;
 	INT32 opaque = priority & TMAP_FORCEOPAQUE;
 	INT32 opaque2 = priority & TMAP_DRAWOPAQUE;
@@ -1120,6 +1384,12 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 					flipx ^= TILE_FLIPX;
 				}
 
+				// skip fully transparent tiles (not before this point, scrx carries over to the next tile).
+				// the loop below tests transparent[category], so only if the classification used the same pens
+				if ((cur_map->flags & (TMAP_TRANSPARENT | TMAP_TRANSMASK)) != (TMAP_TRANSPARENT | TMAP_TRANSMASK) && (category == 0 || (cur_map->flags & TMAP_TRANSMASK))) {
+					if (TilemapTileDrawMode(&sTileData, category, 0) < 0) continue; // fully transparent
+				}
+
 				UINT8 *gfxsrc = gfx->gfxbase + (sTileData.code * cur_map->twidth * cur_map->theight) + (scy * cur_map->twidth);
 				UINT8 *trans_ptr = cur_map->transparent[category];
 
@@ -1277,9 +1547,12 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 					continue;
 				}
 
+				INT32 drawmode = TilemapTileDrawMode(&sTileData, category, opaque | opaque2);
+				if (drawmode < 0) continue; // fully transparent
+
 				if (sx < minx || sy < miny || sx >= (INT32)(maxx - cur_map->twidth - 1) || sy >= (INT32)(maxy - cur_map->theight - 1))
 				{
-					if ((cur_map->flags & TMAP_TRANSPARENT) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
+					if (drawmode == TMAP_TRANSPARENT)
 					{
 						if (flipy) {
 							if (flipx) {
@@ -1295,7 +1568,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 							}
 						}
 					}
-					else if ((cur_map->flags & TMAP_TRANSMASK) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
+					else if (drawmode == TMAP_TRANSMASK)
 					{
 						if (flipy) {
 							if (flipx) {
@@ -1330,7 +1603,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 				} 
 				else
 				{
-					if ((cur_map->flags & TMAP_TRANSPARENT) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
+					if (drawmode == TMAP_TRANSPARENT)
 					{
 						if (flipy) {
 							if (flipx) {
@@ -1346,7 +1619,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 							}
 						}
 					}
-					else if ((cur_map->flags & TMAP_TRANSMASK) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
+					else if (drawmode == TMAP_TRANSMASK)
 					{
 						if (flipy) {
 							if (flipx) {
@@ -1487,9 +1760,12 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 			continue;
 		}
 
+		INT32 drawmode = TilemapTileDrawMode(&sTileData, category, opaque | opaque2);
+		if (drawmode < 0) continue; // fully transparent
+
 		if (sx < minx || sy < miny || sx >= (INT32)(maxx - cur_map->twidth - 1) || sy >= (INT32)(maxy - cur_map->theight - 1))
 		{
-			if ((cur_map->flags & TMAP_TRANSPARENT) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
+			if (drawmode == TMAP_TRANSPARENT)
 			{
 				if (flipy) {
 					if (flipx) {
@@ -1505,7 +1781,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 					}
 				}
 			}
-			else if ((cur_map->flags & TMAP_TRANSMASK) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
+			else if (drawmode == TMAP_TRANSMASK)
 			{
 				if (flipy) {
 					if (flipx) {
@@ -1540,7 +1816,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 		} 
 		else
 		{
-			if ((cur_map->flags & TMAP_TRANSPARENT) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
+			if (drawmode == TMAP_TRANSPARENT)
 			{
 				if (flipy) {
 					if (flipx) {
@@ -1556,7 +1832,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 					}
 				}
 			}
-			else if ((cur_map->flags & TMAP_TRANSMASK) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
+			else if (drawmode == TMAP_TRANSMASK)
 			{
 				if (flipy) {
 					if (flipx) {
@@ -127,6 +127,11 @@ void GenericTilemapSetTransSplit(INT32 which, INT32 category, UINT16 layer0, UIN
 // Build a table of fully transparent tiles
 void GenericTilemapBuildSkipTable(INT32 which, INT32 gfxnum, INT32 transparent);
 
+// Tiles are checked for fully transparent / fully opaque pixels the first time they are drawn,
+// drivers that change their tile data at run time (char ram) must mark the changed tiles
+void GenericTilemapSetGfxTileDirty(INT32 num, UINT32 code);
+void GenericTilemapAllGfxTilesDirty(INT32 num);
+
 // Set scroll x (horizontal) or y (vertical) for the tilemap
 void GenericTilemapSetScrollX(INT32 which, INT32 scrollx);
 void GenericTilemapSetScrollY(INT32 which, INT32 scrolly);
@@ -182,5 +187,10 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 // Draw using the bitmap manager (uses clipping and bitmap dimensions)
 void GenericTilemapDraw(INT32 which, INT32 bitmap, INT32 priority);
 
+// Returns 1 if GenericTilemapDraw(which, Bitmap, priority) would write every pixel in the current
+// clip, so any layer drawn before it is completely hidden and doesn't need to be drawn (as long
+// as the draw doesn't keep the old priority bits via priority_mask)
+INT32 GenericTilemapCoversClip(INT32 which, INT32 priority);
+
 // Dump all tilemaps to bitmap files
 void GenericTilemapDumpToBitmap();
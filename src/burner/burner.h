@@ -212,8 +212,29 @@ INT32 BurnStateSave(TCHAR* szName, INT32 bAll);
 INT32 BurnStateUNDO(TCHAR* szName);
 
 // statec.cpp
+#define STATE_CODEC_DEFLATE			0
+#define STATE_CODEC_DEFLATE_FAST	1
+#define STATE_CODEC_LZ				2
+
+#define STATE_LZ_WORKMEM			(sizeof(UINT32) << 14)
+
+INT32 BurnStateCompressEx(UINT8** pDef, INT32* pnDefLen, INT32 bAll, INT32 nCodec);
 INT32 BurnStateCompress(UINT8** pDef, INT32* pnDefLen, INT32 bAll);
 INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll);
+INT32 BurnStateLen(INT32 bAll);
+INT32 BurnStateLZBound(INT32 nLen);
+INT32 BurnStateLZCompress(const UINT8* pSrc, INT32 nSrcLen, UINT8* pDest, INT32 nDestLen);
+INT32 BurnStateLZCompressWork(const UINT8* pSrc, INT32 nSrcLen, UINT8* pDest, INT32 nDestLen, void* pWork);
+INT32 BurnStateLZDecompress(const UINT8* pSrc, INT32 nSrcLen, UINT8* pDest, INT32 nDestLen);
+
+// rewind.cpp
+INT32 RewindInit(INT32 nBudget, INT32 nInterval);
+void RewindExit();
+void RewindReset();
+INT32 RewindCapture();
+void RewindSync();
+INT32 RewindCount();
+INT32 RewindStep(INT32 nFrames);
 
 // zipfn.cpp
 struct ZipEntry { char* szName;	UINT32 nLen; UINT32 nCrc; };
@@ -223,6 +244,10 @@ INT32 ZipClose();
 INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount);
 INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry);
 INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote);
+INT32 ZipPrefetchAdd(char* szZip, INT32 nEntry, INT32 nLen, INT32 nRom);
+INT32 ZipPrefetchRun();
+INT32 ZipPrefetchGet(INT32 i, UINT8* Dest, INT32 nLen, INT32* pnWrote);
+void ZipPrefetchExit();
 
 // bzip.cpp
 
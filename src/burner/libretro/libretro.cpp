@@ -11,6 +11,7 @@
 #include "retro_cdemu.h"
 #include "retro_input.h"
 #include "retro_memory.h"
+#include "resampler.h"
 
 #include <file/file_path.h>
 
@@ -78,8 +79,30 @@ INT32 nAudSegLen = 0;
 
 static UINT8* pVidImage = NULL;
 static bool bVidImageNeedRealloc = false;
+static bool bVidImageShown = false;		// the frontend is showing pVidImage as it is now
+static bool bLibretroCanDupe = false;
 static int16_t *g_audio_buf = NULL;
 
+// With an internal samplerate the driver renders at g_audio_internal_samplerate and
+// AudResampler converts it to g_audio_samplerate, which is what the frontend is told
+static Resampler AudResampler;
+static bool bAudResample = false;
+static int16_t *g_audio_resample_buf = NULL;
+static INT32 nAudResampleMax = 0;
+static double dAudRateAdjust = 1.0;
+
+#define AUDIO_RATE_CONTROL_MAX	0.005
+
+#ifndef RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK
+// newer than our copy of libretro.h
+#define RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK 62
+typedef void (RETRO_CALLCONV *retro_audio_buffer_status_callback_t)(bool active, unsigned occupancy, bool underrun_likely);
+struct retro_audio_buffer_status_callback
+{
+	retro_audio_buffer_status_callback_t callback;
+};
+#endif
+
 // Mapping of PC inputs to game inputs
 struct GameInp* GameInp = NULL;
 UINT32 nGameInpCount = 0;
@@ -122,8 +145,6 @@ static int nDIPOffset;
 
 const int nConfigMinVersion = 0x020921;
 
-static uint8_t *write_state_ptr;
-static const uint8_t *read_state_ptr;
 static unsigned state_sizes[2];
 
 int HandleMessage(enum retro_log_level level, TCHAR* szFormat, ...)
@@ -681,12 +702,17 @@ static int archive_load_rom(uint8_t *dest, int *wrote, int i)
 
 	int archive = g_find_list[i].nArchive;
 
-	if (ZipOpen((char*)g_find_list_path[archive].path.c_str()) != 0)
-		return 1;
-
 	BurnRomInfo ri = {0};
 	BurnDrvGetRomInfo(&ri, i);
 
+	// Already inflated by the prefetch ?
+	int ret = ZipPrefetchGet(i, dest, ri.nLen, wrote);
+	if (ret >= 0)
+		return (ret == 0) ? 0 : 1;
+
+	if (ZipOpen((char*)g_find_list_path[archive].path.c_str()) != 0)
+		return 1;
+
 	if (!(ri.nType & BRF_NODUMP))
 	{
 		if (ZipLoadFile(dest, ri.nLen, wrote, g_find_list[i].nPos) != 0)
@@ -920,6 +946,15 @@ static bool open_archive()
 	}
 
 	BurnExtLoadRom = archive_load_rom;
+
+	// Queue the zipped roms, they are inflated in parallel right before the driver loads them
+	ZipPrefetchExit();
+	for (unsigned i = 0; i < g_rom_count; i++)
+	{
+		if (g_find_list[i].nState == STAT_OK && g_find_list[i].ri.nType != 0 && g_find_list[i].ri.nLen > 0 && !(g_find_list[i].ri.nType & BRF_NODUMP))
+			ZipPrefetchAdd((char*)g_find_list_path[g_find_list[i].nArchive].path.c_str(), g_find_list[i].nPos, g_find_list[i].ri.nLen, i);
+	}
+
 	return true;
 }
 
@@ -1011,6 +1046,12 @@ void retro_init()
 	if (environ_cb(RETRO_ENVIRONMENT_GET_INPUT_BITMASKS, NULL))
 		bLibretroSupportsBitmasks = true;
 
+	bLibretroCanDupe = false;
+	environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &bLibretroCanDupe);
+
+	// pVidImage is kept between frames, only the rows that changed get converted
+	bBurnDirtyRows = true;
+
 	libretro_msg_interface_version = 0;
 	environ_cb(RETRO_ENVIRONMENT_GET_MESSAGE_INTERFACE_VERSION, &libretro_msg_interface_version);
 
@@ -1025,6 +1066,7 @@ void retro_deinit()
 {
 	BurnLibExit();
 	bLibretroSupportsBitmasks = false;
+	bBurnDirtyRows = false;
 }
 
 void retro_reset()
@@ -1049,14 +1091,33 @@ void retro_reset()
 
 void retro_run()
 {
+	// hidden frames (run-ahead) have video and/or audio disabled, the drivers skip
+	// drawing, BurnTransferCopy and sound rendering when the pointers are NULL
+	int nAVEnable = -1;
+	environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &nAVEnable);
+	bool bVideoEnabled = (nAVEnable & 1) ? true : false;
+	bool bAudioEnabled = (nAVEnable & 2) ? true : false;
+
 	pBurnDraw = pVidImage;
+	pBurnSoundOut = bAudioEnabled ? g_audio_buf : NULL;
 	bDisableSerialize = 0;
 
 	InputMake();
 
-	ForceFrameStep(nCurrentFrame % nFrameskip == 0);
+	ForceFrameStep(bVideoEnabled && (nCurrentFrame % nFrameskip == 0));
 
-	audio_batch_cb(g_audio_buf, nBurnSoundLen);
+	if (bAudioEnabled)
+	{
+		if (bAudResample)
+		{
+			AudResampler.set_ratio(bAudioRateControl ? dAudRateAdjust : 1.0);
+			audio_batch_cb(g_audio_resample_buf, AudResampler.process(g_audio_buf, nBurnSoundLen, g_audio_resample_buf, nAudResampleMax));
+		}
+		else
+		{
+			audio_batch_cb(g_audio_buf, nBurnSoundLen);
+		}
+	}
 	bool updated = false;
 
 	if (bVidImageNeedRealloc)
@@ -1068,9 +1129,26 @@ void retro_run()
 			pVidImage = (UINT8*)malloc(nGameWidth * nGameHeight * nBurnBpp);
 		// current frame will be corrupted, let's dupe instead
 		video_cb(NULL, nGameWidth, nGameHeight, nBurnPitch);
+		bVidImageShown = false;
+	}
+	else if (!bVideoEnabled)
+	{
+		// pVidImage wasn't updated, and the frontend won't show this frame anyway
+		video_cb(bLibretroCanDupe ? NULL : pVidImage, nGameWidth, nGameHeight, nBurnPitch);
+		bVidImageShown = false;
 	}
 	else
-		video_cb(pVidImage, nGameWidth, nGameHeight, nBurnPitch);
+	{
+		INT32 nFirst, nLast;
+
+		// nothing was redrawn, the frontend can repeat the frame it already has
+		if (bLibretroCanDupe && bVidImageShown && BurnTransferGetDirtyRows(&nFirst, &nLast, NULL) == 0 && nLast < nFirst)
+			video_cb(NULL, nGameWidth, nGameHeight, nBurnPitch);
+		else
+			video_cb(pVidImage, nGameWidth, nGameHeight, nBurnPitch);
+
+		bVidImageShown = true;
+	}
 
 	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
 	{
@@ -1101,20 +1179,6 @@ void retro_run()
 	}
 }
 
-static int burn_write_state_cb(BurnArea *pba)
-{
-	memcpy(write_state_ptr, pba->Data, pba->nLen);
-	write_state_ptr += pba->nLen;
-	return 0;
-}
-
-static int burn_read_state_cb(BurnArea *pba)
-{
-	memcpy(pba->Data, read_state_ptr, pba->nLen);
-	read_state_ptr += pba->nLen;
-	return 0;
-}
-
 static int burn_dummy_state_cb(BurnArea *pba)
 {
 #ifdef FBNEO_DEBUG
@@ -1124,80 +1188,60 @@ static int burn_dummy_state_cb(BurnArea *pba)
 	return 0;
 }
 
-size_t retro_serialize_size()
+// Shared by the serialize calls - netplay mode and the state size
+static unsigned state_size_update()
 {
-	if (bDisableSerialize == 1)
-		return 0;
 	int result = -1;
 	environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &result);
-	kNetGame = result & 4 ? 1 : 0;
+	int nNetGame = result & 4 ? 1 : 0;
+	// the cached area list belongs to the other mode
+	if (nNetGame != kNetGame)
+		BurnStateCacheExit();
+	kNetGame = nNetGame;
 	// hiscores are causing desync in netplay
 	if (kNetGame == 1)
 		EnableHiscores = false;
-	if (state_sizes[kNetGame])
-		return state_sizes[kNetGame];
-
-	BurnAcb = burn_dummy_state_cb;
-	// The following value is required in savestates for some games (xmen6p, ...)
-	// On standalone, this value is stored in savestate files headers
-	SCAN_VAR(nCurrentFrame);
-	BurnAreaScan(ACB_FULLSCAN, 0);
+	if (!state_sizes[kNetGame])
+	{
+		BurnAcb = burn_dummy_state_cb;
+		// The following value is required in savestates for some games (xmen6p, ...)
+		// On standalone, this value is stored in savestate files headers
+		SCAN_VAR(nCurrentFrame);
+		BurnAreaScan(ACB_FULLSCAN, 0);
+	}
 	return state_sizes[kNetGame];
 }
 
+size_t retro_serialize_size()
+{
+	if (bDisableSerialize == 1)
+		return 0;
+	return state_size_update();
+}
+
+// Run-ahead and rewind call these every frame. BurnStateCacheSave() is a full
+// BurnAreaScan() unless the driver opted in with BurnStateCacheAllow(), then the
+// areas are copied from the list it keeps instead of going through the driver
 bool retro_serialize(void *data, size_t size)
 {
 	if (bDisableSerialize == 1)
 		return false;
-	int result = -1;
-	environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &result);
-	kNetGame = result & 4 ? 1 : 0;
-	// hiscores are causing desync in netplay
-	if (kNetGame == 1)
-		EnableHiscores = false;
-	if (!state_sizes[kNetGame])
-	{
-		BurnAcb = burn_dummy_state_cb;
-		SCAN_VAR(nCurrentFrame);
-		BurnAreaScan(ACB_FULLSCAN, 0);
-	}
-	if (size != state_sizes[kNetGame])
+	if (size != state_size_update())
 		return false;
 
-	BurnAcb = burn_write_state_cb;
-	write_state_ptr = (uint8_t*)data;
-	// The following value is required in savestates for some games (xmen6p, ...)
-	// On standalone, this value is stored in savestate files headers
-	SCAN_VAR(nCurrentFrame);
-	BurnAreaScan(ACB_FULLSCAN | ACB_READ, 0);
-	return true;
+	memcpy(data, &nCurrentFrame, sizeof(nCurrentFrame));
+	return BurnStateCacheSave(ACB_FULLSCAN, (UINT8*)data + sizeof(nCurrentFrame), size - sizeof(nCurrentFrame)) == 0;
 }
 
 bool retro_unserialize(const void *data, size_t size)
 {
 	if (bDisableSerialize == 1)
 		return false;
-	int result = -1;
-	environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &result);
-	kNetGame = result & 4 ? 1 : 0;
-	// hiscores are causing desync in netplay
-	if (kNetGame == 1)
-		EnableHiscores = false;
-	if (!state_sizes[kNetGame])
-	{
-		BurnAcb = burn_dummy_state_cb;
-		SCAN_VAR(nCurrentFrame);
-		BurnAreaScan(ACB_FULLSCAN, 0);
-	}
-	if (size != state_sizes[kNetGame])
+	if (size != state_size_update())
 		return false;
 
-	BurnAcb = burn_read_state_cb;
-	read_state_ptr = (const uint8_t*)data;
-	// The following value is required in savestates for some games (xmen6p, ...)
-	// On standalone, this value is stored in savestate files headers
-	SCAN_VAR(nCurrentFrame);
-	BurnAreaScan(ACB_FULLSCAN | ACB_WRITE, 0);
+	memcpy(&nCurrentFrame, data, sizeof(nCurrentFrame));
+	BurnStateCacheLoad(ACB_FULLSCAN, (const UINT8*)data + sizeof(nCurrentFrame), size - sizeof(nCurrentFrame));
 	BurnRecalcPal();
 	return true;
 }
@@ -1303,15 +1347,58 @@ static void SetColorDepth()
 
 static void init_audio_buffer(INT32 sample_rate, INT32 fps)
 {
-	nAudSegLen = (sample_rate * 100 + (fps >> 1)) / fps;
+	// nAudSegLen is what the frontend gets each frame, nBurnSoundLen what the driver renders
+	nAudSegLen = (g_audio_samplerate * 100 + (fps >> 1)) / fps;
+	nBurnSoundLen = (sample_rate * 100 + (fps >> 1)) / fps;
 	if (g_audio_buf)
-		g_audio_buf = (int16_t*)realloc(g_audio_buf, nAudSegLen<<2 * sizeof(int16_t));
+		g_audio_buf = (int16_t*)realloc(g_audio_buf, nBurnSoundLen<<2 * sizeof(int16_t));
 	else
-		g_audio_buf = (int16_t*)calloc(nAudSegLen<<2, sizeof(int16_t));
-	nBurnSoundLen = nAudSegLen;
+		g_audio_buf = (int16_t*)calloc(nBurnSoundLen<<2, sizeof(int16_t));
 	pBurnSoundOut = g_audio_buf;
 }
 
+// the frontend's audio buffer fill level, stretch the sound a little to keep it half full
+static void RETRO_CALLCONV audio_buffer_status_cb(bool active, unsigned occupancy, bool /* underrun_likely */)
+{
+	if (!active || occupancy > 100)
+		dAudRateAdjust = 1.0;
+	else
+		dAudRateAdjust = 1.0 + AUDIO_RATE_CONTROL_MAX * (50.0 - (double)occupancy) / 50.0;
+}
+
+static void init_audio_resampler()
+{
+	struct retro_audio_buffer_status_callback buf_status = { NULL };
+
+	bAudResample = (g_audio_internal_samplerate > 0);
+	dAudRateAdjust = 1.0;
+
+	if (bAudResample)
+	{
+		AudResampler.init(nBurnSoundRate, g_audio_samplerate);
+		nAudResampleMax = AudResampler.max_output(nBurnSoundLen, 1.0 + AUDIO_RATE_CONTROL_MAX);
+		g_audio_resample_buf = (int16_t*)calloc(nAudResampleMax * 2, sizeof(int16_t));
+		buf_status.callback = audio_buffer_status_cb;
+		HandleMessage(RETRO_LOG_INFO, "[FBNeo] Resampling from %dhz to %dhz\n", nBurnSoundRate, g_audio_samplerate);
+	}
+
+	environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK, &buf_status);
+}
+
+static void exit_audio_resampler()
+{
+	if (bAudResample)
+	{
+		struct retro_audio_buffer_status_callback buf_status = { NULL };
+		environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK, &buf_status);
+
+		AudResampler.exit();
+		free(g_audio_resample_buf);
+		g_audio_resample_buf = NULL;
+		bAudResample = false;
+	}
+}
+
 static void extract_basename(char *buf, const char *path, size_t size, char *prefix)
 {
 	strcpy(buf, prefix);
@@ -1609,7 +1696,7 @@ static bool retro_load_game_common()
 
 		// Announcing to fbneo which samplerate we want
 		// Some game drivers won't initialize with an undefined nBurnSoundLen
-		nBurnSoundRate = g_audio_samplerate;
+		nBurnSoundRate = g_audio_internal_samplerate ? g_audio_internal_samplerate : g_audio_samplerate;
 		init_audio_buffer(nBurnSoundRate, 6000);
 		HandleMessage(RETRO_LOG_INFO, "[FBNeo] Samplerate set to %d\n", nBurnSoundRate);
 
@@ -1620,12 +1707,25 @@ static bool retro_load_game_common()
 			}
 		}
 
+		// Initialize ROM cache path (system/fbneo/romcache/)
+		szBurnRomCachePath[0] = 0;
+		if (bRomCacheEnabled) {
+			char RomCachePathToCreate[MAX_PATH];
+			snprintf_nowarn (RomCachePathToCreate, sizeof(RomCachePathToCreate), "%s%cfbneo%cromcache", g_system_dir, path_default_slash_c(), path_default_slash_c());
+			path_mkdir(RomCachePathToCreate);
+			snprintf_nowarn (szBurnRomCachePath, sizeof(szBurnRomCachePath), "%s%c", RomCachePathToCreate, path_default_slash_c());
+		}
+
 		// Apply dipswitches
 		apply_dipswitches_from_variables();
 		HandleMessage(RETRO_LOG_INFO, "[FBNeo] Applied dipswitches from core options\n");
 
-		// Initialize game driver
-		if(BurnDrvInit() == 0)
+		// Inflate the roms on all cores, then initialize game driver
+		ZipPrefetchRun();
+		INT32 nDrvInitRet = BurnDrvInit();
+		ZipPrefetchExit();
+
+		if(nDrvInitRet == 0)
 			HandleMessage(RETRO_LOG_INFO, "[FBNeo] Initialized driver for %s\n", g_driver_name);
 		else
 		{
@@ -1644,6 +1744,7 @@ static bool retro_load_game_common()
 		// Now we know real game fps, let's initialize sound buffer again
 		init_audio_buffer(nBurnSoundRate, nBurnFPS);
 		HandleMessage(RETRO_LOG_INFO, "[FBNeo] Adjusted audio buffer to match driver's refresh rate (%f Hz)\n", (nBurnFPS/100.0f));
+		init_audio_resampler();
 
 		// Get MainRam for RetroAchievements support
 		INT32 nMin = 0;
@@ -1852,6 +1953,7 @@ void retro_unload_game(void)
 			free(g_audio_buf);
 			g_audio_buf = NULL;
 		}
+		exit_audio_resampler();
 		BurnDrvExit();
 		if (nGameType == RETRO_GAME_TYPE_NEOCD)
 			CDEmuExit();
@@ -58,9 +58,12 @@ bool allow_neogeo_mode = true;
 bool neogeo_use_specific_default_bios = false;
 bool bAllowDepth32 = false;
 bool bLightgunHideCrosshairEnabled = true;
+bool bRomCacheEnabled = false;
 UINT32 nVerticalMode = 0;
 UINT32 nFrameskip = 1;
 INT32 g_audio_samplerate = 48000;
+INT32 g_audio_internal_samplerate = 0;
+bool bAudioRateControl = true;
 UINT32 nMemcardMode = 0;
 UINT8 *diag_input;
 neo_geo_modes g_opt_neo_geo_mode = NEO_GEO_MODE_MVS;
@@ -159,6 +162,17 @@ static const struct retro_core_option_definition var_fbneo_hiscores = {
 	},
 	"enabled"
 };
+static const struct retro_core_option_definition var_fbneo_rom_cache = {
+	"fbneo-rom-cache",
+	"ROM cache",
+	"Store the decoded Neo Geo, PGM and CPS-3 roms in your system/fbneo/romcache/ folder to speed up the next start of large romsets, it needs a lot of disk space",
+	{
+		{ "disabled", NULL },
+		{ "enabled", NULL },
+		{ NULL, NULL },
+	},
+	"disabled"
+};
 static const struct retro_core_option_definition var_fbneo_samplerate = {
 	"fbneo-samplerate",
 	"Samplerate",
@@ -172,6 +186,32 @@ static const struct retro_core_option_definition var_fbneo_samplerate = {
 	},
 	"48000"
 };
+static const struct retro_core_option_definition var_fbneo_internal_samplerate = {
+	"fbneo-internal-samplerate",
+	"Internal samplerate",
+	"Render the sound at this rate and convert it to the samplerate above with a single high quality resampler, pick the rate of the board's sound chips to spare them their own interpolation, closing & starting game again is required",
+	{
+		{ "disabled", NULL },
+		{ "44100", NULL },
+		{ "48000", NULL },
+		{ "55555", NULL },
+		{ "55930", NULL },
+		{ "96000", NULL },
+		{ NULL, NULL },
+	},
+	"disabled"
+};
+static const struct retro_core_option_definition var_fbneo_audio_rate_control = {
+	"fbneo-audio-rate-control",
+	"Dynamic rate control",
+	"With an internal samplerate, stretch the sound slightly to keep the frontend's audio buffer half full instead of letting it drift (requires frontend support)",
+	{
+		{ "disabled", NULL },
+		{ "enabled", NULL },
+		{ NULL, NULL },
+	},
+	"enabled"
+};
 static const struct retro_core_option_definition var_fbneo_sample_interpolation = {
 	"fbneo-sample-interpolation",
 	"Sample Interpolation",
@@ -228,6 +268,69 @@ static const struct retro_core_option_definition var_fbneo_cyclone = {
 	"disabled"
 };
 #endif
+#ifdef M68K_X64_DRC
+static const struct retro_core_option_definition var_fbneo_m68k_recompiler = {
+	"fbneo-m68k-recompiler",
+	"68000 recompiler",
+	"Translate 68000 code to native code instead of interpreting it, savestates stay compatible with the interpreter. Applied when a game is loaded",
+	{
+		{ "disabled", NULL },
+		{ "enabled", NULL },
+		{ NULL, NULL },
+	},
+	"disabled"
+};
+#endif
+#ifdef SH2_X64_DRC
+static const struct retro_core_option_definition var_fbneo_sh2_recompiler = {
+	"fbneo-sh2-recompiler",
+	"SH-2 recompiler",
+	"Translate SH-2 code to native code instead of interpreting it, savestates stay compatible with the interpreter. Applied when a game is loaded",
+	{
+		{ "disabled", NULL },
+		{ "enabled", NULL },
+		{ NULL, NULL },
+	},
+	"disabled"
+};
+#endif
+#ifdef ARM7_X64_DRC
+static const struct retro_core_option_definition var_fbneo_arm7_recompiler = {
+	"fbneo-arm7-recompiler",
+	"ARM7 recompiler",
+	"Translate ARM7 code to native code instead of interpreting it, savestates stay compatible with the interpreter. Applied when a game is loaded",
+	{
+		{ "disabled", NULL },
+		{ "enabled", NULL },
+		{ NULL, NULL },
+	},
+	"disabled"
+};
+#endif
+#ifdef E132XS_X64_DRC
+static const struct retro_core_option_definition var_fbneo_hyperstone_recompiler = {
+	"fbneo-hyperstone-recompiler",
+	"Hyperstone recompiler",
+	"Translate Hyperstone E1-32XS code to native code instead of interpreting it, savestates stay compatible with the interpreter. Applied when a game is loaded",
+	{
+		{ "disabled", NULL },
+		{ "enabled", NULL },
+		{ NULL, NULL },
+	},
+	"disabled"
+};
+#endif
+static const struct retro_core_option_definition var_fbneo_idle_skip = {
+	"fbneo-idle-skip",
+	"Idle loop skipping",
+	"Skip SH-2 and ARM7 wait loops that only poll memory, up to the next interrupt or timer. Applied when a game is loaded",
+	{
+		{ "disabled", NULL },
+		{ "enabled", NULL },
+		{ NULL, NULL },
+	},
+	"disabled"
+};
 
 // Neo Geo core options
 static const struct retro_core_option_definition var_fbneo_neogeo_mode = {
@@ -532,8 +635,13 @@ void set_environment()
 	vars_systems.push_back(&var_fbneo_frameskip);
 	vars_systems.push_back(&var_fbneo_cpu_speed_adjust);
 	vars_systems.push_back(&var_fbneo_hiscores);
+	vars_systems.push_back(&var_fbneo_rom_cache);
 	if (nGameType != RETRO_GAME_TYPE_NEOCD)
+	{
 		vars_systems.push_back(&var_fbneo_samplerate);
+		vars_systems.push_back(&var_fbneo_internal_samplerate);
+		vars_systems.push_back(&var_fbneo_audio_rate_control);
+	}
 	vars_systems.push_back(&var_fbneo_sample_interpolation);
 	vars_systems.push_back(&var_fbneo_fm_interpolation);
 	vars_systems.push_back(&var_fbneo_analog_speed);
@@ -541,6 +649,19 @@ void set_environment()
 #ifdef USE_CYCLONE
 	vars_systems.push_back(&var_fbneo_cyclone);
 #endif
+#ifdef M68K_X64_DRC
+	vars_systems.push_back(&var_fbneo_m68k_recompiler);
+#endif
+#ifdef SH2_X64_DRC
+	vars_systems.push_back(&var_fbneo_sh2_recompiler);
+#endif
+#ifdef ARM7_X64_DRC
+	vars_systems.push_back(&var_fbneo_arm7_recompiler);
+#endif
+#ifdef E132XS_X64_DRC
+	vars_systems.push_back(&var_fbneo_hyperstone_recompiler);
+#endif
+	vars_systems.push_back(&var_fbneo_idle_skip);
 #ifdef FBNEO_DEBUG
 	vars_systems.push_back(&var_fbneo_debug_layer_1);
 	vars_systems.push_back(&var_fbneo_debug_layer_2);
@@ -967,6 +1088,15 @@ void check_variables(void)
 			EnableHiscores = false;
 	}
 
+	var.key = var_fbneo_rom_cache.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bRomCacheEnabled = true;
+		else
+			bRomCacheEnabled = false;
+	}
+
 	if (nGameType != RETRO_GAME_TYPE_NEOCD)
 	{
 		var.key = var_fbneo_samplerate.key;
@@ -983,11 +1113,30 @@ void check_variables(void)
 			else
 				g_audio_samplerate = 48000;
 		}
+
+		var.key = var_fbneo_internal_samplerate.key;
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+		{
+			if (strcmp(var.value, "disabled") == 0)
+				g_audio_internal_samplerate = 0;
+			else
+				g_audio_internal_samplerate = atoi(var.value);
+		}
+
+		var.key = var_fbneo_audio_rate_control.key;
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+		{
+			if (strcmp(var.value, "disabled") == 0)
+				bAudioRateControl = false;
+			else
+				bAudioRateControl = true;
+		}
 	}
 	else
 	{
 		// src/burn/drv/neogeo/neo_run.cpp is mentioning issues with ngcd cdda playback if samplerate isn't 44100
 		g_audio_samplerate = 44100;
+		g_audio_internal_samplerate = 0;
 	}
 
 	var.key = var_fbneo_sample_interpolation.key;
@@ -1041,6 +1190,59 @@ void check_variables(void)
 	}
 #endif
 
+#ifdef M68K_X64_DRC
+	var.key = var_fbneo_m68k_recompiler.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bBurnUseM68KRecompiler = true;
+		else if (strcmp(var.value, "disabled") == 0)
+			bBurnUseM68KRecompiler = false;
+	}
+#endif
+
+#ifdef SH2_X64_DRC
+	var.key = var_fbneo_sh2_recompiler.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bBurnUseSh2Recompiler = true;
+		else if (strcmp(var.value, "disabled") == 0)
+			bBurnUseSh2Recompiler = false;
+	}
+#endif
+
+#ifdef ARM7_X64_DRC
+	var.key = var_fbneo_arm7_recompiler.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bBurnUseArm7Recompiler = true;
+		else if (strcmp(var.value, "disabled") == 0)
+			bBurnUseArm7Recompiler = false;
+	}
+#endif
+
+#ifdef E132XS_X64_DRC
+	var.key = var_fbneo_hyperstone_recompiler.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bBurnUseE132XSRecompiler = true;
+		else if (strcmp(var.value, "disabled") == 0)
+			bBurnUseE132XSRecompiler = false;
+	}
+#endif
+
+	var.key = var_fbneo_idle_skip.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bBurnIdleSkip = true;
+		else if (strcmp(var.value, "disabled") == 0)
+			bBurnIdleSkip = false;
+	}
+
 #ifdef FBNEO_DEBUG
 	var.key = var_fbneo_debug_layer_1.key;
 	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
@@ -127,11 +127,14 @@ extern bool allow_neogeo_mode;
 extern bool core_aspect_par;
 extern bool bAllowDepth32;
 extern bool bLightgunHideCrosshairEnabled;
+extern bool bRomCacheEnabled;
 extern UINT32 nVerticalMode;
 extern UINT32 nFrameskip;
 extern UINT32 nMemcardMode;
 extern UINT8 NeoSystem;
 extern INT32 g_audio_samplerate;
+extern INT32 g_audio_internal_samplerate;
+extern bool bAudioRateControl;
 extern UINT8 *diag_input;
 extern neo_geo_modes g_opt_neo_geo_mode;
 extern unsigned nGameType;
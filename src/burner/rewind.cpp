@@ -0,0 +1,378 @@
+// Rewind module
+//
+// The last few seconds (or minutes) of states, kept in a ring of a fixed size so a
+// frontend can step back through them. Every capture stores the difference from the
+// state before it (the two xor'd together, mostly zeros, then LZ compressed), and
+// every nRewindInterval captures the whole state as well. Going back starts from the
+// nearest keyframe after the target (or the newest state, which is kept uncompressed)
+// and undoes the differences one at a time, so a step never costs more than
+// nRewindInterval of them. When the ring is full the oldest entries make room.
+//
+// RewindCapture() copies the state with BurnStateCacheSave(), the xor and compression
+// run on the workers through the module's own BurnThreadQueue() queue, while the
+// frontend gets on with drawing, sound and the next frame. RewindSync() waits for them
+// and files the result, everything else here calls it before touching the ring.
+
+#include "burner.h"
+
+struct RewindEntry {
+	UINT32 nOffset;							// in the ring
+	UINT32 nKeyLen;							// the whole state, 0 if this isn't a keyframe
+	UINT32 nDeltaLen;						// difference from the state before, 0 if there wasn't one
+};
+
+static INT32 bRewindInit = 0;
+static INT32 nRewindInterval = 0;
+
+static UINT8* pRing = NULL;					// compressed entries, key then delta
+static UINT32 nRingLen = 0;
+static UINT32 nRingHead = 0;				// where the next entry goes
+
+static RewindEntry* pEntry = NULL;			// circular, oldest first
+static INT32 nEntryMax = 0;
+static INT32 nEntryFirst = 0;
+static INT32 nEntryCount = 0;
+static INT32 nSinceKey = 0;					// captures since the last keyframe
+
+static INT32 nStateLen = 0;
+static UINT8* pState = NULL;				// the newest entry's state
+static UINT8* pNext = NULL;					// the capture being compressed, or a state being rebuilt
+static UINT8* pDiff = NULL;					// the two xor'd together
+static INT32 bStateValid = 0;
+
+static UINT8* pKeyComp = NULL;				// job output, BurnStateLZBound(nStateLen) each
+static UINT8* pDeltaComp = NULL;
+static INT32 nKeyCompLen = 0;
+static INT32 nDeltaCompLen = 0;
+static UINT8* pWork[2] = { NULL, NULL };	// LZ hash tables, one per job
+
+static BurnJobQueue* pRewindQueue = NULL;
+static INT32 bPending = 0;
+static INT32 bPendingKey = 0;
+static INT32 bPendingDelta = 0;
+
+static inline RewindEntry* EntryGet(INT32 n)
+{
+	return &pEntry[(nEntryFirst + n) % nEntryMax];
+}
+
+static inline UINT32 EntryLen(RewindEntry* pe)
+{
+	return pe->nKeyLen + pe->nDeltaLen;
+}
+
+static void RewindFreeState()
+{
+	free(pState);
+	free(pNext);
+	free(pDiff);
+	free(pKeyComp);
+	free(pDeltaComp);
+
+	pState = pNext = pDiff = NULL;
+	pKeyComp = pDeltaComp = NULL;
+	nStateLen = 0;
+	bStateValid = 0;
+}
+
+static void RewindClear()
+{
+	nEntryFirst = nEntryCount = 0;
+	nRingHead = 0;
+	nSinceKey = 0;
+	bStateValid = 0;
+}
+
+static INT32 RewindAllocState(INT32 nLen)
+{
+	RewindFreeState();
+	RewindClear();
+
+	INT32 nBound = BurnStateLZBound(nLen);
+
+	pState = (UINT8*)malloc(nLen);
+	pNext = (UINT8*)malloc(nLen);
+	pDiff = (UINT8*)malloc(nLen);
+	pKeyComp = (UINT8*)malloc(nBound);
+	pDeltaComp = (UINT8*)malloc(nBound);
+
+	if (pState == NULL || pNext == NULL || pDiff == NULL || pKeyComp == NULL || pDeltaComp == NULL) {
+		RewindFreeState();
+		return 1;
+	}
+
+	nStateLen = nLen;
+
+	return 0;
+}
+
+// Job 0 makes the difference, job 1 (keyframes only) compresses the whole state
+static void RewindJob(void*, INT32 nIndex)
+{
+	INT32 nBound = BurnStateLZBound(nStateLen);
+
+	if (nIndex == 0) {
+		if (!bPendingDelta) {
+			nDeltaCompLen = 0;
+			return;
+		}
+
+		for (INT32 i = 0; i < nStateLen; i++) {
+			pDiff[i] = pState[i] ^ pNext[i];
+		}
+
+		nDeltaCompLen = BurnStateLZCompressWork(pDiff, nStateLen, pDeltaComp, nBound, pWork[0]);
+	} else {
+		nKeyCompLen = BurnStateLZCompressWork(pNext, nStateLen, pKeyComp, nBound, pWork[1]);
+	}
+}
+
+static void RewindDropOldest()
+{
+	nEntryFirst = (nEntryFirst + 1) % nEntryMax;
+	nEntryCount--;
+}
+
+static INT32 RewindStore(INT32 nKeyLen, INT32 nDeltaLen)
+{
+	UINT32 nNeed = nKeyLen + nDeltaLen;
+
+	if (nNeed > nRingLen) {
+		return 1;
+	}
+
+	UINT32 nOffset = nRingHead;
+
+	if (nOffset + nNeed > nRingLen) {
+		// wrap, everything past the head is older than what's at the start
+		while (nEntryCount > 0 && EntryGet(0)->nOffset >= nRingHead) {
+			RewindDropOldest();
+		}
+		nOffset = 0;
+	}
+
+	while (nEntryCount > 0) {
+		RewindEntry* pe = EntryGet(0);
+
+		if (nEntryCount < nEntryMax && (pe->nOffset >= nOffset + nNeed || pe->nOffset + EntryLen(pe) <= nOffset)) {
+			break;
+		}
+
+		RewindDropOldest();
+	}
+
+	RewindEntry* pe = EntryGet(nEntryCount++);
+
+	pe->nOffset = nOffset;
+	pe->nKeyLen = nKeyLen;
+	pe->nDeltaLen = nDeltaLen;
+
+	memcpy(pRing + nOffset, pKeyComp, nKeyLen);
+	memcpy(pRing + nOffset + nKeyLen, pDeltaComp, nDeltaLen);
+
+	nRingHead = nOffset + nNeed;
+
+	return 0;
+}
+
+// Wait for the capture being compressed and file it
+void RewindSync()
+{
+	if (!bPending) {
+		return;
+	}
+
+	BurnThreadWait(pRewindQueue);
+	bPending = 0;
+
+	if (nDeltaCompLen < 0 || nKeyCompLen < 0) {
+		RewindClear();
+		return;
+	}
+
+	if (RewindStore(bPendingKey ? nKeyCompLen : 0, bPendingDelta ? nDeltaCompLen : 0)) {
+		RewindClear();
+		return;
+	}
+
+	UINT8* pTemp = pState;
+	pState = pNext;
+	pNext = pTemp;
+	bStateValid = 1;
+}
+
+// Call once a frame, after the driver has run
+INT32 RewindCapture()
+{
+	if (!bRewindInit) {
+		return 1;
+	}
+
+	RewindSync();
+
+	INT32 nLen = BurnStateLen(1);
+	if (nLen <= 0) {
+		return 1;
+	}
+
+	if (nLen != nStateLen && RewindAllocState(nLen)) {
+		return 1;
+	}
+
+	if (BurnStateCacheSave(ACB_FULLSCAN, pNext, nStateLen)) {
+		return 1;
+	}
+
+	bPendingDelta = bStateValid;
+	bPendingKey = (!bStateValid || nSinceKey + 1 >= nRewindInterval);
+
+	nSinceKey = bPendingKey ? 0 : (nSinceKey + 1);
+	nKeyCompLen = nDeltaCompLen = 0;
+	bPending = 1;
+
+	BurnThreadQueue(pRewindQueue, bPendingKey ? 2 : 1);	// RewindSync() waited, the jobs start at 0
+
+	return 0;
+}
+
+// Number of frames RewindStep() can go back
+INT32 RewindCount()
+{
+	RewindSync();
+
+	return (nEntryCount > 0) ? (nEntryCount - 1) : 0;
+}
+
+// Go back nFrames captures (or as many as there are), returns how many it went back
+INT32 RewindStep(INT32 nFrames)
+{
+	if (!bRewindInit) {
+		return 0;
+	}
+
+	RewindSync();
+
+	if (nFrames > nEntryCount - 1) {
+		nFrames = nEntryCount - 1;
+	}
+	if (nFrames <= 0 || !bStateValid) {
+		return 0;
+	}
+
+	INT32 nTarget = nEntryCount - 1 - nFrames;
+	INT32 nFrom = nEntryCount - 1;
+
+	for (INT32 i = nTarget; i < nEntryCount - 1; i++) {
+		if (EntryGet(i)->nKeyLen) {
+			nFrom = i;
+			break;
+		}
+	}
+
+	if (nFrom < nEntryCount - 1) {
+		RewindEntry* pe = EntryGet(nFrom);
+		if (BurnStateLZDecompress(pRing + pe->nOffset, pe->nKeyLen, pNext, nStateLen) != nStateLen) {
+			RewindClear();
+			return 0;
+		}
+	} else {
+		memcpy(pNext, pState, nStateLen);
+	}
+
+	for (INT32 i = nFrom; i > nTarget; i--) {
+		RewindEntry* pe = EntryGet(i);
+		if (BurnStateLZDecompress(pRing + pe->nOffset + pe->nKeyLen, pe->nDeltaLen, pDiff, nStateLen) != nStateLen) {
+			RewindClear();
+			return 0;
+		}
+
+		for (INT32 j = 0; j < nStateLen; j++) {
+			pNext[j] ^= pDiff[j];
+		}
+	}
+
+	BurnStateCacheLoad(ACB_FULLSCAN, pNext, nStateLen);
+
+	UINT8* pTemp = pState;
+	pState = pNext;
+	pNext = pTemp;
+
+	// the captures after the target are gone, carry on from there
+	nEntryCount = nTarget + 1;
+	RewindEntry* pe = EntryGet(nTarget);
+	nRingHead = pe->nOffset + EntryLen(pe);
+
+	nSinceKey = 0;
+	for (INT32 i = nTarget; i >= 0 && EntryGet(i)->nKeyLen == 0; i--) {
+		nSinceKey++;
+	}
+
+	return nFrames;
+}
+
+// Forget the captures, but keep the buffers
+void RewindReset()
+{
+	RewindSync();
+	RewindClear();
+}
+
+// nBudget is the size of the ring in bytes, nInterval the captures between keyframes
+INT32 RewindInit(INT32 nBudget, INT32 nInterval)
+{
+	RewindExit();
+
+	if (nBudget <= 0) {
+		return 1;
+	}
+
+	nRingLen = nBudget;
+	nRewindInterval = (nInterval > 0) ? nInterval : 1;
+
+	// a delta of an unchanged state is around 1/255th of it, so this is plenty
+	nEntryMax = nBudget / 256;
+	if (nEntryMax < 64) {
+		nEntryMax = 64;
+	}
+
+	pRing = (UINT8*)malloc(nRingLen);
+	pEntry = (RewindEntry*)malloc(nEntryMax * sizeof(RewindEntry));
+	pWork[0] = (UINT8*)malloc(STATE_LZ_WORKMEM);
+	pWork[1] = (UINT8*)malloc(STATE_LZ_WORKMEM);
+	pRewindQueue = BurnThreadQueueInit(RewindJob, NULL);
+
+	if (pRing == NULL || pEntry == NULL || pWork[0] == NULL || pWork[1] == NULL || pRewindQueue == NULL) {
+		RewindExit();
+		return 1;
+	}
+
+	RewindClear();
+	bRewindInit = 1;
+
+	return 0;
+}
+
+void RewindExit()
+{
+	RewindSync();
+
+	RewindFreeState();
+
+	BurnThreadQueueExit(pRewindQueue);
+	pRewindQueue = NULL;
+
+	free(pRing);
+	free(pEntry);
+	free(pWork[0]);
+	free(pWork[1]);
+
+	pRing = NULL;
+	pEntry = NULL;
+	pWork[0] = pWork[1] = NULL;
+
+	nRingLen = 0;
+	nEntryMax = 0;
+
+	RewindClear();
+	bRewindInit = 0;
+}
@@ -0,0 +1,607 @@
+// Headless benchmark
+//
+// fbneo -bench <driver> [-frames N] [-input file]
+// fbneo -benchsuite <results.json> [-frames N] [-hardware 0x01000000,...]
+//
+// Boots the driver without a window or audio device, runs N frames as fast as
+// possible and prints the frame rate, frame time percentiles and the time spent
+// in the cpu cores, sound chips, transfer/tilemap drawing and palette updates
+// (see burn_profile.cpp). Whatever is left over is driver code that isn't
+// covered by one of those (hand written draw and palette routines, glue).
+//
+// The input file is plain text, one change per line, which is held until the
+// next change to the same input:
+//   <frame> <input name> <value>       e.g.  "60 P1 Coin 1" / "64 P1 Coin 0"
+// input names are the ones in the driver's input list, lines starting with # are ignored.
+//
+// -replay <file.fr> plays back an input recording (replay.cpp) instead, for as many
+// frames as it has.
+//
+// The suite runs every driver whose romset is complete (optionally only some hardware
+// families) and writes init time, BurnMalloc peak, frame times and crcs of the last
+// frame and of all the sound to a json file, for comparing builds and machines.
+//
+// fbneo -benchsound times the sound mixing kernels (burn_sound_simd.cpp) the cpu
+// supports against the C versions, and checks that they give the same output.
+
+#include "burner.h"
+#include "burn_sound.h"
+#include "zlib.h"
+
+int bBench = 0;
+int nBenchFrames = 600;
+char* szBenchDriver = NULL;
+char* szBenchInput = NULL;
+char* szBenchSuite = NULL;
+char* szBenchHardware = NULL;
+int bBenchSound = 0;
+
+struct BenchEvent {
+	int nFrame;
+	int nInput;
+	int nValue;
+};
+
+static BenchEvent* pEvents = NULL;
+static int nEventCount = 0;
+
+static unsigned short* pInputState = NULL;	// value written to each input every frame
+static int nInputCount = 0;
+
+static unsigned char* pBenchDraw = NULL;
+static short* pBenchSound = NULL;
+
+static int BenchFindInput(const char* szName)
+{
+	struct BurnInputInfo bii;
+
+	for (int i = 0; i < nInputCount; i++) {
+		BurnDrvGetInputInfo(&bii, i);
+		if (bii.szName && strcmp(bii.szName, szName) == 0) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int BenchLoadInput(const char* szFilename)
+{
+	FILE* fp = fopen(szFilename, "rt");
+	if (fp == NULL) {
+		printf("bench: can't open input file %s\n", szFilename);
+		return 1;
+	}
+
+	char szLine[256];
+	int nLine = 0, nAlloc = 0;
+
+	while (fgets(szLine, sizeof(szLine), fp)) {
+		nLine++;
+
+		char* s = szLine + strlen(szLine);
+		while (s > szLine && (s[-1] == '\n' || s[-1] == '\r' || s[-1] == ' ' || s[-1] == '\t')) {
+			*--s = 0;
+		}
+
+		s = szLine;
+		while (*s == ' ' || *s == '\t') s++;
+		if (*s == 0 || *s == '#') {
+			continue;
+		}
+
+		// frame first, value last, the input name (which can contain spaces) in between
+		char* pName;
+		int nFrame = strtol(s, &pName, 10);
+		char* pValue = strrchr(pName, ' ');
+		if (pName == s || pValue == NULL) {
+			printf("bench: %s:%d: expected \"<frame> <input> <value>\"\n", szFilename, nLine);
+			fclose(fp);
+			return 1;
+		}
+		*pValue++ = 0;
+		while (*pName == ' ' || *pName == '\t') pName++;
+
+		int nInput = BenchFindInput(pName);
+		if (nInput < 0) {
+			printf("bench: %s:%d: %s has no input called \"%s\"\n", szFilename, nLine, BurnDrvGetTextA(DRV_NAME), pName);
+			fclose(fp);
+			return 1;
+		}
+
+		if (nEventCount == nAlloc) {
+			nAlloc = nAlloc ? nAlloc * 2 : 64;
+			pEvents = (BenchEvent*)realloc(pEvents, nAlloc * sizeof(BenchEvent));
+		}
+
+		pEvents[nEventCount].nFrame = nFrame;
+		pEvents[nEventCount].nInput = nInput;
+		pEvents[nEventCount].nValue = strtol(pValue, NULL, 0);
+		nEventCount++;
+	}
+
+	fclose(fp);
+
+	// keep the file order for events on the same frame
+	for (int i = 1; i < nEventCount; i++) {
+		BenchEvent e = pEvents[i];
+		int j = i;
+		while (j > 0 && pEvents[j - 1].nFrame > e.nFrame) {
+			pEvents[j] = pEvents[j - 1];
+			j--;
+		}
+		pEvents[j] = e;
+	}
+
+	return 0;
+}
+
+// Same as InputMake() does for a frontend with nothing pressed: default dips, everything else from the script
+static void BenchInputInit()
+{
+	struct BurnInputInfo bii;
+	struct BurnDIPInfo bdi;
+
+	nInputCount = 0;
+	while (BurnDrvGetInputInfo(&bii, nInputCount) == 0) {
+		nInputCount++;
+	}
+
+	pInputState = (unsigned short*)calloc(nInputCount + 1, sizeof(unsigned short));
+
+	int nDIPOffset = 0;
+	for (int i = 0; BurnDrvGetDIPInfo(&bdi, i) == 0; i++) {
+		if (bdi.nFlags == 0xF0) {
+			nDIPOffset = bdi.nInput;
+			break;
+		}
+	}
+
+	for (int i = 0; BurnDrvGetDIPInfo(&bdi, i) == 0; i++) {
+		int nInput = bdi.nInput + nDIPOffset;
+		if (bdi.nFlags == 0xFF && nInput < nInputCount) {
+			pInputState[nInput] = (pInputState[nInput] & ~bdi.nMask) | (bdi.nSetting & bdi.nMask);
+		}
+	}
+}
+
+static void BenchInputMake(int nFrame, int* pnEvent)
+{
+	struct BurnInputInfo bii;
+
+	while (*pnEvent < nEventCount && pEvents[*pnEvent].nFrame <= nFrame) {
+		pInputState[pEvents[*pnEvent].nInput] = pEvents[*pnEvent].nValue;
+		(*pnEvent)++;
+	}
+
+	for (int i = 0; i < nInputCount; i++) {
+		BurnDrvGetInputInfo(&bii, i);
+		if (bii.pVal == NULL) {
+			continue;
+		}
+
+		if (bii.nType == BIT_DIGITAL || bii.nType == BIT_DIPSWITCH) {
+			*bii.pVal = (unsigned char)pInputState[i];
+		} else if (bii.nType & BIT_GROUP_ANALOG) {
+			*bii.pShortVal = pInputState[i];
+		}
+	}
+}
+
+static int BenchCompareTimes(const void* a, const void* b)
+{
+	double x = *(const double*)a, y = *(const double*)b;
+
+	return (x > y) - (x < y);
+}
+
+static void BenchExit()
+{
+	StopReplay();
+	GameInpExit();
+
+	if (bDrvOkay) {
+		BurnDrvExit();
+		bDrvOkay = 0;
+	}
+
+	bBurnProfile = false;
+
+	free(pEvents);
+	pEvents = NULL;
+	nEventCount = 0;
+	free(pInputState);
+	pInputState = NULL;
+	free(pBenchDraw);
+	pBenchDraw = NULL;
+	free(pBenchSound);
+	pBenchSound = NULL;
+
+	pBurnDraw = NULL;
+	pBurnSoundOut = NULL;
+}
+
+struct BenchResult {
+	double dInitTime;				// seconds, rom loading included
+	double dTotal;					// seconds spent in BurnDrvFrame()
+	double dAvg, dP50, dP90, dP99, dMax;		// frame times, milliseconds
+	double dSection[BURN_PROFILE_COUNT];	// seconds, see burn_profile.cpp
+	int nFrames;					// frames run
+	INT64 nPeakBytes;				// BurnMalloc peak
+	UINT32 nVideoCrc;				// last frame, 32-bit pixels
+	UINT32 nAudioCrc;				// every frame
+};
+
+// Recordings from power-on start the driver again once the movie flags are set
+static int BenchReload()
+{
+	BurnDrvExit();
+
+	BzipOpen(false);
+	int nRet = BurnDrvInit();
+	BzipClose();
+
+	return nRet;
+}
+
+// Returns 0 if the driver ran, 1 on error, 2 if its romset isn't there
+static int BenchDriver(int nDrvNum, int nFrames, const char* szInput, const char* szReplay, BenchResult* pResult)
+{
+	int nWidth, nHeight;
+
+	memset(pResult, 0, sizeof(BenchResult));
+
+	nBurnDrvActive = nDrvNum;
+
+	if ((BurnDrvGetHardwareCode() & HARDWARE_PUBLIC_MASK) == HARDWARE_SNK_NEOCD) {
+		printf("bench: %s needs a cd image, not supported\n", BurnDrvGetTextA(DRV_NAME));
+		return 1;
+	}
+
+	BenchInputInit();
+
+	if (szInput && BenchLoadInput(szInput)) {
+		BenchExit();
+		return 1;
+	}
+
+	// no audio device, but render sound at the configured rate so the chips do their usual work
+	nBurnSoundRate = nAudSampleRate[nAudSelect] ? nAudSampleRate[nAudSelect] : 44100;
+	nMaxPlayers = BurnDrvGetMaxPlayers();
+	bCheatsAllowed = false;
+	EnableHiscores = 0;
+
+	// dips and the script's frame 0 have to be in place for the driver's reset
+	int nEvent = 0;
+	BenchInputMake(0, &nEvent);
+
+	Uint64 nInitStart = SDL_GetPerformanceCounter();
+
+	BzipOpen(false);
+	if (BzipStatus() != BZIP_STATUS_OK) {
+		BzipClose();
+		BenchExit();
+		return 2;
+	}
+
+	int nRet = BurnDrvInit();
+	BzipClose();
+
+	pResult->dInitTime = (double)(SDL_GetPerformanceCounter() - nInitStart) / SDL_GetPerformanceFrequency();
+
+	if (nRet) {
+		printf("bench: %s failed to initialise\n", BurnDrvGetTextA(DRV_NAME));
+		BurnDrvExit();
+		BenchExit();
+		return 1;
+	}
+	bDrvOkay = 1;
+
+	if (szReplay) {
+		GameInpInit();
+
+		if (StartReplay(szReplay, BenchReload)) {
+			BenchExit();
+			return 1;
+		}
+
+		nFrames = nTotalFrames;
+		if (nFrames < 1) {
+			printf("bench: %s has no frames\n", szReplay);
+			BenchExit();
+			return 1;
+		}
+	}
+
+	nBurnSoundLen = (nBurnSoundRate * 100 + nBurnFPS / 2) / nBurnFPS;
+	pBenchSound = (short*)calloc(nBurnSoundLen * 2, sizeof(short));
+	pBurnSoundOut = pBenchSound;
+
+	BurnDrvGetVisibleSize(&nWidth, &nHeight);
+	if (BurnDrvGetFlags() & BDF_ORIENTATION_VERTICAL) {
+		BurnDrvGetVisibleSize(&nHeight, &nWidth);
+	}
+
+	nBurnBpp = 4;
+	nBurnPitch = nWidth * nBurnBpp;
+	SetBurnHighCol(32);
+	pBenchDraw = (unsigned char*)calloc(nWidth * nHeight, nBurnBpp);
+	pBurnDraw = pBenchDraw;
+	BurnRecalcPal();
+
+	double* pTimes = (double*)malloc(nFrames * sizeof(double));
+	double dFreq = (double)SDL_GetPerformanceFrequency();
+	uLong nAudioCrc = crc32(0L, Z_NULL, 0);
+
+	BurnProfileReset();
+	bBurnProfile = true;
+
+	for (int i = 0; i < nFrames; i++) {
+		nCurrentFrame++;
+
+		if (szReplay) {
+			ReplayInput();
+		} else {
+			BenchInputMake(i, &nEvent);
+		}
+		memset(pBenchSound, 0, nBurnSoundLen * 2 * sizeof(short));
+
+		Uint64 nStart = SDL_GetPerformanceCounter();
+		BurnDrvFrame();
+		pTimes[i] = (SDL_GetPerformanceCounter() - nStart) / dFreq;
+
+		pResult->dTotal += pTimes[i];
+		nAudioCrc = crc32(nAudioCrc, (const Bytef*)pBenchSound, nBurnSoundLen * 2 * sizeof(short));
+	}
+
+	bBurnProfile = false;
+
+	BurnProfileGet(pResult->dSection);
+
+	qsort(pTimes, nFrames, sizeof(double), BenchCompareTimes);
+
+	pResult->nFrames = nFrames;
+	pResult->dAvg = pResult->dTotal / nFrames * 1000.0;
+	pResult->dP50 = pTimes[nFrames * 50 / 100] * 1000.0;
+	pResult->dP90 = pTimes[nFrames * 90 / 100] * 1000.0;
+	pResult->dP99 = pTimes[nFrames * 99 / 100] * 1000.0;
+	pResult->dMax = pTimes[nFrames - 1] * 1000.0;
+	pResult->nAudioCrc = nAudioCrc;
+	pResult->nVideoCrc = crc32(crc32(0L, Z_NULL, 0), pBenchDraw, nWidth * nHeight * nBurnBpp);
+
+	free(pTimes);
+	BenchExit();
+
+	struct BurnMemoryStats ms;
+	BurnGetMemoryStats(&ms);
+	pResult->nPeakBytes = ms.nPeakBytes;
+
+	return 0;
+}
+
+static const char* szSectionName[BURN_PROFILE_COUNT] = { "cpu", "sound", "draw", "palette" };
+
+int BenchRun(int nDrvNum, int nFrames, const char* szInput)
+{
+	BenchResult r;
+
+	nBurnDrvActive = nDrvNum;
+	printf("bench: %s - %s\n", BurnDrvGetTextA(DRV_NAME), BurnDrvGetTextA(DRV_FULLNAME));
+
+	int nRet = BenchDriver(nDrvNum, nFrames, szInput, szReplayPlay, &r);
+	if (nRet == 2) {
+		printf("bench: romset for %s not found or incomplete\n", BurnDrvGetTextA(DRV_NAME));
+	}
+	if (nRet) {
+		return 1;
+	}
+
+	nFrames = r.nFrames;
+	double dFps = nFrames / r.dTotal;
+
+	printf("bench: %d frames in %.3fs (init %.3fs), %.1f fps, %.2fx realtime\n", nFrames, r.dTotal, r.dInitTime, dFps, dFps * 100.0 / nBurnFPS);
+	printf("bench: frame time ms  avg %.3f  p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n", r.dAvg, r.dP50, r.dP90, r.dP99, r.dMax);
+
+	double dOther = r.dTotal;
+
+	for (int i = 0; i < BURN_PROFILE_COUNT; i++) {
+		printf("bench:   %-8s %8.3f ms/frame %6.1f%%\n", szSectionName[i], r.dSection[i] * 1000.0 / nFrames, r.dSection[i] * 100.0 / r.dTotal);
+		dOther -= r.dSection[i];
+	}
+	printf("bench:   %-8s %8.3f ms/frame %6.1f%%\n", "other", dOther * 1000.0 / nFrames, dOther * 100.0 / r.dTotal);
+	printf("bench: peak memory %.1f MB, video crc %08x, audio crc %08x\n", r.nPeakBytes / 1048576.0, r.nVideoCrc, r.nAudioCrc);
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Suite - every driver with a complete romset, results as json
+
+static void BenchJsonString(FILE* fp, const char* s)
+{
+	fputc('"', fp);
+	for (; s && *s; s++) {
+		unsigned char c = *s;
+		if (c == '"' || c == '\\') {
+			fprintf(fp, "\\%c", c);
+		} else if (c < 0x20) {
+			fprintf(fp, "\\u%04x", c);
+		} else {
+			fputc(c, fp);
+		}
+	}
+	fputc('"', fp);
+}
+
+// filter is a comma separated list of hardware codes, a code with the low 24 bits
+// clear (e.g. 0x01000000, HARDWARE_PREFIX_CAPCOM) matches the whole family
+static bool BenchHardwareMatch(const char* szFilter, UINT32 nHardware)
+{
+	if (szFilter == NULL || *szFilter == 0) {
+		return true;
+	}
+
+	const char* s = szFilter;
+	while (*s) {
+		char* pEnd;
+		UINT32 nCode = strtoul(s, &pEnd, 0);
+		if (pEnd == s) {
+			break;
+		}
+
+		if (nCode & 0x00ffffff) {
+			if ((nHardware & HARDWARE_PUBLIC_MASK) == (nCode & HARDWARE_PUBLIC_MASK)) return true;
+		} else {
+			if ((nHardware & 0xff000000) == nCode) return true;
+		}
+
+		s = pEnd;
+		while (*s == ',' || *s == ' ') s++;
+	}
+
+	return false;
+}
+
+int BenchSuite(const char* szOutput, int nFrames, const char* szHardware)
+{
+	FILE* fp = fopen(szOutput, "wt");
+	if (fp == NULL) {
+		printf("bench: can't create %s\n", szOutput);
+		return 1;
+	}
+
+	int nRan = 0, nFailed = 0;
+
+	fprintf(fp, "{\n\t\"version\": \"%s\",\n\t\"frames\": %d,\n\t\"drivers\": [", szAppBurnVer, nFrames);
+
+	for (UINT32 i = 0; i < nBurnDrvCount; i++) {
+		nBurnDrvActive = i;
+
+		if (BurnDrvGetFlags() & BDF_BOARDROM) {
+			continue;
+		}
+		if ((BurnDrvGetHardwareCode() & HARDWARE_PUBLIC_MASK) == HARDWARE_SNK_NEOCD) {
+			continue;
+		}
+		if (!BenchHardwareMatch(szHardware, BurnDrvGetHardwareCode())) {
+			continue;
+		}
+
+		BenchResult r;
+		int nRet = BenchDriver(i, nFrames, NULL, NULL, &r);
+		if (nRet == 2) {
+			continue;
+		}
+
+		nBurnDrvActive = i;
+		printf("bench: %-16s %s\n", BurnDrvGetTextA(DRV_NAME), nRet ? "failed" : "ok");
+
+		fprintf(fp, "%s\n\t\t{ \"name\": ", (nRan + nFailed) ? "," : "");
+		BenchJsonString(fp, BurnDrvGetTextA(DRV_NAME));
+		fprintf(fp, ", \"fullname\": ");
+		BenchJsonString(fp, BurnDrvGetTextA(DRV_FULLNAME));
+		fprintf(fp, ", \"hardware\": \"0x%08x\"", BurnDrvGetHardwareCode());
+
+		if (nRet) {
+			fprintf(fp, ", \"ok\": false }");
+			nFailed++;
+		} else {
+			fprintf(fp, ", \"ok\": true, \"init_s\": %.4f, \"peak_bytes\": %lld, \"fps\": %.2f, \"frame_avg_ms\": %.4f, \"frame_p99_ms\": %.4f",
+				r.dInitTime, (long long)r.nPeakBytes, nFrames / r.dTotal, r.dAvg, r.dP99);
+			for (int j = 0; j < BURN_PROFILE_COUNT; j++) {
+				fprintf(fp, ", \"%s_ms\": %.4f", szSectionName[j], r.dSection[j] * 1000.0 / nFrames);
+			}
+			fprintf(fp, ", \"video_crc\": \"%08x\", \"audio_crc\": \"%08x\" }", r.nVideoCrc, r.nAudioCrc);
+			nRan++;
+		}
+
+		fflush(fp);
+	}
+
+	fprintf(fp, "\n\t]\n}\n");
+	fclose(fp);
+
+	printf("bench: %d drivers run, %d failed, results in %s\n", nRan, nFailed, szOutput);
+
+	return nFailed ? 1 : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Sound kernels
+
+#define BENCH_SOUND_LEN		4096			// samples per call, about 5 frames at 48khz
+#define BENCH_SOUND_LOOPS	2000
+
+static double BenchSoundKernel(const BurnSoundKernels* k, int nKernel, INT32* pSrc, INT16* pSrcL, INT16* pSrcR, INT16* pDest)
+{
+	Uint64 nStart = SDL_GetPerformanceCounter();
+
+	for (int i = 0; i < BENCH_SOUND_LOOPS; i++) {
+		switch (nKernel) {
+			case 0: k->CopyClamp(pSrc, pDest, BENCH_SOUND_LEN); break;
+			case 1: k->CopyClamp_Add(pSrc, pDest, BENCH_SOUND_LEN); break;
+			case 2: k->CopyClamp_Mono(pSrc, pDest, BENCH_SOUND_LEN); break;
+			case 3: k->CopyClamp_Mono_Add(pSrc, pDest, BENCH_SOUND_LEN); break;
+			case 4: k->Copy_FM(pSrcL, pSrcR, pDest, BENCH_SOUND_LEN, 0x6000, 0x5000); break;
+			case 5: k->Copy_FM_Add(pSrcL, pSrcR, pDest, BENCH_SOUND_LEN, 0x6000, 0x5000); break;
+		}
+	}
+
+	return (double)(SDL_GetPerformanceCounter() - nStart) / SDL_GetPerformanceFrequency();
+}
+
+int BenchSound()
+{
+	static const char* szKernelName[6] = { "CopyClamp", "CopyClamp_Add", "CopyClamp_Mono", "CopyClamp_Mono_Add", "Copy_FM", "Copy_FM_Add" };
+
+	INT32* pSrc = (INT32*)malloc(BENCH_SOUND_LEN * 2 * sizeof(INT32));
+	INT16* pSrcL = (INT16*)malloc(BENCH_SOUND_LEN * sizeof(INT16));
+	INT16* pSrcR = (INT16*)malloc(BENCH_SOUND_LEN * sizeof(INT16));
+	INT16* pInit = (INT16*)malloc(BENCH_SOUND_LEN * 2 * sizeof(INT16));
+	INT16* pDest = (INT16*)malloc(BENCH_SOUND_LEN * 2 * sizeof(INT16));
+	INT16* pRef = (INT16*)malloc(BENCH_SOUND_LEN * 2 * sizeof(INT16));
+
+	// mixed signals at up to 4x full scale, so the clamping gets exercised
+	srand(1);
+	for (int i = 0; i < BENCH_SOUND_LEN * 2; i++) {
+		pSrc[i] = ((rand() & 0x3ffff) - 0x20000) << 8;
+		pInit[i] = (rand() & 0xffff) - 0x8000;
+	}
+	for (int i = 0; i < BENCH_SOUND_LEN; i++) {
+		pSrcL[i] = (rand() & 0xffff) - 0x8000;
+		pSrcR[i] = (rand() & 0xffff) - 0x8000;
+	}
+
+	const BurnSoundKernels* pC = BurnSoundKernelsGet(0);
+	int nRet = 0;
+
+	printf("benchsound: %d samples x %d calls, default set %s\n", BENCH_SOUND_LEN, BENCH_SOUND_LOOPS, BurnSoundKernel.szName);
+
+	for (int nKernel = 0; nKernel < 6; nKernel++) {
+		memcpy(pDest, pInit, BENCH_SOUND_LEN * 2 * sizeof(INT16));
+		double dC = BenchSoundKernel(pC, nKernel, pSrc, pSrcL, pSrcR, pDest);
+		memcpy(pRef, pDest, BENCH_SOUND_LEN * 2 * sizeof(INT16));
+
+		printf("benchsound: %-20s C %8.3f ms", szKernelName[nKernel], dC * 1000.0);
+
+		const BurnSoundKernels* k;
+		for (int i = 1; (k = BurnSoundKernelsGet(i)) != NULL; i++) {
+			memcpy(pDest, pInit, BENCH_SOUND_LEN * 2 * sizeof(INT16));
+			double dTime = BenchSoundKernel(k, nKernel, pSrc, pSrcL, pSrcR, pDest);
+			bool bMatch = memcmp(pDest, pRef, BENCH_SOUND_LEN * 2 * sizeof(INT16)) == 0;
+
+			printf("  %s %8.3f ms (%.2fx)%s", k->szName, dTime * 1000.0, dC / dTime, bMatch ? "" : " MISMATCH");
+			if (!bMatch) nRet = 1;
+		}
+		printf("\n");
+	}
+
+	free(pSrc);
+	free(pSrcL);
+	free(pSrcR);
+	free(pInit);
+	free(pDest);
+	free(pRef);
+
+	return nRet;
+}
@@ -39,6 +39,9 @@ extern bool  bRunPause;
 extern bool  bAppDoFast;    // TODO: bad
 extern char  fpsstring[20]; // TODO: also bad
 extern bool  bAppShowFPS;   // TODO: Also also bad
+extern bool  bAppDoRewind;
+extern int   nAppRewindBudget;
+extern int   nAppRewindInterval;
 extern bool  bAlwaysProcessKeyboardInput;
 extern TCHAR szAppBurnVer[16];
 extern bool  bAppFullscreen;
@@ -56,6 +59,32 @@ char* TCHARToANSI(const TCHAR* pszInString, char* pszOutString, int nOutSize);
 
 bool AppProcessKeyboardInput();
 
+//bench.cpp
+extern int bBench;
+extern int nBenchFrames;
+extern char* szBenchDriver;
+extern char* szBenchInput;
+extern char* szBenchSuite;
+extern char* szBenchHardware;
+extern int bBenchSound;
+int BenchRun(int nDrvNum, int nFrames, const char* szInput);
+int BenchSuite(const char* szOutput, int nFrames, const char* szHardware);
+int BenchSound();
+
+// replay.cpp
+extern INT32 nReplayStatus;
+extern INT32 movieFlags;
+extern UINT32 nTotalFrames;
+extern char* szReplayRecord;
+extern char* szReplayPlay;
+INT32 RecordInput();
+INT32 ReplayInput();
+INT32 StartRecord(const TCHAR* szFileName, INT32 (*pLoadGame)());
+INT32 StartReplay(const TCHAR* szFileName, INT32 (*pLoadGame)());
+void StopReplay();
+INT32 FreezeInput(UINT8** buf, INT32* size);
+INT32 UnfreezeInput(const UINT8* buf, INT32 size);
+
 //config.cpp
 int ConfigAppLoad();
 int ConfigAppSave();
@@ -74,6 +74,8 @@ int ConfigAppLoad()
 		VAR(nInterpolation);
 		VAR(nFMInterpolation);
 		VAR(EnableHiscores);
+		VAR(nAppRewindBudget);
+		VAR(nAppRewindInterval);
 		// Other
 		STR(szAppRomPaths[0]);
 		STR(szAppRomPaths[1]);
@@ -178,6 +180,9 @@ int ConfigAppSave()
 	VAR(nFMInterpolation);
 	_ftprintf(f, _T("\n// If non-zero, enable high score saving support.\n"));
 	VAR(EnableHiscores);
+	_ftprintf(f, _T("\n// Memory for rewinding (hold backspace) in MB, 0 to disable, and the frames between full states\n"));
+	VAR(nAppRewindBudget);
+	VAR(nAppRewindInterval);
 
 	fprintf(f, "\n// The paths to search for rom zips. (include trailing slash)\n");
 	STR(szAppRomPaths[0]);
@@ -103,6 +103,46 @@ int parseSwitches(int argc, char* argv[])
 		{
 			_tcscpy(CDEmuImage, argv[i + 1]);
 		}
+		if (strcmp(argv[i] + 1, "record") == 0 && i + 1 < argc)
+		{
+			szReplayRecord = argv[i + 1];
+		}
+		if (strcmp(argv[i] + 1, "replay") == 0 && i + 1 < argc)
+		{
+			szReplayPlay = argv[i + 1];
+		}
+#ifdef BUILD_SDL2
+		if (strcmp(argv[i] + 1, "bench") == 0 && i + 1 < argc)
+		{
+			bBench = 1;
+			szBenchDriver = argv[i + 1];
+		}
+		if (strcmp(argv[i] + 1, "frames") == 0 && i + 1 < argc)
+		{
+			nBenchFrames = atoi(argv[i + 1]);
+			if (nBenchFrames < 1)
+			{
+				nBenchFrames = 1;
+			}
+		}
+		if (strcmp(argv[i] + 1, "input") == 0 && i + 1 < argc)
+		{
+			szBenchInput = argv[i + 1];
+		}
+		if (strcmp(argv[i] + 1, "benchsuite") == 0 && i + 1 < argc)
+		{
+			bBench = 1;
+			szBenchSuite = argv[i + 1];
+		}
+		if (strcmp(argv[i] + 1, "hardware") == 0 && i + 1 < argc)
+		{
+			szBenchHardware = argv[i + 1];
+		}
+		if (strcmp(argv[i] + 1, "benchsound") == 0)
+		{
+			bBenchSound = 1;
+		}
+#endif
 	}
 	return 0;
 }
@@ -221,6 +261,16 @@ void DoGame(int gameToRun)
 {
 	if (!DrvInit(gameToRun, 0))
 	{
+		// from power-on, the driver is started again with the recording's seed and date
+		if (szReplayPlay)
+		{
+			StartReplay(szReplayPlay, DrvInitCallback);
+		}
+		else if (szReplayRecord)
+		{
+			StartRecord(szReplayRecord, DrvInitCallback);
+		}
+
 		MediaInit();
 		Init_Joysticks(usejoy);
 		RunMessageLoop();
@@ -309,7 +359,23 @@ int main(int argc, char* argv[])
 
 	parseSwitches(argc, argv);
 
+#ifdef BUILD_SDL2
+	if (bBenchSound)
+	{
+		return BenchSound();
+	}
+
+	if (bBench)
+	{
+		romname = szBenchDriver;
+	}
+#endif
+
+#ifdef BUILD_SDL2
+	if (romname == NULL && szBenchSuite == NULL)
+#else
 	if (romname == NULL)
+#endif
 	{
 		printf("Usage: %s [-cd] [-joy] [-menu] [-novsync] [-integerscale] [-fullscreen] [-dat] [-autosave] [-nearest] [-linear] [-best] <romname>\n", argv[0]);
 		printf("Note the -menu switch does not require a romname\n");
@@ -317,6 +383,15 @@ int main(int argc, char* argv[])
 		printf("e.g.: %s -menu -joy\n", argv[0]);
 		printf("For NeoCD games:\n");
 		printf("%s neocdz -cd path/to/ccd/filename.cue (or .ccd)\n", argv[0]);
+		printf("Input recording (from power-on, until you quit) and playback:\n");
+		printf("%s <romname> -record file.fr\n", argv[0]);
+		printf("%s <romname> -replay file.fr\n", argv[0]);
+#ifdef BUILD_SDL2
+		printf("Headless benchmark (no window or sound):\n");
+		printf("%s -bench <romname> [-frames 600] [-input script.txt | -replay file.fr]\n", argv[0]);
+		printf("%s -benchsuite results.json [-frames 600] [-hardware 0x01000000,0x05000000]\n", argv[0]);
+		printf("%s -benchsound\n", argv[0]);
+#endif
 		printf("Usage is restricted by the license at https://raw.githubusercontent.com/finalburnneo/FBNeo/master/src/license.txt\n");
 
 		if (!usemenu && !bAlwaysMenu && !dat)
@@ -361,13 +436,14 @@ int main(int argc, char* argv[])
 
 	SDL_setenv("SDL_AUDIODRIVER", "directsound", true);        // fix audio for windows
 #endif
-	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_JOYSTICK | SDL_INIT_AUDIO) < 0)
+	if (SDL_Init(bBench ? SDL_INIT_TIMER : (SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_JOYSTICK | SDL_INIT_AUDIO)) < 0)
 	{
 		printf("SDL could not initialize! SDL_Error: %s\n", SDL_GetError());
 		return 0;
 	}
-#endif
 
+	if (!bBench)
+#endif
 	SDL_ShowCursor(SDL_DISABLE);
 
 #if defined(BUILD_SDL2) && !defined(SDL_WINDOWS)
@@ -390,6 +466,11 @@ int main(int argc, char* argv[])
 		}
 	}
 	ComputeGammaLUT();
+
+	if (szReplayRecord || szReplayPlay)
+	{
+		EnableHiscores = 0;                                     // the hiscore file isn't part of the recording
+	}
 #if defined(BUILD_SDL2) && !defined(SDL_WINDOWS)
 	bprintf = AppDebugPrintf;
 #endif
@@ -408,6 +489,24 @@ int main(int argc, char* argv[])
 		}
 	}
 
+#ifdef BUILD_SDL2
+	if (bBench)
+	{
+		if (szBenchSuite)
+		{
+			return BenchSuite(szBenchSuite, nBenchFrames, szBenchHardware);
+		}
+
+		if (i == nBurnDrvCount)
+		{
+			printf("%s is not supported by FinalBurn Neo.\n", romname);
+			return 1;
+		}
+
+		return BenchRun(i, nBenchFrames, szBenchInput);
+	}
+#endif
+
 	if (usemenu || bAlwaysMenu)
 	{
 #ifdef BUILD_SDL2
@@ -1,18 +1,477 @@
 // Functions for recording & replaying input
-// Stub version for SDL/Pi
+//
+// The same .fr files as the win32 build: a "FB1 " header, the movie flags, a
+// savestate unless the recording starts from power-on, then the "FR1 " chunk with
+// the frame count, the date/time BurnGetLocalTime() gives the driver and the
+// Huffman coded (dynhuff.cpp) input changes, one 0xFF terminated list per frame.
+//
+// A recording from power-on re-initialises the driver with the pLoadGame callback
+// after setting movieFlags, so BurnRandomInit() picks the fixed seed and the driver
+// sees the recorded date/time from its first frame; both ends have to do this
+// before the driver runs for the replay to stay in sync.
+//
+// fbneo <romname> -record <file.fr>        records from power-on until the emulator quits
+// fbneo <romname> -replay <file.fr>        plays it back
+// fbneo -bench <romname> -replay <file.fr> plays it back headless, as fast as it goes
 #include "burner.h"
+#include "dynhuff.h"
 
-INT32  nReplayStatus = 0; // 1 record, 2 replay, 0 nothing
-INT32  nReplayUndoCount = 0;
+INT32 nReplayStatus = 0; // 1 record, 2 replay, 0 nothing
+bool bReplayReadOnly = false;
+INT32 nReplayUndoCount = 0;
+INT32 movieFlags = 0;
+UINT32 nTotalFrames = 0;
 UINT32 nReplayCurrentFrame = 0;
+
+char* szReplayRecord = NULL;
+char* szReplayPlay = NULL;
+
+// If a driver has external data that needs to be recorded every frame.
+INT32 nReplayExternalDataCount = 0;
+UINT8 *ReplayExternalData = NULL;
+
+#define MOVIE_FLAG_FROM_POWERON (1<<1)
+
+const UINT32 nMovieVersion = 0x0401;
+UINT32 nThisMovieVersion = 0;
+UINT32 nThisFBVersion = 0;
+
 UINT32 nStartFrame = 0;
+static UINT32 nEndFrame;
+
+static FILE* fp = NULL;
+static INT32 nSizeOffset;
+
+static short nPrevInputs[0x0100];
+
+struct MovieExtInfo
+{
+	// date & time
+	UINT32 year, month, day;
+	UINT32 hour, minute, second;
+};
+
+extern struct MovieExtInfo MovieInfo; // from burn.cpp
+
+INT32 RecordInput()
+{
+	struct BurnInputInfo bii;
+	memset(&bii, 0, sizeof(bii));
+
+	for (UINT32 i = 0; i < nGameInpCount; i++) {
+		BurnDrvGetInputInfo(&bii, i);
+		if (bii.pVal) {
+			if (bii.nType & BIT_GROUP_ANALOG) {
+				if (*bii.pShortVal != nPrevInputs[i]) {
+					EncodeBuffer(i);
+					EncodeBuffer(*bii.pShortVal >> 8);
+					EncodeBuffer(*bii.pShortVal & 0xFF);
+					nPrevInputs[i] = *bii.pShortVal;
+				}
+			} else {
+				if (*bii.pVal != nPrevInputs[i]) {
+					EncodeBuffer(i);
+					EncodeBuffer(*bii.pVal);
+					nPrevInputs[i] = *bii.pVal;
+				}
+			}
+		}
+	}
+	EncodeBuffer(0xFF);
+
+	if (nReplayExternalDataCount && ReplayExternalData) {
+		for (INT32 i = 0; i < nReplayExternalDataCount; i++) {
+			EncodeBuffer(ReplayExternalData[i]);
+		}
+	}
+
+	return 0;
+}
+
+// Returns 1 once the recording has run out (the replay is stopped by then)
+INT32 ReplayInput()
+{
+	UINT8 n;
+	struct BurnInputInfo bii;
+	memset(&bii, 0, sizeof(bii));
+
+	if ((UINT32)GetCurrentFrame() > nEndFrame) {	// every recorded frame has been played
+		StopReplay();
+		return 1;
+	}
+
+	// Just to be safe, restore the inputs to the known correct settings
+	for (UINT32 i = 0; i < nGameInpCount; i++) {
+		BurnDrvGetInputInfo(&bii, i);
+		if (bii.pVal) {
+			if (bii.nType & BIT_GROUP_ANALOG) {
+				*bii.pShortVal = nPrevInputs[i];
+			} else {
+				*bii.pVal = nPrevInputs[i];
+			}
+		}
+	}
+
+	// Now read all inputs that need to change from the .fr file
+	while ((n = DecodeBuffer()) != 0xFF) {
+		BurnDrvGetInputInfo(&bii, n);
+		if (bii.pVal) {
+			if (bii.nType & BIT_GROUP_ANALOG) {
+				*bii.pShortVal = nPrevInputs[n] = (DecodeBuffer() << 8) | DecodeBuffer();
+			} else {
+				*bii.pVal = nPrevInputs[n] = DecodeBuffer();
+			}
+		} else {
+			DecodeBuffer();
+		}
+	}
+
+	if (nReplayExternalDataCount && ReplayExternalData) {
+		for (INT32 i = 0; i < nReplayExternalDataCount; i++) {
+			ReplayExternalData[i] = DecodeBuffer();
+		}
+	}
+
+	if (end_of_buffer && (UINT32)GetCurrentFrame() < nEndFrame) {	// the file was cut short
+		StopReplay();
+		return 1;
+	}
+
+	return 0;
+}
+
+// Record to szFileName. With pLoadGame the recording starts from power-on (the driver
+// is initialised again through it), without it from the current state.
+INT32 StartRecord(const TCHAR* szFileName, INT32 (*pLoadGame)())
+{
+	INT32 nRet;
+
+	fp = NULL;
+	movieFlags = 0;
+	bReplayReadOnly = false;
+
+	memset(&MovieInfo, 0, sizeof(MovieInfo));
+	{
+		time_t nLocalTime = time(NULL);
+		tm* tmLocalTime = localtime(&nLocalTime);
+
+		MovieInfo.hour   = tmLocalTime->tm_hour;
+		MovieInfo.minute = tmLocalTime->tm_min;
+		MovieInfo.second = tmLocalTime->tm_sec;
+		MovieInfo.month  = tmLocalTime->tm_mon;
+		MovieInfo.day    = tmLocalTime->tm_mday;
+		MovieInfo.year   = tmLocalTime->tm_year;
+	}
+
+	if (pLoadGame) {
+		movieFlags |= MOVIE_FLAG_FROM_POWERON;
+		if (pLoadGame()) {
+			printf("*** Replay(record): error starting game.\n");
+			movieFlags = 0;
+			return 1;
+		}
+	}
+
+	{
+		const char szFileHeader[] = "FB1 ";				// File identifier
+		fp = _tfopen(szFileName, _T("w+b"));
+
+		nRet = 0;
+		if (fp == NULL) {
+			nRet = 1;
+		} else {
+			fwrite(&szFileHeader, 1, 4, fp);
+			fwrite(&movieFlags, 1, 4, fp);
+			if (movieFlags & MOVIE_FLAG_FROM_POWERON)
+				nRet = 1;
+			else
+				nRet = BurnStateSaveEmbed(fp, -1, 1);
+			if (nRet >= 0) {
+				const char szChunkHeader[] = "FR1 ";	// Chunk identifier
+				INT32 nZero = 0;
+
+				fwrite(&szChunkHeader, 1, 4, fp);		// Write chunk identifier
+
+				nSizeOffset = ftell(fp);
+
+				fwrite(&nZero, 1, 4, fp);				// reserve space for chunk size
+
+				fwrite(&nZero, 1, 4, fp);				// reserve space for number of frames
+
+				fwrite(&nZero, 1, 4, fp);				// undo count
+				fwrite(&nMovieVersion, 1, 4, fp);		// ThisMovieVersion
+				fwrite(&MovieInfo, 1, sizeof(MovieInfo), fp);
+				fwrite(&nBurnVer, 1, 4, fp);			// fb version#
+
+				nRet = EmbedCompressedFile(fp, -1);
+			}
+		}
+	}
+
+	if (nRet) {
+		if (fp) {
+			fclose(fp);
+			fp = NULL;
+		}
+
+		printf("*** Replay(record): can't create %s\n", szFileName);
+		movieFlags = 0;
+
+		return 1;
+	}
+
+	struct BurnInputInfo bii;
+	memset(&bii, 0, sizeof(bii));
+
+	nReplayStatus = 1;								// Set record status
+
+	nStartFrame = GetCurrentFrame();
+	nReplayUndoCount = 0;
+
+	// Create a baseline so we can just record the deltas afterwards
+	for (UINT32 i = 0; i < nGameInpCount; i++) {
+		BurnDrvGetInputInfo(&bii, i);
+		if (bii.pVal) {
+			if (bii.nType & BIT_GROUP_ANALOG) {
+				EncodeBuffer(*bii.pShortVal >> 8);
+				EncodeBuffer(*bii.pShortVal & 0xFF);
+				nPrevInputs[i] = *bii.pShortVal;
+			} else {
+				EncodeBuffer(*bii.pVal);
+				nPrevInputs[i] = *bii.pVal;
+			}
+		} else {
+			EncodeBuffer(0);
+		}
+	}
+
+	printf("*** Recording to %s started.\n", szFileName);
+
+	return 0;
+}
+
+// Play szFileName back, pLoadGame initialises the driver again for recordings from power-on
+INT32 StartReplay(const TCHAR* szFileName, INT32 (*pLoadGame)())
+{
+	INT32 nRet = 0;
+
+	const char szFileHeader[] = "FB1 ";					// File identifier
+	const char szChunkHeader[] = "FR1 ";				// Chunk identifier
+	char ReadHeader[] = "    ";
+
+	fp = _tfopen(szFileName, _T("r+b"));
+	if (!fp) {
+		printf("*** Replay(playback): can't open %s\n", szFileName);
+		return 1;
+	}
+
+	memset(ReadHeader, 0, 4);
+	fread(ReadHeader, 1, 4, fp);						// Read identifier
+	if (memcmp(ReadHeader, szFileHeader, 4)) {			// Not the right file type
+		nRet = 2;
+	} else {
+		fread(&movieFlags, 1, 4, fp);					// Read movie flags
+
+		if ((movieFlags & MOVIE_FLAG_FROM_POWERON) == 0) {
+			// Load the savestate associated with the recording
+			nRet = BurnStateLoadEmbed(fp, -1, 1, pLoadGame);
+		}
+	}
+
+	INT32 nEmbedPosition = 0;
+
+	if (nRet == 0) {
+		memset(ReadHeader, 0, 4);
+		fread(ReadHeader, 1, 4, fp);					// Read identifier
+		if (memcmp(ReadHeader, szChunkHeader, 4)) {		// Not the right file type
+			nRet = 2;
+		} else {
+			INT32 nChunkSize = 0;
+
+			nSizeOffset = ftell(fp);					// Save chunk size offset in case the file is re-recorded
+			fread(&nChunkSize, 1, 0x04, fp);			// Read chunk size
+			fread(&nTotalFrames, 1, 4, fp);				// Read framecount
+			fread(&nReplayUndoCount, 1, 4, fp);
+			fread(&nThisMovieVersion, 1, 4, fp);
+
+			memset(&MovieInfo, 0, sizeof(MovieInfo));
+			if (nThisMovieVersion >= 0x0401) {
+				fread(&MovieInfo, 1, sizeof(MovieInfo), fp);
+			}
+			fread(&nThisFBVersion, 1, 4, fp);
+			nEmbedPosition = ftell(fp);
+		}
+	}
+
+	// the flags and the date/time are in place, now the driver can start from power-on
+	if (nRet == 0 && (movieFlags & MOVIE_FLAG_FROM_POWERON)) {
+		if (pLoadGame == NULL || pLoadGame()) {
+			printf("*** Replay(playback): error starting game.\n");
+			nRet = 1;
+		}
+	}
+
+	if (nRet == 0) {
+		fseek(fp, nEmbedPosition, SEEK_SET);			// Seek back to the beginning of compressed data
+		nRet = EmbedCompressedFile(fp, -1);
+	}
+
+	if (nRet) {
+		if (fp) {
+			fclose(fp);
+			fp = NULL;
+		}
+
+		printf("*** Replay(playback): error loading %s\n", szFileName);
+		movieFlags = 0;
+
+		return 1;
+	}
+
+	nStartFrame = GetCurrentFrame();
+	nEndFrame = nStartFrame + nTotalFrames;
+
+	nReplayStatus = 2;							// Set replay status
+
+	{
+		struct BurnInputInfo bii;
+		memset(&bii, 0, sizeof(bii));
+
+		LoadCompressedFile();
+
+		// Get the baseline
+		for (UINT32 i = 0; i < nGameInpCount; i++) {
+			BurnDrvGetInputInfo(&bii, i);
+			if (bii.pVal) {
+				if (bii.nType & BIT_GROUP_ANALOG) {
+					*bii.pShortVal = nPrevInputs[i] = (DecodeBuffer() << 8) | DecodeBuffer();
+				} else {
+					*bii.pVal = nPrevInputs[i] = DecodeBuffer();
+				}
+			} else {
+				DecodeBuffer();
+			}
+		}
+	}
+
+	printf("*** Replay of %s started, %d frames.\n", szFileName, nTotalFrames);
+
+	return 0;
+}
+
+static void CloseRecord()
+{
+	INT32 nFrames = GetCurrentFrame() - nStartFrame;
+
+	WriteCompressedFile();
+
+	fseek(fp, 0, SEEK_END);
+	INT32 nChunkSize = ftell(fp) - 4 - nSizeOffset;		// Fill in chunk size and no of recorded frames
+	fseek(fp, nSizeOffset, SEEK_SET);
+	fwrite(&nChunkSize, 1, 4, fp);
+	fwrite(&nFrames, 1, 4, fp);
+	fwrite(&nReplayUndoCount, 1, 4, fp);
+
+	fclose(fp);
+	fp = NULL;
+}
+
+static void CloseReplay()
+{
+	CloseCompressedFile();
+
+	if(fp) {
+		fclose(fp);
+		fp = NULL;
+	}
+}
+
+void StopReplay()
+{
+	if (nReplayStatus) {
+		if (nReplayStatus == 1) {
+			printf("*** Recording stopped, recorded %d frames.\n", GetCurrentFrame() - nStartFrame);
+			CloseRecord();
+		} else {
+			UINT32 nFrames = GetCurrentFrame() - nStartFrame;
+			printf("*** Replay stopped, replayed %d frames.\n", (nFrames > nTotalFrames) ? nTotalFrames : nFrames);
+			CloseReplay();
+		}
+		nReplayStatus = 0;
+		nStartFrame = 0;
+	}
+}
+
+
+//#
+//#             Input Status Freezing
+//#
+//##############################################################################
+
+static inline void Write32(UINT8*& ptr, const unsigned long v)
+{
+	*ptr++ = (UINT8)(v&0xff);
+	*ptr++ = (UINT8)((v>>8)&0xff);
+	*ptr++ = (UINT8)((v>>16)&0xff);
+	*ptr++ = (UINT8)((v>>24)&0xff);
+}
+
+static inline UINT32 Read32(const UINT8*& ptr)
+{
+	UINT32 v;
+	v = (UINT32)(*ptr++);
+	v |= (UINT32)((*ptr++)<<8);
+	v |= (UINT32)((*ptr++)<<16);
+	v |= (UINT32)((*ptr++)<<24);
+	return v;
+}
+
+static inline void Write16(UINT8*& ptr, const UINT16 v)
+{
+	*ptr++ = (UINT8)(v&0xff);
+	*ptr++ = (UINT8)((v>>8)&0xff);
+}
+
+static inline UINT16 Read16(const UINT8*& ptr)
+{
+	UINT16 v;
+	v = (UINT16)(*ptr++);
+	v |= (UINT16)((*ptr++)<<8);
+	return v;
+}
 
 INT32 FreezeInput(UINT8** buf, INT32* size)
 {
+	*size = 4 + 2*nGameInpCount;
+	*buf = (UINT8*)malloc(*size);
+	if(!*buf)
+	{
+		return -1;
+	}
+
+	UINT8* ptr=*buf;
+	Write32(ptr, nGameInpCount);
+
+	for (UINT32 i = 0; i < nGameInpCount; i++)
+	{
+		Write16(ptr, nPrevInputs[i]);
+	}
+
 	return 0;
 }
 
 INT32 UnfreezeInput(const UINT8* buf, INT32 size)
 {
+	UINT32 n=Read32(buf);
+	if(n>0x100 || (unsigned)size < (4 + 2*n))
+	{
+		return -1;
+	}
+
+	for (UINT32 i = 0; i < n; i++)
+	{
+		nPrevInputs[i]=Read16(buf);
+	}
+
 	return 0;
 }
@@ -18,6 +18,10 @@ bool        bAppDoFast = 0;
 bool        bAppShowFPS = 0;
 static int  nFastSpeed = 6;
 
+bool        bAppDoRewind = 0;
+int         nAppRewindBudget = 0;           // MB, 0 = off
+int         nAppRewindInterval = 30;        // frames between full states
+
 UINT32 messageFrames = 0;
 char lastMessage[MESSAGE_MAX_LENGTH];
 
@@ -146,9 +150,34 @@ static int RunFrame(int bDraw, int bPause)
 	}
 	else
 	{
+		if (bAppDoRewind && !nReplayStatus)
+		{
+			nCurrentFrame -= RewindStep(2);                       // back two, this frame makes it one
+		}
+
 		nFramesEmulated++;
 		nCurrentFrame++;
-		InputMake(true);
+
+		if (nReplayStatus == 2)
+		{
+			InputMake(false);                                     // Update burner inputs, but not game inputs
+			if (ReplayInput())                                    // Read input from file
+			{
+				bRunPause = 1;                                    // Replay has finished
+				bAppDoFast = 0;
+				UpdateMessage((char*)"Replay finished");
+				return 0;
+			}
+		}
+		else
+		{
+			InputMake(true);
+		}
+
+		if (nReplayStatus == 1)
+		{
+			RecordInput();                                        // Write input to file
+		}
 	}
 
 	if (bDraw)
@@ -158,12 +187,17 @@ static int RunFrame(int bDraw, int bPause)
 		{
 		 	AudBlankSound();
 		}
+		if (!bPause)
+		{
+			RewindCapture();                                      // compressed while the screen is painted
+		}
 		VidPaint(0);                                              // paint the screen (no need to validate)
 	}
 	else
 	{                                       // frame skipping
 		pBurnDraw = NULL;                    // Make sure no image is drawn
 		BurnDrvFrame();
+		RewindCapture();
 	}
 
 	if (bAppShowFPS) {
@@ -317,13 +351,23 @@ int RunInit()
 	AudSoundPlay();
 
 	RunReset();
-	StatedAuto(0);
+	if (!nReplayStatus)
+	{
+		StatedAuto(0);                                            // would put the recording out of sync
+	}
+
+	if (nAppRewindBudget > 0)
+	{
+		RewindInit(nAppRewindBudget << 20, nAppRewindInterval);
+	}
 	return 0;
 }
 
 int RunExit()
 {
 	nNormalLast = 0;
+	StopReplay();
+	RewindExit();
 	StatedAuto(1);
 	return 0;
 }
@@ -363,6 +407,9 @@ int RunMessageLoop()
 				case SDLK_F11:
 					bAppShowFPS = !bAppShowFPS;
 					break;
+				case SDLK_BACKSPACE:
+					bAppDoRewind = 1;
+					break;
 #ifdef BUILD_SDL2
 				case SDLK_TAB:
 					ingame_gui_start(sdlRenderer);
@@ -379,6 +426,9 @@ int RunMessageLoop()
 				case SDLK_F1:
 					bAppDoFast = 0;
 					break;
+				case SDLK_BACKSPACE:
+					bAppDoRewind = 0;
+					break;
 
 				case SDLK_F12:
 					quit = 1;
@@ -8,5 +8,5 @@ void Reinitialise()
 
 INT32 is_netgame_or_recording() // returns: 1 = netgame, 2 = recording/playback
 {
-	return 0;
+	return (movieFlags & (1<<1)); // recording from power_on
 }
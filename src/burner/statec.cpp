@@ -1,16 +1,267 @@
 // Driver State Compression module
 #include "zlib.h"
 
-#include "burnint.h"
+#include "burner.h"
+
+// Codecs (see burner.h):
+//  STATE_CODEC_DEFLATE       zlib deflate at Z_DEFAULT_COMPRESSION (the on-disk format)
+//  STATE_CODEC_DEFLATE_FAST  zlib deflate at Z_BEST_SPEED (still readable by any build)
+//  STATE_CODEC_LZ            small in-tree LZ coder (LZ4 block style) for rewind/netplay use
+//
+// BurnStateDecompress() recognises the LZ format by its header, so buffers made with any
+// codec can be passed to it.
+
+#define LZ_STATE_MAGIC		0x315a4c46			// "FLZ1"
+#define LZ_STATE_HEADER		8					// magic, raw length
+#define LZ_STATE_MAX_RAW	(256 << 20)			// larger than any driver's state, anything past it is a corrupt header
+
+struct StateCodec {
+	INT32 (*CompBegin)(INT32 nRawLen);
+	INT32 (__cdecl *CompAcb)(struct BurnArea* pba);
+	INT32 (*CompEnd)();
+	INT32 (*DecompBegin)(UINT8* Def, INT32 nDefLen);
+	INT32 (__cdecl *DecompAcb)(struct BurnArea* pba);
+	INT32 (*DecompEnd)();
+};
 
 static UINT8* Comp = NULL;		// Compressed data buffer
 static INT32 nCompLen = 0;
 static INT32 nCompFill = 0;				// How much of the buffer has been filled so far
 
 static z_stream Zstr;					// Deflate stream
+static INT32 nZlibLevel = Z_DEFAULT_COMPRESSION;
+
+static UINT8* Raw = NULL;				// Uncompressed staging buffer (LZ codec), kept between calls
+static INT32 nRawAlloc = 0;
+static INT32 nRawFill = 0;
+static INT32 nRawLen = 0;
 
 // -----------------------------------------------------------------------------
-// Compression
+// Length pass
+
+static INT32 nStateLen = 0;
+
+static INT32 __cdecl StateLenAcb(struct BurnArea* pba)
+{
+	nStateLen += pba->nLen;
+
+	return 0;
+}
+
+static INT32 StateLen(INT32 nAction)
+{
+	nStateLen = 0;
+	BurnAcb = StateLenAcb;
+	BurnAreaScan(nAction, NULL);
+
+	return nStateLen;
+}
+
+// -----------------------------------------------------------------------------
+// LZ coder
+//
+// Sequences of: token (literal length << 4 | match length - 4), extra literal length bytes,
+// literals, 16-bit little endian match offset, extra match length bytes.  The last sequence
+// has literals only.
+
+#define LZ_HASH_BITS		14
+#define LZ_MIN_MATCH		4
+#define LZ_LAST_LITERALS	5
+#define LZ_MF_LIMIT			12
+#define LZ_MAX_OFFSET		65535
+
+static UINT32 LZHashTable[1 << LZ_HASH_BITS];		// BurnStateLZCompress()
+
+static inline UINT32 LZRead32(const UINT8* p)
+{
+	UINT32 v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline UINT32 LZHash(UINT32 v)
+{
+	return (v * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+static inline UINT8* LZWriteLength(UINT8* op, INT32 nLen)
+{
+	while (nLen >= 255) {
+		*op++ = 255;
+		nLen -= 255;
+	}
+	*op++ = (UINT8)nLen;
+
+	return op;
+}
+
+static inline UINT8* LZWriteLiterals(UINT8* op, UINT8* token, const UINT8* pLit, INT32 nLit)
+{
+	*token = (nLit >= 15 ? 15 : nLit) << 4;
+	if (nLit >= 15) {
+		op = LZWriteLength(op, nLit - 15);
+	}
+	memcpy(op, pLit, nLit);
+
+	return op + nLit;
+}
+
+// Worst case size of compressed data
+INT32 BurnStateLZBound(INT32 nLen)
+{
+	return nLen + (nLen / 255) + 16;
+}
+
+// As BurnStateLZCompress(), with the caller's STATE_LZ_WORKMEM bytes of hash table so it
+// can run on a worker thread alongside other compression
+INT32 BurnStateLZCompressWork(const UINT8* pSrc, INT32 nSrcLen, UINT8* pDest, INT32 nDestLen, void* pWork)
+{
+	if (nSrcLen < 0 || nDestLen < BurnStateLZBound(nSrcLen)) {
+		return -1;
+	}
+
+	UINT32* pHashTable = (UINT32*)pWork;
+
+	const UINT8* ip = pSrc;
+	const UINT8* anchor = pSrc;
+	const UINT8* end = pSrc + nSrcLen;
+	UINT8* op = pDest;
+
+	if (nSrcLen >= LZ_MF_LIMIT) {
+		const UINT8* mflimit = end - LZ_MF_LIMIT;
+		const UINT8* matchlimit = end - LZ_LAST_LITERALS;
+
+		while (ip < mflimit) {
+			UINT32 nSeq = LZRead32(ip);
+			UINT32 nHash = LZHash(nSeq);
+			UINT32 nPos = ip - pSrc;
+			UINT32 nRef = pHashTable[nHash];		// may be stale, so validate it
+			pHashTable[nHash] = nPos;
+
+			if (nRef >= nPos || (nPos - nRef) > LZ_MAX_OFFSET || LZRead32(pSrc + nRef) != nSeq) {
+				ip += 1 + ((ip - anchor) >> 6);		// skip faster through incompressible data
+				continue;
+			}
+
+			const UINT8* ref = pSrc + nRef;
+
+			while (ip > anchor && ref > pSrc && ip[-1] == ref[-1]) {
+				ip--;
+				ref--;
+			}
+
+			const UINT8* mp = ip + LZ_MIN_MATCH;
+			const UINT8* mr = ref + LZ_MIN_MATCH;
+			while (mp < matchlimit && *mp == *mr) {
+				mp++;
+				mr++;
+			}
+
+			INT32 nMatch = (mp - ip) - LZ_MIN_MATCH;
+			INT32 nOffset = ip - ref;
+
+			UINT8* token = op++;
+			op = LZWriteLiterals(op, token, anchor, ip - anchor);
+			*token |= (nMatch >= 15 ? 15 : nMatch);
+
+			*op++ = nOffset & 0xff;
+			*op++ = (nOffset >> 8) & 0xff;
+			if (nMatch >= 15) {
+				op = LZWriteLength(op, nMatch - 15);
+			}
+
+			ip = anchor = mp;
+
+			pHashTable[LZHash(LZRead32(ip - 2))] = (ip - 2) - pSrc;
+		}
+	}
+
+	UINT8* token = op++;
+	op = LZWriteLiterals(op, token, anchor, end - anchor);
+
+	return op - pDest;
+}
+
+// Returns the compressed length, or -1 if pDest is smaller than BurnStateLZBound(nSrcLen)
+INT32 BurnStateLZCompress(const UINT8* pSrc, INT32 nSrcLen, UINT8* pDest, INT32 nDestLen)
+{
+	return BurnStateLZCompressWork(pSrc, nSrcLen, pDest, nDestLen, LZHashTable);
+}
+
+// Returns the decompressed length, or -1 if the data is corrupt or doesn't fit
+INT32 BurnStateLZDecompress(const UINT8* pSrc, INT32 nSrcLen, UINT8* pDest, INT32 nDestLen)
+{
+	const UINT8* ip = pSrc;
+	const UINT8* iend = pSrc + nSrcLen;
+	UINT8* op = pDest;
+	UINT8* oend = pDest + nDestLen;
+
+	while (ip < iend) {
+		UINT32 nToken = *ip++;
+		UINT32 nLit = nToken >> 4;
+		UINT32 s;
+
+		if (nLit == 15) {
+			do {
+				if (ip >= iend) return -1;
+				s = *ip++;
+				nLit += s;
+			} while (s == 255);
+		}
+
+		if ((UINT32)(iend - ip) < nLit || (UINT32)(oend - op) < nLit) {
+			return -1;
+		}
+
+		memcpy(op, ip, nLit);
+		op += nLit;
+		ip += nLit;
+
+		if (ip >= iend) {
+			break;									// last sequence, literals only
+		}
+
+		if (iend - ip < 2) {
+			return -1;
+		}
+
+		UINT32 nOffset = ip[0] | (ip[1] << 8);
+		ip += 2;
+
+		if (nOffset == 0 || nOffset > (UINT32)(op - pDest)) {
+			return -1;
+		}
+
+		UINT32 nMatch = nToken & 15;
+		if (nMatch == 15) {
+			do {
+				if (ip >= iend) return -1;
+				s = *ip++;
+				nMatch += s;
+			} while (s == 255);
+		}
+		nMatch += LZ_MIN_MATCH;
+
+		if ((UINT32)(oend - op) < nMatch) {
+			return -1;
+		}
+
+		const UINT8* ref = op - nOffset;
+		if (nOffset >= nMatch) {
+			memcpy(op, ref, nMatch);
+		} else {
+			for (UINT32 i = 0; i < nMatch; i++) {	// overlapping copy (runs)
+				op[i] = ref[i];
+			}
+		}
+		op += nMatch;
+	}
+
+	return op - pDest;
+}
+
+// -----------------------------------------------------------------------------
+// Deflate codec
 
 static INT32 CompEnlarge(INT32 nAdd)
 {
@@ -23,7 +274,6 @@ static INT32 CompEnlarge(INT32 nAdd)
 	}
 
 	Comp = (UINT8*)NewMem;
-	memset(Comp + nCompLen, 0, nAdd);
 	nCompLen += nAdd;
 
 	return 0;
@@ -78,7 +328,19 @@ static INT32 CompGo(INT32 bFinish)
 	return 0;
 }
 
-static INT32 __cdecl StateCompressAcb(struct BurnArea* pba)
+static INT32 DeflateCompBegin(INT32 nLen)
+{
+	memset(&Zstr, 0, sizeof(Zstr));
+
+	if (deflateInit(&Zstr, nZlibLevel) != Z_OK) {
+		return 1;
+	}
+
+	// Size the buffer from the length pass, so CompGo() shouldn't need to enlarge it
+	return CompEnlarge(deflateBound(&Zstr, nLen) + 1024);
+}
+
+static INT32 __cdecl DeflateCompAcb(struct BurnArea* pba)
 {
 	// Set the data as the next available input
 	Zstr.next_in = (UINT8*)pba->Data;
@@ -92,52 +354,36 @@ static INT32 __cdecl StateCompressAcb(struct BurnArea* pba)
 	return 0;
 }
 
-// Compress a state using deflate
-INT32 BurnStateCompress(UINT8** pDef, INT32* pnDefLen, INT32 bAll)
+static INT32 DeflateCompEnd()
 {
-	void* NewMem = NULL;
-
-	memset(&Zstr, 0, sizeof(Zstr));
-
-	Comp = NULL; nCompLen = 0; nCompFill = 0;					// Begin with a zero-length buffer
-	if (CompEnlarge(8 * 1024)) {
-		return 1;
-	}
-
-	deflateInit(&Zstr, Z_DEFAULT_COMPRESSION);
-
-	BurnAcb = StateCompressAcb;									// callback our function with each area
-
-	if (bAll) BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);		// scan all ram, read (from driver <- decompress)
-	else      BurnAreaScan(ACB_NVRAM    | ACB_READ, NULL);		// scan nvram,   read (from driver <- decompress)
-
 	// Finish off
 	CompGo(1);
 
 	deflateEnd(&Zstr);
 
 	// Size down
-	NewMem = realloc(Comp, nCompFill);
+	void* NewMem = realloc(Comp, nCompFill);
 	if (NewMem) {
 		Comp = (UINT8*)NewMem;
 		nCompLen = nCompFill;
 	}
 
-	// Return the buffer
-	if (pDef) {
-		*pDef = Comp;
-	}
-	if (pnDefLen) {
-		*pnDefLen = nCompFill;
-	}
-
 	return 0;
 }
 
-// -----------------------------------------------------------------------------
-// Decompression
+static INT32 DeflateDecompBegin(UINT8* Def, INT32 nDefLen)
+{
+	memset(&Zstr, 0, sizeof(Zstr));
+	inflateInit(&Zstr);
+
+	// Set all of the buffer as available input
+	Zstr.next_in = (UINT8*)Def;
+	Zstr.avail_in = nDefLen;
+
+	return 0;
+}
 
-static INT32 __cdecl StateDecompressAcb(struct BurnArea* pba)
+static INT32 __cdecl DeflateDecompAcb(struct BurnArea* pba)
 {
 	Zstr.next_out =(UINT8*)pba->Data;
 	Zstr.avail_out = pba->nLen;
@@ -150,22 +396,231 @@ static INT32 __cdecl StateDecompressAcb(struct BurnArea* pba)
 	return 0;
 }
 
-INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll)
+static INT32 DeflateDecompEnd()
 {
+	inflateEnd(&Zstr);
 	memset(&Zstr, 0, sizeof(Zstr));
-	inflateInit(&Zstr);
 
-	// Set all of the buffer as available input
-	Zstr.next_in = (UINT8*)Def;
-	Zstr.avail_in = nDefLen;
+	return 0;
+}
 
-	BurnAcb = StateDecompressAcb;								// callback our function with each area
+// -----------------------------------------------------------------------------
+// LZ codec - areas are gathered into one staging buffer and compressed in one go
 
-	if (bAll) BurnAreaScan(ACB_FULLSCAN | ACB_WRITE, NULL);		// scan all ram, write (to driver <- decompress)
-	else      BurnAreaScan(ACB_NVRAM    | ACB_WRITE, NULL);		// scan nvram,   write (to driver <- decompress)
+static INT32 RawEnlarge(INT32 nLen)
+{
+	if (nLen > nRawAlloc) {
+		void* NewMem = realloc(Raw, nLen);
+		if (NewMem == NULL) {
+			return 1;
+		}
+		Raw = (UINT8*)NewMem;
+		nRawAlloc = nLen;
+	}
 
-	inflateEnd(&Zstr);
-	memset(&Zstr, 0, sizeof(Zstr));
+	return 0;
+}
+
+static INT32 LZCompBegin(INT32 nLen)
+{
+	if (RawEnlarge(nLen)) {
+		return 1;
+	}
+
+	nRawLen = nLen;
+	nRawFill = 0;
+
+	return CompEnlarge(LZ_STATE_HEADER + BurnStateLZBound(nLen));
+}
+
+static INT32 __cdecl LZCompAcb(struct BurnArea* pba)
+{
+	if (nRawFill + (INT32)pba->nLen > nRawLen) {				// area grew since the length pass
+		if (RawEnlarge(nRawFill + pba->nLen)) {
+			return 1;
+		}
+		nRawLen = nRawFill + pba->nLen;
+	}
+
+	memcpy(Raw + nRawFill, pba->Data, pba->nLen);
+	nRawFill += pba->nLen;
 
 	return 0;
 }
+
+static INT32 LZCompEnd()
+{
+	INT32 nNeed = LZ_STATE_HEADER + BurnStateLZBound(nRawFill);
+	if (nNeed > nCompLen && CompEnlarge(nNeed - nCompLen)) {
+		return 1;
+	}
+
+	UINT32 nHeader[2] = { LZ_STATE_MAGIC, (UINT32)nRawFill };
+	memcpy(Comp, nHeader, sizeof(nHeader));
+
+	INT32 nLen = BurnStateLZCompress(Raw, nRawFill, Comp + LZ_STATE_HEADER, nCompLen - LZ_STATE_HEADER);
+	if (nLen < 0) {
+		return 1;
+	}
+
+	nCompFill = LZ_STATE_HEADER + nLen;
+
+	return 0;
+}
+
+static INT32 LZDecompBegin(UINT8* Def, INT32 nDefLen)
+{
+	UINT32 nHeader[2];
+
+	if (nDefLen < LZ_STATE_HEADER) {
+		return 1;
+	}
+
+	memcpy(nHeader, Def, sizeof(nHeader));
+
+	if (nHeader[1] == 0 || nHeader[1] > LZ_STATE_MAX_RAW) {
+		return 1;
+	}
+
+	if (RawEnlarge(nHeader[1])) {
+		return 1;
+	}
+
+	nRawLen = BurnStateLZDecompress(Def + LZ_STATE_HEADER, nDefLen - LZ_STATE_HEADER, Raw, nHeader[1]);
+	if (nRawLen != (INT32)nHeader[1]) {
+		return 1;
+	}
+
+	nRawFill = 0;
+
+	return 0;
+}
+
+static INT32 __cdecl LZDecompAcb(struct BurnArea* pba)
+{
+	if (nRawFill + (INT32)pba->nLen > nRawLen) {
+		return 1;
+	}
+
+	memcpy(pba->Data, Raw + nRawFill, pba->nLen);
+	nRawFill += pba->nLen;
+
+	return 0;
+}
+
+static INT32 LZDecompEnd()
+{
+	return (nRawFill == nRawLen) ? 0 : 1;
+}
+
+static StateCodec StateCodecs[] = {
+	{ DeflateCompBegin, DeflateCompAcb, DeflateCompEnd, DeflateDecompBegin, DeflateDecompAcb, DeflateDecompEnd },
+	{ DeflateCompBegin, DeflateCompAcb, DeflateCompEnd, DeflateDecompBegin, DeflateDecompAcb, DeflateDecompEnd },
+	{ LZCompBegin,      LZCompAcb,      LZCompEnd,      LZDecompBegin,      LZDecompAcb,      LZDecompEnd      },
+};
+
+// -----------------------------------------------------------------------------
+// Compression
+
+// Size of the uncompressed state
+INT32 BurnStateLen(INT32 bAll)
+{
+	INT32 nAction = bAll ? ACB_FULLSCAN : ACB_NVRAM;
+
+	INT32 nLen = BurnStateCacheLen(nAction);
+	if (nLen < 0) {
+		nLen = StateLen(nAction);
+	}
+
+	return nLen;
+}
+
+// Compress a state using the selected codec
+INT32 BurnStateCompressEx(UINT8** pDef, INT32* pnDefLen, INT32 bAll, INT32 nCodec)
+{
+	INT32 nAction = bAll ? ACB_FULLSCAN : ACB_NVRAM;
+	INT32 nRet = 0;
+
+	if (nCodec < STATE_CODEC_DEFLATE || nCodec > STATE_CODEC_LZ) {
+		nCodec = STATE_CODEC_DEFLATE;
+	}
+
+	StateCodec* pCodec = &StateCodecs[nCodec];
+	nZlibLevel = (nCodec == STATE_CODEC_DEFLATE_FAST) ? Z_BEST_SPEED : Z_DEFAULT_COMPRESSION;
+
+	Comp = NULL; nCompLen = 0; nCompFill = 0;					// Begin with a zero-length buffer
+
+	// rewind/netplay states, the area list BurnStateCacheSave() keeps saves going through the driver twice
+	INT32 nLen = (nCodec == STATE_CODEC_LZ) ? BurnStateCacheLen(nAction) : -1;
+	if (nLen < 0) {
+		nLen = StateLen(nAction);
+	}
+
+	if (pCodec->CompBegin(nLen)) {
+		if (Comp) {
+			free(Comp);
+			Comp = NULL;
+		}
+		return 1;
+	}
+
+	if (nCodec == STATE_CODEC_LZ && BurnStateCacheSave(nAction, Raw, nRawLen) == 0) {
+		nRawFill = nRawLen;
+	} else {
+		nRawFill = 0;
+		BurnAcb = pCodec->CompAcb;								// callback our function with each area
+
+		BurnAreaScan(nAction | ACB_READ, NULL);					// scan ram, read (from driver <- decompress)
+	}
+
+	nRet = pCodec->CompEnd();
+
+	if (nRet && Comp) {
+		free(Comp);
+		Comp = NULL;
+		nCompFill = 0;
+	}
+
+	// Return the buffer
+	if (pDef) {
+		*pDef = Comp;
+	}
+	if (pnDefLen) {
+		*pnDefLen = nCompFill;
+	}
+
+	return nRet;
+}
+
+// Compress a state using deflate
+INT32 BurnStateCompress(UINT8** pDef, INT32* pnDefLen, INT32 bAll)
+{
+	return BurnStateCompressEx(pDef, pnDefLen, bAll, STATE_CODEC_DEFLATE);
+}
+
+// -----------------------------------------------------------------------------
+// Decompression
+
+INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll)
+{
+	INT32 nAction = bAll ? ACB_FULLSCAN : ACB_NVRAM;
+	StateCodec* pCodec = &StateCodecs[STATE_CODEC_DEFLATE];
+
+	if (nDefLen >= LZ_STATE_HEADER) {
+		UINT32 nMagic;
+		memcpy(&nMagic, Def, sizeof(nMagic));
+		if (nMagic == LZ_STATE_MAGIC) {
+			pCodec = &StateCodecs[STATE_CODEC_LZ];
+		}
+	}
+
+	if (pCodec->DecompBegin(Def, nDefLen)) {
+		return 1;
+	}
+
+	BurnAcb = pCodec->DecompAcb;								// callback our function with each area
+
+	BurnAreaScan(nAction | ACB_WRITE, NULL);					// scan ram, write (to driver <- decompress)
+
+	return pCodec->DecompEnd();
+}
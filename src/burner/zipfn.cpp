@@ -1,4 +1,10 @@
 // Zip module
+#if defined(_WIN32)
+ #include <windows.h>
+#else
+ #include <sys/time.h>
+#endif
+
 #include "burner.h"
 #include "unzip.h"
 
@@ -398,3 +404,183 @@ INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, I
 
 	return 0;
 }
+
+// ---------------------------------------------------------------------------
+// Rom prefetch
+//
+// The frontend queues every rom of the driver with ZipPrefetchAdd() once the
+// archives have been scanned, ZipPrefetchRun() inflates them all on the worker
+// threads (each job opens its own handle on the archive), and the frontend's
+// BurnExtLoadRom handler takes the data from ZipPrefetchGet() while the driver
+// loads. Entries that can't be staged (7z archives, over the size limit) return
+// -1 from ZipPrefetchGet() and are loaded the normal way.
+
+#define PREFETCH_MAX_BYTES	0x10000000 // don't stage more than 256 MB
+
+struct PrefetchEntry {
+	char szZip[MAX_PATH];
+	char szName[64];
+	INT32 nEntry;				// position in the archive
+	INT32 nLen;
+	UINT8* pData;
+	INT32 nWrote;
+	INT32 nRet;					// -1 = not staged, else as ZipLoadFile()
+	INT32 nTime;				// microseconds
+};
+
+static struct PrefetchEntry* PrefetchList = NULL;
+static INT32 nPrefetchCount = 0;
+
+static INT64 PrefetchTime()
+{
+#if defined(_WIN32)
+	LARGE_INTEGER nCount, nFreq;
+	QueryPerformanceCounter(&nCount);
+	QueryPerformanceFrequency(&nFreq);
+	return (INT64)((double)nCount.QuadPart * 1000000.0 / (double)nFreq.QuadPart);
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (INT64)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+static void PrefetchJob(void*, INT32 i)
+{
+	struct PrefetchEntry* pe = &PrefetchList[i];
+	if (pe->nLen <= 0) return;
+
+	INT64 nStart = PrefetchTime();
+
+	char szFileName[MAX_PATH + 8];
+	sprintf(szFileName, "%s.zip", pe->szZip);
+
+	unzFile z = unzOpen(szFileName);
+	if (z == NULL) return;
+
+	INT32 nRet = unzGoToFirstFile(z);
+	for (INT32 n = 0; n < pe->nEntry && nRet == UNZ_OK; n++) {
+		nRet = unzGoToNextFile(z);
+	}
+
+	if (nRet == UNZ_OK) {
+		unz_file_info FileInfo;
+		unzGetCurrentFileInfo(z, &FileInfo, pe->szName, sizeof(pe->szName), NULL, 0, NULL, 0);
+	}
+
+	if (nRet == UNZ_OK && unzOpenCurrentFile(z) == UNZ_OK) {
+		pe->pData = (UINT8*)malloc(pe->nLen);
+
+		if (pe->pData) {
+			nRet = unzReadCurrentFile(z, pe->pData, pe->nLen);
+			pe->nWrote = (nRet >= 0) ? nRet : 0;
+
+			nRet = unzCloseCurrentFile(z);
+			pe->nRet = (nRet == UNZ_CRCERROR) ? 2 : (nRet != UNZ_OK) ? 1 : 0;
+		} else {
+			unzCloseCurrentFile(z);
+		}
+	}
+
+	unzClose(z);
+
+	pe->nTime = (INT32)(PrefetchTime() - nStart);
+}
+
+// Queue rom nRom (entry nEntry of archive szZip, without extension)
+INT32 ZipPrefetchAdd(char* szZip, INT32 nEntry, INT32 nLen, INT32 nRom)
+{
+	if (szZip == NULL || nRom < 0 || nLen <= 0) return 1;
+
+	if (nRom >= nPrefetchCount) {
+		struct PrefetchEntry* pList = (struct PrefetchEntry*)realloc(PrefetchList, (nRom + 1) * sizeof(struct PrefetchEntry));
+		if (pList == NULL) return 1;
+
+		memset(pList + nPrefetchCount, 0, (nRom + 1 - nPrefetchCount) * sizeof(struct PrefetchEntry));
+		for (INT32 i = nPrefetchCount; i <= nRom; i++) {
+			pList[i].nRet = -1;
+		}
+
+		PrefetchList = pList;
+		nPrefetchCount = nRom + 1;
+	}
+
+	struct PrefetchEntry* pe = &PrefetchList[nRom];
+	if (pe->pData) return 1;
+
+	strncpy(pe->szZip, szZip, MAX_PATH - 1);
+	pe->nEntry = nEntry;
+	pe->nLen = nLen;
+
+	return 0;
+}
+
+// Inflate everything queued with ZipPrefetchAdd(), then print the time taken by each rom
+INT32 ZipPrefetchRun()
+{
+	if (nPrefetchCount == 0) return 0;
+
+	// stop staging once the set gets too big, the remaining roms are loaded normally
+	INT64 nTotal = 0;
+	for (INT32 i = 0; i < nPrefetchCount; i++) {
+		if (nTotal + PrefetchList[i].nLen > PREFETCH_MAX_BYTES) {
+			PrefetchList[i].nLen = 0;
+		}
+		nTotal += PrefetchList[i].nLen;
+	}
+
+	INT64 nStart = PrefetchTime();
+
+	BurnThreadRun(PrefetchJob, NULL, nPrefetchCount);
+
+	INT64 nElapsed = PrefetchTime() - nStart;
+	INT64 nSum = 0;
+	INT32 nStaged = 0;
+
+	for (INT32 i = 0; i < nPrefetchCount; i++) {
+		struct PrefetchEntry* pe = &PrefetchList[i];
+		if (pe->nLen <= 0) continue;
+
+		if (pe->nRet >= 0) {
+			bprintf(PRINT_NORMAL, _T("    rom %3d: %-24hs %9d bytes %7.2f ms%s\n"), i, pe->szName, pe->nWrote, pe->nTime / 1000.0, pe->nRet ? _T(" (error)") : _T(""));
+			nStaged++;
+		}
+
+		nSum += pe->nTime;
+	}
+
+	bprintf(PRINT_NORMAL, _T("*** Prefetched %d roms (%d MB) on %d threads in %.2f ms (%.2f ms summed over roms)\n"), nStaged, (INT32)(nTotal >> 20), BurnThreadCount(), nElapsed / 1000.0, nSum / 1000.0);
+
+	return 0;
+}
+
+// Copy a staged rom to Dest, returns -1 if rom i wasn't staged, otherwise the ZipLoadFile() result
+INT32 ZipPrefetchGet(INT32 i, UINT8* Dest, INT32 nLen, INT32* pnWrote)
+{
+	if (i < 0 || i >= nPrefetchCount || PrefetchList[i].pData == NULL || PrefetchList[i].nRet < 0) return -1;
+
+	struct PrefetchEntry* pe = &PrefetchList[i];
+	INT32 nCopy = (pe->nWrote < nLen) ? pe->nWrote : nLen;
+
+	memcpy(Dest, pe->pData, nCopy);
+	if (pnWrote != NULL) *pnWrote = nCopy;
+
+	return pe->nRet;
+}
+
+// Free the staging buffers (after the driver has loaded its roms)
+void ZipPrefetchExit()
+{
+	for (INT32 i = 0; i < nPrefetchCount; i++) {
+		if (PrefetchList[i].pData) {
+			free(PrefetchList[i].pData);
+		}
+	}
+
+	if (PrefetchList) {
+		free(PrefetchList);
+		PrefetchList = NULL;
+	}
+
+	nPrefetchCount = 0;
+}
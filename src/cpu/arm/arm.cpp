@@ -333,6 +333,8 @@ static int end_run = 0;
 
 int ArmRun( int cycles )
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	UINT32 pc;
 	UINT32 insn;
 
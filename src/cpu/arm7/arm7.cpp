@@ -37,6 +37,9 @@
 #include "burnint.h"
 #include "arm7core.h"
 #include "arm7_intf.h"
+#if defined ARM7_X64_DRC
+#include "x64/arm7_x64.h"
+#endif
 
 /* Example for showing how Co-Proc functions work */
 #define TEST_COPROC_FUNCS 0
@@ -81,6 +84,9 @@ static int ARM7_ICOUNT;
 static int total_cycles = 0;
 static int curr_cycles = 0;
 static int end_run = 0;
+#if defined ARM7_X64_DRC
+static int drc_irq = 0;			// a line changed under translated code, check once its instruction is done
+#endif
 
 void Arm7Open(int ) 
 {
@@ -146,11 +152,58 @@ void Arm7NewFrame()
 #endif
 
 	total_cycles = 0;
+
+#if defined ARM7_X64_DRC
+	if (pArm7DrcCode) Arm7DrcVerify();
+#endif
 }
 
+// short backward branches are looked at by burn_idle.cpp
+static INT32 nArm7IdleCore = -1;
+static void arm7_idle_branch(UINT32 from, UINT32 to);
+
+#define ARM7_IDLE_BRANCH(from, to)	if (nArm7IdleCore >= 0 && (UINT32)((from) - (to)) <= BURN_IDLE_MAX_LOOP) arm7_idle_branch(from, to)
+
 /* include the arm7 core */
 #include "arm7core.c"
 
+// hash of everything a wait loop could change in the registers
+static UINT32 arm7_idle_state()
+{
+	UINT32 h = GET_CPSR;
+
+	for (INT32 i = 0; i < 15; i++) {
+		h = h * 31 + GET_REGISTER(i);
+	}
+
+	return h;
+}
+
+static void arm7_idle_branch(UINT32 from, UINT32 to)
+{
+	if (ARM7.pendingIrq | ARM7.pendingFiq | ARM7.pendingAbtD | ARM7.pendingAbtP | ARM7.pendingUnd | ARM7.pendingSwi) return;
+	if (end_run) return;
+
+	INT32 iteration = BurnIdleBranch(nArm7IdleCore, from, to, Arm7TotalCycles());
+	if (iteration == 0 || curr_cycles - ARM7_ICOUNT < iteration) return;	// its loads may be from before this run
+
+	// skip whole iterations, leaving the last one to run before the slice ends
+	INT32 left = ARM7_ICOUNT - 1;
+	if (left < iteration) return;
+
+	INT32 skip = left - (left % iteration);
+	ARM7_ICOUNT -= skip;
+	BurnIdleSkip(skip);
+}
+
+// returns -1 if idle loops aren't looked at (and writes needn't be counted)
+INT32 Arm7IdleRegister()
+{
+	nArm7IdleCore = BurnIdleRegister(&Arm7Config, arm7_idle_state);
+
+	return nArm7IdleCore;
+}
+
 /***************************************************************************
  * CPU SPECIFIC IMPLEMENTATIONS
  **************************************************************************/
@@ -168,6 +221,10 @@ void Arm7Reset()
 
     // must call core reset
     arm7_core_reset();
+
+#if defined ARM7_X64_DRC
+	if (pArm7DrcCode) Arm7DrcVerify();
+#endif
 }
 
 /*
@@ -182,16 +239,94 @@ int Arm7Run(int cycles)
 	if (!DebugCPU_ARM7Initted) bprintf(PRINT_ERROR, _T("Arm7Run called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
+#if defined ARM7_X64_DRC
+	// Arm7Run(0) (irq auto) and runs from inside the recompiler stay on the interpreter
+	if (pArm7DrcCode && cycles > 0 && !Arm7DrcRunning()) {
+		ARM7_ICOUNT = cycles;
+		curr_cycles = cycles;
+		end_run = 0;
+
+		// translated code doesn't look at pending lines, the interpreter takes them after its first instruction
+		if (ARM7.pendingIrq | ARM7.pendingFiq | ARM7.pendingAbtD | ARM7.pendingAbtP | ARM7.pendingUnd | ARM7.pendingSwi) {
+			Arm7DrcStep();
+		}
+
+		while (ARM7_ICOUNT > 0 && !end_run) {
+			if (Arm7DrcRun() == 0) {
+				Arm7DrcStep();
+			} else if (drc_irq) {
+				drc_irq = 0;
+				ARM7_CHECKIRQ;
+			}
+		}
+
+		cycles = curr_cycles - ARM7_ICOUNT;
+		total_cycles += cycles;
+		curr_cycles = ARM7_ICOUNT = 0;
+
+		return cycles;
+	}
+#endif
+
 /* include the arm7 core execute code */
 #include "arm7exec.c"
 }
 
+#if defined ARM7_X64_DRC
+INT32 Arm7DrcStep()
+{
+#define ARM7_EXEC_STEP
+#include "arm7exec.c"
+#undef ARM7_EXEC_STEP
+}
+
+void Arm7DrcGetContext(Arm7DrcContext* pContext)
+{
+	pContext->pRegs = ARM7.sArmRegister;
+	pContext->pICount = &ARM7_ICOUNT;
+	pContext->pEndRun = &end_run;
+}
+
+INT32 Arm7DrcIdleAllowed(UINT32 pc)
+{
+	return BurnIdleAllowed(nArm7IdleCore, pc);
+}
+
+INT32 Arm7DrcIdleCounting()
+{
+	return nArm7IdleCore >= 0;
+}
+
+void Arm7DrcIdleBranch(UINT32 from, UINT32 to)
+{
+	arm7_idle_branch(from, to);
+}
+#endif
+
 void arm7_set_irq_line(int irqline, int state)
 {
 #if defined FBNEO_DEBUG
 	if (!DebugCPU_ARM7Initted) bprintf(PRINT_ERROR, _T("arm7_set_irq_line called without init\n"));
 #endif
 
+#if defined ARM7_X64_DRC
+	if (pArm7DrcCode && Arm7DrcInHandler()) {
+		// a handler of a translated instruction: latch the line, the recompiler stops after the
+		// instruction and Arm7Run() checks, as the interpreter does after every instruction
+		switch (irqline) {
+			case ARM7_IRQ_LINE:					ARM7.pendingIrq = state & 1; break;
+			case ARM7_FIRQ_LINE:				ARM7.pendingFiq = state & 1; break;
+			case ARM7_ABORT_EXCEPTION:			ARM7.pendingAbtD = state & 1; break;
+			case ARM7_ABORT_PREFETCH_EXCEPTION:	ARM7.pendingAbtP = state & 1; break;
+			case ARM7_UNDEFINE_EXCEPTION:		ARM7.pendingUnd = state & 1; break;
+		}
+		drc_irq = 1;
+		return;
+	}
+#endif
+
 	// must call core
 	arm7_core_set_irq_line(irqline,state);
 }
@@ -216,5 +351,9 @@ int Arm7Scan(int nAction)
 		SCAN_VAR(curr_cycles);
 	}
 
+#if defined ARM7_X64_DRC
+	if (pArm7DrcCode && (nAction & ACB_WRITE)) Arm7DrcVerify();
+#endif
+
 	return 0;
 }
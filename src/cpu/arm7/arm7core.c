@@ -814,7 +814,14 @@ static void HandleBranch(UINT32 insn)
     /* Sign-extend the 24-bit offset in our calculations */
     if (off & 0x2000000u)
     {
+        UINT32 pc = R15;
+
         R15 -= ((~(off | 0xfc000000u)) + 1) - 8;
+
+        if ((insn & INSN_BL) == 0)
+        {
+            ARM7_IDLE_BRANCH(pc, R15);
+        }
     }
     else
     {
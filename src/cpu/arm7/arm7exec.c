@@ -36,6 +36,9 @@
  *         #include "arm7exec.c"
  *         }
  *
+ *         With ARM7_EXEC_STEP defined it runs a single instruction on the current
+ *         icount and returns end_run (used by the recompiler, x64/arm7_x64.cpp).
+ *
 *****************************************************************************/
 
 /* This implementation uses an improved switch() for hopefully faster opcode fetches compared to my last version
@@ -44,9 +47,11 @@
     UINT32 pc;
     UINT32 insn;
 
+#ifndef ARM7_EXEC_STEP
     ARM7_ICOUNT = cycles;
     curr_cycles = cycles;
 	end_run = 0;
+#endif
 
     do
     {
@@ -1360,6 +1365,11 @@
 
         /* All instructions remove 3 cycles.. Others taking less / more will have adjusted this # prior to here */
         ARM7_ICOUNT -= 3;
+#ifdef ARM7_EXEC_STEP
+    } while (0);
+
+    return end_run;
+#else
     } while (ARM7_ICOUNT > 0 && !end_run);
 
 	cycles = curr_cycles - ARM7_ICOUNT;
@@ -1367,4 +1377,5 @@
 	curr_cycles = ARM7_ICOUNT = 0;
 
     return cycles;
+#endif
 }
@@ -0,0 +1,1785 @@
+// ARM7 block recompiler for x86-64 hosts
+//
+// Runs on the interpreter's context (arm7.cpp), so save states, Arm7TotalCycles() and the
+// drivers' handlers see what the interpreter would leave behind.  Code is translated a block
+// at a time out of the fetch map; blocks are keyed by pc and by the cpsr mode / thumb bits,
+// so banked registers are resolved while translating.  Memory operands go straight through
+// the arm7_intf.cpp page tables and drop to the Arm7 read / write functions for handler pages.
+// Instructions we don't translate (thumb, msr, swp, swi, coprocessor, ldm/stm with ^ and the
+// odd r15 forms) are run by calling the interpreter for one instruction from inside the block.
+//
+// Every translated instruction charges its cycles the way arm7exec.c does, so the icount and
+// the idle loop skip come out the same.  An irq raised by a handler is latched and taken once
+// the instruction is done (arm7.cpp), which is where the interpreter checks anyway.  Short
+// backward b go to the interpreter's idle loop detection (burn_idle.cpp) as its own do, with
+// the stores done inline counted in DrcHot and handed over there.
+//
+// Stale code: Arm7 writes to pages holding translated code invalidate the blocks there, and
+// blocks translated from writable pages compare their code on every entry, which also catches
+// the 68k and the handlers writing shared ram.  Rom blocks are checked at frame start, reset
+// and state load.
+//
+// Register use inside generated code:
+//   rbx = sArmRegister[], r12 = read pages, r15 = write pages, r13 = &icount, r14 = DrcHot
+//   rbp = callee saved temporary that lives across memory accesses
+//   eax = operand / result, ecx = address, edx, r8-r11 = scratch
+
+#ifdef ARM7_X64_DRC
+
+#include "burnint.h"
+
+#include <deque>
+#include <vector>
+#include <unordered_map>
+
+#include "../../mips3/x64/xbyak/xbyak.h"
+
+// after xbyak, arm7core.h's R15 / LSL / ROR macros would break its headers
+#include "../arm7core.h"
+#include "arm7_intf.h"
+#include "arm7_x64.h"
+
+#define DRC_CODE_SIZE		(8 * 1024 * 1024)
+#define DRC_CODE_SLACK		(256 * 1024)			// room a single block may need
+#define DRC_CACHE_SIZE		4096					// direct mapped pc -> code cache (power of 2)
+#define DRC_MAX_INSNS		128						// instructions per block
+
+#define DRC_PAGE_SHIFT		12						// arm7_intf.cpp's pages
+#define DRC_PAGE_SIZE		(1 << DRC_PAGE_SHIFT)
+#define DRC_PAGEM			(DRC_PAGE_SIZE - 1)
+#define DRC_PAGE_COUNT		(0x80000000 >> DRC_PAGE_SHIFT)
+#define DRC_AM				0x7fffffff				// address bits the map decodes
+
+#define DRC_KEY_MASK		(T_MASK | MODE_FLAG)	// cpsr bits a block is translated for
+
+struct DrcBlock;
+
+struct DrcCacheEntry {
+	UINT32 nPC;
+	UINT32 nKey;
+	UINT8* pFetch;
+	void* pCode;
+	DrcBlock* pBlock;
+};
+
+// everything generated code touches besides the registers, addressed through r14
+struct DrcHot {
+	UINT8 Code[DRC_PAGE_COUNT];					// must stay first
+	UINT32 nBreak;
+	UINT32 nWrites;								// inline stores not yet added to nBurnIdleWrites
+	DrcCacheEntry Cache[DRC_CACHE_SIZE];
+};
+
+#define HOT_BREAK			((INT32)offsetof(DrcHot, nBreak))
+#define HOT_WRITES			((INT32)offsetof(DrcHot, nWrites))
+#define HOT_CACHE			((INT32)offsetof(DrcHot, Cache))
+
+struct DrcBlock {
+	UINT32 nPC;
+	UINT32 nKey;
+	UINT32 nPage;								// pc >> DRC_PAGE_SHIFT
+	INT32 nLen;									// bytes of host memory covered
+	bool bDead;
+	bool bCheck;								// from a writable page: compared with pSource on every entry
+	UINT8* pFetch;								// fetch page it was translated from
+	UINT8* pHost;								// first byte of its code in host memory
+	UINT8* pSource;								// copy of that code
+	void* pCode;
+};
+
+enum { STUB_READ, STUB_WRITE, STUB_EXIT };
+
+struct DrcStub {
+	Xbyak::Label lFrom, lBack;
+	INT32 nType;
+	INT32 nSize;
+	UINT32 nInsnPC, nPC;
+	bool bCall;
+	bool bKeepR15;
+};
+
+// carry out of the shifter, for the logical ops with S
+enum { SC_OLD, SC_CONST, SC_REG };
+
+#define REG_CPSR			dword[rbx + eCPSR * 4]
+#define REG_R15				dword[rbx + eR15 * 4]
+
+class Arm7Drc : public Xbyak::CodeGenerator
+{
+public:
+	Arm7Drc(Arm7DrcContext* pContext);
+	~Arm7Drc();
+
+	INT32 Run();
+	void MapChanged(UINT32 nStart, UINT32 nEnd);
+	void Verify();
+	void CheckHost(UINT8* p, INT32 nLen);
+	void SetIdleLoop(UINT32 nAddress);
+	void Invalidate(DrcBlock* b);
+
+	Arm7DrcContext Ctx;
+	DrcHot* pHot;
+	INT32 nHandler;
+	bool bRunning;
+	bool bVerifyPending;
+
+private:
+	void* Find(UINT32 nPC);
+	DrcBlock* Compile(UINT32 nPC, UINT32 nKey, UINT8* pFetch);
+	void EmitCommon();
+	bool PageHasCode(INT32 nPage);
+	void ComputeCode(INT32 nFirst, INT32 nLast);
+	void CodeAdded(uintptr_t nChunk);
+	void Forget(DrcBlock* b);
+	void Flush();
+
+	// translation
+	Xbyak::Address Reg(INT32 r) { return dword[rbx + sRegisterTable[m_nMode][r] * 4]; }
+	void LoadReg(const Xbyak::Reg32& r, INT32 n, UINT32 nPCAdd);
+
+	INT32 CompileArm();
+	INT32 CompileFallback();
+	bool ArmNative(UINT32 op);
+	INT32 CompileALU();
+	INT32 CompileMRS();
+	INT32 CompileMul();
+	INT32 CompileMulLong();
+	INT32 CompileMemSingle();
+	INT32 CompileHalfWord();
+	INT32 CompileMemBlock();
+	INT32 CompileBranch();
+	INT32 CompileBX();
+
+	void EmitCond(INT32 nCond, Xbyak::Label& lSkip);
+	INT32 EmitShift(UINT32 op, bool bCarry);
+	void SetNZCV(bool bSub);
+	void SetNZ(const Xbyak::Reg32& r);
+
+	DrcStub& NewStub(INT32 nType, INT32 nSize);
+	void EmitStubs();
+	void MemRead(INT32 nSize);
+	void MemWrite(INT32 nSize);
+	void EmitCheck(DrcBlock* b, const void* pBody);
+	void EndInsn(INT32 nCycles);
+	void EndJump(INT32 nCycles);
+	void EndBranch(UINT32 nTarget, INT32 nCycles);
+
+	UINT32 m_nIdle;
+	bool m_bFlushPending;
+
+	void (*m_pEntry)(void*, DrcHot*);
+	Xbyak::Label* m_plExit;
+	Xbyak::Label* m_plDispatch;
+
+	std::unordered_multimap<UINT32, DrcBlock*> m_Blocks;
+	std::unordered_map<UINT32, std::vector<DrcBlock*> > m_Pages;
+	std::unordered_map<uintptr_t, std::vector<DrcBlock*> > m_Chunks;	// host address >> DRC_PAGE_SHIFT -> blocks
+	std::vector<DrcBlock*> m_Dead;
+
+	// state of the block being translated
+	UINT8* m_pPage;
+	UINT32 m_nKey, m_nMode;
+	UINT32 m_nPC, m_nInsnPC, m_nOp;
+	UINT32 m_nHandlerPC;						// R15 as handlers see it
+	bool m_bKeepR15;							// or whatever the instruction loaded into it
+	bool m_bCall;
+	std::deque<DrcStub> m_Stubs;
+	std::vector<std::pair<UINT32, const UINT8*> > m_Insns;
+};
+
+static Arm7Drc* pDrc = NULL;
+UINT8* pArm7DrcCode = NULL;
+
+// ----------------------------------------------------------------------------
+// Calls out of generated code
+
+// something the run loop has to look at happened inside a handler, leave after this instruction
+struct DrcCall {
+	UINT32 nPC;
+	UINT8 nPending[6];
+
+	DrcCall() {
+		nPC = pDrc->Ctx.pRegs[eR15];
+		memcpy(nPending, pDrc->Ctx.pRegs + kNumRegisters, sizeof(nPending));
+		pDrc->nHandler++;
+	}
+
+	~DrcCall() {
+		pDrc->nHandler--;
+		if (pDrc->Ctx.pRegs[eR15] != nPC || *pDrc->Ctx.pEndRun || memcmp(nPending, pDrc->Ctx.pRegs + kNumRegisters, sizeof(nPending))) {
+			pDrc->pHot->nBreak = 1;
+		}
+	}
+};
+
+static UINT32 DrcRead8(UINT32 a)			{ DrcCall c; return Arm7ReadByte(a); }
+static UINT32 DrcRead16(UINT32 a)			{ DrcCall c; return Arm7ReadWord(a); }
+static UINT32 DrcRead32(UINT32 a)			{ DrcCall c; return Arm7ReadLong(a); }
+static void DrcWrite8(UINT32 a, UINT32 d)	{ DrcCall c; Arm7WriteByte(a, d); }
+static void DrcWrite16(UINT32 a, UINT32 d)	{ DrcCall c; Arm7WriteWord(a, d); }
+static void DrcWrite32(UINT32 a, UINT32 d)	{ DrcCall c; Arm7WriteLong(a, d); }
+
+// called from the entry check of a block whose code changed
+static void DrcStale(DrcBlock* b)
+{
+	pDrc->Invalidate(b);
+}
+
+// the stores translated code did itself, for burn_idle.cpp (the interpreter may be about to look)
+static inline void DrcFlushWrites()
+{
+	nBurnIdleWrites += pDrc->pHot->nWrites;
+	pDrc->pHot->nWrites = 0;
+}
+
+static void DrcStep()
+{
+	DrcFlushWrites();
+	if (Arm7DrcStep()) pDrc->pHot->nBreak = 1;
+}
+
+static void DrcIdleBranch(UINT32 nFrom, UINT32 nTo)
+{
+	DrcFlushWrites();
+	Arm7DrcIdleBranch(nFrom, nTo);
+}
+
+// decodeShift() for a shift by register, carry out in the upper half
+static UINT64 DrcShift(UINT32 rm, UINT32 k, UINT32 t, UINT32 cpsr)
+{
+	UINT32 c;
+
+	if (k == 0) {
+		return rm | ((UINT64)((cpsr >> C_BIT) & 1) << 32);
+	}
+
+	switch (t) {
+		case 0:																// lsl
+			if (k >= 32) {
+				c = (k == 32) ? (rm & 1) : 0;
+				rm = 0;
+			} else {
+				c = (rm >> (32 - k)) & 1;
+				rm <<= k;
+			}
+			break;
+
+		case 1:																// lsr
+			if (k >= 32) {
+				c = (k == 32) ? (rm >> 31) : 0;
+				rm = 0;
+			} else {
+				c = (rm >> (k - 1)) & 1;
+				rm >>= k;
+			}
+			break;
+
+		case 2:																// asr
+			if (k > 32) k = 32;
+			c = (rm >> (k - 1)) & 1;
+			rm = (k == 32) ? (UINT32)((INT32)rm >> 31) : (UINT32)((INT32)rm >> k);
+			break;
+
+		default:															// ror
+			while (k > 32) k -= 32;
+			c = (rm >> (k - 1)) & 1;
+			if (k < 32) rm = (rm >> k) | (rm << (32 - k));
+			break;
+	}
+
+	return rm | ((UINT64)c << 32);
+}
+
+Arm7Drc::Arm7Drc(Arm7DrcContext* pContext) : CodeGenerator(DRC_CODE_SIZE)
+{
+	Ctx = *pContext;
+	m_nIdle = ~0;
+	m_bFlushPending = true;
+	m_plExit = NULL;
+	m_plDispatch = NULL;
+
+	pHot = new DrcHot;
+	memset(pHot->Code, 0, sizeof(pHot->Code));
+	pHot->nBreak = 0;
+	pHot->nWrites = 0;
+	nHandler = 0;
+	bRunning = false;
+	bVerifyPending = false;
+
+	Flush();
+}
+
+Arm7Drc::~Arm7Drc()
+{
+	m_bFlushPending = true;
+	Flush();
+
+	delete m_plExit;
+	delete m_plDispatch;
+	delete pHot;
+}
+
+// ----------------------------------------------------------------------------
+// Block bookkeeping
+
+void Arm7Drc::Forget(DrcBlock* b)
+{
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.find(b->nPC); i != m_Blocks.end() && i->first == b->nPC; ++i) {
+		if (i->second == b) {
+			m_Blocks.erase(i);
+			break;
+		}
+	}
+
+	std::vector<DrcBlock*>& v = m_Pages[b->nPage];
+	for (UINT32 i = 0; i < v.size(); i++) {
+		if (v[i] == b) {
+			v.erase(v.begin() + i);
+			break;
+		}
+	}
+
+	for (uintptr_t k = (uintptr_t)b->pHost >> DRC_PAGE_SHIFT; k <= ((uintptr_t)b->pHost + b->nLen - 1) >> DRC_PAGE_SHIFT; k++) {
+		std::unordered_map<uintptr_t, std::vector<DrcBlock*> >::iterator c = m_Chunks.find(k);
+		if (c == m_Chunks.end()) continue;
+
+		for (UINT32 i = 0; i < c->second.size(); i++) {
+			if (c->second[i] == b) {
+				c->second.erase(c->second.begin() + i);
+				break;
+			}
+		}
+		if (c->second.empty()) m_Chunks.erase(c);
+	}
+
+	DrcCacheEntry& e = pHot->Cache[(b->nPC >> 1) & (DRC_CACHE_SIZE - 1)];
+	if (e.pBlock == b) {
+		e.nPC = ~0;
+		e.pFetch = (UINT8*)~(uintptr_t)0;
+		e.pBlock = NULL;
+	}
+}
+
+// The block's code is stale - it stays in the code buffer (it may be running) until the next flush
+void Arm7Drc::Invalidate(DrcBlock* b)
+{
+	if (b->bDead) return;
+
+	b->bDead = true;
+	Forget(b);
+	m_Dead.push_back(b);
+
+	pHot->nBreak = 1;
+}
+
+void Arm7Drc::Flush()
+{
+	if (bRunning || !m_bFlushPending) return;
+
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.begin(); i != m_Blocks.end(); ++i) {
+		m_Dead.push_back(i->second);
+	}
+	for (UINT32 i = 0; i < m_Dead.size(); i++) {
+		free(m_Dead[i]->pSource);
+		delete m_Dead[i];
+	}
+	m_Dead.clear();
+	m_Blocks.clear();
+	m_Pages.clear();
+	m_Chunks.clear();
+
+	for (INT32 i = 0; i < DRC_CACHE_SIZE; i++) {
+		pHot->Cache[i].nPC = ~0;
+		pHot->Cache[i].nKey = ~0;
+		pHot->Cache[i].pFetch = (UINT8*)~(uintptr_t)0;
+		pHot->Cache[i].pCode = NULL;
+		pHot->Cache[i].pBlock = NULL;
+	}
+	memset(pHot->Code, 0, sizeof(pHot->Code));
+
+	// not reset(): that restarts the label ids, and jumps to labels dropped by a failed
+	// translation are still waiting in xbyak's lists - a new label with their id would patch them
+	m_Stubs.clear();
+	delete m_plExit;
+	delete m_plDispatch;
+	setSize(0);
+	m_plExit = new Xbyak::Label;
+	m_plDispatch = new Xbyak::Label;
+	EmitCommon();
+
+	m_bFlushPending = false;
+}
+
+// a write to this page may hit code: its write side is host memory some block was translated from
+bool Arm7Drc::PageHasCode(INT32 nPage)
+{
+	UINT8* p = Ctx.pWrite[nPage];
+	if (p == NULL) return false;
+
+	for (uintptr_t k = (uintptr_t)p >> DRC_PAGE_SHIFT; k <= ((uintptr_t)p + DRC_PAGE_SIZE - 1) >> DRC_PAGE_SHIFT; k++) {
+		if (m_Chunks.count(k)) return true;
+	}
+
+	return false;
+}
+
+void Arm7Drc::ComputeCode(INT32 nFirst, INT32 nLast)
+{
+	if (m_Chunks.empty()) {
+		memset(pHot->Code + nFirst, 0, nLast - nFirst + 1);
+		return;
+	}
+
+	for (INT32 i = nFirst; i <= nLast; i++) {
+		pHot->Code[i] = PageHasCode(i);
+	}
+}
+
+// a chunk of host memory got its first block - flag the pages that can write to it
+void Arm7Drc::CodeAdded(uintptr_t nChunk)
+{
+	for (UINT32 i = 0; i < DRC_PAGE_COUNT; i++) {
+		uintptr_t p = (uintptr_t)Ctx.pWrite[i];
+		if (p == 0 || pHot->Code[i]) continue;
+
+		if ((p >> DRC_PAGE_SHIFT) <= nChunk && ((p + DRC_PAGE_SIZE - 1) >> DRC_PAGE_SHIFT) >= nChunk) {
+			pHot->Code[i] = 1;
+		}
+	}
+}
+
+// something wrote p[0 .. nLen - 1]
+void Arm7Drc::CheckHost(UINT8* p, INT32 nLen)
+{
+	for (uintptr_t k = (uintptr_t)p >> DRC_PAGE_SHIFT; k <= ((uintptr_t)p + nLen - 1) >> DRC_PAGE_SHIFT; k++) {
+		std::unordered_map<uintptr_t, std::vector<DrcBlock*> >::iterator c = m_Chunks.find(k);
+		if (c == m_Chunks.end()) continue;
+
+		std::vector<DrcBlock*> v = c->second;
+		for (UINT32 i = 0; i < v.size(); i++) {
+			DrcBlock* b = v[i];
+			if (b->pHost < p + nLen && p < b->pHost + b->nLen && memcmp(b->pHost, b->pSource, b->nLen)) {
+				Invalidate(b);
+			}
+		}
+	}
+}
+
+void Arm7Drc::MapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	INT32 nFirst = (nStart & DRC_AM) >> DRC_PAGE_SHIFT;
+	INT32 nLast = (nEnd & DRC_AM) >> DRC_PAGE_SHIFT;
+	if (nLast < nFirst) nLast = DRC_PAGE_COUNT - 1;
+
+	ComputeCode(nFirst, nLast);
+
+	// blocks in the range that match the new mapping must still match its memory
+	for (std::unordered_map<UINT32, std::vector<DrcBlock*> >::iterator i = m_Pages.begin(); i != m_Pages.end(); ++i) {
+		if ((INT32)i->first < nFirst || (INT32)i->first > nLast) continue;
+
+		std::vector<DrcBlock*> v = i->second;
+		for (UINT32 j = 0; j < v.size(); j++) {
+			DrcBlock* b = v[j];
+			if (b->pFetch == Ctx.pFetch[b->nPage] && memcmp(b->pHost, b->pSource, b->nLen)) {
+				Invalidate(b);
+			}
+		}
+	}
+
+	pHot->nBreak = 1;
+}
+
+void Arm7Drc::Verify()
+{
+	bVerifyPending = false;
+
+	std::vector<DrcBlock*> v;
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.begin(); i != m_Blocks.end(); ++i) {
+		DrcBlock* b = i->second;
+		if (b->pFetch == Ctx.pFetch[b->nPage] && memcmp(b->pHost, b->pSource, b->nLen)) {
+			v.push_back(b);
+		}
+	}
+	for (UINT32 i = 0; i < v.size(); i++) {
+		Invalidate(v[i]);
+	}
+}
+
+// the idle loop skip is translated into the code
+void Arm7Drc::SetIdleLoop(UINT32 nAddress)
+{
+	if (nAddress == m_nIdle) return;
+
+	m_nIdle = nAddress;
+	m_bFlushPending = true;
+	pHot->nBreak = 1;
+}
+
+// ----------------------------------------------------------------------------
+// Execution
+
+// entry trampoline, exit and the block to block dispatcher
+void Arm7Drc::EmitCommon()
+{
+	m_pEntry = getCurr<void (*)(void*, DrcHot*)>();
+
+	push(rbx);
+	push(rbp);
+	push(r12);
+	push(r13);
+	push(r14);
+	push(r15);
+#ifdef _WIN32
+	push(rsi);
+	push(rdi);
+#endif
+	sub(rsp, 56);								// shadow space, keeps rsp 16 byte aligned
+
+	mov(rbx, (size_t)Ctx.pRegs);
+	mov(r12, (size_t)Ctx.pRead);
+	mov(r15, (size_t)Ctx.pWrite);
+	mov(r13, (size_t)Ctx.pICount);
+#ifdef _WIN32
+	mov(r14, rdx);
+	jmp(rcx);
+#else
+	mov(r14, rsi);
+	jmp(rdi);
+#endif
+
+	L(*m_plExit);
+	add(rsp, 56);
+#ifdef _WIN32
+	pop(rdi);
+	pop(rsi);
+#endif
+	pop(r15);
+	pop(r14);
+	pop(r13);
+	pop(r12);
+	pop(rbp);
+	pop(rbx);
+	ret();
+
+	// R15 is set and there are cycles left: find the next block in the cache or leave
+	align(16);
+	L(*m_plDispatch);
+	mov(eax, REG_R15);
+	mov(edx, REG_CPSR);
+	and_(edx, DRC_KEY_MASK);
+	mov(ecx, eax);
+	and_(ecx, (DRC_CACHE_SIZE - 1) << 1);
+	shl(ecx, 4);
+	lea(r9, ptr[r14 + rcx + HOT_CACHE]);
+	cmp(dword[r9 + offsetof(DrcCacheEntry, nPC)], eax);
+	jne(*m_plExit, T_NEAR);
+	cmp(dword[r9 + offsetof(DrcCacheEntry, nKey)], edx);
+	jne(*m_plExit, T_NEAR);
+	and_(eax, DRC_AM);
+	shr(eax, DRC_PAGE_SHIFT);
+	mov(r10, (size_t)Ctx.pFetch);
+	mov(r8, qword[r10 + rax * 8]);
+	cmp(qword[r9 + offsetof(DrcCacheEntry, pFetch)], r8);
+	jne(*m_plExit, T_NEAR);
+	jmp(qword[r9 + offsetof(DrcCacheEntry, pCode)]);
+}
+
+void* Arm7Drc::Find(UINT32 nPC)
+{
+	UINT32 nKey = Ctx.pRegs[eCPSR] & DRC_KEY_MASK;
+
+	// only follow pcs the interpreter would fetch as is, in a valid mode
+	if ((nPC & ((nKey & T_MASK) ? 1 : 3)) || sRegisterTable[nKey & MODE_FLAG][15] != eR15 || m_bFlushPending) return NULL;
+
+	UINT8* pFetch = Ctx.pFetch[(nPC & DRC_AM) >> DRC_PAGE_SHIFT];
+	if (pFetch == NULL) return NULL;
+
+	DrcCacheEntry& e = pHot->Cache[(nPC >> 1) & (DRC_CACHE_SIZE - 1)];
+	DrcBlock* b = NULL;
+	if (e.nPC == nPC && e.nKey == nKey && e.pFetch == pFetch) {
+		b = e.pBlock;
+	} else {
+		for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.find(nPC); i != m_Blocks.end() && i->first == nPC; ++i) {
+			if (i->second->pFetch == pFetch && i->second->nKey == nKey) {
+				b = i->second;
+				break;
+			}
+		}
+	}
+
+	// the entry check would leave without running anything, Arm7Run() would go round again
+	if (b && b->bCheck && memcmp(b->pHost, b->pSource, b->nLen)) {
+		Invalidate(b);
+		b = NULL;
+	}
+
+	if (b == NULL) {
+		if (getSize() + DRC_CODE_SLACK > DRC_CODE_SIZE) {
+			m_bFlushPending = true;
+			Flush();
+		}
+
+		b = Compile(nPC, nKey, pFetch);
+		if (b == NULL) return NULL;
+	}
+
+	e.nPC = nPC;
+	e.nKey = nKey;
+	e.pFetch = pFetch;
+	e.pCode = b->pCode;
+	e.pBlock = b;
+
+	return b->pCode;
+}
+
+INT32 Arm7Drc::Run()
+{
+	Flush();
+	if (bVerifyPending) Verify();
+
+	void* pCode = Find(Ctx.pRegs[eR15]);
+	if (pCode == NULL) return 0;
+
+	bRunning = true;
+	pHot->nBreak = 0;
+	m_pEntry(pCode, pHot);
+	bRunning = false;
+	DrcFlushWrites();
+
+	return 1;
+}
+
+// ----------------------------------------------------------------------------
+// Code emitters
+
+DrcStub& Arm7Drc::NewStub(INT32 nType, INT32 nSize)
+{
+	m_Stubs.emplace_back();
+	DrcStub& s = m_Stubs.back();
+
+	s.nType = nType;
+	s.nSize = nSize;
+	s.nInsnPC = m_nHandlerPC;
+	s.nPC = m_nPC;
+	s.bCall = m_bCall;
+	s.bKeepR15 = m_bKeepR15;
+
+	return s;
+}
+
+void Arm7Drc::EmitStubs()
+{
+	static const void* pRead[3]  = { (void*)DrcRead8,  (void*)DrcRead16,  (void*)DrcRead32  };
+	static const void* pWrite[3] = { (void*)DrcWrite8, (void*)DrcWrite16, (void*)DrcWrite32 };
+
+	for (std::deque<DrcStub>::iterator i = m_Stubs.begin(); i != m_Stubs.end(); ++i) {
+		DrcStub& s = *i;
+
+		L(s.lFrom);
+
+		if (s.nType == STUB_EXIT) {
+			mov(REG_R15, s.nPC);
+			jmp(*m_plExit, T_NEAR);
+			continue;
+		}
+
+		// the handler sees R15 as the interpreter has it, at the instruction
+		if (!s.bKeepR15) mov(REG_R15, s.nInsnPC);
+
+		INT32 nFunc = (s.nSize == 4) ? 2 : (s.nSize - 1);
+		if (s.nType == STUB_WRITE) {
+#ifdef _WIN32
+			mov(edx, eax);
+#else
+			mov(esi, eax);
+			mov(edi, ecx);
+#endif
+			mov(rax, (size_t)pWrite[nFunc]);
+		} else {
+#ifndef _WIN32
+			mov(edi, ecx);
+#endif
+			mov(rax, (size_t)pRead[nFunc]);
+		}
+		call(rax);
+		jmp(s.lBack, T_NEAR);
+	}
+
+	m_Stubs.clear();
+}
+
+// ecx = address (already aligned for the size) -> eax, zero extended
+void Arm7Drc::MemRead(INT32 nSize)
+{
+	m_bCall = true;
+	DrcStub& s = NewStub(STUB_READ, nSize);
+
+	mov(edx, ecx);
+	and_(edx, DRC_AM);
+	shr(edx, DRC_PAGE_SHIFT);
+	mov(r8, qword[r12 + rdx * 8]);
+	test(r8, r8);
+	jz(s.lFrom, T_NEAR);
+	and_(ecx, DRC_PAGEM);
+
+	switch (nSize) {
+		case 1: movzx(eax, byte[r8 + rcx]);	break;
+		case 2: movzx(eax, word[r8 + rcx]);	break;
+		case 4: mov(eax, dword[r8 + rcx]);	break;
+	}
+
+	L(s.lBack);
+}
+
+// ecx = address (already aligned for the size), eax = data
+void Arm7Drc::MemWrite(INT32 nSize)
+{
+	m_bCall = true;
+	DrcStub& s = NewStub(STUB_WRITE, nSize);
+
+	mov(edx, ecx);
+	and_(edx, DRC_AM);
+	shr(edx, DRC_PAGE_SHIFT);
+	cmp(byte[r14 + rdx], 0);					// DrcHot::Code[]
+	jne(s.lFrom, T_NEAR);
+	mov(r8, qword[r15 + rdx * 8]);
+	test(r8, r8);
+	jz(s.lFrom, T_NEAR);
+	and_(ecx, DRC_PAGEM);
+
+	switch (nSize) {
+		case 1: mov(byte[r8 + rcx], al);	break;
+		case 2: mov(word[r8 + rcx], ax);	break;
+		case 4: mov(dword[r8 + rcx], eax);	break;
+	}
+	if (Arm7DrcIdleCounting()) {
+		inc(dword[r14 + HOT_WRITES]);			// the handlers count their own
+	}
+
+	L(s.lBack);
+}
+
+// a register as the instruction sees it, r15 reads as the instruction's address + nPCAdd
+void Arm7Drc::LoadReg(const Xbyak::Reg32& r, INT32 n, UINT32 nPCAdd)
+{
+	if (n == 15) {
+		mov(r, m_nInsnPC + nPCAdd);
+	} else {
+		mov(r, Reg(n));
+	}
+}
+
+// entry of a block from a writable page: run the body if its code is still what was
+// translated, else drop the block and leave with R15 at its pc, Run() translates the new code
+void Arm7Drc::EmitCheck(DrcBlock* b, const void* pBody)
+{
+	Xbyak::Label lStale;
+
+	mov(rdx, (size_t)b->pHost);
+	for (INT32 i = 0; i < b->nLen; ) {
+		if (b->nLen - i >= 8) {
+			UINT64 d;
+			memcpy(&d, b->pSource + i, 8);
+			mov(rax, d);
+			cmp(qword[rdx + i], rax);
+			i += 8;
+		} else if (b->nLen - i >= 4) {
+			INT32 d;
+			memcpy(&d, b->pSource + i, 4);
+			cmp(dword[rdx + i], d);
+			i += 4;
+		} else {
+			INT16 d;
+			memcpy(&d, b->pSource + i, 2);
+			cmp(word[rdx + i], d);
+			i += 2;
+		}
+		jne(lStale, T_NEAR);
+	}
+	jmp(pBody, T_NEAR);
+
+	L(lStale);
+#ifdef _WIN32
+	mov(rcx, (size_t)b);
+#else
+	mov(rdi, (size_t)b);
+#endif
+	mov(rax, (size_t)DrcStale);
+	call(rax);
+	jmp(*m_plExit, T_NEAR);
+}
+
+// charge the instruction, leave the block when out of cycles or when a handler asked to
+void Arm7Drc::EndInsn(INT32 nCycles)
+{
+	DrcStub& s = NewStub(STUB_EXIT, 0);
+
+	sub(dword[r13], nCycles);
+	jle(s.lFrom, T_NEAR);
+	if (m_bCall) {
+		cmp(dword[r14 + HOT_BREAK], 0);
+		jne(s.lFrom, T_NEAR);
+	}
+}
+
+// R15 holds where to go
+void Arm7Drc::EndJump(INT32 nCycles)
+{
+	sub(dword[r13], nCycles);
+	jle(*m_plExit, T_NEAR);
+	if (m_bCall) {
+		cmp(dword[r14 + HOT_BREAK], 0);
+		jne(*m_plExit, T_NEAR);
+	}
+	jmp(*m_plDispatch, T_NEAR);
+}
+
+// continue at a known pc: inside this block if it's an instruction we translated, else through the dispatcher
+void Arm7Drc::EndBranch(UINT32 nTarget, INT32 nCycles)
+{
+	UINT32 nSaved = m_nPC;
+	m_nPC = nTarget;
+	EndInsn(nCycles);
+	m_nPC = nSaved;
+
+	for (UINT32 i = 0; i < m_Insns.size(); i++) {
+		if (m_Insns[i].first == nTarget) {
+			jmp(m_Insns[i].second, T_NEAR);
+			return;
+		}
+	}
+
+	mov(REG_R15, nTarget);
+	jmp(*m_plDispatch, T_NEAR);
+}
+
+// jump to lSkip when the condition fails
+void Arm7Drc::EmitCond(INT32 nCond, Xbyak::Label& lSkip)
+{
+	mov(eax, REG_CPSR);
+
+	switch (nCond) {
+		case COND_EQ: test(eax, Z_MASK); jz(lSkip, T_NEAR);		break;
+		case COND_NE: test(eax, Z_MASK); jnz(lSkip, T_NEAR);	break;
+		case COND_CS: test(eax, C_MASK); jz(lSkip, T_NEAR);		break;
+		case COND_CC: test(eax, C_MASK); jnz(lSkip, T_NEAR);	break;
+		case COND_MI: test(eax, N_MASK); jz(lSkip, T_NEAR);		break;
+		case COND_PL: test(eax, N_MASK); jnz(lSkip, T_NEAR);	break;
+		case COND_VS: test(eax, V_MASK); jz(lSkip, T_NEAR);		break;
+		case COND_VC: test(eax, V_MASK); jnz(lSkip, T_NEAR);	break;
+
+		case COND_HI:
+		case COND_LS:
+			and_(eax, C_MASK | Z_MASK);
+			cmp(eax, C_MASK);
+			if (nCond == COND_HI) jne(lSkip, T_NEAR); else je(lSkip, T_NEAR);
+			break;
+
+		case COND_GE:
+		case COND_LT:
+			mov(edx, eax);
+			shl(edx, N_BIT - V_BIT);
+			xor_(edx, eax);
+			test(edx, N_MASK);
+			if (nCond == COND_GE) jnz(lSkip, T_NEAR); else jz(lSkip, T_NEAR);
+			break;
+
+		case COND_GT:
+		case COND_LE:
+			mov(edx, eax);
+			shl(edx, N_BIT - V_BIT);
+			xor_(edx, eax);
+			and_(edx, N_MASK);
+			and_(eax, Z_MASK);
+			or_(eax, edx);
+			if (nCond == COND_GT) jnz(lSkip, T_NEAR); else jz(lSkip, T_NEAR);
+			break;
+	}
+}
+
+// NZCV from the flags of the last add / sub, the arm carry is the inverted borrow on a sub
+void Arm7Drc::SetNZCV(bool bSub)
+{
+	lahf();
+	seto(al);
+	mov(ecx, eax);
+	shr(ecx, 8);
+	movzx(eax, al);
+	shl(eax, V_BIT);
+	mov(r8d, ecx);
+	and_(r8d, 1);
+	shl(r8d, C_BIT);
+	if (bSub) xor_(r8d, C_MASK);
+	or_(eax, r8d);
+	and_(ecx, 0xc0);							// sf, zf
+	shl(ecx, 24);
+	or_(eax, ecx);
+	mov(ecx, REG_CPSR);
+	and_(ecx, ~(N_MASK | Z_MASK | C_MASK | V_MASK));
+	or_(ecx, eax);
+	mov(REG_CPSR, ecx);
+}
+
+// NZ from r (not ecx / r8d)
+void Arm7Drc::SetNZ(const Xbyak::Reg32& r)
+{
+	mov(ecx, REG_CPSR);
+	and_(ecx, ~(N_MASK | Z_MASK));
+	mov(r8d, r);
+	and_(r8d, N_MASK);
+	or_(ecx, r8d);
+	test(r, r);
+	setz(r8b);
+	movzx(r8d, r8b);
+	shl(r8d, Z_BIT);
+	or_(ecx, r8d);
+	mov(REG_CPSR, ecx);
+}
+
+// decodeShift(): the shifted register -> eax, with bCarry the carry out -> r9d (0 / 1, SC_REG) or SC_OLD
+INT32 Arm7Drc::EmitShift(UINT32 op, bool bCarry)
+{
+	INT32 rm = op & 15;
+	INT32 t = (op >> 5) & 3;
+	INT32 k = (op >> 7) & 31;
+
+	LoadReg(eax, rm, 8);
+
+	if (op & 0x10) {
+		// by register, rarely used
+#ifdef _WIN32
+		mov(ecx, eax);
+		LoadReg(edx, (op >> 8) & 15, 0);
+		and_(edx, 0xff);
+		mov(r8d, t);
+		mov(r9d, REG_CPSR);
+#else
+		mov(edi, eax);
+		LoadReg(esi, (op >> 8) & 15, 0);
+		and_(esi, 0xff);
+		mov(edx, t);
+		mov(ecx, REG_CPSR);
+#endif
+		mov(rax, (size_t)DrcShift);
+		call(rax);
+		mov(r9, rax);
+		shr(r9, 32);
+		return SC_REG;
+	}
+
+	switch (t) {
+		case 0:																// lsl
+			if (k == 0) return SC_OLD;
+			if (bCarry) {
+				mov(r9d, eax);
+				shr(r9d, 32 - k);
+				and_(r9d, 1);
+			}
+			shl(eax, k);
+			break;
+
+		case 1:																// lsr, #0 is #32
+			if (k == 0) {
+				if (bCarry) {
+					mov(r9d, eax);
+					shr(r9d, 31);
+				}
+				xor_(eax, eax);
+				break;
+			}
+			if (bCarry) {
+				mov(r9d, eax);
+				shr(r9d, k - 1);
+				and_(r9d, 1);
+			}
+			shr(eax, k);
+			break;
+
+		case 2:																// asr, #0 is #32
+			if (k == 0) k = 32;
+			if (bCarry) {
+				mov(r9d, eax);
+				shr(r9d, k - 1);
+				and_(r9d, 1);
+			}
+			sar(eax, (k == 32) ? 31 : k);
+			break;
+
+		case 3:																// ror, #0 is rrx
+			if (k == 0) {
+				if (bCarry) {
+					mov(r9d, eax);
+					and_(r9d, 1);
+				}
+				mov(edx, REG_CPSR);
+				bt(edx, C_BIT);
+				rcr(eax, 1);
+				break;
+			}
+			if (bCarry) {
+				mov(r9d, eax);
+				shr(r9d, k - 1);
+				and_(r9d, 1);
+			}
+			ror(eax, k);
+			break;
+	}
+
+	return SC_REG;
+}
+
+// ----------------------------------------------------------------------------
+// Translation
+//
+// CompileX() return 0 to carry on with the block, 1 when the instruction always leaves it.
+
+INT32 Arm7Drc::CompileFallback()
+{
+	mov(REG_R15, m_nInsnPC);
+	mov(rax, (size_t)DrcStep);
+	call(rax);
+
+	// the interpreter charged the instruction and left R15 / cpsr wherever it went
+	cmp(dword[r14 + HOT_BREAK], 0);
+	jne(*m_plExit, T_NEAR);
+	cmp(dword[r13], 0);
+	jle(*m_plExit, T_NEAR);
+	cmp(REG_R15, m_nPC);
+	jne(*m_plDispatch, T_NEAR);
+	mov(eax, REG_CPSR);
+	and_(eax, DRC_KEY_MASK);
+	cmp(eax, m_nKey);
+	jne(*m_plDispatch, T_NEAR);
+
+	return 0;
+}
+
+// what we translate, following arm7exec.c's decoding
+bool Arm7Drc::ArmNative(UINT32 op)
+{
+	INT32 rn = (op >> 16) & 15;
+	INT32 rd = (op >> 12) & 15;
+
+	switch ((op >> 24) & 15) {
+		case 0: case 1: case 2: case 3:
+			if ((op & 0x0ffffff0) == 0x012fff10) {							// bx
+				return (op & 15) != 15;
+			}
+
+			if ((op & 0x0e000000) == 0 && (op & 0x80) && (op & 0x10)) {
+				if (op & 0x60) {											// ldrh / strh / ldrsb / ldrsh
+					if (rd == 15) return false;
+					if (rn == 15 && (!(op & INSN_SDT_P) || (op & INSN_SDT_W) || !(op & INSN_SDT_L))) return false;
+					return true;
+				}
+
+				if (op & 0x01000000) return false;							// swp
+
+				if (op & 0x800000) {										// umull / smull / umlal / smlal
+					return (op & 15) != 15 && ((op >> 8) & 15) != 15 && rn != 15 && rd != 15;
+				}
+
+				// mul / mla
+				return (op & 15) != 15 && ((op >> 8) & 15) != 15 && rn != 15 && (!(op & INSN_MUL_A) || rd != 15);
+			}
+
+			if ((op & 0x00100000) == 0 && (op & 0x01800000) == 0x01000000) {	// mrs / msr
+				return !(op & 0x00200000) && rd != 15;
+			}
+
+			// alu, with S writing r15 restores the cpsr
+			return !(rd == 15 && (op & INSN_S));
+
+		case 4: case 5: case 6: case 7:										// ldr / str
+			if ((op & INSN_I) && (op & 0x10)) return false;
+			if (rn == 15 && (!(op & INSN_SDT_P) || (op & INSN_SDT_W))) return false;
+			if ((op & INSN_SDT_L) && (op & INSN_SDT_B) && rd == 15) return false;
+			return true;
+
+		case 8: case 9:														// ldm / stm
+			return !(op & INSN_BDT_S) && rn != 15 && (op & 0xffff) != 0;
+
+		case 10: case 11:													// b / bl
+			return true;
+	}
+
+	return false;
+}
+
+INT32 Arm7Drc::CompileArm()
+{
+	UINT32 op = m_nOp;
+	INT32 nCond = op >> 28;
+
+	if (nCond == COND_NV) {
+		if (m_nInsnPC == m_nIdle) mov(dword[r13], 0);
+		EndInsn(1);
+		return 0;
+	}
+
+	if (!ArmNative(op)) return CompileFallback();
+
+	Xbyak::Label lSkip, lDone;
+
+	// Arm7FetchLong()'s idle loop skip
+	if (m_nInsnPC == m_nIdle) mov(dword[r13], 0);
+
+	if (nCond != COND_AL) EmitCond(nCond, lSkip);
+
+	INT32 r = 0;
+
+	switch ((op >> 24) & 15) {
+		case 0: case 1: case 2: case 3:
+			if ((op & 0x0ffffff0) == 0x012fff10) {
+				r = CompileBX();
+			} else if ((op & 0x0e000000) == 0 && (op & 0x80) && (op & 0x10)) {
+				if (op & 0x60) {
+					r = CompileHalfWord();
+				} else if (op & 0x800000) {
+					r = CompileMulLong();
+				} else {
+					r = CompileMul();
+				}
+			} else if ((op & 0x00100000) == 0 && (op & 0x01800000) == 0x01000000) {
+				r = CompileMRS();
+			} else {
+				r = CompileALU();
+			}
+			break;
+
+		case 4: case 5: case 6: case 7:
+			r = CompileMemSingle();
+			break;
+
+		case 8: case 9:
+			r = CompileMemBlock();
+			break;
+
+		case 10: case 11:
+			r = CompileBranch();
+			break;
+	}
+
+	if (nCond != COND_AL) {
+		// not executed: 1 cycle
+		if (r == 0) jmp(lDone, T_NEAR);
+		L(lSkip);
+		m_bCall = false;
+		EndInsn(1);
+		L(lDone);
+		r = 0;
+	}
+
+	return r;
+}
+
+INT32 Arm7Drc::CompileALU()
+{
+	UINT32 op = m_nOp;
+	INT32 nOpcode = (op >> 21) & 15;
+	INT32 rd = (op >> 12) & 15;
+	INT32 rn = (op >> 16) & 15;
+	bool bS = (op & INSN_S) != 0;
+	bool bLogical = nOpcode < 2 || nOpcode == OPCODE_TST || nOpcode == OPCODE_TEQ || nOpcode >= OPCODE_ORR;
+
+	INT32 nCarry = SC_CONST;
+	UINT32 nCarryConst = 0;
+
+	// op2 -> eax
+	if (op & INSN_I) {
+		INT32 by = (op >> 8) & 15;
+		UINT32 nImm = op & 0xff;
+		if (by) {
+			nImm = (nImm >> (by * 2)) | (nImm << (32 - by * 2));
+			nCarryConst = nImm >> 31;
+		} else {
+			nCarry = SC_OLD;
+		}
+		mov(eax, nImm);
+	} else {
+		nCarry = EmitShift(op, bS && bLogical);
+	}
+
+	// rn -> edx
+	if ((nOpcode & 0xd) != 0xd) {
+		LoadReg(edx, rn, 8);
+	}
+
+	switch (nOpcode) {
+		case OPCODE_SUB:
+		case OPCODE_CMP:
+			sub(edx, eax);
+			if (bS) SetNZCV(true);
+			break;
+
+		case OPCODE_RSB:
+			mov(ecx, eax);
+			sub(ecx, edx);
+			mov(edx, ecx);
+			if (bS) SetNZCV(true);
+			break;
+
+		case OPCODE_ADD:
+		case OPCODE_CMN:
+			add(edx, eax);
+			if (bS) SetNZCV(false);
+			break;
+
+		case OPCODE_ADC:
+			if (bS) {
+				// the core's carry is that of rn + op2, without the carry in
+				mov(r10d, edx);
+				add(r10d, eax);
+				setc(r10b);
+				movzx(r10d, r10b);
+			}
+			mov(ecx, REG_CPSR);
+			bt(ecx, C_BIT);
+			adc(edx, eax);
+			if (bS) {
+				SetNZCV(false);
+				and_(REG_CPSR, ~C_MASK);
+				shl(r10d, C_BIT);
+				or_(REG_CPSR, r10d);
+			}
+			break;
+
+		case OPCODE_SBC:
+			mov(ecx, REG_CPSR);
+			bt(ecx, C_BIT);
+			cmc();
+			sbb(edx, eax);
+			if (bS) SetNZCV(true);
+			break;
+
+		case OPCODE_RSC:
+			mov(ecx, REG_CPSR);
+			bt(ecx, C_BIT);
+			cmc();
+			mov(ecx, eax);
+			sbb(ecx, edx);
+			mov(edx, ecx);
+			if (bS) SetNZCV(true);
+			break;
+
+		case OPCODE_AND:
+		case OPCODE_TST:	and_(edx, eax);		break;
+		case OPCODE_EOR:
+		case OPCODE_TEQ:	xor_(edx, eax);		break;
+		case OPCODE_ORR:	or_(edx, eax);		break;
+		case OPCODE_MOV:	mov(edx, eax);		break;
+		case OPCODE_BIC:	not_(eax); and_(edx, eax);	break;
+		case OPCODE_MVN:	not_(eax); mov(edx, eax);	break;
+	}
+
+	if (bS && bLogical) {
+		mov(ecx, REG_CPSR);
+		and_(ecx, (nCarry == SC_OLD) ? ~(N_MASK | Z_MASK) : ~(N_MASK | Z_MASK | C_MASK));
+		mov(eax, edx);
+		and_(eax, N_MASK);
+		or_(ecx, eax);
+		test(edx, edx);
+		setz(al);
+		movzx(eax, al);
+		shl(eax, Z_BIT);
+		or_(ecx, eax);
+		if (nCarry == SC_REG) {
+			shl(r9d, C_BIT);
+			or_(ecx, r9d);
+		} else if (nCarry == SC_CONST && nCarryConst) {
+			or_(ecx, C_MASK);
+		}
+		mov(REG_CPSR, ecx);
+	}
+
+	if ((nOpcode & 0xc) != 0x8) {
+		if (rd == 15) {
+			mov(REG_R15, edx);
+			EndJump(3);
+			return 1;
+		}
+		mov(Reg(rd), edx);
+	}
+
+	EndInsn(3);
+	return 0;
+}
+
+INT32 Arm7Drc::CompileMRS()
+{
+	UINT32 op = m_nOp;
+
+	mov(eax, Reg((op & 0x400000) ? SPSR : eCPSR));
+	mov(Reg((op >> 12) & 15), eax);
+
+	EndInsn(1);
+	return 0;
+}
+
+INT32 Arm7Drc::CompileMul()
+{
+	UINT32 op = m_nOp;
+
+	mov(eax, Reg(op & 15));
+	imul(eax, Reg((op >> 8) & 15));
+	if (op & INSN_MUL_A) add(eax, Reg((op >> 12) & 15));
+	mov(Reg((op >> 16) & 15), eax);
+	if (op & INSN_S) SetNZ(eax);
+
+	EndInsn(3);
+	return 0;
+}
+
+INT32 Arm7Drc::CompileMulLong()
+{
+	UINT32 op = m_nOp;
+	INT32 rhi = (op >> 16) & 15;
+	INT32 rlo = (op >> 12) & 15;
+
+	mov(eax, Reg(op & 15));
+	if (op & 0x00400000) imul(Reg((op >> 8) & 15)); else mul(Reg((op >> 8) & 15));
+	if (op & INSN_MUL_A) {
+		add(eax, Reg(rlo));
+		adc(edx, Reg(rhi));
+	}
+	mov(Reg(rhi), edx);
+	mov(Reg(rlo), eax);
+
+	if (op & INSN_S) {
+		mov(ecx, REG_CPSR);
+		and_(ecx, ~(N_MASK | Z_MASK));
+		mov(r8d, edx);
+		and_(r8d, N_MASK);
+		or_(ecx, r8d);
+		or_(eax, edx);
+		setz(r8b);
+		movzx(r8d, r8b);
+		shl(r8d, Z_BIT);
+		or_(ecx, r8d);
+		mov(REG_CPSR, ecx);
+	}
+
+	EndInsn(3);
+	return 0;
+}
+
+// ldr / str / ldrb / strb
+INT32 Arm7Drc::CompileMemSingle()
+{
+	UINT32 op = m_nOp;
+	INT32 rn = (op >> 16) & 15;
+	INT32 rd = (op >> 12) & 15;
+	bool bImm = !(op & INSN_I);
+	UINT32 nOff = op & INSN_SDT_IMM;
+
+	// offset -> eax, address -> ebp, writeback done up front (never when rd == rn after the transfer)
+	if (!bImm) EmitShift(op, false);
+
+	LoadReg(ebp, rn, 0);
+	if (op & INSN_SDT_P) {
+		if (op & INSN_SDT_U) {
+			if (bImm) add(ebp, nOff); else add(ebp, eax);
+		} else {
+			if (bImm) sub(ebp, nOff); else sub(ebp, eax);
+		}
+		if (op & INSN_SDT_W) {
+			mov(Reg(rn), ebp);
+		} else if (rn == 15) {
+			add(ebp, 8);
+		}
+	} else if (rd != rn) {
+		mov(edx, ebp);
+		if (op & INSN_SDT_U) {
+			if (bImm) add(edx, nOff); else add(edx, eax);
+		} else {
+			if (bImm) sub(edx, nOff); else sub(edx, eax);
+		}
+		mov(Reg(rn), edx);
+	}
+
+	if (op & INSN_SDT_L) {
+		if (op & INSN_SDT_B) {
+			mov(ecx, ebp);
+			MemRead(1);
+		} else {
+			// unaligned words come back rotated
+			mov(ecx, ebp);
+			and_(ecx, ~3);
+			MemRead(4);
+			mov(ecx, ebp);
+			and_(ecx, 3);
+			shl(ecx, 3);
+			ror(eax, cl);
+
+			if (rd == 15) {
+				mov(REG_R15, eax);
+				EndJump(5);
+				return 1;
+			}
+		}
+		mov(Reg(rd), eax);
+		EndInsn(3);
+		return 0;
+	}
+
+	mov(ecx, ebp);
+	if (op & INSN_SDT_B) {
+		LoadReg(eax, rd, 0);
+		MemWrite(1);
+	} else {
+		and_(ecx, ~3);
+		LoadReg(eax, rd, 12);
+		MemWrite(4);
+	}
+
+	EndInsn(2);
+	return 0;
+}
+
+// ldrh / strh / ldrsb / ldrsh
+INT32 Arm7Drc::CompileHalfWord()
+{
+	UINT32 op = m_nOp;
+	INT32 rn = (op >> 16) & 15;
+	INT32 rd = (op >> 12) & 15;
+	bool bImm = (op & 0x400000) != 0;
+	UINT32 nOff = (((op >> 8) & 0x0f) << 4) | (op & 0x0f);
+
+	if (!bImm) LoadReg(eax, op & 15, 0);
+
+	LoadReg(ebp, rn, 0);
+	if (op & INSN_SDT_P) {
+		if (op & INSN_SDT_U) {
+			if (bImm) add(ebp, nOff); else add(ebp, eax);
+		} else {
+			if (bImm) sub(ebp, nOff); else sub(ebp, eax);
+		}
+		if (op & INSN_SDT_W) {
+			mov(Reg(rn), ebp);
+		} else if (rn == 15) {
+			add(ebp, 8);
+		}
+	} else if (rd != rn) {
+		mov(edx, ebp);
+		if (op & INSN_SDT_U) {
+			if (bImm) add(edx, nOff); else add(edx, eax);
+		} else {
+			if (bImm) sub(edx, nOff); else sub(edx, eax);
+		}
+		mov(Reg(rn), edx);
+	}
+
+	mov(ecx, ebp);
+
+	if (op & INSN_SDT_L) {
+		if ((op & 0x60) == 0x40) {											// ldrsb
+			MemRead(1);
+			movsx(eax, al);
+		} else {															// ldrh / ldrsh, odd addresses swap the bytes
+			Xbyak::Label lEven;
+			and_(ecx, ~1);
+			MemRead(2);
+			test(ebp, 1);
+			jz(lEven);
+			rol(ax, 8);
+			L(lEven);
+			if (op & 0x40) movsx(eax, ax); else movzx(eax, ax);
+		}
+		mov(Reg(rd), eax);
+		EndInsn(3);
+		return 0;
+	}
+
+	and_(ecx, ~1);
+	mov(eax, Reg(rd));
+	MemWrite(2);
+
+	EndInsn(2);
+	return 0;
+}
+
+// ldm / stm (no ^)
+INT32 Arm7Drc::CompileMemBlock()
+{
+	UINT32 op = m_nOp;
+	INT32 rb = (op >> 16) & 15;
+	INT32 nCount = 0;
+
+	for (INT32 i = 0; i < 16; i++) {
+		if (op & (1 << i)) nCount++;
+	}
+
+	mov(ebp, Reg(rb));
+
+	// the core takes the -3 back up front, handlers see the cycle count that way
+	add(dword[r13], 3);
+
+	if (op & INSN_BDT_L) {
+		if (op & INSN_BDT_U) {
+			if (!(op & INSN_BDT_P)) sub(ebp, 4);
+			and_(ebp, ~3);
+			for (INT32 i = 0; i < 16; i++) {
+				if (~op & (1 << i)) continue;
+				add(ebp, 4);
+				mov(ecx, ebp);
+				MemRead(4);
+				if (i == 15) {
+					mov(REG_R15, eax);
+					m_bKeepR15 = true;
+				} else {
+					mov(Reg(i), eax);
+				}
+			}
+		} else {
+			if (!(op & INSN_BDT_P)) add(ebp, 4);
+			and_(ebp, ~3);
+			for (INT32 i = 15; i >= 0; i--) {
+				if (~op & (1 << i)) continue;
+				sub(ebp, 4);
+				mov(ecx, ebp);
+				MemRead(4);
+				if (i == 15) {
+					mov(REG_R15, eax);
+					m_bKeepR15 = true;
+				} else {
+					mov(Reg(i), eax);
+				}
+			}
+		}
+
+		if (op & INSN_BDT_W) {
+			if (op & INSN_BDT_U) add(Reg(rb), nCount * 4); else sub(Reg(rb), nCount * 4);
+		}
+
+		// ldmia costs one cycle whatever it loads, the others n + 2 (+ 1 with the pc)
+		INT32 nCycles = 3 + ((op & INSN_BDT_U) ? 1 : (nCount + 2 + ((op & 0x8000) ? 1 : 0)));
+
+		if (op & 0x8000) {
+			EndJump(nCycles);
+			return 1;
+		}
+
+		EndInsn(nCycles);
+		return 0;
+	}
+
+	// stm with the pc runs with R15 at the stored value
+	if (op & 0x8000) m_nHandlerPC = m_nInsnPC + 12;
+
+	if (op & INSN_BDT_U) {
+		if (!(op & INSN_BDT_P)) sub(ebp, 4);
+		for (INT32 i = 0; i < 16; i++) {
+			if (~op & (1 << i)) continue;
+			add(ebp, 4);
+			mov(ecx, ebp);
+			and_(ecx, ~3);
+			LoadReg(eax, i, 12);
+			MemWrite(4);
+		}
+	} else {
+		if (!(op & INSN_BDT_P)) add(ebp, 4);
+		for (INT32 i = 15; i >= 0; i--) {
+			if (~op & (1 << i)) continue;
+			sub(ebp, 4);
+			mov(ecx, ebp);
+			and_(ecx, ~3);
+			LoadReg(eax, i, 12);
+			MemWrite(4);
+		}
+	}
+
+	if (op & INSN_BDT_W) {
+		if (op & INSN_BDT_U) add(Reg(rb), nCount * 4); else sub(Reg(rb), nCount * 4);
+	}
+
+	m_nHandlerPC = m_nInsnPC;
+	EndInsn(nCount + 4 + 3);
+	return 0;
+}
+
+INT32 Arm7Drc::CompileBranch()
+{
+	UINT32 op = m_nOp;
+	UINT32 nTarget = m_nInsnPC + 8 + ((INT32)(op << 8) >> 6);
+
+	if (op & INSN_BL) {
+		mov(Reg(14), m_nInsnPC + 4);
+	} else if ((UINT32)(m_nInsnPC - nTarget) <= BURN_IDLE_MAX_LOOP && Arm7DrcIdleAllowed(m_nInsnPC)) {
+		// HandleBranch()'s ARM7_IDLE_BRANCH(), before the branch is charged
+#ifdef _WIN32
+		mov(ecx, m_nInsnPC);
+		mov(edx, nTarget);
+#else
+		mov(edi, m_nInsnPC);
+		mov(esi, nTarget);
+#endif
+		mov(rax, (size_t)DrcIdleBranch);
+		call(rax);
+	}
+
+	EndBranch(nTarget, 3);
+	return 1;
+}
+
+INT32 Arm7Drc::CompileBX()
+{
+	Xbyak::Label lArm;
+
+	mov(eax, Reg(m_nOp & 15));
+	test(al, 1);
+	jz(lArm);
+	or_(REG_CPSR, T_MASK);
+	dec(eax);
+	L(lArm);
+	mov(REG_R15, eax);
+
+	EndJump(3);
+	return 1;
+}
+
+DrcBlock* Arm7Drc::Compile(UINT32 nPC, UINT32 nKey, UINT8* pFetch)
+{
+	bool bThumb = (nKey & T_MASK) != 0;
+	UINT32 nSize = bThumb ? 2 : 4;
+
+	m_pPage = pFetch;
+	m_nKey = nKey;
+	m_nMode = nKey & MODE_FLAG;
+	m_nPC = nPC;
+	m_Insns.clear();
+	m_Stubs.clear();
+
+	size_t nStart = getSize();
+	void* pCode = (void*)getCurr();
+	bool bEnd = false;
+	DrcBlock* b = NULL;
+
+	try {
+		// stop at the end of the fetch page
+		while (!bEnd && m_Insns.size() < DRC_MAX_INSNS && (m_Insns.empty() || (m_nPC & DRC_PAGEM))) {
+			m_nInsnPC = m_nHandlerPC = m_nPC;
+			m_bKeepR15 = false;
+			m_nPC += nSize;
+			m_bCall = false;
+			m_Insns.push_back(std::make_pair(m_nInsnPC, getCurr()));
+
+			if (bThumb) {
+				m_nOp = *(UINT16*)(m_pPage + (m_nInsnPC & DRC_PAGEM));
+				bEnd = CompileFallback() != 0;
+			} else {
+				m_nOp = *(UINT32*)(m_pPage + (m_nInsnPC & DRC_PAGEM));
+				bEnd = CompileArm() != 0;
+			}
+		}
+
+		if (!bEnd) {
+			mov(REG_R15, m_nPC);
+			jmp(*m_plDispatch, T_NEAR);
+		}
+
+		EmitStubs();
+
+		b = new DrcBlock;
+		b->nPC = nPC;
+		b->nKey = nKey;
+		b->nPage = (nPC & DRC_AM) >> DRC_PAGE_SHIFT;
+		b->nLen = m_nPC - nPC;
+		b->bDead = false;
+		b->pFetch = pFetch;
+		b->pHost = pFetch + (nPC & DRC_PAGEM);
+		b->pSource = (UINT8*)malloc(b->nLen);
+		memcpy(b->pSource, b->pHost, b->nLen);
+
+		b->bCheck = Ctx.pWrite[b->nPage] != NULL;
+		if (b->bCheck) {
+			void* pBody = pCode;
+			pCode = (void*)getCurr();
+			EmitCheck(b, pBody);
+		}
+		b->pCode = pCode;
+	} catch (Xbyak::Error&) {
+		// out of code space: drop what we have and let the next run flush
+		if (b) {
+			free(b->pSource);
+			delete b;
+		}
+		m_Stubs.clear();
+		setSize(nStart);
+		m_bFlushPending = true;
+		return NULL;
+	}
+
+	m_Blocks.insert(std::make_pair(nPC, b));
+	m_Pages[b->nPage].push_back(b);
+
+	for (uintptr_t k = (uintptr_t)b->pHost >> DRC_PAGE_SHIFT; k <= ((uintptr_t)b->pHost + b->nLen - 1) >> DRC_PAGE_SHIFT; k++) {
+		std::vector<DrcBlock*>& v = m_Chunks[k];
+		v.push_back(b);
+		if (v.size() == 1) CodeAdded(k);
+	}
+
+	return b;
+}
+
+// ----------------------------------------------------------------------------
+// Interface
+
+INT32 Arm7DrcInit(Arm7DrcContext* pContext)
+{
+	try {
+		pDrc = new Arm7Drc(pContext);
+	} catch (Xbyak::Error& e) {
+		bprintf(PRINT_ERROR, _T("ARM7 DRC: %S\n"), e.what());
+		pDrc = NULL;
+		return 1;
+	}
+
+	pArm7DrcCode = pDrc->pHot->Code;
+
+	return 0;
+}
+
+void Arm7DrcExit()
+{
+	pArm7DrcCode = NULL;
+
+	delete pDrc;
+	pDrc = NULL;
+}
+
+INT32 Arm7DrcRun()
+{
+	return pDrc->Run();
+}
+
+INT32 Arm7DrcRunning()
+{
+	return pDrc->bRunning;
+}
+
+INT32 Arm7DrcInHandler()
+{
+	return pDrc->nHandler > 0;
+}
+
+void Arm7DrcMapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	pDrc->MapChanged(nStart, nEnd);
+}
+
+void Arm7DrcSetIdleLoop(UINT32 nAddress)
+{
+	pDrc->SetIdleLoop(nAddress);
+}
+
+void Arm7DrcVerify()
+{
+	pDrc->bVerifyPending = true;
+}
+
+void Arm7DrcWrite(UINT8* p, INT32 nLen)
+{
+	pDrc->CheckHost(p, nLen);
+}
+
+#endif
@@ -0,0 +1,41 @@
+// ARM7 block recompiler for x86-64 hosts (arm7.cpp context, arm7_intf.cpp memory map)
+
+#ifndef ARM7_X64_H
+#define ARM7_X64_H
+
+#ifdef ARM7_X64_DRC
+
+// Per-page flags: non-zero where a write may hit recompiled code (NULL when not recompiling)
+extern UINT8* pArm7DrcCode;
+
+struct Arm7DrcContext {
+	UINT32* pRegs;								// sArmRegister[], the pending exception flags follow it
+	INT32* pICount;
+	INT32* pEndRun;
+	UINT8** pRead;								// arm7_intf.cpp page tables
+	UINT8** pWrite;
+	UINT8** pFetch;
+};
+
+INT32 Arm7DrcInit(Arm7DrcContext* pContext);
+void Arm7DrcExit();
+INT32 Arm7DrcRun();								// run blocks from R15 while icount > 0, 0 if there was nothing to run
+INT32 Arm7DrcRunning();							// inside Arm7DrcRun()
+INT32 Arm7DrcInHandler();						// a translated instruction is calling a memory handler
+
+void Arm7DrcMapChanged(UINT32 nStart, UINT32 nEnd);
+void Arm7DrcSetIdleLoop(UINT32 nAddress);
+void Arm7DrcVerify();							// drop blocks whose code changed behind our back
+
+void Arm7DrcWrite(UINT8* p, INT32 nLen);		// a write through the Arm7 map hit a flagged page
+
+// arm7.cpp
+void Arm7DrcGetContext(Arm7DrcContext* pContext);
+INT32 Arm7DrcStep();							// one instruction on the interpreter, returns end_run
+INT32 Arm7DrcIdleAllowed(UINT32 pc);			// BurnIdleAllowed() for the arm7
+INT32 Arm7DrcIdleCounting();					// non-zero if writes are counted in nBurnIdleWrites
+void Arm7DrcIdleBranch(UINT32 from, UINT32 to);	// a taken short backward branch, may skip idle iterations
+
+#endif
+
+#endif
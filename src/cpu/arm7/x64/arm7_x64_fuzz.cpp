@@ -0,0 +1,441 @@
+// Differential test for the ARM7 recompiler: every timeslice runs twice from the same state,
+// on the interpreter and on the recompiler, over random code in rom, ram and a switched bank,
+// and the two runs must end in the same state.  There is only the one ARM7, so the state
+// (registers, counters, memory) is saved before the first run and put back for the second.
+//
+// Build and run from src/burner/libretro (x86-64 hosts):
+//   g++ -O2 -std=gnu++11 -DLSB_FIRST -D__LIBRETRO__ -DARM7_X64_DRC -DXBYAK_NO_OP_NAMES \
+//     -I../../burn -I../../burn/devices -I../../burn/snd -I../../burner -I../../burner/libretro \
+//     -I../../burner/libretro/libretro-common/include \
+//     -I../../cpu -I../../intf -I../../intf/input -I../../intf/cd -I../../intf/audio \
+//     ../../cpu/arm7/x64/arm7_x64.cpp ../../cpu/arm7/x64/arm7_x64_fuzz.cpp ../../burn/burn_idle.cpp \
+//     -no-pie -Wl,--unresolved-symbols=ignore-all -o arm7_x64_fuzz
+//   ./arm7_x64_fuzz [first seed] [seeds] [timeslices] > /dev/null
+// (the interpreter logs the odd opcodes it meets to stdout, the results go to stderr)
+//
+// Code in ram is changed under the recompiler by everything that isn't its own store: a write
+// handler poking the host memory (as the 68k does to PGM's shared ram) and the test itself
+// between timeslices.  A write handler also switches a code bank, raises irqs and ends the run.
+
+#include "../arm7.cpp"
+#include "../../arm7_intf.cpp"
+
+bool bBurnUseArm7Recompiler = true;
+bool bBurnProfile = false;
+void BurnProfileEnter(INT32) {}
+void BurnProfileLeave() {}
+UINT8 DebugCPU_ARM7Initted = 0;
+void CpuCheatRegister(INT32, cpu_core_config*) {}
+INT32 (__cdecl *BurnAcb) (struct BurnArea* pba) = NULL;
+
+char* BurnDrvGetTextA(UINT32)
+{
+	static char szName[] = "arm7_x64_fuzz";
+	return szName;
+}
+
+static INT32 __cdecl FuzzPrintf(INT32, TCHAR* szFormat, ...)
+{
+	va_list vl;
+	va_start(vl, szFormat);
+	vprintf(szFormat, vl);
+	va_end(vl);
+	return 0;
+}
+
+INT32 (__cdecl *bprintf) (INT32 nStatus, TCHAR* szFormat, ...) = FuzzPrintf;
+
+// the results, away from the interpreter's logging
+static void Report(const char* szFormat, ...)
+{
+	va_list vl;
+	va_start(vl, szFormat);
+	vfprintf(stderr, szFormat, vl);
+	va_end(vl);
+}
+
+#define ROM_SIZE	0x10000				// at 0
+#define RAM_SIZE	0x10000				// at 0x10000000
+#define BANK_SIZE	0x40000				// 64k at 0x18000000, four banks
+#define RAM_ROUTINES	0x4000				// start of ram: routines the rest of it keeps calling
+#define ROUTINE_SIZE	0x200
+
+static UINT8* Rom;
+static UINT8* Ram;
+static UINT8* Bank;
+static INT32 nBank;
+static UINT32 nHash;
+static UINT32 nReads;
+static UINT32 nSeed;
+
+static UINT32 Rand()
+{
+	nSeed = nSeed * 1103515245 + 12345;
+	return (nSeed >> 8) ^ (nSeed << 20);
+}
+
+static void SetBank(INT32 b)
+{
+	nBank = b & 3;
+	Arm7MapMemory(Bank + nBank * 0x10000, 0x18000000, 0x1800ffff, MAP_RAM);
+}
+
+// ----------------------------------------------------------------------------
+// Handlers
+
+static UINT32 HandlerRead(UINT32 a)
+{
+	nReads++;
+	nHash = nHash * 31 + a * 5 + ARM7.sArmRegister[eR15] * 3 + Arm7TotalCycles() * 7;
+	return (a * 2654435761u) ^ (nReads * 40503);
+}
+
+static void HandlerWrite(UINT32 a, UINT32 d)
+{
+	nReads++;
+	nHash = nHash * 31 + a * 7 + d + ARM7.sArmRegister[eR15] * 3 + Arm7TotalCycles() * 11;
+
+	switch (a & 0xf0) {
+		case 0x10:
+			Arm7RunEnd();
+			break;
+
+		case 0x20:
+			SetBank(d);
+			break;
+
+		case 0x30:
+			// only lines the cpu has masked, or drops: a taken irq would run from the vectors
+			if (!(d & 2) || (ARM7.sArmRegister[eCPSR] & ((d & 1) ? F_MASK : I_MASK))) {
+				Arm7SetIRQLine(d & 1, (d & 2) ? CPU_IRQSTATUS_ACK : CPU_IRQSTATUS_NONE);
+			}
+			break;
+
+		case 0x40:
+			Arm7BurnCycles(d & 63);
+			break;
+
+		case 0x50:
+			Arm7RunEndEatCycles();
+			break;
+
+		default:
+			if (a & 0x80) {
+				// the other side of shared ram changes the first instruction of a routine, not the
+				// one that is running (the interpreter would see the write before the block is
+				// done, we wouldn't): mov r0-r7, #imm
+				UINT32 o = ((a * 0x9e3779b1) ^ d) & (RAM_ROUTINES - ROUTINE_SIZE);
+				UINT32 pc = ARM7.sArmRegister[eR15];
+				if ((pc & 0xffff0000) != 0x10000000 || (UINT32)(o - (pc & 0xffff) + 0x400) > 0x800) {
+					*(UINT32*)(Ram + o) = 0xe3a00000 | ((d & 0x700) << 4) | (d & 0xff);
+				}
+			}
+			break;
+	}
+}
+
+static UINT8 HandlerReadByte(UINT32 a)				{ return HandlerRead(a); }
+static UINT16 HandlerReadWord(UINT32 a)				{ return HandlerRead(a); }
+static UINT32 HandlerReadLong(UINT32 a)				{ return HandlerRead(a); }
+static void HandlerWriteByte(UINT32 a, UINT8 d)		{ HandlerWrite(a, d); }
+static void HandlerWriteWord(UINT32 a, UINT16 d)	{ HandlerWrite(a, d); }
+static void HandlerWriteLong(UINT32 a, UINT32 d)	{ HandlerWrite(a, d); }
+
+// ----------------------------------------------------------------------------
+// Random code
+
+static UINT32 MakeCond()
+{
+	return ((Rand() & 15) < 10) ? 0xe : (Rand() % 15);
+}
+
+static UINT32 MakeReg()
+{
+	return Rand() % ((Rand() & 7) ? 13 : 16);
+}
+
+// a base register that mostly points at memory
+static UINT32 MakeBase()
+{
+	return (Rand() & 7) ? (1 + Rand() % 7) : MakeReg();
+}
+
+static UINT32 MakeOp()
+{
+	UINT32 c = MakeCond() << 28;
+	UINT32 k = Rand() % 40;
+	UINT32 rn = MakeReg(), rd = MakeReg(), rm = MakeReg();
+
+	if (k < 10) {
+		// data processing, immediate, shift by immediate, shift by register
+		UINT32 op = Rand() & 15, s = (Rand() & 1) << 20;
+		if ((op & 0xc) == 0x8) s = 1 << 20;
+		if (rd == 15 && (Rand() & 3)) rd = Rand() % 13;
+		if (k < 5) return c | (1 << 25) | (op << 21) | s | (rn << 16) | (rd << 12) | (Rand() & 0xfff);
+		if (k < 9) return c | (op << 21) | s | (rn << 16) | (rd << 12) | (Rand() & 0xf80) | ((Rand() & 3) << 5) | rm;
+		return c | (op << 21) | s | (rn << 16) | (rd << 12) | ((Rand() % 16) << 8) | ((Rand() & 3) << 5) | 0x10 | rm;
+	}
+
+	if (k < 18) {
+		// ldr / str, immediate or register offset
+		UINT32 off = (Rand() & 3) ? (Rand() & 0x3f) : (Rand() & 0xfff);
+		UINT32 bits = (Rand() & 0x1f) << 20;
+		rn = MakeBase();
+		if (k < 16) return c | 0x04000000 | bits | (rn << 16) | (rd << 12) | off;
+		return c | 0x06000000 | bits | (rn << 16) | (rd << 12) | ((Rand() & 3) << 7) | ((Rand() & 3) << 5) | (8 + (Rand() & 3));
+	}
+
+	if (k < 22) {
+		// halfword and signed transfers
+		UINT32 sh = 1 + Rand() % 3;
+		UINT32 bits = (Rand() & 0x1b) << 20;
+		rn = MakeBase();
+		if (Rand() & 1) return c | bits | (1 << 22) | (rn << 16) | (rd << 12) | ((Rand() & 3) << 8) | 0x90 | (sh << 5) | (Rand() & 15);
+		return c | (bits & ~(1 << 22)) | (rn << 16) | (rd << 12) | 0x90 | (sh << 5) | (8 + (Rand() & 3));
+	}
+
+	if (k < 25) {
+		// ldm / stm
+		rn = MakeBase();
+		UINT32 list = Rand() & ((Rand() & 3) ? 0x7ff0 : 0xffff);
+		if (Rand() & 1) list &= ~(1 << rn);
+		return c | 0x08000000 | ((Rand() & 0x1f) << 20) | (rn << 16) | list | (((Rand() & 7) == 0) ? (1 << 22) : 0);
+	}
+
+	if (k < 28) {
+		// mul / mla, and the long forms
+		UINT32 rs = MakeReg();
+		if (k < 26) return c | ((Rand() & 3) << 20) | (rn << 16) | (rd << 12) | (rs << 8) | 0x90 | rm;
+		return c | 0x00800000 | ((Rand() & 7) << 20) | (rn << 16) | (rd << 12) | (rs << 8) | 0x90 | rm;
+	}
+
+	if (k < 32) {
+		// b / bl, mostly short
+		INT32 off = (Rand() & 1) ? -(INT32)(Rand() % 16) - 2 : (INT32)(Rand() % 16);
+		if ((Rand() & 7) == 0) off = (INT32)(Rand() % 0x2000) - 0x1000;
+		return c | 0x0a000000 | ((Rand() & 1) << 24) | (off & 0xffffff);
+	}
+
+	if (k < 33) return c | 0x012fff10 | (1 + Rand() % 7);													// bx
+	if (k < 35) return c | 0x010f0000 | ((Rand() & 1) << 22) | (rd << 12);									// mrs
+	if (k < 36) return c | 0x0128f000 | ((Rand() & 3) << 22) | (1 << 25) | (Rand() & 0xff);				// msr flags
+	if (k < 37) return c | 0x01000090 | ((Rand() & 1) << 22) | ((1 + Rand() % 7) << 16) | (rd << 12) | rm;	// swp
+	if (k < 38) return Rand();
+	return c | (1 << 25) | (0xd << 21) | (rd << 12) | (Rand() & 0xff);										// mov immediate
+}
+
+static void MakeCode(UINT8* m, UINT32 nLen)
+{
+	for (UINT32 a = 0; a < nLen; a += 4) {
+		if ((Rand() & 63) == 0 && a + 8 <= nLen) {
+			// a counted loop, for the idle loop speedhack
+			UINT32 r = 1 + Rand() % 7;
+			*(UINT32*)(m + a) = 0xe2500001 | (r << 16) | (r << 12);			// subs r, r, #1
+			*(UINT32*)(m + a + 4) = 0x1afffffd;								// bne $-4
+			a += 4;
+			continue;
+		}
+		*(UINT32*)(m + a) = MakeOp();
+	}
+}
+
+static UINT32 MakeValue()
+{
+	UINT32 k = Rand() & 15;
+	if (k < 6) return 0x10000000 + (Rand() & 0xfffc) + (((Rand() & 3) == 0) ? (Rand() & 3) : 0);
+	if (k < 8) return 0x18000000 + (Rand() & 0xfffc);
+	if (k < 9) return 0x40000000 + (Rand() & 0xff);
+	if (k < 10) return Rand() & 0xfffc;
+	if (k < 13) return Rand() & 0xff;
+	return Rand();
+}
+
+// ----------------------------------------------------------------------------
+// The state a timeslice may change
+
+struct FuzzState {
+	ARM7_REGS Regs;
+	INT32 nICount, nTotal, nCurr, nEndRun, nDrcIrq;
+	UINT32 nIdleLoop;
+	UINT32 nHash, nReads;
+	INT32 nBank;
+	INT32 nDone;
+	UINT8 Ram[RAM_SIZE];
+	UINT8 Bank[BANK_SIZE];
+};
+
+static FuzzState Start, Interp, Drc;
+
+static void SaveState(FuzzState& s)
+{
+	s.Regs = ARM7;
+	s.nICount = ARM7_ICOUNT;
+	s.nTotal = total_cycles;
+	s.nCurr = curr_cycles;
+	s.nEndRun = end_run;
+	s.nDrcIrq = drc_irq;
+	s.nIdleLoop = Arm7IdleLoop;
+	s.nHash = nHash;
+	s.nReads = nReads;
+	s.nBank = nBank;
+	memcpy(s.Ram, Ram, RAM_SIZE);
+	memcpy(s.Bank, Bank, BANK_SIZE);
+}
+
+static void LoadState(FuzzState& s)
+{
+	ARM7 = s.Regs;
+	ARM7_ICOUNT = s.nICount;
+	total_cycles = s.nTotal;
+	curr_cycles = s.nCurr;
+	end_run = s.nEndRun;
+	drc_irq = s.nDrcIrq;
+	Arm7IdleLoop = s.nIdleLoop;
+	nHash = s.nHash;
+	nReads = s.nReads;
+	memcpy(Ram, s.Ram, RAM_SIZE);
+	memcpy(Bank, s.Bank, BANK_SIZE);
+	SetBank(s.nBank);
+}
+
+static const UINT32 Modes[] = { 0x10, 0x11, 0x12, 0x13, 0x17, 0x1b, 0x1f };
+
+static INT32 RunSeed(UINT32 nTestSeed, INT32 nSlices)
+{
+	nSeed = nTestSeed;
+	nHash = nReads = 0;
+
+	MakeCode(Rom, ROM_SIZE);
+	MakeCode(Ram, RAM_SIZE);
+	for (UINT32 a = 0; a < RAM_SIZE; a += 0x40) {
+		UINT32 o = a + (Rand() & 0x3c);
+		INT32 nTarget = Rand() & (RAM_ROUTINES - ROUTINE_SIZE);
+		*(UINT32*)(Ram + o) = 0xeb000000 | (((nTarget - (INT32)o - 8) >> 2) & 0xffffff);		// bl to a routine
+	}
+	MakeCode(Bank, BANK_SIZE);
+	for (INT32 v = 0; v < 8; v++) {
+		*(UINT32*)(Rom + v * 4) = 0xea000000 | ((0x100 + (Rand() & 0x3ff) - v - 2) & 0xffffff);	// b to somewhere past the vectors
+	}
+
+	Arm7Init(0);
+	Arm7Open(0);
+	Arm7MapMemory(Rom, 0x00000000, 0x0000ffff, MAP_ROM);
+	Arm7MapMemory(Ram, 0x10000000, 0x1000ffff, MAP_RAM);
+	SetBank(0);
+	Arm7SetWriteByteHandler(HandlerWriteByte);
+	Arm7SetWriteWordHandler(HandlerWriteWord);
+	Arm7SetWriteLongHandler(HandlerWriteLong);
+	Arm7SetReadByteHandler(HandlerReadByte);
+	Arm7SetReadWordHandler(HandlerReadWord);
+	Arm7SetReadLongHandler(HandlerReadLong);
+	Arm7Reset();
+
+	UINT8* pCode = pArm7DrcCode;
+	if (pCode == NULL) {
+		Report("seed %u: no recompiler\n", nTestSeed);
+		Arm7Close();
+		Arm7Exit();
+		return 1;
+	}
+
+	INT32 nRet = 0;
+	for (INT32 n = 0; n < nSlices; n++) {
+		INT32 nCycles = 1 + (Rand() % 3000);
+
+		SaveState(Start);
+
+		pArm7DrcCode = NULL;
+		Interp.nDone = Arm7Run(nCycles);
+		SaveState(Interp);
+
+		pArm7DrcCode = pCode;
+		LoadState(Start);
+		Drc.nDone = Arm7Run(nCycles);
+		SaveState(Drc);
+
+		if (memcmp(&Interp.Regs, &Drc.Regs, sizeof(ARM7_REGS)) || Interp.nDone != Drc.nDone || Interp.nTotal != Drc.nTotal || Interp.nBank != Drc.nBank) {
+			Report("seed %u timeslice %d: states differ, started at %08x cpsr %08x for %d cycles\n", nTestSeed, n, Start.Regs.sArmRegister[eR15], Start.Regs.sArmRegister[eCPSR], nCycles);
+			Report("  done   %8d %8d\n", Interp.nDone, Drc.nDone);
+			Report("  total  %8d %8d\n", Interp.nTotal, Drc.nTotal);
+			Report("  bank   %8d %8d\n", Interp.nBank, Drc.nBank);
+			for (INT32 i = 0; i < kNumRegisters; i++) {
+				Report("  reg%-3d %08x %08x%s\n", i, Interp.Regs.sArmRegister[i], Drc.Regs.sArmRegister[i], (Interp.Regs.sArmRegister[i] != Drc.Regs.sArmRegister[i]) ? " <<<" : "");
+			}
+			nRet = 1;
+		}
+
+		if (nRet == 0 && (Interp.nHash != Drc.nHash || Interp.nReads != Drc.nReads)) {
+			Report("seed %u timeslice %d: handler accesses differ\n", nTestSeed, n);
+			nRet = 1;
+		}
+
+		if (nRet == 0 && (memcmp(Interp.Ram, Drc.Ram, RAM_SIZE) || memcmp(Interp.Bank, Drc.Bank, BANK_SIZE))) {
+			Report("seed %u timeslice %d: memory differs\n", nTestSeed, n);
+			nRet = 1;
+		}
+
+		if (nRet) break;
+
+		if (Rand() & 1) {
+			// somewhere else in the code, with fresh registers
+			UINT32 nPC;
+			switch (Rand() % 3) {
+				case 0:  nPC = 0x00000100 + (Rand() & 0xfefc); break;
+				case 1:  nPC = 0x10000000 + (Rand() & 0xfefc); break;
+				default: nPC = 0x18000000 + (Rand() & 0xfefc); break;
+			}
+			for (INT32 i = 0; i < 15; i++) {
+				ARM7.sArmRegister[i] = MakeValue();
+			}
+			for (INT32 i = eR8_FIQ; i < kNumRegisters; i++) {
+				ARM7.sArmRegister[i] = MakeValue();
+			}
+			ARM7.sArmRegister[eR15] = nPC;
+			UINT32 nCPSR = (Rand() & 0xf0000000) | ((Rand() & 3) ? 0xc0 : (Rand() & 0xc0)) | Modes[Rand() % 7];
+			if ((Rand() & 15) == 0) nCPSR |= T_MASK;
+			ARM7.sArmRegister[eCPSR] = nCPSR;
+		}
+
+		if ((Rand() & 3) == 0) {
+			// code changed behind the cpu's back
+			MakeCode(Ram + (Rand() & (RAM_SIZE - 0x40)), 0x40);
+		}
+
+		if ((Rand() % 300) == 0) {
+			Arm7SetIdleLoopAddress((Rand() & 1) ? ~0 : (0x10000000 + (Rand() & 0xfffc)));
+		}
+
+		if ((n % 500) == 250) {
+			Arm7NewFrame();
+		}
+	}
+
+	Arm7Close();
+	Arm7Exit();
+
+	return nRet;
+}
+
+int main(int argc, char** argv)
+{
+	UINT32 nFirst = (argc > 1) ? atoi(argv[1]) : 1;
+	INT32 nSeeds = (argc > 2) ? atoi(argv[2]) : 20;
+	INT32 nSlices = (argc > 3) ? atoi(argv[3]) : 2000;
+
+	Rom = (UINT8*)malloc(ROM_SIZE);
+	Ram = (UINT8*)malloc(RAM_SIZE);
+	Bank = (UINT8*)malloc(BANK_SIZE);
+
+	INT32 nFailed = 0;
+	for (INT32 i = 0; i < nSeeds; i++) {
+		nFailed += RunSeed(nFirst + i, nSlices);
+	}
+
+	Report("%d of %d seeds passed\n", nSeeds - nFailed, nSeeds);
+
+	free(Rom);
+	free(Ram);
+	free(Bank);
+
+	return nFailed ? 1 : 0;
+}
@@ -1,5 +1,8 @@
 #include "burnint.h"
 #include "arm7_intf.h"
+#if defined ARM7_X64_DRC
+#include "arm7/x64/arm7_x64.h"
+#endif
 
 //#define DEBUG_LOG
 
@@ -28,7 +31,16 @@ static UINT8  (*pReadByteHandler)(UINT32) = NULL;
 
 static UINT32 Arm7IdleLoop = ~0;
 
+#if defined ARM7_X64_DRC
+ #define DRC_WRITE(a, n) if (pArm7DrcCode && pArm7DrcCode[(a) >> PAGE_SHIFT]) Arm7DrcWrite(membase[WRITE][(a) >> PAGE_SHIFT] + ((a) & PAGE_BYTE_AND), n)
+#else
+ #define DRC_WRITE(a, n)
+#endif
+
 extern void arm7_set_irq_line(INT32 irqline, INT32 state);
+extern INT32 Arm7IdleRegister();
+
+static INT32 bArm7IdleWrites = 0;		// burn_idle.cpp is watching this cpu's loops, count its writes
 
 static void core_set_irq(INT32 /*cpu*/, INT32 irqline, INT32 state)
 {
@@ -65,6 +77,10 @@ void Arm7Exit() // only one cpu supported
 	if (!DebugCPU_ARM7Initted) bprintf(PRINT_ERROR, _T("Arm7Exit called without init\n"));
 #endif
 
+#if defined ARM7_X64_DRC
+	Arm7DrcExit();
+#endif
+
 	for (INT32 i = 0; i < 3; i++) {
 		if (membase[i]) {
 			free (membase[i]);
@@ -93,6 +109,10 @@ void Arm7MapMemory(UINT8 *src, UINT32 start, UINT32 finish, INT32 type)
 		if (type & (1 << WRITE)) membase[WRITE][offset] = src + (i << PAGE_SHIFT);
 		if (type & (1 << FETCH)) membase[FETCH][offset] = src + (i << PAGE_SHIFT);
 	}
+
+#if defined ARM7_X64_DRC
+	if (pArm7DrcCode) Arm7DrcMapChanged(start, finish);
+#endif
 }
 
 void Arm7SetWriteByteHandler(void (*write)(UINT32, UINT8))
@@ -155,6 +175,8 @@ void Arm7WriteByte(UINT32 addr, UINT8 data)
 	if (!DebugCPU_ARM7Initted) bprintf(PRINT_ERROR, _T("Arm7WriteByte called without init\n"));
 #endif
 
+	if (bArm7IdleWrites) nBurnIdleWrites++;
+
 	addr &= MAX_MEMORY_AND;
 
 #ifdef DEBUG_LOG
@@ -163,6 +185,7 @@ void Arm7WriteByte(UINT32 addr, UINT8 data)
 
 	if (membase[WRITE][addr >> PAGE_SHIFT] != NULL) {
 		membase[WRITE][addr >> PAGE_SHIFT][addr & PAGE_BYTE_AND] = data;
+		DRC_WRITE(addr, 1);
 		return;
 	}
 
@@ -177,6 +200,8 @@ void Arm7WriteWord(UINT32 addr, UINT16 data)
 	if (!DebugCPU_ARM7Initted) bprintf(PRINT_ERROR, _T("Arm7WriteWord called without init\n"));
 #endif
 
+	if (bArm7IdleWrites) nBurnIdleWrites++;
+
 	addr &= MAX_MEMORY_AND;
 
 #ifdef DEBUG_LOG
@@ -185,6 +210,7 @@ void Arm7WriteWord(UINT32 addr, UINT16 data)
 
 	if (membase[WRITE][addr >> PAGE_SHIFT] != NULL) {
 		*((UINT16*)(membase[WRITE][addr >> PAGE_SHIFT] + (addr & PAGE_WORD_AND))) = BURN_ENDIAN_SWAP_INT16(data);
+		DRC_WRITE(addr & ~1, 2);
 		return;
 	}
 
@@ -199,6 +225,8 @@ void Arm7WriteLong(UINT32 addr, UINT32 data)
 	if (!DebugCPU_ARM7Initted) bprintf(PRINT_ERROR, _T("Arm7WriteLong called without init\n"));
 #endif
 
+	if (bArm7IdleWrites) nBurnIdleWrites++;
+
 	addr &= MAX_MEMORY_AND;
 
 #ifdef DEBUG_LOG
@@ -207,6 +235,7 @@ void Arm7WriteLong(UINT32 addr, UINT32 data)
 
 	if (membase[WRITE][addr >> PAGE_SHIFT] != NULL) {
 		*((UINT32*)(membase[WRITE][addr >> PAGE_SHIFT] + (addr & PAGE_LONG_AND))) = BURN_ENDIAN_SWAP_INT32(data);
+		DRC_WRITE(addr & ~3, 4);
 		return;
 	}
 
@@ -367,6 +396,10 @@ void Arm7SetIdleLoopAddress(UINT32 address)
 #endif
 
 	Arm7IdleLoop = address;
+
+#if defined ARM7_X64_DRC
+	if (pArm7DrcCode) Arm7DrcSetIdleLoop(address);
+#endif
 }
 
 
@@ -386,6 +419,9 @@ void Arm7SetIdleLoopAddress(UINT32 address)
 
 	if (membase[READ][addr >> PAGE_SHIFT] != NULL) {
 		membase[READ][addr >> PAGE_SHIFT][addr & PAGE_BYTE_AND] = data;
+#if defined ARM7_X64_DRC
+		if (pArm7DrcCode) Arm7DrcWrite(membase[READ][addr >> PAGE_SHIFT] + (addr & PAGE_BYTE_AND), 1);
+#endif
 	}
 
 	if (pWriteByteHandler) {
@@ -403,4 +439,16 @@ void Arm7Init( INT32 nCPU ) // only one cpu supported
 	}
 
 	CpuCheatRegister(nCPU, &Arm7Config);
+	bArm7IdleWrites = Arm7IdleRegister() >= 0;
+
+#if defined ARM7_X64_DRC && !defined FBNEO_DEBUG
+	if (bBurnUseArm7Recompiler) {
+		Arm7DrcContext c;
+		Arm7DrcGetContext(&c);
+		c.pRead = membase[READ];
+		c.pWrite = membase[WRITE];
+		c.pFetch = membase[FETCH];
+		Arm7DrcInit(&c);
+	}
+#endif
 }
@@ -1398,6 +1398,8 @@ void SekRunEnd()
 // Run the active CPU
 INT32 SekRun(const INT32 nCycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 #ifdef EMU_C68K
 	if ((nSekCpuCore == SEK_CORE_C68K) && nSekCPUType[nSekActive] == 0x68000) {
 		//printf("EMU_C68K: SekRun\n");
@@ -1892,6 +1894,7 @@ INT32 SekScan(INT32 nAction)
 			ba.szName = szName;
 
 			if (nAction & ACB_READ) { // save
+				BurnStateCacheScanOnSave();
 				memset(cyclone_buffer, 0, 128);
 				CyclonePack(&c68k[i], cyclone_buffer);
 				ba.Data = &cyclone_buffer;
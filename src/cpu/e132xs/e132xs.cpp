@@ -214,6 +214,7 @@
 #include "burnint.h"
 #include "e132xs.h"
 #include "e132xs_intf.h"
+#include "x64/e132xs_x64.h"
 
 static UINT8 *mem[2][0x100000];
 
@@ -277,8 +278,18 @@ void E132XSMapMemory(UINT8 *ptr, UINT32 start, UINT32 end, INT32 flags)
 		if (flags & MAP_READ) mem[0][start + i] = (ptr == NULL) ? NULL : (ptr + (i << 12));
 		if (flags & MAP_WRITE) mem[1][start + i] = (ptr == NULL) ? NULL : (ptr + (i << 12));
 	}
+
+#if defined E132XS_X64_DRC
+	if (pE132XSDrcCode) E132XSDrcMapChanged(start << 12, (end << 12) | 0xfff);
+#endif
 }
 
+#if defined E132XS_X64_DRC
+ #define DRC_WRITE(p, n) if (pE132XSDrcCode && pE132XSDrcCode[address >> 12]) E132XSDrcWrite(p, n)
+#else
+ #define DRC_WRITE(p, n)
+#endif
+
 static UINT8 program_read_byte_16be(UINT32 address)
 {
 //	bprintf (0, _T("RB: %8.8x\n"), address);
@@ -356,6 +367,7 @@ static void program_write_byte_16be(UINT32 address, UINT8 data)
 
 	if (ptr) {
 		ptr[(address & 0xfff)^1] = data;
+		DRC_WRITE(ptr + (address & 0xffe), 2);
 		return;
 	}
 
@@ -372,6 +384,7 @@ static void program_write_word_16be(UINT32 address, UINT16 data)
 
 	if (ptr) {
 		*((UINT16*)(ptr + (address & 0xffe))) = BURN_ENDIAN_SWAP_INT16(data);
+		DRC_WRITE(ptr + (address & 0xffe), 2);
 		return;
 	}
 
@@ -389,6 +402,7 @@ static void program_write_dword_32be(UINT32 address, UINT32 data)
 	if (ptr) {
 		data = (data << 16) | (data >> 16);
 		*((UINT32*)(ptr + (address & 0xffe))) = BURN_ENDIAN_SWAP_INT32(data); // word aligned!
+		DRC_WRITE(ptr + (address & 0xffe), 4);
 		return;
 	}
 
@@ -506,6 +520,13 @@ static UINT64	itotal_cycles; // internal total cycles (timers etc)
 static UINT64	utotal_cycles; // user-total cycles (E132XSTotalCycles() / E132XSNewFrame() etc..)
 static INT32	n_cycles;
 static INT32    sleep_until_int;
+static INT32	end_run = 0;
+
+#if defined E132XS_X64_DRC
+static INT32	drc_base;		// icount when translated code was entered
+static INT32	drc_last;		// icount before the last instruction it ran
+static INT32	drc_stop;		// icount it runs down to
+#endif
 
 struct regs_decode
 {
@@ -4748,6 +4769,32 @@ void E132XSInit(INT32 , INT32 type, INT32 )
 			map_internal_ram(0x2000);
 		break;
 	}
+
+#if defined E132XS_X64_DRC && !defined FBNEO_DEBUG
+	if (bBurnUseE132XSRecompiler) {
+		E132XSDrcContext ctx;
+		ctx.pGlobalRegs = m_global_regs;
+		ctx.pLocalRegs = m_local_regs;
+		ctx.pPPC = &m_ppc;
+		ctx.pOp = &m_op;
+		ctx.pICount = &m_icount;
+		ctx.pIntBlock = &m_intblock;
+		ctx.pInstructionLength = &m_instruction_length;
+		ctx.pDelayCmd = &m_delay.delay_cmd;
+		ctx.pDelayPC = &m_delay.delay_pc;
+		ctx.pEndRun = &end_run;
+		ctx.pStop = &drc_stop;
+		ctx.pLast = &drc_last;
+		ctx.pClock[0] = &m_clock_scale;
+		ctx.pClock[1] = &m_clock_cycles_1;
+		ctx.pClock[2] = &m_clock_cycles_2;
+		ctx.pClock[3] = &m_clock_cycles_4;
+		ctx.pClock[4] = &m_clock_cycles_6;
+		ctx.pRead = mem[0];
+		ctx.pWrite = mem[1];
+		E132XSDrcInit(&ctx);
+	}
+#endif
 }
 
 void E132XSReset()
@@ -4784,6 +4831,10 @@ void E132XSReset()
 
 	m_hold_irq = 0;
 	sleep_until_int = 0;
+
+#if defined E132XS_X64_DRC
+	if (pE132XSDrcCode) E132XSDrcVerify();
+#endif
 }
 
 void E132XSOpen(INT32 nCpu)
@@ -4797,7 +4848,9 @@ void E132XSClose()
 
 void E132XSExit()
 {
-
+#if defined E132XS_X64_DRC
+	E132XSDrcExit();
+#endif
 }
 
 INT64 E132XSTotalCycles()
@@ -4808,6 +4861,10 @@ INT64 E132XSTotalCycles()
 void E132XSNewFrame()
 {
 	utotal_cycles = 0;
+
+#if defined E132XS_X64_DRC
+	if (pE132XSDrcCode) E132XSDrcVerify();
+#endif
 }
 
 void E132XSScan(INT32 nAction)
@@ -4846,6 +4903,12 @@ void E132XSScan(INT32 nAction)
 	SCAN_VAR(itotal_cycles); // internal total cycles (timers etc)
 	SCAN_VAR(utotal_cycles); // user-total cycles (E132XSTotalCycles() / E132XSNewFrame() etc..)
 	SCAN_VAR(n_cycles);
+
+#if defined E132XS_X64_DRC
+	if ((nAction & ACB_WRITE) && pE132XSDrcCode) {
+		E132XSDrcVerify();
+	}
+#endif
 }
 
 void E132XSSetIRQLine(INT32 line, INT32 state)
@@ -4880,322 +4943,395 @@ INT32 E132XSIdle(INT32 cycles)
 	return cycles;
 }
 
-static INT32 end_run = 0;
-
-INT32 E132XSRun(INT32 cycles)
+static void execute_insn()
 {
-	if (sleep_until_int) {
-		return E132XSIdle(cycles);
-	}
-
-	m_icount = cycles;
-	n_cycles = m_icount;
+	INT32 t_icount = m_icount;
 
-	if (m_intblock < 0)
-		m_intblock = 0;
+	UINT32 oldh = SR & 0x00000020;
 
-	check_interrupts();
+	PPC = PC;   /* copy PC to previous PC */
 
-	INT32 t_icount;
+	OP = READ_OP(PC);
+	PC += 2;
 
-	end_run = 0;
+	m_instruction_length = 1;
 
-	do
+	switch (OP >> 8)
 	{
-		t_icount = m_icount;
+		case 0x00: op00(); break;
+		case 0x01: op01(); break;
+		case 0x02: op02(); break;
+		case 0x03: op03(); break;
+		case 0x04: op04(); break;
+		case 0x05: op05(); break;
+		case 0x06: op06(); break;
+		case 0x07: op07(); break;
+		case 0x08: op08(); break;
+		case 0x09: op09(); break;
+		case 0x0a: op0a(); break;
+		case 0x0b: op0b(); break;
+		case 0x0c: op0c(); break;
+		case 0x0d: op0d(); break;
+		case 0x0e: op0e(); break;
+		case 0x0f: op0f(); break;
+		case 0x10: op10(); break;
+		case 0x11: op11(); break;
+		case 0x12: op12(); break;
+		case 0x13: op13(); break;
+		case 0x14: op14(); break;
+		case 0x15: op15(); break;
+		case 0x16: op16(); break;
+		case 0x17: op17(); break;
+		case 0x18: op18(); break;
+		case 0x19: op19(); break;
+		case 0x1a: op1a(); break;
+		case 0x1b: op1b(); break;
+		case 0x1c: op1c(); break;
+		case 0x1d: op1d(); break;
+		case 0x1e: op1e(); break;
+		case 0x1f: op1f(); break;
+		case 0x20: op20(); break;
+		case 0x21: op21(); break;
+		case 0x22: op22(); break;
+		case 0x23: op23(); break;
+		case 0x24: op24(); break;
+		case 0x25: op25(); break;
+		case 0x26: op26(); break;
+		case 0x27: op27(); break;
+		case 0x28: op28(); break;
+		case 0x29: op29(); break;
+		case 0x2a: op2a(); break;
+		case 0x2b: op2b(); break;
+		case 0x2c: op2c(); break;
+		case 0x2d: op2d(); break;
+		case 0x2e: op2e(); break;
+		case 0x2f: op2f(); break;
+		case 0x30: op30(); break;
+		case 0x31: op31(); break;
+		case 0x32: op32(); break;
+		case 0x33: op33(); break;
+		case 0x34: op34(); break;
+		case 0x35: op35(); break;
+		case 0x36: op36(); break;
+		case 0x37: op37(); break;
+		case 0x38: op38(); break;
+		case 0x39: op39(); break;
+		case 0x3a: op3a(); break;
+		case 0x3b: op3b(); break;
+		case 0x3c: op3c(); break;
+		case 0x3d: op3d(); break;
+		case 0x3e: op3e(); break;
+		case 0x3f: op3f(); break;
+		case 0x40: op40(); break;
+		case 0x41: op41(); break;
+		case 0x42: op42(); break;
+		case 0x43: op43(); break;
+		case 0x44: op44(); break;
+		case 0x45: op45(); break;
+		case 0x46: op46(); break;
+		case 0x47: op47(); break;
+		case 0x48: op48(); break;
+		case 0x49: op49(); break;
+		case 0x4a: op4a(); break;
+		case 0x4b: op4b(); break;
+		case 0x4c: op4c(); break;
+		case 0x4d: op4d(); break;
+		case 0x4e: op4e(); break;
+		case 0x4f: op4f(); break;
+		case 0x50: op50(); break;
+		case 0x51: op51(); break;
+		case 0x52: op52(); break;
+		case 0x53: op53(); break;
+		case 0x54: op54(); break;
+		case 0x55: op55(); break;
+		case 0x56: op56(); break;
+		case 0x57: op57(); break;
+		case 0x58: op58(); break;
+		case 0x59: op59(); break;
+		case 0x5a: op5a(); break;
+		case 0x5b: op5b(); break;
+		case 0x5c: op5c(); break;
+		case 0x5d: op5d(); break;
+		case 0x5e: op5e(); break;
+		case 0x5f: op5f(); break;
+		case 0x60: op60(); break;
+		case 0x61: op61(); break;
+		case 0x62: op62(); break;
+		case 0x63: op63(); break;
+		case 0x64: op64(); break;
+		case 0x65: op65(); break;
+		case 0x66: op66(); break;
+		case 0x67: op67(); break;
+		case 0x68: op68(); break;
+		case 0x69: op69(); break;
+		case 0x6a: op6a(); break;
+		case 0x6b: op6b(); break;
+		case 0x6c: op6c(); break;
+		case 0x6d: op6d(); break;
+		case 0x6e: op6e(); break;
+		case 0x6f: op6f(); break;
+		case 0x70: op70(); break;
+		case 0x71: op71(); break;
+		case 0x72: op72(); break;
+		case 0x73: op73(); break;
+		case 0x74: op74(); break;
+		case 0x75: op75(); break;
+		case 0x76: op76(); break;
+		case 0x77: op77(); break;
+		case 0x78: op78(); break;
+		case 0x79: op79(); break;
+		case 0x7a: op7a(); break;
+		case 0x7b: op7b(); break;
+		case 0x7c: op7c(); break;
+		case 0x7d: op7d(); break;
+		case 0x7e: op7e(); break;
+		case 0x7f: op7f(); break;
+		case 0x80: op80(); break;
+		case 0x81: op81(); break;
+		case 0x82: op82(); break;
+		case 0x83: op83(); break;
+		case 0x84: op84(); break;
+		case 0x85: op85(); break;
+		case 0x86: op86(); break;
+		case 0x87: op87(); break;
+		case 0x88: op88(); break;
+		case 0x89: op89(); break;
+		case 0x8a: op8a(); break;
+		case 0x8b: op8b(); break;
+		case 0x8c: op8c(); break;
+		case 0x8d: op8d(); break;
+		case 0x8e: op8e(); break;
+		case 0x8f: op8f(); break;
+		case 0x90: op90(); break;
+		case 0x91: op91(); break;
+		case 0x92: op92(); break;
+		case 0x93: op93(); break;
+		case 0x94: op94(); break;
+		case 0x95: op95(); break;
+		case 0x96: op96(); break;
+		case 0x97: op97(); break;
+		case 0x98: op98(); break;
+		case 0x99: op99(); break;
+		case 0x9a: op9a(); break;
+		case 0x9b: op9b(); break;
+		case 0x9c: op9c(); break;
+		case 0x9d: op9d(); break;
+		case 0x9e: op9e(); break;
+		case 0x9f: op9f(); break;
+		case 0xa0: opa0(); break;
+		case 0xa1: opa1(); break;
+		case 0xa2: opa2(); break;
+		case 0xa3: opa3(); break;
+		case 0xa4: opa4(); break;
+		case 0xa5: opa5(); break;
+		case 0xa6: opa6(); break;
+		case 0xa7: opa7(); break;
+		case 0xa8: opa8(); break;
+		case 0xa9: opa9(); break;
+		case 0xaa: opaa(); break;
+		case 0xab: opab(); break;
+		case 0xac: opac(); break;
+		case 0xad: opad(); break;
+		case 0xae: opae(); break;
+		case 0xaf: opaf(); break;
+		case 0xb0: opb0(); break;
+		case 0xb1: opb1(); break;
+		case 0xb2: opb2(); break;
+		case 0xb3: opb3(); break;
+		case 0xb4: opb4(); break;
+		case 0xb5: opb5(); break;
+		case 0xb6: opb6(); break;
+		case 0xb7: opb7(); break;
+		case 0xb8: opb8(); break;
+		case 0xb9: opb9(); break;
+		case 0xba: opba(); break;
+		case 0xbb: opbb(); break;
+		case 0xbc: opbc(); break;
+		case 0xbd: opbd(); break;
+		case 0xbe: opbe(); break;
+		case 0xbf: opbf(); break;
+		case 0xc0: opc0(); break;
+		case 0xc1: opc1(); break;
+		case 0xc2: opc2(); break;
+		case 0xc3: opc3(); break;
+		case 0xc4: opc4(); break;
+		case 0xc5: opc5(); break;
+		case 0xc6: opc6(); break;
+		case 0xc7: opc7(); break;
+		case 0xc8: opc8(); break;
+		case 0xc9: opc9(); break;
+		case 0xca: opca(); break;
+		case 0xcb: opcb(); break;
+		case 0xcc: opcc(); break;
+		case 0xcd: opcd(); break;
+		case 0xce: opce(); break;
+		case 0xcf: opcf(); break;
+		case 0xd0: opd0(); break;
+		case 0xd1: opd1(); break;
+		case 0xd2: opd2(); break;
+		case 0xd3: opd3(); break;
+		case 0xd4: opd4(); break;
+		case 0xd5: opd5(); break;
+		case 0xd6: opd6(); break;
+		case 0xd7: opd7(); break;
+		case 0xd8: opd8(); break;
+		case 0xd9: opd9(); break;
+		case 0xda: opda(); break;
+		case 0xdb: opdb(); break;
+		case 0xdc: opdc(); break;
+		case 0xdd: opdd(); break;
+		case 0xde: opde(); break;
+		case 0xdf: opdf(); break;
+		case 0xe0: ope0(); break;
+		case 0xe1: ope1(); break;
+		case 0xe2: ope2(); break;
+		case 0xe3: ope3(); break;
+		case 0xe4: ope4(); break;
+		case 0xe5: ope5(); break;
+		case 0xe6: ope6(); break;
+		case 0xe7: ope7(); break;
+		case 0xe8: ope8(); break;
+		case 0xe9: ope9(); break;
+		case 0xea: opea(); break;
+		case 0xeb: opeb(); break;
+		case 0xec: opec(); break;
+		case 0xed: oped(); break;
+		case 0xee: opee(); break;
+		case 0xef: opef(); break;
+		case 0xf0: opf0(); break;
+		case 0xf1: opf1(); break;
+		case 0xf2: opf2(); break;
+		case 0xf3: opf3(); break;
+		case 0xf4: opf4(); break;
+		case 0xf5: opf5(); break;
+		case 0xf6: opf6(); break;
+		case 0xf7: opf7(); break;
+		case 0xf8: opf8(); break;
+		case 0xf9: opf9(); break;
+		case 0xfa: opfa(); break;
+		case 0xfb: opfb(); break;
+		case 0xfc: opfc(); break;
+		case 0xfd: opfd(); break;
+		case 0xfe: opfe(); break;
+		case 0xff: opff(); break;
+	}
 
-		UINT32 oldh = SR & 0x00000020;
+	/* clear the H state if it was previously set */
+	SR ^= oldh;
 
-		PPC = PC;   /* copy PC to previous PC */
+	SET_ILC(m_instruction_length & 3);
 
-		OP = READ_OP(PC);
-		PC += 2;
+	if( GET_T && GET_P && m_delay.delay_cmd == NO_DELAY ) /* Not in a Delayed Branch instructions */
+	{
+		UINT32 addr = get_trap_addr(TRAPNO_TRACE_EXCEPTION);
+		execute_exception(addr);
+	}
 
-		m_instruction_length = 1;
+	if (--m_intblock == 0)
+		check_interrupts();
 
-		switch (OP >> 8)
-		{
-			case 0x00: op00(); break;
-			case 0x01: op01(); break;
-			case 0x02: op02(); break;
-			case 0x03: op03(); break;
-			case 0x04: op04(); break;
-			case 0x05: op05(); break;
-			case 0x06: op06(); break;
-			case 0x07: op07(); break;
-			case 0x08: op08(); break;
-			case 0x09: op09(); break;
-			case 0x0a: op0a(); break;
-			case 0x0b: op0b(); break;
-			case 0x0c: op0c(); break;
-			case 0x0d: op0d(); break;
-			case 0x0e: op0e(); break;
-			case 0x0f: op0f(); break;
-			case 0x10: op10(); break;
-			case 0x11: op11(); break;
-			case 0x12: op12(); break;
-			case 0x13: op13(); break;
-			case 0x14: op14(); break;
-			case 0x15: op15(); break;
-			case 0x16: op16(); break;
-			case 0x17: op17(); break;
-			case 0x18: op18(); break;
-			case 0x19: op19(); break;
-			case 0x1a: op1a(); break;
-			case 0x1b: op1b(); break;
-			case 0x1c: op1c(); break;
-			case 0x1d: op1d(); break;
-			case 0x1e: op1e(); break;
-			case 0x1f: op1f(); break;
-			case 0x20: op20(); break;
-			case 0x21: op21(); break;
-			case 0x22: op22(); break;
-			case 0x23: op23(); break;
-			case 0x24: op24(); break;
-			case 0x25: op25(); break;
-			case 0x26: op26(); break;
-			case 0x27: op27(); break;
-			case 0x28: op28(); break;
-			case 0x29: op29(); break;
-			case 0x2a: op2a(); break;
-			case 0x2b: op2b(); break;
-			case 0x2c: op2c(); break;
-			case 0x2d: op2d(); break;
-			case 0x2e: op2e(); break;
-			case 0x2f: op2f(); break;
-			case 0x30: op30(); break;
-			case 0x31: op31(); break;
-			case 0x32: op32(); break;
-			case 0x33: op33(); break;
-			case 0x34: op34(); break;
-			case 0x35: op35(); break;
-			case 0x36: op36(); break;
-			case 0x37: op37(); break;
-			case 0x38: op38(); break;
-			case 0x39: op39(); break;
-			case 0x3a: op3a(); break;
-			case 0x3b: op3b(); break;
-			case 0x3c: op3c(); break;
-			case 0x3d: op3d(); break;
-			case 0x3e: op3e(); break;
-			case 0x3f: op3f(); break;
-			case 0x40: op40(); break;
-			case 0x41: op41(); break;
-			case 0x42: op42(); break;
-			case 0x43: op43(); break;
-			case 0x44: op44(); break;
-			case 0x45: op45(); break;
-			case 0x46: op46(); break;
-			case 0x47: op47(); break;
-			case 0x48: op48(); break;
-			case 0x49: op49(); break;
-			case 0x4a: op4a(); break;
-			case 0x4b: op4b(); break;
-			case 0x4c: op4c(); break;
-			case 0x4d: op4d(); break;
-			case 0x4e: op4e(); break;
-			case 0x4f: op4f(); break;
-			case 0x50: op50(); break;
-			case 0x51: op51(); break;
-			case 0x52: op52(); break;
-			case 0x53: op53(); break;
-			case 0x54: op54(); break;
-			case 0x55: op55(); break;
-			case 0x56: op56(); break;
-			case 0x57: op57(); break;
-			case 0x58: op58(); break;
-			case 0x59: op59(); break;
-			case 0x5a: op5a(); break;
-			case 0x5b: op5b(); break;
-			case 0x5c: op5c(); break;
-			case 0x5d: op5d(); break;
-			case 0x5e: op5e(); break;
-			case 0x5f: op5f(); break;
-			case 0x60: op60(); break;
-			case 0x61: op61(); break;
-			case 0x62: op62(); break;
-			case 0x63: op63(); break;
-			case 0x64: op64(); break;
-			case 0x65: op65(); break;
-			case 0x66: op66(); break;
-			case 0x67: op67(); break;
-			case 0x68: op68(); break;
-			case 0x69: op69(); break;
-			case 0x6a: op6a(); break;
-			case 0x6b: op6b(); break;
-			case 0x6c: op6c(); break;
-			case 0x6d: op6d(); break;
-			case 0x6e: op6e(); break;
-			case 0x6f: op6f(); break;
-			case 0x70: op70(); break;
-			case 0x71: op71(); break;
-			case 0x72: op72(); break;
-			case 0x73: op73(); break;
-			case 0x74: op74(); break;
-			case 0x75: op75(); break;
-			case 0x76: op76(); break;
-			case 0x77: op77(); break;
-			case 0x78: op78(); break;
-			case 0x79: op79(); break;
-			case 0x7a: op7a(); break;
-			case 0x7b: op7b(); break;
-			case 0x7c: op7c(); break;
-			case 0x7d: op7d(); break;
-			case 0x7e: op7e(); break;
-			case 0x7f: op7f(); break;
-			case 0x80: op80(); break;
-			case 0x81: op81(); break;
-			case 0x82: op82(); break;
-			case 0x83: op83(); break;
-			case 0x84: op84(); break;
-			case 0x85: op85(); break;
-			case 0x86: op86(); break;
-			case 0x87: op87(); break;
-			case 0x88: op88(); break;
-			case 0x89: op89(); break;
-			case 0x8a: op8a(); break;
-			case 0x8b: op8b(); break;
-			case 0x8c: op8c(); break;
-			case 0x8d: op8d(); break;
-			case 0x8e: op8e(); break;
-			case 0x8f: op8f(); break;
-			case 0x90: op90(); break;
-			case 0x91: op91(); break;
-			case 0x92: op92(); break;
-			case 0x93: op93(); break;
-			case 0x94: op94(); break;
-			case 0x95: op95(); break;
-			case 0x96: op96(); break;
-			case 0x97: op97(); break;
-			case 0x98: op98(); break;
-			case 0x99: op99(); break;
-			case 0x9a: op9a(); break;
-			case 0x9b: op9b(); break;
-			case 0x9c: op9c(); break;
-			case 0x9d: op9d(); break;
-			case 0x9e: op9e(); break;
-			case 0x9f: op9f(); break;
-			case 0xa0: opa0(); break;
-			case 0xa1: opa1(); break;
-			case 0xa2: opa2(); break;
-			case 0xa3: opa3(); break;
-			case 0xa4: opa4(); break;
-			case 0xa5: opa5(); break;
-			case 0xa6: opa6(); break;
-			case 0xa7: opa7(); break;
-			case 0xa8: opa8(); break;
-			case 0xa9: opa9(); break;
-			case 0xaa: opaa(); break;
-			case 0xab: opab(); break;
-			case 0xac: opac(); break;
-			case 0xad: opad(); break;
-			case 0xae: opae(); break;
-			case 0xaf: opaf(); break;
-			case 0xb0: opb0(); break;
-			case 0xb1: opb1(); break;
-			case 0xb2: opb2(); break;
-			case 0xb3: opb3(); break;
-			case 0xb4: opb4(); break;
-			case 0xb5: opb5(); break;
-			case 0xb6: opb6(); break;
-			case 0xb7: opb7(); break;
-			case 0xb8: opb8(); break;
-			case 0xb9: opb9(); break;
-			case 0xba: opba(); break;
-			case 0xbb: opbb(); break;
-			case 0xbc: opbc(); break;
-			case 0xbd: opbd(); break;
-			case 0xbe: opbe(); break;
-			case 0xbf: opbf(); break;
-			case 0xc0: opc0(); break;
-			case 0xc1: opc1(); break;
-			case 0xc2: opc2(); break;
-			case 0xc3: opc3(); break;
-			case 0xc4: opc4(); break;
-			case 0xc5: opc5(); break;
-			case 0xc6: opc6(); break;
-			case 0xc7: opc7(); break;
-			case 0xc8: opc8(); break;
-			case 0xc9: opc9(); break;
-			case 0xca: opca(); break;
-			case 0xcb: opcb(); break;
-			case 0xcc: opcc(); break;
-			case 0xcd: opcd(); break;
-			case 0xce: opce(); break;
-			case 0xcf: opcf(); break;
-			case 0xd0: opd0(); break;
-			case 0xd1: opd1(); break;
-			case 0xd2: opd2(); break;
-			case 0xd3: opd3(); break;
-			case 0xd4: opd4(); break;
-			case 0xd5: opd5(); break;
-			case 0xd6: opd6(); break;
-			case 0xd7: opd7(); break;
-			case 0xd8: opd8(); break;
-			case 0xd9: opd9(); break;
-			case 0xda: opda(); break;
-			case 0xdb: opdb(); break;
-			case 0xdc: opdc(); break;
-			case 0xdd: opdd(); break;
-			case 0xde: opde(); break;
-			case 0xdf: opdf(); break;
-			case 0xe0: ope0(); break;
-			case 0xe1: ope1(); break;
-			case 0xe2: ope2(); break;
-			case 0xe3: ope3(); break;
-			case 0xe4: ope4(); break;
-			case 0xe5: ope5(); break;
-			case 0xe6: ope6(); break;
-			case 0xe7: ope7(); break;
-			case 0xe8: ope8(); break;
-			case 0xe9: ope9(); break;
-			case 0xea: opea(); break;
-			case 0xeb: opeb(); break;
-			case 0xec: opec(); break;
-			case 0xed: oped(); break;
-			case 0xee: opee(); break;
-			case 0xef: opef(); break;
-			case 0xf0: opf0(); break;
-			case 0xf1: opf1(); break;
-			case 0xf2: opf2(); break;
-			case 0xf3: opf3(); break;
-			case 0xf4: opf4(); break;
-			case 0xf5: opf5(); break;
-			case 0xf6: opf6(); break;
-			case 0xf7: opf7(); break;
-			case 0xf8: opf8(); break;
-			case 0xf9: opf9(); break;
-			case 0xfa: opfa(); break;
-			case 0xfb: opfb(); break;
-			case 0xfc: opfc(); break;
-			case 0xfd: opfd(); break;
-			case 0xfe: opfe(); break;
-			case 0xff: opff(); break;
+		// here??
+	if (timer_time > 0) {
+		timer_time -= t_icount - m_icount;
+		if (timer_time <= 0) {
+			timer_callback(timer_param);
 		}
+	}
+
+	itotal_cycles += t_icount - m_icount;
+}
 
-		/* clear the H state if it was previously set */
-		SR ^= oldh;
+#if defined E132XS_X64_DRC
+// charge the timer and the internal cycle count with what translated code ran, the
+// last instruction on its own since that's where the interpreter would fire the timer
+static void drc_sync()
+{
+	INT32 a = drc_base - drc_last;
+	INT32 b = drc_last - m_icount;
 
-		SET_ILC(m_instruction_length & 3);
+	if (timer_time > 0) timer_time -= a;
+	itotal_cycles += a;
 
-		if( GET_T && GET_P && m_delay.delay_cmd == NO_DELAY ) /* Not in a Delayed Branch instructions */
-		{
-			UINT32 addr = get_trap_addr(TRAPNO_TRACE_EXCEPTION);
-			execute_exception(addr);
+	if (timer_time > 0) {
+		timer_time -= b;
+		if (timer_time <= 0) {
+			timer_callback(timer_param);
 		}
+	}
+	itotal_cycles += b;
 
-		if (--m_intblock == 0)
-			check_interrupts();
+	drc_base = drc_last = m_icount;
+}
 
-			// here??
-		if (timer_time > 0) {
-			timer_time -= t_icount - m_icount;
-			if (timer_time <= 0) {
-				timer_callback(timer_param);
+// translated code stops once the timer is due
+static INT32 drc_timer_stop()
+{
+	return (timer_time > 0 && timer_time < m_icount) ? m_icount - timer_time : 0;
+}
+
+// the interpreter as seen from translated code
+UINT32 E132XSDrcReadByte(UINT32 a)				{ return READ_B(a); }
+UINT32 E132XSDrcReadWord(UINT32 a)				{ return READ_HW(a); }
+UINT32 E132XSDrcReadLong(UINT32 a)				{ return READ_W(a); }
+void E132XSDrcWriteByte(UINT32 a, UINT32 d)		{ WRITE_B(a, d); }
+void E132XSDrcWriteWord(UINT32 a, UINT32 d)		{ WRITE_HW(a, d); }
+void E132XSDrcWriteLong(UINT32 a, UINT32 d)		{ WRITE_W(a, d); }
+UINT32 E132XSDrcIORead(UINT32 a)				{ return IO_READ_W(a); }
+void E132XSDrcIOWrite(UINT32 a, UINT32 d)		{ IO_WRITE_W(a, d); }
+
+INT32 E132XSDrcCheckInterrupts()
+{
+	UINT32 sr = SR;
+	check_interrupts();
+
+	return SR != sr;
+}
+
+INT32 E132XSDrcStep()
+{
+	UINT8 scale = m_clock_scale;
+
+	drc_last = m_icount;
+	drc_sync();
+	execute_insn();
+	drc_base = drc_last = m_icount;
+	drc_stop = drc_timer_stop();
+
+	return end_run || m_delay.delay_cmd != NO_DELAY || GET_H || (GET_T && GET_P) || m_clock_scale != scale;
+}
+#endif
+
+INT32 E132XSRun(INT32 cycles)
+{
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
+	if (sleep_until_int) {
+		return E132XSIdle(cycles);
+	}
+
+	m_icount = cycles;
+	n_cycles = m_icount;
+
+	if (m_intblock < 0)
+		m_intblock = 0;
+
+	check_interrupts();
+
+	end_run = 0;
+
+	do
+	{
+#if defined E132XS_X64_DRC
+		if (pE132XSDrcCode && m_delay.delay_cmd == NO_DELAY && !GET_H && !(GET_T && GET_P) && !E132XSDrcRunning()) {
+			drc_base = drc_last = m_icount;
+			drc_stop = drc_timer_stop();
+			if (E132XSDrcRun()) {
+				drc_sync();
+				continue;
 			}
 		}
-
-		itotal_cycles += t_icount - m_icount;
+#endif
+		execute_insn();
 
 	} while( m_icount > 0 && !end_run );
 
@@ -0,0 +1,2509 @@
+// Hyperstone E1-32XS block recompiler for x86-64 hosts
+//
+// Runs on the interpreter's context (e132xs.cpp), so save states, E132XSGetPC() in the drivers'
+// speedhack handlers and the on-chip timer see what the interpreter would leave behind.  Code
+// is translated a block at a time out of the read map; blocks are keyed by pc and by the frame
+// pointer, so local registers are resolved while translating.  Memory operands go straight
+// through the e132xs.cpp page tables and drop to the E132XS read / write functions for handler
+// pages.  A delayed branch gets its delay slot translated inline on the taken path.
+// Instructions we don't translate (anything writing SR, RET and the other high global writers,
+// ADDC / SUBC and the trapping forms, CHK, DIV, XM, the register and double shifts, SET,
+// EXTEND, FRAME, TRAP, the stack forms and the floating point ops) are run by calling the
+// interpreter for one instruction from inside the block.
+//
+// E132XSRun() stays in charge of the timer: translated code runs down to the icount the timer
+// is due at, and the run loop charges the timer and the internal cycle count afterwards, with
+// the last instruction apart since that's where the interpreter fires the timer.  Every
+// translated instruction counts m_intblock down and checks the interrupts when it runs out,
+// as the interpreter does.
+//
+// Spin loops (a backward branch over translated instructions that don't store anything and
+// only read registers and flags they wrote first) are fast-forwarded to the stop once an
+// iteration went by without calling a handler: nothing can change until something outside
+// the cpu does.
+//
+// Stale code: E132XS writes to pages holding translated code invalidate the blocks there, and
+// blocks translated from writable pages compare their code on every entry, which also catches
+// the driver and the handlers writing ram.  Rom blocks are checked at frame start, reset and
+// state load.
+//
+// Register use inside generated code:
+//   rbx = m_global_regs[] (the other statics are addressed from it), rbp = DrcHot,
+//   r12 = read pages (the write pages follow), r13d = m_intblock, r14d = icount to stop at,
+//   r15d = m_icount
+//   eax = operand / result, ecx = address, edx, r8-r11 = scratch,
+//   [rsp + 32..55] = operands that live across memory accesses
+
+#ifdef E132XS_X64_DRC
+
+#include "burnint.h"
+
+#include <deque>
+#include <vector>
+#include <unordered_map>
+
+#include "../../mips3/x64/xbyak/xbyak.h"
+
+#include "../e132xs.h"
+#include "e132xs_x64.h"
+
+#define DRC_CODE_SIZE		(8 * 1024 * 1024)
+#define DRC_CODE_SLACK		(256 * 1024)			// room a single block may need
+#define DRC_CACHE_SIZE		4096					// direct mapped pc / fp -> code cache (power of 2)
+#define DRC_MAX_INSNS		128						// instructions per block
+
+#define DRC_PAGE_SHIFT		12						// e132xs.cpp's pages
+#define DRC_PAGE_SIZE		(1 << DRC_PAGE_SHIFT)
+#define DRC_PAGEM			(DRC_PAGE_SIZE - 1)
+#define DRC_PAGE_COUNT		(0x100000000ULL >> DRC_PAGE_SHIFT)
+
+#define DRC_KEEP_PC			1						// odd, no translated target is: PC is already set
+
+// SR
+#define SR_C				0x00000001
+#define SR_Z				0x00000002
+#define SR_N				0x00000004
+#define SR_V				0x00000008
+#define SR_M				0x00000010
+#define SR_S				0x00040000
+#define SR_ILC				0x00180000
+#define SR_FL				0x01e00000
+#define SR_FP				0xfe000000
+
+struct DrcBlock;
+
+struct DrcCacheEntry {
+	UINT32 nPC;
+	UINT32 nKey;
+	UINT8* pFetch;
+	void* pCode;
+	DrcBlock* pBlock;
+};
+
+// everything generated code touches besides the cpu context, addressed through rbp
+struct DrcHot {
+	UINT8 Code[DRC_PAGE_COUNT];					// must stay first
+	UINT32 nBreak;
+	UINT32 nHit;								// a handler ran since the last loop head
+	INT32 nDelta;								// icount handlers took, for the exit's sums
+	UINT32 nPad;
+	DrcCacheEntry Cache[DRC_CACHE_SIZE];
+};
+
+#define HOT_BREAK			((INT32)offsetof(DrcHot, nBreak))
+#define HOT_HIT				((INT32)offsetof(DrcHot, nHit))
+#define HOT_DELTA			((INT32)offsetof(DrcHot, nDelta))
+#define HOT_CACHE			((INT32)offsetof(DrcHot, Cache))
+
+struct DrcBlock {
+	UINT32 nPC;
+	UINT32 nKey;
+	UINT32 nPage;								// pc >> DRC_PAGE_SHIFT
+	INT32 nLen;									// bytes of host memory covered
+	bool bDead;
+	bool bCheck;								// from a writable page: compared with pSource on every entry
+	UINT8* pFetch;								// read page it was translated from
+	UINT8* pHost;								// first byte of its code in host memory
+	UINT8* pSource;								// copy of that code
+	void* pCode;
+};
+
+// an instruction as the decode macros see it
+struct DrcInsn {
+	UINT32 nPC, nNext;							// its address, the one after it
+	UINT16 nOp;
+	INT32 nLen;									// m_instruction_length
+	INT32 nSub;									// sub_type
+	UINT32 nExtra;
+	INT32 nS, nD;								// register codes
+	bool bS, bD;								// local
+	bool bSame, bSameF;							// SAME_SRC_DST, SAME_SRCF_DST
+};
+
+// an instruction of the block being translated
+struct DrcNode {
+	DrcInsn i;
+	Xbyak::Label l;
+	bool bTarget;								// a branch in the block goes here
+	bool bHead;									// ... from behind
+	bool bSpin;									// translated, no stores, calls or jumps, fixed cycles
+	INT32 nCycles;								// when it falls through
+	UINT64 nReadL, nWriteL;						// local registers (absolute)
+	UINT32 nReadG, nWriteG;						// global registers, flags from bit 20
+};
+
+enum { STUB_READ, STUB_WRITE, STUB_IOREAD, STUB_IOWRITE, STUB_EXIT, STUB_CHECKINT };
+
+struct DrcStub {
+	Xbyak::Label lFrom, lBack;
+	INT32 nType;
+	INT32 nSize;
+	UINT32 nPC, nPPC;
+	UINT16 nOp;
+	INT32 nLen;
+	INT32 nCycles;								// the instruction's, for the timer sums
+	UINT32 nDelayPC;							// DRC_KEEP_PC: no delayed branch pending
+};
+
+#define REG_PC				dword[rbx + 0]
+#define REG_SR				dword[rbx + 4]
+
+#define SLOT_D				dword[rsp + 32]
+#define SLOT_S				dword[rsp + 40]
+#define SLOT_SF				dword[rsp + 48]
+
+#define FLAG_BITS(f)		((f) << 20)
+
+class E132XSDrc : public Xbyak::CodeGenerator
+{
+public:
+	E132XSDrc(E132XSDrcContext* pContext);
+	~E132XSDrc();
+
+	INT32 Run();
+	void MapChanged(UINT32 nStart, UINT32 nEnd);
+	void Verify();
+	void CheckHost(UINT8* p, INT32 nLen);
+	void Invalidate(DrcBlock* b);
+
+	E132XSDrcContext Ctx;
+	DrcHot* pHot;
+	bool bRunning;
+	bool bVerifyPending;
+
+private:
+	void* Find(UINT32 nPC);
+	DrcBlock* Compile(UINT32 nPC, UINT32 nKey, UINT8* pFetch);
+	void EmitCommon();
+	bool PageHasCode(INT32 nPage);
+	void ComputeCode(INT32 nFirst, INT32 nLast);
+	void CodeAdded(uintptr_t nChunk);
+	void Forget(DrcBlock* b);
+	void Flush();
+
+	// decoding
+	bool Fetch(UINT32& a, UINT16& w);
+	bool Decode(UINT32 nPC, DrcInsn& d);
+	void Scan(UINT32 nPC);
+
+	// translation
+	INT32 Ofs(const void* p);
+	Xbyak::Address Var(const void* p) { return dword[rbx + Ofs(p)]; }
+	Xbyak::Address Local(INT32 n) { return dword[rbx + m_nLocalOfs + ((n + m_nFP) & 63) * 4]; }
+	Xbyak::Address Global(INT32 n) { return dword[rbx + n * 4]; }
+
+	void UseReg(bool bLocal, INT32 n, bool bWrite);
+	void UseFlags(UINT32 nFlags, bool bWrite);
+	void Load(const Xbyak::Reg32& r, bool bLocal, INT32 n);
+	void LoadF(const Xbyak::Reg32& r, bool bLocal, INT32 n);
+	void Store(const Xbyak::Reg32& r, bool bLocal, INT32 n);
+	void StoreF(const Xbyak::Reg32& r, bool bLocal, INT32 n);
+	void LoadSC(const Xbyak::Reg32& r);
+
+	void Ilc();
+	void UpdateSR(UINT32 nClear, UINT32 nSet, bool bEcx);
+	void SetFlags(UINT32 nFlags, bool bLess = false, UINT32 nClear = 0, bool bVr11 = false);
+	void EmitCond(INT32 nCond, Xbyak::Label& lSkip);
+
+	DrcStub& NewStub(INT32 nType, INT32 nSize);
+	void EmitStubs();
+	void MemRead(INT32 nSize);
+	void MemWrite(INT32 nSize);
+	void IORead();
+	void IOWrite();
+	void EmitCheck(DrcBlock* b, const void* pBody);
+	void EndInsn(INT32 nCycles) { EndInsnAt(nCycles, m_nNextPC, m_nInsnPC, -1, DRC_KEEP_PC); }
+	void EndInsnAt(INT32 nCycles, UINT32 nPC, UINT32 nPPC, INT32 nIntBlock, UINT32 nDelayPC);
+	void JumpTo(UINT32 nTarget, UINT32 nPPC);
+	void JumpOut(UINT32 nTarget, UINT32 nPPC);
+	bool SpinLoop(INT32 nHead, INT32 nBranch, INT32& nCycles, INT32& nInsns);
+
+	INT32 CompileOp(const DrcInsn& d);
+	INT32 CompileFallback(const DrcInsn& d);
+	INT32 CompileALU(const DrcInsn& d);
+	INT32 CompileImm(const DrcInsn& d);
+	INT32 CompileShift(const DrcInsn& d);
+	INT32 CompileMul(const DrcInsn& d);
+	INT32 CompileMovd(const DrcInsn& d);
+	INT32 CompileTestlz(const DrcInsn& d);
+	INT32 CompileLoad1(const DrcInsn& d);
+	INT32 CompileLoad2(const DrcInsn& d);
+	INT32 CompileStore1(const DrcInsn& d);
+	INT32 CompileStore2(const DrcInsn& d);
+	INT32 CompileLR(const DrcInsn& d);
+	INT32 CompileBranch(const DrcInsn& d);
+	INT32 CompileDelayed(const DrcInsn& d);
+	INT32 CompileCall(const DrcInsn& d);
+	bool CompileSlot(UINT32 nTarget);
+
+	bool m_bFlushPending;
+	UINT8 m_nClock[5];							// the clock fields the code was translated for
+
+	INT32 m_nLocalOfs;							// from m_global_regs[]
+	INT32 m_nWriteOfs;							// write pages from the read pages
+
+	void (*m_pEntry)(void*, DrcHot*);
+	Xbyak::Label* m_plExit;
+	Xbyak::Label* m_plExitSync;
+	Xbyak::Label* m_plDispatch;
+
+	std::unordered_multimap<UINT32, DrcBlock*> m_Blocks;
+	std::unordered_map<UINT32, std::vector<DrcBlock*> > m_Pages;
+	std::unordered_map<uintptr_t, std::vector<DrcBlock*> > m_Chunks;	// host address >> DRC_PAGE_SHIFT -> blocks
+	std::vector<DrcBlock*> m_Dead;
+
+	// state of the block being translated
+	UINT8* m_pPage;
+	UINT32 m_nPC;								// where the block starts
+	UINT32 m_nFP;
+	INT32 m_nIlc;								// SR's ILC as the code leaves it, -1 unknown
+	std::deque<DrcNode> m_Nodes;
+	DrcNode m_Slot;								// a delay slot translated inline
+
+	// the instruction being translated
+	DrcNode* m_pNode;
+	INT32 m_nIndex;
+	UINT32 m_nInsnPC;
+	UINT32 m_nNextPC;							// PC as the instruction and its handlers see it
+	UINT16 m_nOp;
+	INT32 m_nLen;
+	bool m_bSlot;
+	bool m_bCall;
+	std::deque<DrcStub> m_Stubs;
+};
+
+static E132XSDrc* pDrc = NULL;
+UINT8* pE132XSDrcCode = NULL;
+
+static inline UINT32 DrcCacheIndex(UINT32 nPC, UINT32 nKey)
+{
+	return ((nPC >> 1) ^ (nKey << 5)) & (DRC_CACHE_SIZE - 1);
+}
+
+// ----------------------------------------------------------------------------
+// Calls out of generated code
+
+// something the run loop has to look at happened inside a handler, leave after this instruction
+struct DrcCall {
+	UINT32 nPC;
+	INT32 nICount;
+
+	DrcCall() {
+		nPC = pDrc->Ctx.pGlobalRegs[0];
+		nICount = *pDrc->Ctx.pICount;
+	}
+
+	~DrcCall() {
+		DrcHot* p = pDrc->pHot;
+
+		p->nHit = 1;
+		if (*pDrc->Ctx.pICount != nICount) {
+			p->nDelta += nICount - *pDrc->Ctx.pICount;
+			p->nBreak = 1;
+		}
+		if (pDrc->Ctx.pGlobalRegs[0] != nPC || *pDrc->Ctx.pEndRun) {
+			p->nBreak = 1;
+		}
+	}
+};
+
+static UINT32 DrcRead8(UINT32 a)			{ DrcCall c; return E132XSDrcReadByte(a); }
+static UINT32 DrcRead16(UINT32 a)			{ DrcCall c; return E132XSDrcReadWord(a); }
+static UINT32 DrcRead32(UINT32 a)			{ DrcCall c; return E132XSDrcReadLong(a); }
+static void DrcWrite8(UINT32 a, UINT32 d)	{ DrcCall c; E132XSDrcWriteByte(a, d); }
+static void DrcWrite16(UINT32 a, UINT32 d)	{ DrcCall c; E132XSDrcWriteWord(a, d); }
+static void DrcWrite32(UINT32 a, UINT32 d)	{ DrcCall c; E132XSDrcWriteLong(a, d); }
+static UINT32 DrcIORead(UINT32 a)			{ DrcCall c; return E132XSDrcIORead(a); }
+static void DrcIOWrite(UINT32 a, UINT32 d)	{ DrcCall c; E132XSDrcIOWrite(a, d); }
+
+static UINT32 DrcCheckInterrupts()
+{
+	DrcCall c;
+	return E132XSDrcCheckInterrupts();
+}
+
+static void DrcStep()
+{
+	if (E132XSDrcStep()) pDrc->pHot->nBreak = 1;
+}
+
+// called from the entry check of a block whose code changed
+static void DrcStale(DrcBlock* b)
+{
+	pDrc->Invalidate(b);
+}
+
+E132XSDrc::E132XSDrc(E132XSDrcContext* pContext) : CodeGenerator(DRC_CODE_SIZE)
+{
+	Ctx = *pContext;
+	m_bFlushPending = true;
+	memset(m_nClock, 0, sizeof(m_nClock));
+	m_plExit = NULL;
+	m_plExitSync = NULL;
+	m_plDispatch = NULL;
+
+	m_nLocalOfs = Ofs(Ctx.pLocalRegs);
+	INT64 nWrite = (UINT8*)Ctx.pWrite - (UINT8*)Ctx.pRead;
+	if (nWrite != (INT32)nWrite) throw Xbyak::Error(Xbyak::ERR_OFFSET_IS_TOO_BIG);
+	m_nWriteOfs = (INT32)nWrite;
+
+	pHot = new DrcHot;
+	memset(pHot->Code, 0, sizeof(pHot->Code));
+	pHot->nBreak = 0;
+	pHot->nHit = 0;
+	pHot->nDelta = 0;
+	bRunning = false;
+	bVerifyPending = false;
+
+	Flush();
+}
+
+E132XSDrc::~E132XSDrc()
+{
+	m_bFlushPending = true;
+	Flush();
+
+	delete m_plExit;
+	delete m_plExitSync;
+	delete m_plDispatch;
+	delete pHot;
+}
+
+// the context's statics are addressed from m_global_regs[]
+INT32 E132XSDrc::Ofs(const void* p)
+{
+	INT64 n = (const UINT8*)p - (const UINT8*)Ctx.pGlobalRegs;
+	if (n != (INT32)n) throw Xbyak::Error(Xbyak::ERR_OFFSET_IS_TOO_BIG);
+
+	return (INT32)n;
+}
+
+// ----------------------------------------------------------------------------
+// Block bookkeeping
+
+void E132XSDrc::Forget(DrcBlock* b)
+{
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.find(b->nPC); i != m_Blocks.end() && i->first == b->nPC; ++i) {
+		if (i->second == b) {
+			m_Blocks.erase(i);
+			break;
+		}
+	}
+
+	std::vector<DrcBlock*>& v = m_Pages[b->nPage];
+	for (UINT32 i = 0; i < v.size(); i++) {
+		if (v[i] == b) {
+			v.erase(v.begin() + i);
+			break;
+		}
+	}
+
+	for (uintptr_t k = (uintptr_t)b->pHost >> DRC_PAGE_SHIFT; k <= ((uintptr_t)b->pHost + b->nLen - 1) >> DRC_PAGE_SHIFT; k++) {
+		std::unordered_map<uintptr_t, std::vector<DrcBlock*> >::iterator c = m_Chunks.find(k);
+		if (c == m_Chunks.end()) continue;
+
+		for (UINT32 i = 0; i < c->second.size(); i++) {
+			if (c->second[i] == b) {
+				c->second.erase(c->second.begin() + i);
+				break;
+			}
+		}
+		if (c->second.empty()) m_Chunks.erase(c);
+	}
+
+	DrcCacheEntry& e = pHot->Cache[DrcCacheIndex(b->nPC, b->nKey)];
+	if (e.pBlock == b) {
+		e.nPC = ~0;
+		e.pFetch = (UINT8*)~(uintptr_t)0;
+		e.pBlock = NULL;
+	}
+}
+
+// The block's code is stale - it stays in the code buffer (it may be running) until the next flush
+void E132XSDrc::Invalidate(DrcBlock* b)
+{
+	if (b->bDead) return;
+
+	b->bDead = true;
+	Forget(b);
+	m_Dead.push_back(b);
+
+	pHot->nBreak = 1;
+}
+
+void E132XSDrc::Flush()
+{
+	if (bRunning || !m_bFlushPending) return;
+
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.begin(); i != m_Blocks.end(); ++i) {
+		m_Dead.push_back(i->second);
+	}
+	for (UINT32 i = 0; i < m_Dead.size(); i++) {
+		free(m_Dead[i]->pSource);
+		delete m_Dead[i];
+	}
+	m_Dead.clear();
+	m_Blocks.clear();
+	m_Pages.clear();
+	m_Chunks.clear();
+
+	for (INT32 i = 0; i < DRC_CACHE_SIZE; i++) {
+		pHot->Cache[i].nPC = ~0;
+		pHot->Cache[i].nKey = ~0;
+		pHot->Cache[i].pFetch = (UINT8*)~(uintptr_t)0;
+		pHot->Cache[i].pCode = NULL;
+		pHot->Cache[i].pBlock = NULL;
+	}
+	memset(pHot->Code, 0, sizeof(pHot->Code));
+
+	// not reset(): that restarts the label ids, and jumps to labels dropped by a failed
+	// translation are still waiting in xbyak's lists - a new label with their id would patch them
+	m_Stubs.clear();
+	m_Nodes.clear();
+	delete m_plExit;
+	delete m_plExitSync;
+	delete m_plDispatch;
+	setSize(0);
+	m_plExit = new Xbyak::Label;
+	m_plExitSync = new Xbyak::Label;
+	m_plDispatch = new Xbyak::Label;
+	EmitCommon();
+
+	m_bFlushPending = false;
+}
+
+// a write to this page may hit code: its write side is host memory some block was translated from
+bool E132XSDrc::PageHasCode(INT32 nPage)
+{
+	UINT8* p = Ctx.pWrite[nPage];
+	if (p == NULL) return false;
+
+	for (uintptr_t k = (uintptr_t)p >> DRC_PAGE_SHIFT; k <= ((uintptr_t)p + DRC_PAGE_SIZE - 1) >> DRC_PAGE_SHIFT; k++) {
+		if (m_Chunks.count(k)) return true;
+	}
+
+	return false;
+}
+
+void E132XSDrc::ComputeCode(INT32 nFirst, INT32 nLast)
+{
+	if (m_Chunks.empty()) {
+		memset(pHot->Code + nFirst, 0, nLast - nFirst + 1);
+		return;
+	}
+
+	for (INT32 i = nFirst; i <= nLast; i++) {
+		pHot->Code[i] = PageHasCode(i);
+	}
+}
+
+// a chunk of host memory got its first block - flag the pages that can write to it
+void E132XSDrc::CodeAdded(uintptr_t nChunk)
+{
+	for (UINT32 i = 0; i < DRC_PAGE_COUNT; i++) {
+		uintptr_t p = (uintptr_t)Ctx.pWrite[i];
+		if (p == 0 || pHot->Code[i]) continue;
+
+		if ((p >> DRC_PAGE_SHIFT) <= nChunk && ((p + DRC_PAGE_SIZE - 1) >> DRC_PAGE_SHIFT) >= nChunk) {
+			pHot->Code[i] = 1;
+		}
+	}
+}
+
+// something wrote p[0 .. nLen - 1]
+void E132XSDrc::CheckHost(UINT8* p, INT32 nLen)
+{
+	for (uintptr_t k = (uintptr_t)p >> DRC_PAGE_SHIFT; k <= ((uintptr_t)p + nLen - 1) >> DRC_PAGE_SHIFT; k++) {
+		std::unordered_map<uintptr_t, std::vector<DrcBlock*> >::iterator c = m_Chunks.find(k);
+		if (c == m_Chunks.end()) continue;
+
+		std::vector<DrcBlock*> v = c->second;
+		for (UINT32 i = 0; i < v.size(); i++) {
+			DrcBlock* b = v[i];
+			if (b->pHost < p + nLen && p < b->pHost + b->nLen && memcmp(b->pHost, b->pSource, b->nLen)) {
+				Invalidate(b);
+			}
+		}
+	}
+}
+
+void E132XSDrc::MapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	INT32 nFirst = nStart >> DRC_PAGE_SHIFT;
+	INT32 nLast = nEnd >> DRC_PAGE_SHIFT;
+
+	ComputeCode(nFirst, nLast);
+
+	// blocks in the range that match the new mapping must still match its memory
+	for (std::unordered_map<UINT32, std::vector<DrcBlock*> >::iterator i = m_Pages.begin(); i != m_Pages.end(); ++i) {
+		if ((INT32)i->first < nFirst || (INT32)i->first > nLast) continue;
+
+		std::vector<DrcBlock*> v = i->second;
+		for (UINT32 j = 0; j < v.size(); j++) {
+			DrcBlock* b = v[j];
+			if (b->pFetch == Ctx.pRead[b->nPage] && memcmp(b->pHost, b->pSource, b->nLen)) {
+				Invalidate(b);
+			}
+		}
+	}
+
+	pHot->nBreak = 1;
+}
+
+void E132XSDrc::Verify()
+{
+	bVerifyPending = false;
+
+	std::vector<DrcBlock*> v;
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.begin(); i != m_Blocks.end(); ++i) {
+		DrcBlock* b = i->second;
+		if (b->pFetch == Ctx.pRead[b->nPage] && memcmp(b->pHost, b->pSource, b->nLen)) {
+			v.push_back(b);
+		}
+	}
+	for (UINT32 i = 0; i < v.size(); i++) {
+		Invalidate(v[i]);
+	}
+}
+
+// ----------------------------------------------------------------------------
+// Execution
+
+// entry trampoline, exits and the block to block dispatcher
+void E132XSDrc::EmitCommon()
+{
+	m_pEntry = getCurr<void (*)(void*, DrcHot*)>();
+
+	push(rbx);
+	push(rbp);
+	push(r12);
+	push(r13);
+	push(r14);
+	push(r15);
+#ifdef _WIN32
+	push(rsi);
+	push(rdi);
+#endif
+	sub(rsp, 56);								// shadow space and operand slots, keeps rsp 16 byte aligned
+
+	mov(rbx, (size_t)Ctx.pGlobalRegs);
+	mov(r12, (size_t)Ctx.pRead);
+	mov(r13d, Var(Ctx.pIntBlock));
+	mov(r14d, Var(Ctx.pStop));
+	mov(r15d, Var(Ctx.pICount));
+#ifdef _WIN32
+	mov(rbp, rdx);
+	jmp(rcx);
+#else
+	mov(rbp, rsi);
+	jmp(rdi);
+#endif
+
+	// left between instructions: nothing of the last one is still to be charged to the timer
+	L(*m_plExitSync);
+	mov(Var(Ctx.pLast), r15d);
+
+	L(*m_plExit);
+	mov(Var(Ctx.pICount), r15d);
+	mov(Var(Ctx.pIntBlock), r13d);
+	add(rsp, 56);
+#ifdef _WIN32
+	pop(rdi);
+	pop(rsi);
+#endif
+	pop(r15);
+	pop(r14);
+	pop(r13);
+	pop(r12);
+	pop(rbp);
+	pop(rbx);
+	ret();
+
+	// PC is set and there are cycles left: find the next block in the cache or leave
+	align(16);
+	L(*m_plDispatch);
+	mov(eax, REG_PC);
+	mov(edx, REG_SR);
+	shr(edx, 25);
+	mov(ecx, eax);
+	shr(ecx, 1);
+	mov(r8d, edx);
+	shl(r8d, 5);
+	xor_(ecx, r8d);
+	and_(ecx, DRC_CACHE_SIZE - 1);
+	shl(ecx, 5);								// sizeof(DrcCacheEntry)
+	lea(r9, ptr[rbp + rcx + HOT_CACHE]);
+	cmp(dword[r9 + offsetof(DrcCacheEntry, nPC)], eax);
+	jne(*m_plExitSync, T_NEAR);
+	cmp(dword[r9 + offsetof(DrcCacheEntry, nKey)], edx);
+	jne(*m_plExitSync, T_NEAR);
+	shr(eax, DRC_PAGE_SHIFT);
+	mov(r8, qword[r12 + rax * 8]);
+	cmp(qword[r9 + offsetof(DrcCacheEntry, pFetch)], r8);
+	jne(*m_plExitSync, T_NEAR);
+	jmp(qword[r9 + offsetof(DrcCacheEntry, pCode)]);
+}
+
+void* E132XSDrc::Find(UINT32 nPC)
+{
+	UINT32 nKey = Ctx.pGlobalRegs[1] >> 25;
+
+	if ((nPC & 1) || m_bFlushPending || m_nClock[1] == 0) return NULL;
+
+	UINT8* pFetch = Ctx.pRead[nPC >> DRC_PAGE_SHIFT];
+	if (pFetch == NULL) return NULL;
+
+	DrcCacheEntry& e = pHot->Cache[DrcCacheIndex(nPC, nKey)];
+	DrcBlock* b = NULL;
+	if (e.nPC == nPC && e.nKey == nKey && e.pFetch == pFetch) {
+		b = e.pBlock;
+	} else {
+		for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.find(nPC); i != m_Blocks.end() && i->first == nPC; ++i) {
+			if (i->second->pFetch == pFetch && i->second->nKey == nKey) {
+				b = i->second;
+				break;
+			}
+		}
+	}
+
+	// the entry check would leave without running anything, E132XSRun() would go round again
+	if (b && b->bCheck && memcmp(b->pHost, b->pSource, b->nLen)) {
+		Invalidate(b);
+		b = NULL;
+	}
+
+	if (b == NULL) {
+		if (getSize() + DRC_CODE_SLACK > DRC_CODE_SIZE) {
+			m_bFlushPending = true;
+			Flush();
+		}
+
+		b = Compile(nPC, nKey, pFetch);
+		if (b == NULL) return NULL;
+	}
+
+	e.nPC = nPC;
+	e.nKey = nKey;
+	e.pFetch = pFetch;
+	e.pCode = b->pCode;
+	e.pBlock = b;
+
+	return b->pCode;
+}
+
+INT32 E132XSDrc::Run()
+{
+	// the cycle counts are translated into the code
+	for (INT32 i = 0; i < 5; i++) {
+		if (m_nClock[i] != *Ctx.pClock[i]) {
+			m_nClock[i] = *Ctx.pClock[i];
+			m_bFlushPending = true;
+		}
+	}
+
+	Flush();
+	if (bVerifyPending) Verify();
+
+	void* pCode = Find(Ctx.pGlobalRegs[0]);
+	if (pCode == NULL) return 0;
+
+	bRunning = true;
+	pHot->nBreak = 0;
+	pHot->nHit = 1;
+	pHot->nDelta = 0;
+	m_pEntry(pCode, pHot);
+	bRunning = false;
+
+	return 1;
+}
+
+// ----------------------------------------------------------------------------
+// Decoding
+
+// the next word of an instruction, if it's on the block's page
+bool E132XSDrc::Fetch(UINT32& a, UINT16& w)
+{
+	if ((a >> DRC_PAGE_SHIFT) != (m_nPC >> DRC_PAGE_SHIFT)) return false;
+
+	w = *(UINT16*)(m_pPage + (a & (DRC_PAGEM & ~1)));
+	a += 2;
+
+	return true;
+}
+
+// what the decode macros in e132xs.cpp pick out of the instruction
+bool E132XSDrc::Decode(UINT32 nPC, DrcInsn& d)
+{
+	static const UINT32 nImmediate[16] = { 16, 0, 0, 0, 32, 64, 128, 0x80000000, (UINT32)-8, (UINT32)-7, (UINT32)-6, (UINT32)-5, (UINT32)-4, (UINT32)-3, (UINT32)-2, (UINT32)-1 };
+
+	UINT32 a = nPC;
+	UINT16 w1, w2;
+
+	if (!Fetch(a, d.nOp)) return false;
+
+	INT32 o = d.nOp >> 8;
+
+	d.nPC = nPC;
+	d.nLen = 1;
+	d.nSub = 0;
+	d.nExtra = 0;
+	d.nS = d.nOp & 15;
+	d.nD = (d.nOp >> 4) & 15;
+	d.bS = (d.nOp & 0x100) != 0;
+	d.bD = (d.nOp & 0x200) != 0;
+
+	if ((o >= 0x10 && o <= 0x13) || (o >= 0x90 && o <= 0x9f)) {
+		// lim, dis
+		if (!Fetch(a, w1)) return false;
+		d.nLen = 2;
+
+		if (o < 0x90) {
+			d.nSub = X_CODE(w1);
+			d.nExtra = w1 & 0xfff;
+			if (E_BIT(w1)) {
+				if (!Fetch(a, w2)) return false;
+				d.nLen = 3;
+				d.nExtra = (d.nExtra << 16) | w2;
+			}
+		} else {
+			d.nSub = DD(w1);
+			if (E_BIT(w1)) {
+				if (!Fetch(a, w2)) return false;
+				d.nLen = 3;
+				d.nExtra = w2 | ((w1 & 0xfff) << 16);
+				if (S_BIT_CONST(w1)) d.nExtra |= 0xf0000000;
+			} else {
+				d.nExtra = w1 & 0xfff;
+				if (S_BIT_CONST(w1)) d.nExtra |= 0xfffff000;
+			}
+		}
+	} else if ((o >= 0x14 && o <= 0x1f) || o == 0xee || o == 0xef) {
+		// const
+		if (!Fetch(a, w1)) return false;
+		d.nLen = 2;
+
+		if (E_BIT(w1)) {
+			if (!Fetch(a, w2)) return false;
+			d.nLen = 3;
+			d.nExtra = w2 | ((w1 & 0x3fff) << 16);
+			if (S_BIT_CONST(w1)) d.nExtra |= 0xc0000000;
+		} else {
+			d.nExtra = w1 & 0x3fff;
+			if (S_BIT_CONST(w1)) d.nExtra |= 0xffffc000;
+		}
+	} else if (o >= 0x60 && o <= 0x7f) {
+		// immediate, N bit in the source local bit's place
+		if (!d.bS) {
+			d.nExtra = d.nOp & 15;
+		} else {
+			switch (d.nOp & 15) {
+				case 1:
+					if (!Fetch(a, w1) || !Fetch(a, w2)) return false;
+					d.nLen = 3;
+					d.nExtra = (w1 << 16) | w2;
+					break;
+
+				case 2:
+					if (!Fetch(a, w1)) return false;
+					d.nLen = 2;
+					d.nExtra = w1;
+					break;
+
+				case 3:
+					if (!Fetch(a, w1)) return false;
+					d.nLen = 2;
+					d.nExtra = 0xffff0000 | w1;
+					break;
+
+				default:
+					d.nExtra = nImmediate[d.nOp & 15];
+					break;
+			}
+		}
+	} else if (o == 0xce) {
+		if (!Fetch(a, w1)) return false;
+		d.nLen = 2;
+		d.nExtra = w1;
+	} else if ((o >= 0xe0 && o <= 0xec) || (o >= 0xf0 && o <= 0xfc)) {
+		// pcrel
+		if (d.nOp & 0x80) {
+			if (!Fetch(a, w1)) return false;
+			d.nLen = 2;
+			d.nExtra = ((d.nOp & 0x7f) << 16) | (w1 & 0xfffe);
+			if (w1 & 1) d.nExtra |= 0xff800000;
+		} else {
+			d.nExtra = d.nOp & 0x7e;
+			if (d.nOp & 1) d.nExtra |= 0xffffff80;
+		}
+	}
+
+	// LL / LR forms: the destination is local
+	if ((o >= 0x80 && o <= 0x8f) || (o >= 0xc0 && o <= 0xcf) || o == 0xed) {
+		d.bS = d.bD = true;
+	} else if ((o >= 0xd0 && o <= 0xdf) || o == 0xee || o == 0xef) {
+		d.bS = (o & 1) != 0;
+		d.bD = true;
+	}
+
+	d.bSame = d.bS == d.bD && d.nS == d.nD;
+	if (d.bS && d.bD) {
+		d.bSameF = ((d.nS + 1) & 63) == d.nD;
+	} else {
+		d.bSameF = !d.bS && !d.bD && d.nS + 1 == d.nD;
+	}
+
+	d.nNext = a;
+
+	return true;
+}
+
+static bool DrcEndsBlock(const DrcInsn& d)
+{
+	INT32 o = d.nOp >> 8;
+
+	if (o == 0xfc || o == 0xee || o == 0xef) return true;						// br, call
+
+	// mov / movi / movd (ret) to the pc
+	if ((o & 0xfc) == 0x24 || (o & 0xfc) == 0x64 || (o & 0xfc) == 0x04) {
+		return !d.bD && d.nD == 0;
+	}
+
+	return false;
+}
+
+// the block's instructions: up to a jump or the end of the page, a dbr takes its delay slot along
+void E132XSDrc::Scan(UINT32 nPC)
+{
+	m_Nodes.clear();
+
+	UINT32 a = nPC;
+	bool bSlot = false;
+
+	while (m_Nodes.size() < DRC_MAX_INSNS) {
+		m_Nodes.emplace_back();
+		DrcNode& n = m_Nodes.back();
+
+		if (!Decode(a, n.i)) {
+			m_Nodes.pop_back();
+			break;
+		}
+
+		n.bTarget = n.bHead = n.bSpin = false;
+		n.nCycles = 0;
+		n.nReadL = n.nWriteL = 0;
+		n.nReadG = n.nWriteG = 0;
+		a = n.i.nNext;
+
+		if (bSlot || DrcEndsBlock(n.i)) break;
+		if ((n.i.nOp >> 8) == 0xec) bSlot = true;
+	}
+
+	for (UINT32 i = 0; i < m_Nodes.size(); i++) {
+		INT32 o = m_Nodes[i].i.nOp >> 8;
+		if (!((o >= 0xe0 && o <= 0xec) || (o >= 0xf0 && o <= 0xfc))) continue;
+
+		UINT32 nTarget = m_Nodes[i].i.nNext + m_Nodes[i].i.nExtra;
+		for (UINT32 j = 0; j < m_Nodes.size(); j++) {
+			if (m_Nodes[j].i.nPC == nTarget) {
+				m_Nodes[j].bTarget = true;
+				if (o >= 0xf0 && j <= i) m_Nodes[j].bHead = true;
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+// Code emitters
+
+void E132XSDrc::UseReg(bool bLocal, INT32 n, bool bWrite)
+{
+	if (bLocal) {
+		UINT64 m = 1ULL << ((n + m_nFP) & 63);
+		if (bWrite) m_pNode->nWriteL |= m; else m_pNode->nReadL |= m;
+	} else {
+		if (bWrite) m_pNode->nWriteG |= 1 << n; else m_pNode->nReadG |= 1 << n;
+	}
+}
+
+void E132XSDrc::UseFlags(UINT32 nFlags, bool bWrite)
+{
+	if (bWrite) m_pNode->nWriteG |= FLAG_BITS(nFlags); else m_pNode->nReadG |= FLAG_BITS(nFlags);
+}
+
+// a register as the decode macros read it: PC is the address after the instruction (or the
+// delayed branch's target), callers deal with SR
+void E132XSDrc::Load(const Xbyak::Reg32& r, bool bLocal, INT32 n)
+{
+	if (!bLocal && n == 0) {
+		mov(r, m_nNextPC);
+		return;
+	}
+
+	UseReg(bLocal, n, false);
+	mov(r, bLocal ? Local(n) : Global(n));
+}
+
+// ... and the one after it (no G16 for G15, callers deal with SR as the one after PC)
+void E132XSDrc::LoadF(const Xbyak::Reg32& r, bool bLocal, INT32 n)
+{
+	if (!bLocal && n == 15) {
+		xor_(r, r);
+		return;
+	}
+
+	UseReg(bLocal, n + 1, false);
+	mov(r, bLocal ? Local(n + 1) : Global(n + 1));
+}
+
+// plain registers only, callers deal with PC and SR
+void E132XSDrc::Store(const Xbyak::Reg32& r, bool bLocal, INT32 n)
+{
+	UseReg(bLocal, n, true);
+	mov(bLocal ? Local(n) : Global(n), r);
+}
+
+void E132XSDrc::StoreF(const Xbyak::Reg32& r, bool bLocal, INT32 n)
+{
+	UseReg(bLocal, n + 1, true);
+	mov(bLocal ? Local(n + 1) : Global(n + 1), r);
+}
+
+// the source of add / sub / sum / neg / cmp, where SR reads as its C bit
+void E132XSDrc::LoadSC(const Xbyak::Reg32& r)
+{
+	const DrcInsn& d = m_pNode->i;
+
+	if (!d.bS && d.nS == 1) {
+		UseFlags(SR_C, false);
+		mov(r, REG_SR);
+		and_(r, SR_C);
+		return;
+	}
+
+	Load(r, d.bS, d.nS);
+}
+
+// the ILC field, once per instruction that doesn't fold it into its own SR update
+void E132XSDrc::Ilc()
+{
+	if (m_nIlc == m_nLen) return;
+
+	and_(REG_SR, ~SR_ILC);
+	or_(REG_SR, m_nLen << 19);
+	m_nIlc = m_nLen;
+}
+
+void E132XSDrc::UpdateSR(UINT32 nClear, UINT32 nSet, bool bEcx)
+{
+	if (m_nIlc != m_nLen) {
+		nClear |= SR_ILC;
+		nSet |= m_nLen << 19;
+		m_nIlc = m_nLen;
+	}
+
+	mov(edx, REG_SR);
+	and_(edx, ~nClear);
+	if (bEcx) or_(edx, ecx);
+	if (nSet) or_(edx, nSet);
+	mov(REG_SR, edx);
+}
+
+// flags from the last x86 op (N from less than for compares, V from r11b if asked), eax survives
+void E132XSDrc::SetFlags(UINT32 nFlags, bool bLess, UINT32 nClear, bool bVr11)
+{
+	if (nFlags & SR_C) setc(cl);
+	if (nFlags & SR_Z) setz(dl);
+	if (nFlags & SR_N) {
+		if (bLess) setl(r8b); else sets(r8b);
+	}
+	if ((nFlags & SR_V) && !bVr11) seto(r9b);
+
+	if (nFlags & SR_C) movzx(ecx, cl); else xor_(ecx, ecx);
+	if (nFlags & SR_Z) {
+		movzx(edx, dl);
+		lea(ecx, ptr[rcx + rdx * 2]);
+	}
+	if (nFlags & SR_N) {
+		movzx(r8d, r8b);
+		lea(ecx, ptr[rcx + r8 * 4]);
+	}
+	if (nFlags & SR_V) {
+		if (bVr11) movzx(r9d, r11b); else movzx(r9d, r9b);
+		lea(ecx, ptr[rcx + r9 * 8]);
+	}
+
+	UseFlags(nFlags | (nClear & (SR_C | SR_Z | SR_N | SR_V)), true);
+	UpdateSR(nFlags | nClear, 0, true);
+}
+
+// jump to lSkip when the condition fails: even conditions need one of the bits, odd ones none
+void E132XSDrc::EmitCond(INT32 nCond, Xbyak::Label& lSkip)
+{
+	static const UINT32 nMask[6] = { SR_V, SR_Z, SR_C, SR_C | SR_Z, SR_N, SR_N | SR_Z };
+
+	UseFlags(nMask[nCond >> 1], false);
+	test(REG_SR, nMask[nCond >> 1]);
+	if (nCond & 1) jnz(lSkip, T_NEAR); else jz(lSkip, T_NEAR);
+}
+
+DrcStub& E132XSDrc::NewStub(INT32 nType, INT32 nSize)
+{
+	m_Stubs.emplace_back();
+	DrcStub& s = m_Stubs.back();
+
+	s.nType = nType;
+	s.nSize = nSize;
+	s.nPC = m_nNextPC;
+	s.nPPC = m_nInsnPC;
+	s.nOp = m_nOp;
+	s.nLen = m_nLen;
+	s.nCycles = 0;
+	s.nDelayPC = DRC_KEEP_PC;
+
+	return s;
+}
+
+void E132XSDrc::EmitStubs()
+{
+	static const void* pRead[3]  = { (void*)DrcRead8,  (void*)DrcRead16,  (void*)DrcRead32  };
+	static const void* pWrite[3] = { (void*)DrcWrite8, (void*)DrcWrite16, (void*)DrcWrite32 };
+
+	for (std::deque<DrcStub>::iterator i = m_Stubs.begin(); i != m_Stubs.end(); ++i) {
+		DrcStub& s = *i;
+
+		L(s.lFrom);
+
+		if (s.nType == STUB_EXIT || s.nType == STUB_CHECKINT) {
+			// the interpreter's view after the instruction
+			if (s.nPC != DRC_KEEP_PC) mov(REG_PC, s.nPC);
+			mov(Var(Ctx.pPPC), s.nPPC);
+			mov(word[rbx + Ofs(Ctx.pOp)], s.nOp);
+			mov(Var(Ctx.pInstructionLength), s.nLen);
+			if (s.nDelayPC != DRC_KEEP_PC) {
+				mov(Var(Ctx.pDelayCmd), DELAY_EXECUTE);
+				mov(Var(Ctx.pDelayPC), s.nDelayPC);
+			}
+
+			if (s.nType == STUB_CHECKINT) {
+				mov(Var(Ctx.pICount), r15d);
+				mov(Var(Ctx.pIntBlock), r13d);
+				mov(rax, (size_t)DrcCheckInterrupts);
+				call(rax);
+				mov(r15d, Var(Ctx.pICount));
+				mov(r13d, Var(Ctx.pIntBlock));
+				test(eax, eax);
+				jz(s.lBack, T_NEAR);
+			}
+
+			// the timer gets the last instruction on its own
+			lea(eax, ptr[r15 + s.nCycles]);
+			add(eax, dword[rbp + HOT_DELTA]);
+			mov(Var(Ctx.pLast), eax);
+			jmp(*m_plExit, T_NEAR);
+			continue;
+		}
+
+		// handlers see PC as the interpreter has it, after the instruction's words
+		if (s.nPC != DRC_KEEP_PC) mov(REG_PC, s.nPC);
+		mov(Var(Ctx.pICount), r15d);
+		mov(Var(Ctx.pIntBlock), r13d);
+
+		const void* pFunc;
+		switch (s.nType) {
+			case STUB_READ:		pFunc = pRead[(s.nSize == 4) ? 2 : (s.nSize - 1)];	break;
+			case STUB_WRITE:	pFunc = pWrite[(s.nSize == 4) ? 2 : (s.nSize - 1)];	break;
+			case STUB_IOREAD:	pFunc = (void*)DrcIORead;							break;
+			default:			pFunc = (void*)DrcIOWrite;							break;
+		}
+
+		if (s.nType == STUB_WRITE || s.nType == STUB_IOWRITE) {
+#ifdef _WIN32
+			mov(edx, eax);
+#else
+			mov(esi, eax);
+			mov(edi, ecx);
+#endif
+		} else {
+#ifndef _WIN32
+			mov(edi, ecx);
+#endif
+		}
+		mov(rax, (size_t)pFunc);
+		call(rax);
+		mov(r15d, Var(Ctx.pICount));
+		mov(r13d, Var(Ctx.pIntBlock));
+		jmp(s.lBack, T_NEAR);
+	}
+
+	m_Stubs.clear();
+}
+
+// ecx = address as the interpreter hands it to the handler -> eax, zero extended
+void E132XSDrc::MemRead(INT32 nSize)
+{
+	m_bCall = true;
+	DrcStub& s = NewStub(STUB_READ, nSize);
+
+	mov(edx, ecx);
+	shr(edx, DRC_PAGE_SHIFT);
+	mov(r8, qword[r12 + rdx * 8]);
+	test(r8, r8);
+	jz(s.lFrom, T_NEAR);
+
+	switch (nSize) {
+		case 1:
+			and_(ecx, DRC_PAGEM);
+			xor_(ecx, 1);
+			movzx(eax, byte[r8 + rcx]);
+			break;
+
+		case 2:
+			and_(ecx, DRC_PAGEM & ~1);
+			movzx(eax, word[r8 + rcx]);
+			break;
+
+		case 4:
+			and_(ecx, DRC_PAGEM & ~1);
+			mov(eax, dword[r8 + rcx]);
+			rol(eax, 16);
+			break;
+	}
+
+	L(s.lBack);
+}
+
+// ecx = address as the interpreter hands it to the handler, eax = data
+void E132XSDrc::MemWrite(INT32 nSize)
+{
+	m_bCall = true;
+	m_pNode->bSpin = false;
+	DrcStub& s = NewStub(STUB_WRITE, nSize);
+
+	mov(edx, ecx);
+	shr(edx, DRC_PAGE_SHIFT);
+	cmp(byte[rbp + rdx], 0);					// DrcHot::Code[]
+	jne(s.lFrom, T_NEAR);
+	mov(r8, qword[r12 + rdx * 8 + m_nWriteOfs]);
+	test(r8, r8);
+	jz(s.lFrom, T_NEAR);
+
+	switch (nSize) {
+		case 1:
+			and_(ecx, DRC_PAGEM);
+			xor_(ecx, 1);
+			mov(byte[r8 + rcx], al);
+			break;
+
+		case 2:
+			and_(ecx, DRC_PAGEM & ~1);
+			mov(word[r8 + rcx], ax);
+			break;
+
+		case 4:
+			and_(ecx, DRC_PAGEM & ~1);
+			mov(edx, eax);
+			rol(edx, 16);
+			mov(dword[r8 + rcx], edx);
+			break;
+	}
+
+	L(s.lBack);
+}
+
+// ecx = address as IO_READ_W() takes it -> eax, always a handler
+void E132XSDrc::IORead()
+{
+	m_bCall = true;
+	DrcStub& s = NewStub(STUB_IOREAD, 4);
+
+	jmp(s.lFrom, T_NEAR);
+	L(s.lBack);
+}
+
+void E132XSDrc::IOWrite()
+{
+	m_bCall = true;
+	m_pNode->bSpin = false;
+	DrcStub& s = NewStub(STUB_IOWRITE, 4);
+
+	jmp(s.lFrom, T_NEAR);
+	L(s.lBack);
+}
+
+// entry of a block from a writable page: run the body if its code is still what was
+// translated, else drop the block and leave between instructions, Run() translates the new code
+void E132XSDrc::EmitCheck(DrcBlock* b, const void* pBody)
+{
+	Xbyak::Label lStale;
+
+	mov(rdx, (size_t)b->pHost);
+	for (INT32 i = 0; i < b->nLen; ) {
+		if (b->nLen - i >= 8) {
+			UINT64 d;
+			memcpy(&d, b->pSource + i, 8);
+			mov(rax, d);
+			cmp(qword[rdx + i], rax);
+			i += 8;
+		} else if (b->nLen - i >= 4) {
+			INT32 d;
+			memcpy(&d, b->pSource + i, 4);
+			cmp(dword[rdx + i], d);
+			i += 4;
+		} else {
+			INT16 d;
+			memcpy(&d, b->pSource + i, 2);
+			cmp(word[rdx + i], d);
+			i += 2;
+		}
+		jne(lStale, T_NEAR);
+	}
+	jmp(pBody, T_NEAR);
+
+	L(lStale);
+#ifdef _WIN32
+	mov(rcx, (size_t)b);
+#else
+	mov(rdi, (size_t)b);
+#endif
+	mov(rax, (size_t)DrcStale);
+	call(rax);
+	jmp(*m_plExitSync, T_NEAR);
+}
+
+// charge the instruction, count m_intblock down (or set it) and leave the block when the
+// run is done or a handler asked to
+void E132XSDrc::EndInsnAt(INT32 nCycles, UINT32 nPC, UINT32 nPPC, INT32 nIntBlock, UINT32 nDelayPC)
+{
+	Ilc();
+	m_pNode->nCycles = nCycles;
+
+	DrcStub& x = NewStub(STUB_EXIT, 0);
+	x.nPC = nPC;
+	x.nPPC = nPPC;
+	x.nCycles = nCycles;
+	x.nDelayPC = nDelayPC;
+
+	if (nCycles) sub(r15d, nCycles);
+
+	if (nIntBlock < 0) {
+		DrcStub& c = NewStub(STUB_CHECKINT, 0);
+		c.nPC = nPC;
+		c.nPPC = nPPC;
+		c.nCycles = nCycles;
+
+		dec(r13d);
+		jz(c.lFrom, T_NEAR);
+		L(c.lBack);
+	} else {
+		mov(r13d, nIntBlock);
+	}
+
+	if (nCycles) {
+		cmp(r15d, r14d);
+		jle(x.lFrom, T_NEAR);
+	}
+	if (m_bCall) {
+		cmp(dword[rbp + HOT_BREAK], 0);
+		jne(x.lFrom, T_NEAR);
+	}
+}
+
+// continue at a known pc: inside this block if a branch there was seen while scanning, else
+// through the dispatcher
+void E132XSDrc::JumpTo(UINT32 nTarget, UINT32 nPPC)
+{
+	for (UINT32 i = 0; i < m_Nodes.size(); i++) {
+		if (m_Nodes[i].i.nPC == nTarget && m_Nodes[i].bTarget) {
+			jmp(m_Nodes[i].l, T_NEAR);
+			return;
+		}
+	}
+
+	JumpOut(nTarget, nPPC);
+}
+
+void E132XSDrc::JumpOut(UINT32 nTarget, UINT32 nPPC)
+{
+	if (nTarget != DRC_KEEP_PC) mov(REG_PC, nTarget);
+	mov(Var(Ctx.pPPC), nPPC);
+	mov(word[rbx + Ofs(Ctx.pOp)], m_nOp);
+	mov(Var(Ctx.pInstructionLength), m_nLen);
+	jmp(*m_plDispatch, T_NEAR);
+}
+
+// A backward branch closing a loop that can only go round the same way until something
+// outside the cpu changes: no other way into it, nothing but translated instructions that
+// don't store, and no register or flag read before the loop wrote it.
+bool E132XSDrc::SpinLoop(INT32 nHead, INT32 nBranch, INT32& nCycles, INT32& nInsns)
+{
+	if (!m_Nodes[nHead].bHead) return false;
+
+	UINT64 nWriteL = 0;
+	UINT32 nWriteG = 0;
+	for (INT32 i = nHead; i <= nBranch; i++) {
+		if (i > nHead && m_Nodes[i].bTarget) return false;
+		nWriteL |= m_Nodes[i].nWriteL;
+		nWriteG |= m_Nodes[i].nWriteG;
+	}
+
+	UINT64 nDoneL = 0;
+	UINT32 nDoneG = 0;
+	nCycles = 0;
+
+	for (INT32 i = nHead; i <= nBranch; i++) {
+		DrcNode& n = m_Nodes[i];
+
+		if (i < nBranch) {
+			if (!n.bSpin) return false;
+
+			// leaving the loop is fine, going round it another way isn't
+			INT32 o = n.i.nOp >> 8;
+			if (o >= 0xf0 && o <= 0xfb) {
+				UINT32 nTarget = n.i.nNext + n.i.nExtra;
+				if (nTarget >= m_Nodes[nHead].i.nPC && nTarget <= m_Nodes[nBranch].i.nPC) return false;
+			}
+
+			nCycles += n.nCycles;
+		}
+
+		if ((n.nReadL & nWriteL & ~nDoneL) || (n.nReadG & nWriteG & ~nDoneG)) return false;
+
+		nDoneL |= n.nWriteL;
+		nDoneG |= n.nWriteG;
+	}
+
+	nCycles += m_nClock[2];
+	nInsns = nBranch - nHead + 1;
+
+	return nCycles > 0;
+}
+
+// ----------------------------------------------------------------------------
+// Translation
+//
+// CompileX() return 0 to carry on with the block, 1 when the instruction always leaves it and
+// -1 without emitting anything when it has to go to the interpreter.
+
+INT32 E132XSDrc::CompileFallback(const DrcInsn& d)
+{
+	mov(REG_PC, d.nPC);
+	mov(Var(Ctx.pICount), r15d);
+	mov(Var(Ctx.pIntBlock), r13d);
+	mov(rax, (size_t)DrcStep);
+	call(rax);
+	mov(r15d, Var(Ctx.pICount));
+	mov(r13d, Var(Ctx.pIntBlock));
+	mov(r14d, Var(Ctx.pStop));
+
+	// the interpreter charged the instruction and left PC / SR wherever it went
+	cmp(dword[rbp + HOT_BREAK], 0);
+	jne(*m_plExitSync, T_NEAR);
+	cmp(r15d, r14d);
+	jle(*m_plExitSync, T_NEAR);
+	cmp(REG_PC, d.nNext);
+	jne(*m_plDispatch, T_NEAR);
+	mov(eax, REG_SR);
+	shr(eax, 25);
+	cmp(eax, m_nFP);
+	jne(*m_plDispatch, T_NEAR);
+
+	m_nIlc = -1;
+
+	return 0;
+}
+
+INT32 E132XSDrc::CompileOp(const DrcInsn& d)
+{
+	INT32 o = d.nOp >> 8;
+
+	if (o >= 0x04 && o <= 0x07) return CompileMovd(d);
+	if ((o >= 0x14 && o <= 0x5f) || (o >= 0xb0 && o <= 0xb7) || (o >= 0xbc && o <= 0xbf)) {
+		if (o >= 0xb0) return CompileMul(d);
+		return CompileALU(d);
+	}
+	if (o >= 0x60 && o <= 0x7f) return CompileImm(d);
+	if (o == 0x8e) return CompileTestlz(d);
+	if (o >= 0x90 && o <= 0x93) return CompileLoad1(d);
+	if (o >= 0x94 && o <= 0x97) return CompileLoad2(d);
+	if (o >= 0x98 && o <= 0x9b) return CompileStore1(d);
+	if (o >= 0x9c && o <= 0x9f) return CompileStore2(d);
+	if (o >= 0xa0 && o <= 0xab) return CompileShift(d);
+	if (o >= 0xd0 && o <= 0xdf) return CompileLR(d);
+	if (o >= 0xe0 && o <= 0xec) return CompileDelayed(d);
+	if (o == 0xee || o == 0xef) return CompileCall(d);
+	if (o >= 0xf0 && o <= 0xfc) return CompileBranch(d);
+
+	return -1;
+}
+
+// RR and RRconst: mask, sum, cmp, mov, add, cmpb, andn, or, xor, not, sub, and, neg
+INT32 E132XSDrc::CompileALU(const DrcInsn& d)
+{
+	INT32 o = (d.nOp >> 8) & 0xfc;
+	bool bSSR = !d.bS && d.nS == 1;
+	bool bDPC = !d.bD && d.nD == 0;
+	bool bDSR = !d.bD && d.nD == 1;
+
+	switch (o) {
+		case 0x14:																// mask
+		case 0x34: case 0x38: case 0x3c: case 0x44: case 0x54:					// andn, or, xor, not, and
+			if (bSSR || bDPC || bDSR) return -1;
+			break;
+
+		case 0x18: case 0x28: case 0x48: case 0x58:								// sum, add, sub, neg
+			if (bDPC || bDSR) return -1;
+			break;
+
+		case 0x20: case 0x30:													// cmp, cmpb
+			if (bDSR || (o == 0x30 && bSSR)) return -1;
+			break;
+
+		case 0x24:																// mov
+			if (bSSR || bDSR || (bDPC && m_bSlot)) return -1;
+			break;
+
+		default:
+			return -1;
+	}
+
+	switch (o) {
+		case 0x14:																// mask
+			Load(eax, d.bS, d.nS);
+			and_(eax, d.nExtra);
+			SetFlags(SR_Z);
+			Store(eax, d.bD, d.nD);
+			break;
+
+		case 0x18:																// sum
+			LoadSC(eax);
+			add(eax, d.nExtra);
+			SetFlags(SR_C | SR_Z | SR_N | SR_V);
+			Store(eax, d.bD, d.nD);
+			break;
+
+		case 0x20:																// cmp
+			Load(eax, d.bD, d.nD);
+			LoadSC(r10d);
+			cmp(eax, r10d);
+			SetFlags(SR_C | SR_Z | SR_N | SR_V, true);
+			break;
+
+		case 0x24:																// mov
+			Load(eax, d.bS, d.nS);
+			if (bDPC) {
+				mov(r10d, eax);
+				and_(r10d, ~1);
+				mov(REG_PC, r10d);
+			} else {
+				Store(eax, d.bD, d.nD);
+			}
+			test(eax, eax);
+			SetFlags(SR_Z | SR_N, false, bDPC ? SR_M : 0);
+			break;
+
+		case 0x28:																// add
+			LoadSC(eax);
+			Load(r10d, d.bD, d.nD);
+			add(eax, r10d);
+			SetFlags(SR_C | SR_Z | SR_N | SR_V);
+			Store(eax, d.bD, d.nD);
+			break;
+
+		case 0x30:																// cmpb
+			Load(eax, d.bD, d.nD);
+			Load(r10d, d.bS, d.nS);
+			test(eax, r10d);
+			SetFlags(SR_Z);
+			break;
+
+		case 0x34:																// andn
+			Load(eax, d.bS, d.nS);
+			not_(eax);
+			Load(r10d, d.bD, d.nD);
+			and_(eax, r10d);
+			SetFlags(SR_Z);
+			Store(eax, d.bD, d.nD);
+			break;
+
+		case 0x38:																// or
+		case 0x3c:																// xor
+		case 0x54:																// and
+			Load(eax, d.bD, d.nD);
+			Load(r10d, d.bS, d.nS);
+			if (o == 0x38) or_(eax, r10d); else if (o == 0x3c) xor_(eax, r10d); else and_(eax, r10d);
+			SetFlags(SR_Z);
+			Store(eax, d.bD, d.nD);
+			break;
+
+		case 0x44:																// not
+			Load(eax, d.bS, d.nS);
+			not_(eax);
+			test(eax, eax);
+			SetFlags(SR_Z);
+			Store(eax, d.bD, d.nD);
+			break;
+
+		case 0x48:																// sub
+			Load(eax, d.bD, d.nD);
+			LoadSC(r10d);
+			sub(eax, r10d);
+			SetFlags(SR_C | SR_Z | SR_N | SR_V);
+			Store(eax, d.bD, d.nD);
+			break;
+
+		case 0x58:																// neg
+			LoadSC(eax);
+			neg(eax);
+			SetFlags(SR_C | SR_Z | SR_N | SR_V);
+			Store(eax, d.bD, d.nD);
+			break;
+	}
+
+	if (o == 0x24 && bDPC) {
+		m_pNode->bSpin = false;
+		EndInsnAt(m_nClock[1], DRC_KEEP_PC, m_nInsnPC, -1, DRC_KEEP_PC);
+		JumpOut(DRC_KEEP_PC, m_nInsnPC);
+		return 1;
+	}
+
+	EndInsn(m_nClock[1]);
+
+	return 0;
+}
+
+// Rimm: cmpi, movi, addi, cmpbi, andni, ori, xori
+INT32 E132XSDrc::CompileImm(const DrcInsn& d)
+{
+	INT32 o = (d.nOp >> 8) & 0xfc;
+	INT32 n = ((d.nOp & 0x100) >> 4) | (d.nOp & 15);
+	bool bDPC = !d.bD && d.nD == 0;
+	bool bDSR = !d.bD && d.nD == 1;
+	UINT32 nImm = d.nExtra;
+
+	switch (o) {
+		case 0x60:																// cmpi
+			if (bDSR) return -1;
+			break;
+
+		case 0x64:																// movi
+			if (bDSR || (bDPC && m_bSlot)) return -1;
+			break;
+
+		case 0x68:																// addi, n == 0 adds the carry
+			if (n == 0 || bDPC || bDSR) return -1;
+			break;
+
+		case 0x70:																// cmpbi, n == 0 tests the bytes
+			if (n == 0 || bDSR) return -1;
+			break;
+
+		case 0x74: case 0x78: case 0x7c:										// andni, ori, xori
+			if (bDPC || bDSR) return -1;
+			break;
+
+		default:
+			return -1;
+	}
+
+	if ((o == 0x70 || o == 0x74) && n == 31) nImm = 0x7fffffff;
+
+	switch (o) {
+		case 0x60:
+			Load(eax, d.bD, d.nD);
+			cmp(eax, nImm);
+			SetFlags(SR_C | SR_Z | SR_N | SR_V, true);
+			break;
+
+		case 0x64:
+			if (bDPC) {
+				mov(REG_PC, nImm & ~1);
+			} else {
+				mov(eax, nImm);
+				Store(eax, d.bD, d.nD);
+			}
+			UseFlags(SR_Z | SR_N | SR_V, true);
+			UpdateSR(SR_Z | SR_N | SR_V | (bDPC ? SR_M : 0), (nImm == 0 ? SR_Z : 0) | ((nImm & 0x80000000) ? SR_N : 0), false);
+			break;
+
+		case 0x68:
+			Load(eax, d.bD, d.nD);
+			add(eax, nImm);
+			SetFlags(SR_C | SR_Z | SR_N | SR_V);
+			Store(eax, d.bD, d.nD);
+			break;
+
+		case 0x70:
+			Load(eax, d.bD, d.nD);
+			test(eax, nImm);
+			SetFlags(SR_Z);
+			break;
+
+		case 0x74:
+		case 0x78:
+		case 0x7c:
+			Load(eax, d.bD, d.nD);
+			if (o == 0x74) and_(eax, ~nImm); else if (o == 0x78) or_(eax, nImm); else xor_(eax, nImm);
+			SetFlags(SR_Z);
+			Store(eax, d.bD, d.nD);
+			break;
+	}
+
+	if (o == 0x64 && bDPC) {
+		m_pNode->bSpin = false;
+		EndInsnAt(m_nClock[1], nImm & ~1, m_nInsnPC, -1, DRC_KEEP_PC);
+		JumpTo(nImm & ~1, m_nInsnPC);
+		return 1;
+	}
+
+	EndInsn(m_nClock[1]);
+
+	return 0;
+}
+
+// Rn: shri, sari, shli
+INT32 E132XSDrc::CompileShift(const DrcInsn& d)
+{
+	INT32 o = (d.nOp >> 8) & 0xfc;
+	INT32 n = ((d.nOp & 0x100) >> 4) | (d.nOp & 15);
+
+	if (!d.bD && d.nD <= 1) return -1;
+
+	Load(eax, d.bD, d.nD);
+
+	if (n == 0) {
+		test(eax, eax);
+		SetFlags(SR_Z | SR_N, false, SR_C | ((o == 0xa8) ? SR_V : 0));
+	} else if (o == 0xa0) {
+		shr(eax, n);
+		SetFlags(SR_C | SR_Z | SR_N);
+	} else if (o == 0xa4) {
+		sar(eax, n);
+		SetFlags(SR_C | SR_Z | SR_N);
+	} else {
+		// V: the bits shifted out and the new sign aren't all the same
+		mov(r10d, eax);
+		sar(r10d, 31 - n);
+		add(r10d, 1);
+		cmp(r10d, 1);
+		seta(r11b);
+		shl(eax, n);
+		SetFlags(SR_C | SR_Z | SR_N | SR_V, false, 0, true);
+	}
+
+	Store(eax, d.bD, d.nD);
+	EndInsn(m_nClock[1]);
+
+	return 0;
+}
+
+// mulu, muls, mul
+INT32 E132XSDrc::CompileMul(const DrcInsn& d)
+{
+	INT32 o = (d.nOp >> 8) & 0xfc;
+
+	if ((!d.bS && d.nS <= 1) || (!d.bD && d.nD <= 1)) return -1;
+
+	Load(eax, d.bS, d.nS);
+	Load(r10d, d.bD, d.nD);
+
+	if (o == 0xbc) {
+		imul(eax, r10d);
+		test(eax, eax);
+		SetFlags(SR_Z | SR_N);
+		Store(eax, d.bD, d.nD);
+		EndInsn(5 << m_nClock[0]);
+		return 0;
+	}
+
+	if (o == 0xb0) {
+		mov(r11d, eax);
+		or_(r11d, r10d);							// both <= 0xffff: the short form
+		mul(r10d);
+	} else {
+		imul(r10d);
+	}
+
+	Store(edx, d.bD, d.nD);
+	StoreF(eax, d.bD, d.nD);
+
+	mov(ecx, edx);
+	shr(ecx, 31);
+	shl(ecx, 2);								// N
+	or_(edx, eax);
+	setz(r8b);
+	movzx(r8d, r8b);
+	lea(ecx, ptr[rcx + r8 * 2]);				// Z
+	UseFlags(SR_Z | SR_N, true);
+	UpdateSR(SR_Z | SR_N, 0, true);
+
+	if (o == 0xb4) {
+		EndInsn(m_nClock[4]);
+		return 0;
+	}
+
+	Xbyak::Label lLong, lDone;
+
+	m_pNode->bSpin = false;
+	cmp(r11d, 0xffff);
+	ja(lLong, T_NEAR);
+	EndInsn(m_nClock[3]);
+	jmp(lDone, T_NEAR);
+	L(lLong);
+	EndInsn(m_nClock[4]);
+	L(lDone);
+
+	return 0;
+}
+
+// movd, but not ret
+INT32 E132XSDrc::CompileMovd(const DrcInsn& d)
+{
+	if (!d.bD && d.nD <= 1) return -1;
+	if (!d.bS && d.nS == 0) return -1;						// the pair after PC is SR
+
+	if (!d.bS && d.nS == 1) {
+		xor_(eax, eax);
+		Store(eax, d.bD, d.nD);
+		StoreF(eax, d.bD, d.nD);
+		UseFlags(SR_Z | SR_N, true);
+		UpdateSR(SR_Z | SR_N, SR_Z, false);
+	} else {
+		Load(eax, d.bS, d.nS);
+		LoadF(r10d, d.bS, d.nS);
+		Store(eax, d.bD, d.nD);
+		StoreF(r10d, d.bD, d.nD);
+
+		mov(ecx, eax);
+		shr(ecx, 31);
+		shl(ecx, 2);							// N
+		or_(r10d, eax);
+		setz(r8b);
+		movzx(r8d, r8b);
+		lea(ecx, ptr[rcx + r8 * 2]);			// Z
+		UseFlags(SR_Z | SR_N, true);
+		UpdateSR(SR_Z | SR_N, 0, true);
+	}
+
+	EndInsn(m_nClock[2]);
+
+	return 0;
+}
+
+INT32 E132XSDrc::CompileTestlz(const DrcInsn& d)
+{
+	Load(eax, true, d.nS);
+	mov(edx, -1);
+	bsr(eax, eax);
+	cmovz(eax, edx);
+	mov(ecx, 31);
+	sub(ecx, eax);
+	Store(ecx, true, d.nD);
+
+	EndInsn(m_nClock[2]);
+
+	return 0;
+}
+
+// RRdis loads / stores with SR as the base register take the displacement as the address
+static bool DrcAbsolute(const DrcInsn& d)
+{
+	return !d.bD && d.nD == 1;
+}
+
+// ldxx1: ld*.d / ld*.a / ld*.iod / ld*.ioa
+INT32 E132XSDrc::CompileLoad1(const DrcInsn& d)
+{
+	INT32 nCycles = m_nClock[1];
+	UINT32 nExtra = d.nExtra;
+
+	if (!d.bS && d.nS <= 1) return -1;
+
+	if (DrcAbsolute(d)) {
+		mov(ecx, 0);
+	} else {
+		Load(ecx, d.bD, d.nD);
+	}
+
+	switch (d.nSub) {
+		case 0:
+		case 1:
+			add(ecx, nExtra);
+			MemRead(1);
+			if (d.nSub == 0) movsx(eax, al);
+			Store(eax, d.bS, d.nS);
+			break;
+
+		case 2:
+			add(ecx, nExtra & ~1);
+			and_(ecx, ~1);
+			MemRead(2);
+			if (nExtra & 1) movsx(eax, ax);
+			Store(eax, d.bS, d.nS);
+			break;
+
+		case 3:
+			switch (nExtra & 3) {
+				case 3:														// ldd.io
+					add(ecx, nExtra & ~3);
+					mov(SLOT_D, ecx);
+					IORead();
+					Store(eax, d.bS, d.nS);
+					mov(ecx, SLOT_D);
+					add(ecx, 4);
+					IORead();
+					StoreF(eax, d.bS, d.nS);
+					nCycles += m_nClock[1];
+					break;
+
+				case 2:														// ldw.io
+					add(ecx, nExtra & ~3);
+					IORead();
+					Store(eax, d.bS, d.nS);
+					break;
+
+				case 1:														// ldd
+					add(ecx, nExtra & ~1);
+					mov(SLOT_D, ecx);
+					and_(ecx, ~3);
+					MemRead(4);
+					Store(eax, d.bS, d.nS);
+					mov(ecx, SLOT_D);
+					add(ecx, 4);
+					and_(ecx, ~3);
+					MemRead(4);
+					StoreF(eax, d.bS, d.nS);
+					nCycles += m_nClock[1];
+					break;
+
+				case 0:														// ldw
+					add(ecx, nExtra & ~1);
+					and_(ecx, ~3);
+					MemRead(4);
+					Store(eax, d.bS, d.nS);
+					break;
+			}
+			break;
+	}
+
+	EndInsn(nCycles);
+
+	return 0;
+}
+
+// ldxx2: ld*.n (not ldw.s)
+INT32 E132XSDrc::CompileLoad2(const DrcInsn& d)
+{
+	INT32 nCycles = m_nClock[1];
+	UINT32 nExtra = d.nExtra;
+	UINT32 nAdd = nExtra & ~1;
+	bool bPost = !d.bSame;
+
+	if ((!d.bD && d.nD <= 1) || (!d.bS && d.nS <= 1)) return -1;
+	if (d.nSub == 3 && (nExtra & 3) >= 2) return -1;
+
+	Load(eax, d.bD, d.nD);
+	mov(SLOT_D, eax);
+	mov(ecx, eax);
+
+	switch (d.nSub) {
+		case 0:
+		case 1:
+			MemRead(1);
+			if (d.nSub == 0) movsx(eax, al);
+			Store(eax, d.bS, d.nS);
+			nAdd = nExtra;
+			break;
+
+		case 2:
+			and_(ecx, ~1);
+			MemRead(2);
+			if (nExtra & 1) movsx(eax, ax);
+			Store(eax, d.bS, d.nS);
+			break;
+
+		case 3:
+			and_(ecx, ~3);
+			MemRead(4);
+			Store(eax, d.bS, d.nS);
+
+			if (nExtra & 1) {												// ldd.n
+				mov(ecx, SLOT_D);
+				add(ecx, 4);
+				and_(ecx, ~3);
+				MemRead(4);
+				StoreF(eax, d.bS, d.nS);
+				bPost = !d.bSame && !d.bSameF;
+				nCycles += m_nClock[1];
+			}
+			break;
+	}
+
+	if (bPost) {
+		mov(eax, SLOT_D);
+		add(eax, nAdd);
+		Store(eax, d.bD, d.nD);
+	}
+
+	EndInsn(nCycles);
+
+	return 0;
+}
+
+// stxx1: st*.d / st*.a / st*.iod / st*.ioa
+INT32 E132XSDrc::CompileStore1(const DrcInsn& d)
+{
+	INT32 nCycles = m_nClock[1];
+	UINT32 nExtra = d.nExtra;
+	bool bDouble = d.nSub == 3 && (nExtra & 1);
+	bool bSSR = !d.bS && d.nS == 1;
+
+	if (bDouble && !d.bS && d.nS == 0) return -1;
+
+	// the values first, a handler can't change the registers but the base may be one of them
+	if (bSSR) {
+		mov(SLOT_S, 0);
+		mov(SLOT_SF, 0);
+	} else {
+		Load(eax, d.bS, d.nS);
+		mov(SLOT_S, eax);
+		if (bDouble) {
+			LoadF(eax, d.bS, d.nS);
+			mov(SLOT_SF, eax);
+		}
+	}
+
+	if (DrcAbsolute(d)) {
+		mov(ecx, 0);
+	} else {
+		Load(ecx, d.bD, d.nD);
+	}
+
+	switch (d.nSub) {
+		case 0:
+		case 1:
+			add(ecx, nExtra);
+			mov(eax, SLOT_S);
+			MemWrite(1);
+			break;
+
+		case 2:
+			add(ecx, nExtra & ~1);
+			and_(ecx, ~1);
+			mov(eax, SLOT_S);
+			MemWrite(2);
+			break;
+
+		case 3:
+			switch (nExtra & 3) {
+				case 3:														// std.io
+					add(ecx, nExtra & ~3);
+					mov(SLOT_D, ecx);
+					mov(eax, SLOT_S);
+					IOWrite();
+					mov(ecx, SLOT_D);
+					add(ecx, 4);
+					mov(eax, SLOT_SF);
+					IOWrite();
+					nCycles += m_nClock[1];
+					break;
+
+				case 2:														// stw.io
+					add(ecx, nExtra & ~3);
+					mov(eax, SLOT_S);
+					IOWrite();
+					break;
+
+				case 1:														// std
+					add(ecx, nExtra & ~1);
+					mov(SLOT_D, ecx);
+					and_(ecx, ~3);
+					mov(eax, SLOT_S);
+					MemWrite(4);
+					mov(ecx, SLOT_D);
+					add(ecx, 4);
+					and_(ecx, ~3);
+					mov(eax, SLOT_SF);
+					MemWrite(4);
+					nCycles += m_nClock[1];
+					break;
+
+				case 0:														// stw
+					add(ecx, nExtra & ~1);
+					and_(ecx, ~3);
+					mov(eax, SLOT_S);
+					MemWrite(4);
+					break;
+			}
+			break;
+	}
+
+	m_pNode->bSpin = false;
+	EndInsn(nCycles);
+
+	return 0;
+}
+
+// stxx2: st*.n (not stw.s)
+INT32 E132XSDrc::CompileStore2(const DrcInsn& d)
+{
+	INT32 nCycles = m_nClock[1];
+	UINT32 nExtra = d.nExtra;
+	UINT32 nAdd = nExtra & ~1;
+	bool bDouble = d.nSub == 3 && (nExtra & 1);
+	bool bSSR = !d.bS && d.nS == 1;
+
+	if (!d.bD && d.nD <= 1) return -1;
+	if (d.nSub == 3 && (nExtra & 3) >= 2) return -1;
+	if (bDouble && !d.bS && d.nS == 0) return -1;
+
+	if (bSSR) {
+		mov(SLOT_S, 0);
+		mov(SLOT_SF, d.bSameF ? nAdd : 0);		// SREGF is 0 and DREG, which moves on
+	} else {
+		Load(eax, d.bS, d.nS);
+		mov(SLOT_S, eax);
+		if (bDouble) {
+			LoadF(eax, d.bS, d.nS);
+			if (d.bSameF) add(eax, nAdd);			// SREGF is DREG, which has moved on
+			mov(SLOT_SF, eax);
+		}
+	}
+
+	Load(ecx, d.bD, d.nD);
+	mov(SLOT_D, ecx);
+
+	switch (d.nSub) {
+		case 0:
+		case 1:
+			mov(eax, SLOT_S);
+			MemWrite(1);
+			nAdd = nExtra;
+			break;
+
+		case 2:
+			and_(ecx, ~1);
+			mov(eax, SLOT_S);
+			MemWrite(2);
+			break;
+
+		case 3:
+			and_(ecx, ~3);
+			mov(eax, SLOT_S);
+			MemWrite(4);
+			break;
+	}
+
+	mov(eax, SLOT_D);
+	add(eax, nAdd);
+	Store(eax, d.bD, d.nD);
+
+	if (bDouble) {												// std.n, at the old DREG + 4
+		mov(ecx, SLOT_D);
+		add(ecx, 4);
+		and_(ecx, ~3);
+		mov(eax, SLOT_SF);
+		MemWrite(4);
+		nCycles += m_nClock[1];
+	}
+
+	m_pNode->bSpin = false;
+	EndInsn(nCycles);
+
+	return 0;
+}
+
+// LR: ldw.r, ldd.r, ldw.p, ldd.p, stw.r, std.r, stw.p, std.p
+INT32 E132XSDrc::CompileLR(const DrcInsn& d)
+{
+	INT32 nKind = ((d.nOp >> 8) >> 1) & 7;
+	bool bStore = nKind >= 4;
+	bool bDouble = nKind & 1;
+	bool bPost = (nKind & 2) != 0;
+	bool bSSR = !d.bS && d.nS == 1;
+
+	if (!bStore && !d.bS && d.nS <= 1) return -1;
+	if (bStore && bDouble && !d.bS && d.nS == 0) return -1;
+
+	if (bStore) {
+		if (bSSR) {
+			mov(SLOT_S, 0);
+			mov(SLOT_SF, 0);
+		} else {
+			Load(eax, d.bS, d.nS);
+			mov(SLOT_S, eax);
+			if (bDouble) {
+				LoadF(eax, d.bS, d.nS);
+				if (bPost && d.bSameF) add(eax, 8);	// SREGF is DREG, which has moved on
+				mov(SLOT_SF, eax);
+			}
+		}
+	}
+
+	Load(ecx, true, d.nD);
+	mov(SLOT_D, ecx);
+	and_(ecx, ~3);
+
+	if (bStore) {
+		mov(eax, SLOT_S);
+		MemWrite(4);
+
+		if (bPost) {
+			mov(eax, SLOT_D);
+			add(eax, bDouble ? 8 : 4);
+			Store(eax, true, d.nD);
+		}
+
+		if (bDouble) {
+			mov(ecx, SLOT_D);
+			add(ecx, 4);
+			and_(ecx, ~3);
+			mov(eax, SLOT_SF);
+			MemWrite(4);
+		}
+	} else {
+		MemRead(4);
+		Store(eax, d.bS, d.nS);
+
+		if (bDouble) {
+			mov(ecx, SLOT_D);
+			add(ecx, 4);
+			and_(ecx, ~3);
+			MemRead(4);
+			StoreF(eax, d.bS, d.nS);
+		}
+
+		// not over the register just loaded
+		if (bPost && !(d.nS == d.nD && d.bS) && !(bDouble && d.bSameF)) {
+			mov(eax, SLOT_D);
+			add(eax, bDouble ? 8 : 4);
+			Store(eax, true, d.nD);
+		}
+	}
+
+	if (bStore) m_pNode->bSpin = false;
+	EndInsn(bDouble ? m_nClock[2] : m_nClock[1]);
+
+	return 0;
+}
+
+// bcc / br: taken is 2 cycles and clears M, not taken 1
+INT32 E132XSDrc::CompileBranch(const DrcInsn& d)
+{
+	INT32 nCond = (d.nOp >> 8) & 15;
+	UINT32 nTarget = d.nNext + d.nExtra;
+
+	if (m_bSlot) return -1;
+
+	Xbyak::Label lSkip;
+
+	Ilc();
+	if (nCond != 12) EmitCond(nCond, lSkip);
+
+	and_(REG_SR, ~SR_M);
+	EndInsnAt(m_nClock[2], nTarget, d.nNext, -1, DRC_KEEP_PC);
+
+	// a spin loop goes round once the normal way, then takes the rest of the run at once
+	INT32 nCycles, nInsns;
+	for (INT32 i = 0; i <= m_nIndex; i++) {
+		if (m_Nodes[i].i.nPC != nTarget) continue;
+
+		if (SpinLoop(i, m_nIndex, nCycles, nInsns)) {
+			Xbyak::Label lNo;
+
+			cmp(dword[rbp + HOT_HIT], 0);
+			jne(lNo, T_NEAR);
+			test(r13d, r13d);
+			jg(lNo, T_NEAR);
+			mov(eax, r15d);
+			sub(eax, r14d);
+			dec(eax);
+			xor_(edx, edx);
+			mov(ecx, nCycles);
+			div(ecx);
+			imul(edx, eax, nInsns);
+			sub(r13d, edx);
+			imul(eax, eax, nCycles);
+			sub(r15d, eax);
+			L(lNo);
+		}
+		break;
+	}
+
+	JumpTo(nTarget, d.nNext);
+
+	if (nCond == 12) {
+		m_pNode->bSpin = false;
+		return 1;
+	}
+
+	L(lSkip);
+	EndInsn(m_nClock[1]);
+
+	return 0;
+}
+
+// dbcc / dbr: taken sets the delayed branch up and runs the delay slot (inline when we can)
+INT32 E132XSDrc::CompileDelayed(const DrcInsn& d)
+{
+	INT32 nCond = (d.nOp >> 8) & 15;
+	UINT32 nTarget = d.nNext + d.nExtra;
+	INT32 nCycles = (nCond == 12) ? 0 : m_nClock[1];
+
+	if (m_bSlot) return -1;
+
+	m_pNode->bSpin = false;
+
+	Xbyak::Label lSkip;
+
+	Ilc();
+	if (nCond != 12) EmitCond(nCond, lSkip);
+
+	EndInsnAt(nCycles, d.nNext, d.nPC, 2, nTarget);
+	mov(Var(Ctx.pDelayPC), nTarget);			// left behind in the state, as the interpreter does
+
+	if (!CompileSlot(nTarget)) {
+		DrcStub& x = NewStub(STUB_EXIT, 0);
+		x.nPC = d.nNext;
+		x.nDelayPC = nTarget;
+		jmp(x.lFrom, T_NEAR);
+	}
+
+	if (nCond == 12) return 1;
+
+	L(lSkip);
+	EndInsn(m_nClock[1]);
+
+	return 0;
+}
+
+// the instruction after a taken dbcc, with PC reading as the branch target
+bool E132XSDrc::CompileSlot(UINT32 nTarget)
+{
+	if (m_nIndex + 1 >= (INT32)m_Nodes.size()) return false;
+
+	const DrcInsn& s = m_Nodes[m_nIndex + 1].i;
+
+	DrcNode* pNode = m_pNode;
+	UINT32 nInsnPC = m_nInsnPC, nNextPC = m_nNextPC;
+	UINT16 nOp = m_nOp;
+	INT32 nLen = m_nLen, nIlc = m_nIlc;
+	bool bCall = m_bCall;
+
+	m_Slot.i = s;
+	m_Slot.bTarget = m_Slot.bHead = m_Slot.bSpin = false;
+	m_Slot.nCycles = 0;
+	m_Slot.nReadL = m_Slot.nWriteL = 0;
+	m_Slot.nReadG = m_Slot.nWriteG = 0;
+	m_pNode = &m_Slot;
+	m_nInsnPC = s.nPC;
+	m_nNextPC = nTarget;
+	m_nOp = s.nOp;
+	m_nLen = s.nLen;
+	m_bCall = false;
+	m_bSlot = true;
+
+	bool bDone = CompileOp(s) == 0;
+	if (bDone) JumpTo(nTarget, s.nPC);
+
+	m_pNode = pNode;
+	m_nInsnPC = nInsnPC;
+	m_nNextPC = nNextPC;
+	m_nOp = nOp;
+	m_nLen = nLen;
+	m_nIlc = nIlc;
+	m_bCall = bCall;
+	m_bSlot = false;
+
+	return bDone;
+}
+
+// call: the return pc and SR go to the new frame's first two locals
+INT32 E132XSDrc::CompileCall(const DrcInsn& d)
+{
+	INT32 nDst = d.nD ? d.nD : 16;
+	UINT32 nFP = (m_nFP + nDst) & 0x7f;
+	bool bConst = !d.bS && d.nS <= 1;
+
+	if (m_bSlot) return -1;
+
+	m_pNode->bSpin = false;
+
+	if (!bConst) {
+		Load(eax, d.bS, d.nS);
+		add(eax, d.nExtra & ~1);
+		mov(SLOT_S, eax);
+	}
+
+	Ilc();
+	mov(edx, REG_SR);
+	mov(eax, edx);
+	shr(eax, 18);
+	and_(eax, 1);
+	or_(eax, d.nNext & ~1);
+	mov(Local(nDst), eax);
+	mov(Local(nDst + 1), edx);
+
+	and_(edx, ~(SR_FP | SR_FL | SR_M));
+	or_(edx, (nFP << 25) | (6 << 21));
+	mov(REG_SR, edx);
+
+	if (bConst) {
+		UINT32 nTarget = (d.nExtra & ~1) + ((d.nS == 0) ? d.nNext : 0);
+		mov(REG_PC, nTarget);
+	} else {
+		mov(eax, SLOT_S);
+		mov(REG_PC, eax);
+	}
+
+	EndInsnAt(m_nClock[1], DRC_KEEP_PC, d.nNext, 1, DRC_KEEP_PC);
+	JumpOut(DRC_KEEP_PC, d.nNext);
+
+	return 1;
+}
+
+DrcBlock* E132XSDrc::Compile(UINT32 nPC, UINT32 nKey, UINT8* pFetch)
+{
+	m_pPage = pFetch;
+	m_nPC = nPC;
+	m_nFP = nKey;
+	m_Stubs.clear();
+
+	Scan(nPC);
+	if (m_Nodes.empty()) return NULL;
+
+	size_t nStart = getSize();
+	void* pCode = (void*)getCurr();
+	bool bEnd = false;
+	DrcBlock* b = NULL;
+
+	try {
+		m_nIlc = -1;
+
+		for (UINT32 i = 0; i < m_Nodes.size(); i++) {
+			DrcNode& n = m_Nodes[i];
+
+			L(n.l);
+			if (n.bTarget) m_nIlc = -1;
+			if (n.bHead) mov(dword[rbp + HOT_HIT], 0);
+
+			m_pNode = &n;
+			m_nIndex = i;
+			m_nInsnPC = n.i.nPC;
+			m_nNextPC = n.i.nNext;
+			m_nOp = n.i.nOp;
+			m_nLen = n.i.nLen;
+			m_bCall = false;
+			m_bSlot = false;
+			n.bSpin = true;
+
+			INT32 r = CompileOp(n.i);
+			if (r < 0) {
+				n.bSpin = false;
+				r = CompileFallback(n.i);
+			}
+			bEnd = r != 0;
+		}
+
+		if (!bEnd) {
+			JumpOut(m_Nodes.back().i.nNext, m_Nodes.back().i.nPC);
+		}
+
+		EmitStubs();
+
+		b = new DrcBlock;
+		b->nPC = nPC;
+		b->nKey = nKey;
+		b->nPage = nPC >> DRC_PAGE_SHIFT;
+		b->nLen = m_Nodes.back().i.nNext - nPC;
+		b->bDead = false;
+		b->pFetch = pFetch;
+		b->pHost = pFetch + (nPC & DRC_PAGEM);
+		b->pSource = (UINT8*)malloc(b->nLen);
+		memcpy(b->pSource, b->pHost, b->nLen);
+
+		b->bCheck = Ctx.pWrite[b->nPage] != NULL;
+		if (b->bCheck) {
+			void* pBody = pCode;
+			pCode = (void*)getCurr();
+			EmitCheck(b, pBody);
+		}
+		b->pCode = pCode;
+	} catch (Xbyak::Error&) {
+		// out of code space: drop what we have and let the next run flush
+		if (b) {
+			free(b->pSource);
+			delete b;
+		}
+		m_Stubs.clear();
+		m_Nodes.clear();
+		setSize(nStart);
+		m_bFlushPending = true;
+		return NULL;
+	}
+
+	m_Nodes.clear();
+
+	m_Blocks.insert(std::make_pair(nPC, b));
+	m_Pages[b->nPage].push_back(b);
+
+	for (uintptr_t k = (uintptr_t)b->pHost >> DRC_PAGE_SHIFT; k <= ((uintptr_t)b->pHost + b->nLen - 1) >> DRC_PAGE_SHIFT; k++) {
+		std::vector<DrcBlock*>& v = m_Chunks[k];
+		v.push_back(b);
+		if (v.size() == 1) CodeAdded(k);
+	}
+
+	return b;
+}
+
+// ----------------------------------------------------------------------------
+// Interface
+
+INT32 E132XSDrcInit(E132XSDrcContext* pContext)
+{
+	try {
+		pDrc = new E132XSDrc(pContext);
+	} catch (Xbyak::Error& e) {
+		bprintf(PRINT_ERROR, _T("E132XS DRC: %S\n"), e.what());
+		pDrc = NULL;
+		return 1;
+	}
+
+	pE132XSDrcCode = pDrc->pHot->Code;
+
+	return 0;
+}
+
+void E132XSDrcExit()
+{
+	pE132XSDrcCode = NULL;
+
+	delete pDrc;
+	pDrc = NULL;
+}
+
+INT32 E132XSDrcRun()
+{
+	return pDrc->Run();
+}
+
+INT32 E132XSDrcRunning()
+{
+	return pDrc->bRunning;
+}
+
+void E132XSDrcMapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	pDrc->MapChanged(nStart, nEnd);
+}
+
+void E132XSDrcVerify()
+{
+	pDrc->bVerifyPending = true;
+}
+
+void E132XSDrcWrite(UINT8* p, INT32 nLen)
+{
+	pDrc->CheckHost(p, nLen);
+}
+
+#endif
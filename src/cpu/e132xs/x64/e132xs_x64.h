@@ -0,0 +1,53 @@
+// Hyperstone E1-32XS block recompiler for x86-64 hosts (e132xs.cpp context and memory map)
+
+#ifndef E132XS_X64_H
+#define E132XS_X64_H
+
+#ifdef E132XS_X64_DRC
+
+// Per-page flags: non-zero where a write may hit recompiled code (NULL when not recompiling)
+extern UINT8* pE132XSDrcCode;
+
+struct E132XSDrcContext {
+	UINT32* pGlobalRegs;						// m_global_regs[], everything below is addressed from it
+	UINT32* pLocalRegs;
+	UINT32* pPPC;
+	UINT16* pOp;
+	INT32* pICount;
+	INT32* pIntBlock;
+	INT32* pInstructionLength;
+	INT32* pDelayCmd;
+	UINT32* pDelayPC;
+	INT32* pEndRun;
+	INT32* pStop;								// icount translated code runs down to
+	INT32* pLast;								// icount before the last instruction it ran
+	UINT8* pClock[5];							// m_clock_scale, m_clock_cycles_1 / 2 / 4 / 6
+	UINT8** pRead;								// e132xs.cpp page tables
+	UINT8** pWrite;
+};
+
+INT32 E132XSDrcInit(E132XSDrcContext* pContext);
+void E132XSDrcExit();
+INT32 E132XSDrcRun();							// run blocks from PC while icount > *pStop, 0 if there was nothing to run
+INT32 E132XSDrcRunning();						// inside E132XSDrcRun()
+
+void E132XSDrcMapChanged(UINT32 nStart, UINT32 nEnd);
+void E132XSDrcVerify();							// drop blocks whose code changed behind our back
+
+void E132XSDrcWrite(UINT8* p, INT32 nLen);		// a write through the E132XS map hit a flagged page
+
+// e132xs.cpp
+UINT32 E132XSDrcReadByte(UINT32 a);
+UINT32 E132XSDrcReadWord(UINT32 a);
+UINT32 E132XSDrcReadLong(UINT32 a);
+void E132XSDrcWriteByte(UINT32 a, UINT32 d);
+void E132XSDrcWriteWord(UINT32 a, UINT32 d);
+void E132XSDrcWriteLong(UINT32 a, UINT32 d);
+UINT32 E132XSDrcIORead(UINT32 a);				// raw address, as IO_READ_W() takes it
+void E132XSDrcIOWrite(UINT32 a, UINT32 d);
+INT32 E132XSDrcCheckInterrupts();				// m_intblock ran out, non-zero if an interrupt was taken
+INT32 E132XSDrcStep();							// one instruction on the interpreter, non-zero when translated code has to stop
+
+#endif
+
+#endif
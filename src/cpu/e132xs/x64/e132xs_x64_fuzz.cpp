@@ -0,0 +1,356 @@
+// Differential test for the Hyperstone recompiler: every seed runs the same random code and
+// the same timeslices twice, first on the interpreter and then on the recompiler, and the
+// state after each timeslice (everything E132XSScan() saves, the handler accesses and now and
+// then the memory) must come out the same both times.
+//
+// Build and run from src/burner/libretro (x86-64 hosts):
+//   g++ -O2 -std=gnu++11 -DLSB_FIRST -D__LIBRETRO__ -DE132XS_X64_DRC -DXBYAK_NO_OP_NAMES \
+//     -I../../burn -I../../burn/devices -I../../burn/snd -I../../burner -I../../burner/libretro \
+//     -I../../burner/libretro/libretro-common/include \
+//     -I../../cpu -I../../intf -I../../intf/input -I../../intf/cd -I../../intf/audio \
+//     ../../cpu/e132xs/x64/e132xs_x64.cpp ../../cpu/e132xs/x64/e132xs_x64_fuzz.cpp \
+//     -no-pie -Wl,--unresolved-symbols=ignore-all -o e132xs_x64_fuzz
+//   ./e132xs_x64_fuzz [first seed] [seeds] [timeslices]
+//
+// Code in ram is changed under the recompiler by everything that isn't its own store: a write
+// handler poking the host memory and the test itself between timeslices.  A write handler also
+// switches a code bank, raises irqs and ends the run.
+
+#include "../e132xs.cpp"
+
+#include <vector>
+
+bool bBurnUseE132XSRecompiler = false;
+bool bBurnProfile = false;
+void BurnProfileEnter(INT32) {}
+void BurnProfileLeave() {}
+void CpuCheatRegister(INT32, cpu_core_config*) {}
+
+static INT32 __cdecl FuzzPrintf(INT32, TCHAR* szFormat, ...)
+{
+	va_list vl;
+	va_start(vl, szFormat);
+	vprintf(szFormat, vl);
+	va_end(vl);
+	return 0;
+}
+
+INT32 (__cdecl *bprintf) (INT32 nStatus, TCHAR* szFormat, ...) = FuzzPrintf;
+
+static UINT32 nScanHash;
+
+static INT32 __cdecl FuzzAcb(struct BurnArea* pba)
+{
+	UINT8* p = (UINT8*)pba->Data;
+	for (UINT32 i = 0; i < pba->nLen; i++) {
+		nScanHash = nScanHash * 31 + p[i];
+	}
+	return 0;
+}
+
+INT32 (__cdecl *BurnAcb) (struct BurnArea* pba) = FuzzAcb;
+
+#define RAM_SIZE	0x100000			// at 0
+#define BANK_SIZE	0x40000				// 64k at 0x00100000, four banks
+#define ROM_SIZE	0x1000				// at 0xfffff000, the trap entries
+#define CODE_LEN	0x8000				// code at the start of ram, data after it
+
+static UINT8* Ram;
+static UINT8* Bank;
+static UINT8* Rom;
+static UINT32 nHash;
+static UINT32 nReads;
+static UINT32 nSeed;
+
+static UINT32 Rand()
+{
+	nSeed = nSeed * 1103515245 + 12345;
+	return (nSeed >> 8) ^ (nSeed << 20);
+}
+
+static void Put16(UINT8* m, UINT32 a, UINT16 w)
+{
+	*(UINT16*)(m + a) = w;
+}
+
+static void Put32(UINT8* m, UINT32 a, UINT32 l)
+{
+	*(UINT32*)(m + a) = (l << 16) | (l >> 16);
+}
+
+// ----------------------------------------------------------------------------
+// Handlers
+
+static UINT32 HandlerRead(UINT32 a)
+{
+	nReads++;
+	nHash = nHash * 31 + a + E132XSGetPC(0) * 3 + (UINT32)E132XSTotalCycles();
+	return (a * 2654435761u) ^ (nReads * 40503);
+}
+
+static void HandlerWrite(UINT32 a, UINT32 d)
+{
+	nHash = nHash * 31 + a * 7 + d + E132XSGetPC(0) * 3 + (UINT32)E132XSTotalCycles() * 11;
+
+	switch (a & 0xf0) {
+		case 0x10:
+			E132XSRunEnd();
+			break;
+
+		case 0x20:
+			E132XSMapMemory(Bank + (d & 3) * 0x10000, 0x00100000, 0x0010ffff, MAP_RAM);
+			break;
+
+		case 0x30:
+			E132XSBurnCycles(d & 63);
+			break;
+
+		case 0x40:
+			E132XSRunEndBurnAllCycles();
+			break;
+
+		case 0x50:
+			E132XSSetIRQLine(d & 3, CPU_IRQSTATUS_HOLD);
+			break;
+
+		default:
+			if (a & 0x80) {
+				// the driver changes code in ram, away from the block that is running (the
+				// interpreter would see the write before the block is done, we wouldn't)
+				UINT32 o = ((a * 0x9e3779b1) ^ d) & (CODE_LEN - 2);
+				UINT32 pc = E132XSGetPC(0);
+				if ((UINT32)(o - pc + 0x400) > 0x800) {
+					Put16(Ram, o, d ^ (a << 8));
+				}
+			}
+			break;
+	}
+}
+
+static UINT8 HandlerReadByte(UINT32 a)				{ return HandlerRead(a); }
+static UINT16 HandlerReadWord(UINT32 a)				{ return HandlerRead(a); }
+static UINT32 HandlerReadLong(UINT32 a)				{ return HandlerRead(a); }
+static void HandlerWriteByte(UINT32 a, UINT8 d)		{ HandlerWrite(a, d); }
+static void HandlerWriteWord(UINT32 a, UINT16 d)	{ HandlerWrite(a, d); }
+static void HandlerWriteLong(UINT32 a, UINT32 d)	{ HandlerWrite(a, d); }
+static UINT32 HandlerIORead(UINT32 a)				{ return HandlerRead(a ^ 0x5000); }
+static void HandlerIOWrite(UINT32 a, UINT32 d)		{ HandlerWrite(a | 0x7000000, d); }
+
+// ----------------------------------------------------------------------------
+// Random code
+
+// opcode byte ranges we want plenty of
+static const UINT8 Ops[][2] = {
+	{ 0x04, 0x07 }, { 0x14, 0x1f }, { 0x20, 0x5f }, { 0x20, 0x3f }, { 0x60, 0x7f }, { 0x60, 0x7f }, { 0x8e, 0x8e },
+	{ 0x90, 0x9f }, { 0x90, 0x9f }, { 0xa0, 0xab }, { 0xb0, 0xb7 }, { 0xbc, 0xbf }, { 0xd0, 0xdf },
+	{ 0xe0, 0xec }, { 0xee, 0xef }, { 0xf0, 0xfc }, { 0xf0, 0xfb }, { 0x00, 0xff },
+};
+
+static void MakeCode(UINT8* m, UINT32 nStart, UINT32 nLen)
+{
+	for (UINT32 a = nStart; a < nStart + nLen; a += 2) {
+		UINT32 r = Rand();
+		INT32 t = Rand() % (sizeof(Ops) / sizeof(Ops[0]));
+		UINT8 o = Ops[t][0] + Rand() % (Ops[t][1] - Ops[t][0] + 1);
+		UINT16 w;
+
+		if ((r & 7) == 0) {
+			w = Rand();													// extension words, mostly
+		} else if ((r & 7) == 1) {
+			w = (o << 8) | (Rand() & 0x77);								// low registers
+		} else if ((r & 31) == 2 && o >= 0xf0 && o <= 0xfb) {
+			w = (o << 8) | 0x01 | (0x7e - (Rand() & 0x0e));				// short backward branch
+		} else if ((r & 7) == 3 && o >= 0x90 && o <= 0x9f) {
+			Put16(m, a, (o << 8) | (Rand() & 0xff));
+			if (a + 2 >= nStart + nLen) break;
+			a += 2;
+			w = Rand() & 0x300f;										// small displacement
+		} else {
+			w = (o << 8) | (Rand() & 0xff);
+		}
+		Put16(m, a, w);
+	}
+}
+
+static UINT32 MakeValue()
+{
+	UINT32 k = Rand() & 15;
+	if (k < 6) return (Rand() & 0xffffc) + (((Rand() & 3) == 0) ? (Rand() & 3) : 0);
+	if (k < 8) return 0x00100000 + (Rand() & 0xfffc);
+	if (k < 10) return 0x40000000 + (Rand() & 0xfc);
+	if (k < 11) return 0xc0000000 + (Rand() & 0x1ffc);
+	if (k < 13) return Rand() & 0xff;
+	return Rand();
+}
+
+static UINT32 HashMemory()
+{
+	UINT32 h = 0;
+	for (INT32 i = 0; i < RAM_SIZE; i += 4) {
+		h = h * 31 + *(UINT32*)(Ram + i);
+	}
+	for (INT32 i = 0; i < BANK_SIZE; i += 4) {
+		h = h * 31 + *(UINT32*)(Bank + i);
+	}
+	return h;
+}
+
+// ----------------------------------------------------------------------------
+// The state after a timeslice
+
+struct FuzzState {
+	INT32 nDone;
+	UINT32 nPC, nSR;
+	UINT32 nScan;
+	UINT32 nHash, nReads;
+	UINT32 nMemory;
+};
+
+// one pass over the seed's timeslices, on the interpreter or the recompiler
+static INT32 RunPass(UINT32 nTestSeed, INT32 nSlices, bool bRecompiler, std::vector<FuzzState>& States)
+{
+	nSeed = nTestSeed;
+	nHash = nReads = 0;
+
+	memset(Ram, 0, RAM_SIZE);
+	MakeCode(Ram, 0, CODE_LEN);
+	for (INT32 i = CODE_LEN; i < RAM_SIZE; i += 4) {
+		Put32(Ram, i, (Rand() & 7) ? (Rand() & 0xff) : MakeValue());
+	}
+	MakeCode(Bank, 0, BANK_SIZE);
+	for (INT32 i = 0; i < ROM_SIZE; i += 2) {
+		Put16(Rom, i, 0x0500);											// trap entries: ret
+	}
+
+	bBurnUseE132XSRecompiler = bRecompiler;
+	E132XSInit(0, TYPE_E132XT, 50000000);
+	if (bRecompiler && pE132XSDrcCode == NULL) {
+		printf("seed %u: no recompiler\n", nTestSeed);
+		E132XSExit();
+		return 1;
+	}
+
+	E132XSMapMemory(Ram, 0x00000000, 0x000fffff, MAP_RAM);
+	E132XSMapMemory(Bank, 0x00100000, 0x0010ffff, MAP_RAM);
+	E132XSMapMemory(Rom, 0xfffff000, 0xffffffff, MAP_ROM);
+	E132XSSetReadByteHandler(HandlerReadByte);
+	E132XSSetReadWordHandler(HandlerReadWord);
+	E132XSSetReadLongHandler(HandlerReadLong);
+	E132XSSetWriteByteHandler(HandlerWriteByte);
+	E132XSSetWriteWordHandler(HandlerWriteWord);
+	E132XSSetWriteLongHandler(HandlerWriteLong);
+	E132XSSetIOReadHandler(HandlerIORead);
+	E132XSSetIOWriteHandler(HandlerIOWrite);
+	E132XSReset();
+
+	// E132XSInit() / E132XSReset() leave these as the last pass had them
+	m_tr_base_cycles = 0;
+	m_tr_base_value = 0;
+	memset(internal_ram, 0, sizeof(internal_ram));
+	memset(&m_delay, 0, sizeof(m_delay));
+
+	INT32 nRet = 0;
+	for (INT32 n = 0; n < nSlices; n++) {
+		if ((n & 1) == 0 || (Rand() & 3) == 0) {
+			// somewhere else in the code, with fresh registers
+			PC = (Rand() & 3) ? (Rand() & (CODE_LEN - 2)) : (0x00100000 + (Rand() & 0xfffe));
+			for (INT32 i = 2; i < 16; i++) {
+				m_global_regs[i] = MakeValue();
+			}
+			for (INT32 i = 0; i < 64; i++) {
+				m_local_regs[i] = MakeValue();
+			}
+			SR = (Rand() & 0xfe00000f) | ((Rand() & 7) << 21) | 0x00040000 | ((Rand() & 3) ? 0x8000 : 0);
+			m_delay.delay_cmd = NO_DELAY;
+			m_intblock = Rand() % 3;
+			sleep_until_int = 0;
+			SP = 0x80000 + (Rand() & 0x1fc);
+			UB = 0xf0000;
+			FCR = (Rand() & 1) ? ~0 : (Rand() & 0x80b00000);
+			if ((Rand() & 3) == 0) {
+				set_global_register(TPR_REGISTER, (Rand() & 0x0c0f0000) | ((Rand() & 1) << 31));
+				set_global_register(TCR_REGISTER, compute_tr() + (Rand() & 0xff));
+			}
+		}
+
+		if ((Rand() & 7) == 0) {
+			E132XSSetIRQLine(Rand() & 3, (Rand() & 1) ? CPU_IRQSTATUS_HOLD : CPU_IRQSTATUS_NONE);
+		}
+		if ((Rand() & 15) == 0) {
+			E132XSSetIRQLine(Rand() & 3, CPU_IRQSTATUS_ACK);
+		}
+
+		if ((Rand() & 3) == 0) {
+			// code changed behind the cpu's back
+			MakeCode(Ram, Rand() & (CODE_LEN - 0x40), 0x40);
+		}
+
+		FuzzState s;
+		s.nDone = E132XSRun(1 + (Rand() % 3000));
+		s.nPC = PC;
+		s.nSR = SR;
+		nScanHash = 0;
+		E132XSScan(ACB_READ);
+		s.nScan = nScanHash;
+		s.nHash = nHash;
+		s.nReads = nReads;
+		s.nMemory = ((n & 15) == 15) ? HashMemory() : 0;
+
+		if (!bRecompiler) {
+			States.push_back(s);
+		} else if (memcmp(&s, &States[n], sizeof(s))) {
+			FuzzState& i = States[n];
+			printf("seed %u timeslice %d: states differ\n", nTestSeed, n);
+			printf("  done   %8d %8d\n", i.nDone, s.nDone);
+			printf("  pc     %08x %08x\n", i.nPC, s.nPC);
+			printf("  sr     %08x %08x\n", i.nSR, s.nSR);
+			printf("  scan   %08x %08x\n", i.nScan, s.nScan);
+			printf("  hash   %08x %08x\n", i.nHash, s.nHash);
+			printf("  reads  %8d %8d\n", i.nReads, s.nReads);
+			printf("  memory %08x %08x\n", i.nMemory, s.nMemory);
+			nRet = 1;
+			break;
+		}
+
+		if ((n % 500) == 250) {
+			E132XSNewFrame();
+		}
+	}
+
+	E132XSExit();
+
+	return nRet;
+}
+
+static INT32 RunSeed(UINT32 nTestSeed, INT32 nSlices)
+{
+	std::vector<FuzzState> States;
+
+	RunPass(nTestSeed, nSlices, false, States);
+
+	return RunPass(nTestSeed, nSlices, true, States);
+}
+
+int main(int argc, char** argv)
+{
+	UINT32 nFirst = (argc > 1) ? atoi(argv[1]) : 1;
+	INT32 nSeeds = (argc > 2) ? atoi(argv[2]) : 20;
+	INT32 nSlices = (argc > 3) ? atoi(argv[3]) : 2000;
+
+	Ram = (UINT8*)malloc(RAM_SIZE);
+	Bank = (UINT8*)malloc(BANK_SIZE);
+	Rom = (UINT8*)malloc(ROM_SIZE);
+
+	INT32 nFailed = 0;
+	for (INT32 i = 0; i < nSeeds; i++) {
+		nFailed += RunSeed(nFirst + i, nSlices);
+	}
+
+	printf("%d of %d seeds passed\n", nSeeds - nFailed, nSeeds);
+
+	free(Ram);
+	free(Bank);
+	free(Rom);
+
+	return nFailed ? 1 : 0;
+}
@@ -235,6 +235,8 @@ int h6280Run(int cycles)
 	if (nh6280CpuActive == -1) bprintf(PRINT_ERROR, _T("h6280Run called with no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	int in;
 	h6280_ICount = cycles;
 	h6280.h6280_iCycles = cycles;
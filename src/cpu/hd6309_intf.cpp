@@ -341,6 +341,8 @@ INT32 HD6309Run(INT32 cycles)
 	if (nActiveCPU == -1) bprintf(PRINT_ERROR, _T("HD6309Run called when no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	cycles = hd6309_execute(cycles);
 	
 	nHD6309CyclesTotal += cycles;
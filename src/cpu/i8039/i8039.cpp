@@ -926,6 +926,8 @@ int I8039Run(int cycles)
 	if (!DebugCPU_I8039Initted) bprintf(PRINT_ERROR, _T("I8039Run called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	UINT8 opcode, T1, timerInt;
 	int count;
 
@@ -2015,6 +2015,8 @@ void mcs51_set_irq_line(int irqline, int state)
 /* Execute cycles - returns number of cycles actually run */
 INT32 mcs51Run(int cycles) // divide cycles by 12! -dink
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	UINT8 op;
 
 	mcs51_state->icount = cycles;
@@ -514,6 +514,8 @@ int konamiRun(int cycles)
 	if (!DebugCPU_KonamiInitted) bprintf(PRINT_ERROR, _T("konamiRun called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	konami_ICount = cycles - konami.extra_cycles;
 	nCyclesToDo = cycles;
 	konami.extra_cycles = 0;
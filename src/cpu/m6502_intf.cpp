@@ -452,6 +452,8 @@ INT32 M6502Run(INT32 cycles)
 	if (nActiveCPU == -1) bprintf(PRINT_ERROR, _T("M6502Run called with no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	INT32 nDelayed = 0;  // handle delayed cycle counts (from M6502Stall())
 
 	while (pCurrentCPU->nCyclesStall && cycles) {
@@ -3,6 +3,7 @@
 #include "burnint.h"
 #include "m68000_intf.h"
 #include "m68000_debug.h"
+#include "m68k/x64/m68k_x64.h"
 
 #ifdef EMU_M68K
 INT32 nSekM68KContextSize[SEK_MAX];
@@ -252,6 +253,15 @@ DEFLONGHANDLERS(0)
 // Mapped Memory lookup (+ SEK_WADD * 2 for fetch)
 #define FIND_F(x) pSekExt->MemMap[(x >> SEK_SHIFT) + SEK_WADD * 2]
 
+// A write that may have hit 68000 code the recompiler translated
+#if defined M68K_X64_DRC
+ #define DRC_WRITE(a, n) if (pM68KDrcCode && pM68KDrcCode[(a) >> SEK_SHIFT]) M68KDrcWrite(a, n)
+ #define DRC_WRITE_HOST(p, n) if (pM68KDrcCode) M68KDrcWriteHost(p, n)
+#else
+ #define DRC_WRITE(a, n)
+ #define DRC_WRITE_HOST(p, n)
+#endif
+
 // Normal memory access functions
 inline static UINT8 ReadByte(UINT32 a)
 {
@@ -295,11 +305,12 @@ inline static void WriteByte(UINT32 a, UINT8 d)
 
 	pr = FIND_W(a);
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
-		a ^= 1;
-		pr[a & SEK_PAGEM] = (UINT8)d;
+		pr[(a ^ 1) & SEK_PAGEM] = (UINT8)d;
+		DRC_WRITE(a, 1);
 		return;
 	}
 	pSekExt->WriteByte[(uintptr_t)pr](a, d);
+	DRC_WRITE(a, 1);
 }
 
 inline static void WriteByteROM(UINT32 a, UINT8 d)
@@ -312,6 +323,7 @@ inline static void WriteByteROM(UINT32 a, UINT8 d)
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
 		a ^= 1;
 		pr[a & SEK_PAGEM] = (UINT8)d;
+		DRC_WRITE_HOST(pr + (a & SEK_PAGEM & ~1), 2);
 		return;
 	}
 	pSekExt->WriteByte[(uintptr_t)pr](a, d);
@@ -380,11 +392,13 @@ inline static void WriteWord(UINT32 a, UINT16 d)
 		else
 		{
 			*((UINT16*)(pr + (a & SEK_PAGEM))) = (UINT16)BURN_ENDIAN_SWAP_INT16(d);
+			DRC_WRITE(a, 2);
 			return;
 		}
 	}
 
 	pSekExt->WriteWord[(uintptr_t)pr](a, d);
+	DRC_WRITE(a, 2);
 }
 
 inline static void WriteWordROM(UINT32 a, UINT16 d)
@@ -396,6 +410,7 @@ inline static void WriteWordROM(UINT32 a, UINT16 d)
 	pr = FIND_R(a);
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
 		*((UINT16*)(pr + (a & SEK_PAGEM))) = (UINT16)d;
+		DRC_WRITE_HOST(pr + (a & SEK_PAGEM), 2);
 		return;
 	}
 	pSekExt->WriteWord[(uintptr_t)pr](a, d);
@@ -481,11 +496,13 @@ inline static void WriteLong(UINT32 a, UINT32 d)
 		{
 			d = (d >> 16) | (d << 16);
 			*((UINT32*)(pr + (a & SEK_PAGEM))) = BURN_ENDIAN_SWAP_INT32(d);
+			DRC_WRITE(a, 4);
 
 			return;
 		}
 	}
 	pSekExt->WriteLong[(uintptr_t)pr](a, d);
+	DRC_WRITE(a, 4);
 }
 
 inline static void WriteLongROM(UINT32 a, UINT32 d)
@@ -498,6 +515,7 @@ inline static void WriteLongROM(UINT32 a, UINT32 d)
 	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
 		d = (d >> 16) | (d << 16);
 		*((UINT32*)(pr + (a & SEK_PAGEM))) = d;
+		DRC_WRITE_HOST(pr + (a & SEK_PAGEM), 4);
 		return;
 	}
 	pSekExt->WriteLong[(uintptr_t)pr](a, d);
@@ -998,6 +1016,10 @@ void SekNewFrame()
 
 	nSekCyclesToDo = m68k_ICount = 0;
 	nSekCyclesTotal = 0;
+
+#if defined M68K_X64_DRC
+	M68KDrcVerify();
+#endif
 }
 
 void SekSetCyclesScanline(INT32 nCycles)
@@ -1153,6 +1175,12 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 
 	nSekAddressMask[nCount] = 0xffffff;
 
+#if defined M68K_X64_DRC && !defined FBNEO_DEBUG
+	if (bBurnUseM68KRecompiler && nCPUType == 0x68000) {
+		M68KDrcInit(nCount, SekExt[nCount]->MemMap, nSekAddressMask[nCount]);
+	}
+#endif
+
 	nSekCycles[nCount] = 0;
 	nSekCyclesToDoCache[nCount] = 0;
 	nSekm68k_ICount[nCount] = 0;
@@ -1208,6 +1236,10 @@ INT32 SekExit()
 		SekCPUExitM68K(i);
 #endif
 
+#if defined M68K_X64_DRC
+		M68KDrcExit(i);
+#endif
+
 		// Deallocate other context data
 		if (SekExt[i]) {
 			free(SekExt[i]);
@@ -1250,6 +1282,9 @@ void SekReset()
 	}
 #endif
 
+#if defined M68K_X64_DRC
+	M68KDrcVerify();
+#endif
 }
 
 void SekReset(INT32 nCPU)
@@ -1299,6 +1334,10 @@ void SekOpen(const INT32 i)
 		}
 #endif
 
+#if defined M68K_X64_DRC
+		M68KDrcOpen(nSekActive);
+#endif
+
 		nSekCyclesTotal = nSekCycles[nSekActive];
 
 		// Allow for SekRun() reentrance:
@@ -1335,6 +1374,10 @@ void SekClose()
 	nSekCyclesToDoCache[nSekActive] = nSekCyclesToDo;
 	nSekm68k_ICount[nSekActive] = m68k_ICount;
 
+#if defined M68K_X64_DRC
+	M68KDrcOpen(-1);
+#endif
+
 	nSekActive = -1;
 }
 
@@ -1663,6 +1706,10 @@ void SekRunEnd()
 		m68k_end_timeslice();
 #endif
 
+#if defined M68K_X64_DRC
+		M68KDrcRunEnd();
+#endif
+
 #ifdef EMU_A68K
 	}
 #endif
@@ -1677,6 +1724,8 @@ INT32 SekRun(const INT32 nCycles)
 	if (nSekActive == -1) bprintf(PRINT_ERROR, _T("SekRun called when no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 #ifdef EMU_A68K
 	if (nSekCPUType[nSekActive] == 0) {
 		nSekCyclesDone = 0;
@@ -1711,7 +1760,11 @@ INT32 SekRun(const INT32 nCycles)
 		}
 		else
 		{
+#if defined M68K_X64_DRC
+			nSekCyclesSegment = pM68KDrcCode ? M68KDrcRun(nCycles) : m68k_execute(nCycles);
+#else
 			nSekCyclesSegment = m68k_execute(nCycles);
+#endif
 		}
 
 		nSekCyclesTotal += nSekCyclesSegment;
@@ -1927,6 +1980,10 @@ void SekSetAddressMask(UINT32 nAddressMask)
 #endif
 
 	nSekAddressMask[nSekActive] = nSekAddressMaskActive = nAddressMask;
+
+#if defined M68K_X64_DRC
+	M68KDrcSetAddressMask(nAddressMask);
+#endif
 }
 
 // Note - each page is 1 << SEK_BITS.
@@ -1947,6 +2004,10 @@ INT32 SekMapMemory(UINT8* pMemory, UINT32 nStart, UINT32 nEnd, INT32 nType)
 			pMemMap[SEK_WADD * 2] = Ptr + i;
 		}
 
+#if defined M68K_X64_DRC
+		M68KDrcMapChanged(nStart, nEnd);
+#endif
+
 		return 0;
 	}
 
@@ -1963,6 +2024,10 @@ INT32 SekMapMemory(UINT8* pMemory, UINT32 nStart, UINT32 nEnd, INT32 nType)
 		}
 	}
 
+#if defined M68K_X64_DRC
+	M68KDrcMapChanged(nStart, nEnd);
+#endif
+
 	return 0;
 }
 
@@ -1989,6 +2054,10 @@ INT32 SekMapHandler(uintptr_t nHandler, UINT32 nStart, UINT32 nEnd, INT32 nType)
 		}
 	}
 
+#if defined M68K_X64_DRC
+	M68KDrcMapChanged(nStart, nEnd);
+#endif
+
 	return 0;
 }
 
@@ -2492,6 +2561,8 @@ INT32 SekScan(INT32 nAction)
 			ba.szName = szName;
 
 			if (nAction & ACB_READ) {
+				BurnStateCacheScanOnSave();
+
 				// Blank pointers
 				SekRegs[i]->IrqCallback = NULL;
 				SekRegs[i]->ResetCallback = NULL;
@@ -2523,5 +2594,11 @@ INT32 SekScan(INT32 nAction)
 
 	}
 
+#if defined M68K_X64_DRC
+	if (nAction & ACB_WRITE) {
+		M68KDrcVerify();
+	}
+#endif
+
 	return 0;
 }
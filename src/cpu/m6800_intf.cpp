@@ -383,6 +383,8 @@ INT32 M6800Run(INT32 cycles)
 	if (nActiveCPU == -1) bprintf(PRINT_ERROR, _T("M6800Run called when no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	cycles = cpu_execute[nActiveCPU](cycles);
 
 	nM6800CyclesTotal += cycles;
@@ -344,6 +344,8 @@ INT32 M6809Run(INT32 cycles)
 	if (nActiveCPU == -1) bprintf(PRINT_ERROR, _T("M6809Run called when no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	cycles = m6809_execute(cycles);
 	
 	m6809CPUContext[nActiveCPU].nCyclesTotal += cycles;
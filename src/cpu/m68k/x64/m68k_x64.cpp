@@ -0,0 +1,2465 @@
+// 68000 block recompiler for x86-64 hosts
+//
+// Runs on the Musashi context (m68ki_cpu / m68k_ICount), so save states, SekGetPC() & co,
+// interrupts and the debugger interface see exactly what the interpreter would leave behind.
+// Code is translated a block at a time out of the SekExt fetch map; memory operands go
+// straight through the SekExt read/write page tables and drop to the M68K* handlers for
+// handler pages and odd addresses.  Instructions we don't translate are run by calling the
+// Musashi opcode handler from inside the block.
+//
+// Stale code: Sek writes to pages holding translated code invalidate the blocks there, and
+// blocks translated from ram a 68000 can write compare their code on every entry, which
+// also catches dma, the other cpus and the driver.  Code elsewhere (rom) is checked at frame
+// start, reset and state load.
+//
+// Register use inside generated code:
+//   rbx = &m68ki_cpu, r12 = SekExt MemMap, r13 = &m68k_ICount, r14 = DrcHot
+//   rbp, r15 = callee saved temporaries that live across memory accesses
+//   eax = operand / result, ecx = address, edx, r8-r11 = scratch
+
+#ifdef M68K_X64_DRC
+
+#include "burnint.h"
+#include "m68000_intf.h"
+#include "m68k_x64.h"
+
+#include <deque>
+#include <vector>
+#include <unordered_map>
+
+#include "../../mips3/x64/xbyak/xbyak.h"
+
+extern "C" {
+#include "../m68kcpu.h"
+#include "../m68kops.h"
+}
+
+#define DRC_CODE_SIZE		(8 * 1024 * 1024)
+#define DRC_CODE_SLACK		(256 * 1024)			// room a single block may need
+#define DRC_CACHE_SIZE		4096					// direct mapped pc -> code cache (power of 2)
+#define DRC_MAX_INSNS		64						// instructions per block
+#define DRC_MAX_INSN_LEN	10
+
+#define DRC_BREAK_EXIT		1						// leave the block after this instruction
+#define DRC_BREAK_PC		2						// ... and REG_PC has been changed by a handler
+
+struct DrcBlock;
+
+struct DrcCacheEntry {
+	UINT32 nPC;
+	UINT32 nPad;
+	UINT8* pFetch;
+	void* pCode;
+	DrcBlock* pBlock;
+};
+
+// everything generated code touches besides m68ki_cpu, addressed through r14
+struct DrcHot {
+	UINT8 Code[SEK_PAGE_COUNT];					// must stay first
+	UINT32 nBreak;
+	UINT32 nPad;
+	UINT8** pMemMap;
+	DrcCacheEntry Cache[DRC_CACHE_SIZE];
+};
+
+#define HOT_BREAK			((INT32)offsetof(DrcHot, nBreak))
+#define HOT_MEMMAP			((INT32)offsetof(DrcHot, pMemMap))
+#define HOT_CACHE			((INT32)offsetof(DrcHot, Cache))
+
+class M68KDrc;
+
+struct DrcBlock {
+	UINT32 nPC;
+	UINT32 nPage;								// masked pc >> SEK_SHIFT
+	INT32 nLen;									// bytes of 68000 code covered
+	bool bDead;
+	bool bCheck;								// in ram: compared with pSource on every entry
+	UINT8* pFetch;								// fetch page it was translated from
+	UINT8* pHost;								// first byte of its code in host memory
+	UINT8* pSource;								// copy of that code
+	void* pCode;
+	M68KDrc* pOwner;
+};
+
+// host address >> SEK_SHIFT -> blocks (of every cpu) whose code lives there
+static std::unordered_map<uintptr_t, std::vector<DrcBlock*> > DrcChunks;
+
+static M68KDrc* DrcCPU[SEK_MAX] = { NULL, };
+static M68KDrc* pDrcActive = NULL;
+UINT8* pM68KDrcCode = NULL;
+
+// memory handlers, called from generated code
+static UINT32 DrcRead8(UINT32 a)			{ return m68k_read_memory_8(a); }
+static UINT32 DrcRead16(UINT32 a)			{ return m68k_read_memory_16(a); }
+static UINT32 DrcRead32(UINT32 a)			{ return m68k_read_memory_32(a); }
+static UINT32 DrcFetch8(UINT32 a)			{ return m68k_read_pcrelative_8(a); }
+static UINT32 DrcFetch16(UINT32 a)			{ return m68k_read_pcrelative_16(a); }
+static UINT32 DrcFetch32(UINT32 a)			{ return m68k_read_pcrelative_32(a); }
+static void DrcWrite8(UINT32 a, UINT32 d)	{ m68k_write_memory_8(a, d); }
+static void DrcWrite16(UINT32 a, UINT32 d)	{ m68k_write_memory_16(a, d); }
+static void DrcWrite32(UINT32 a, UINT32 d)	{ m68k_write_memory_32(a, d); }
+
+// ----------------------------------------------------------------------------
+// Instruction decoding helpers
+
+// effective address kinds, one bit each in the EA_* class masks below
+enum { EK_DN = 0, EK_AN, EK_AI, EK_PI, EK_PD, EK_DI, EK_IX, EK_AW, EK_AL, EK_PCDI, EK_PCIX, EK_IMM };
+
+#define EA_ALL		0xfff
+#define EA_DATA		(EA_ALL & ~(1 << EK_AN))
+#define EA_ALT		0x1ff
+#define EA_DALT		(EA_ALT & ~(1 << EK_AN))
+#define EA_MALT		(EA_DALT & ~(1 << EK_DN))
+#define EA_CTRL		((1 << EK_AI) | (1 << EK_DI) | (1 << EK_IX) | (1 << EK_AW) | (1 << EK_AL) | (1 << EK_PCDI) | (1 << EK_PCIX))
+
+static INT32 EaKind(INT32 nMode, INT32 nReg)
+{
+	if (nMode < 7) return nMode;
+	return (nReg <= 4) ? (EK_AW + nReg) : -1;
+}
+
+static bool EaAllowed(INT32 nEa, INT32 nClass)
+{
+	INT32 k = EaKind((nEa >> 3) & 7, nEa & 7);
+	return k >= 0 && (nClass & (1 << k));
+}
+
+// bytes of extension words used by an effective address
+static INT32 EaLen(INT32 nEa, INT32 nSize)
+{
+	switch (EaKind((nEa >> 3) & 7, nEa & 7)) {
+		case EK_DI: case EK_IX: case EK_AW: case EK_PCDI: case EK_PCIX:
+			return 2;
+		case EK_AL:
+			return 4;
+		case EK_IMM:
+			return (nSize == 4) ? 4 : 2;
+	}
+	return 0;
+}
+
+static const INT32 nSizeOf[4] = { 1, 2, 4, 0 };
+
+// length of a 68000 instruction in bytes, 0 if we can't tell
+static INT32 InsnLength(UINT16 op)
+{
+	INT32 nEa = op & 0x3f;
+	INT32 nSize = nSizeOf[(op >> 6) & 3];
+
+	switch (op >> 12) {
+		case 0x0:
+			if ((op & 0x0138) == 0x0108) return 4;										// movep
+			if (op & 0x0100) return 2 + EaLen(nEa, 1);									// btst/bchg/bclr/bset Dn
+			if ((op & 0x0f00) == 0x0800) return 4 + EaLen(nEa, 1);						// btst/bchg/bclr/bset #
+			if ((op & 0x0f00) == 0x0e00 || (op & 0x0f00) == 0x0800 || nSize == 0) return 0;
+			if (nEa == 0x3c) return 4;													// to ccr/sr
+			return 2 + ((nSize == 4) ? 4 : 2) + EaLen(nEa, nSize);
+
+		case 0x1: return 2 + EaLen(nEa, 1) + EaLen(((op >> 9) & 7) | ((op >> 3) & 0x38), 1);
+		case 0x2: return 2 + EaLen(nEa, 4) + EaLen(((op >> 9) & 7) | ((op >> 3) & 0x38), 4);
+		case 0x3: return 2 + EaLen(nEa, 2) + EaLen(((op >> 9) & 7) | ((op >> 3) & 0x38), 2);
+
+		case 0x4:
+			switch (op) {
+				case 0x4e70: case 0x4e71: case 0x4e73: case 0x4e75: case 0x4e76: case 0x4e77: case 0x4afc:
+					return 2;
+				case 0x4e72:
+					return 4;
+			}
+			if ((op & 0xfff0) == 0x4e40 || (op & 0xfff0) == 0x4e60) return 2;			// trap, move usp
+			if ((op & 0xfff8) == 0x4e50) return 4;										// link
+			if ((op & 0xfff8) == 0x4e58) return 2;										// unlk
+			if ((op & 0xff80) == 0x4e80) return 2 + EaLen(nEa, 4);						// jsr, jmp
+			if ((op & 0xfb80) == 0x4880) return (nEa < 8) ? 2 : (4 + EaLen(nEa, 2));	// ext, movem
+			if ((op & 0xfff8) == 0x4840) return 2;										// swap
+			if ((op & 0xffc0) == 0x4840) return 2 + EaLen(nEa, 4);						// pea
+			if ((op & 0xffc0) == 0x4800) return 2 + EaLen(nEa, 1);						// nbcd
+			if ((op & 0x01c0) == 0x01c0) return 2 + EaLen(nEa, 4);						// lea
+			if ((op & 0x01c0) == 0x0180) return 2 + EaLen(nEa, 2);						// chk
+			switch (op & 0xff00) {
+				case 0x4000: case 0x4200: case 0x4400: case 0x4600: case 0x4a00:
+					if (nSize) return 2 + EaLen(nEa, nSize);
+					if ((op & 0xff00) == 0x4a00) return 2 + EaLen(nEa, 1);				// tas
+					if ((op & 0xff00) != 0x4200) return 2 + EaLen(nEa, 2);				// move sr/ccr
+					return 0;
+			}
+			return 0;
+
+		case 0x5:
+			if ((op & 0xc0) != 0xc0) return 2 + EaLen(nEa, nSize);						// addq, subq
+			if ((op & 0x38) == 0x08) return 4;											// dbcc
+			return 2 + EaLen(nEa, 1);													// scc
+
+		case 0x6:
+			if ((op & 0xff) == 0x00) return 4;
+			if ((op & 0xff) == 0xff) return 0;
+			return 2;
+
+		case 0x7:
+			return 2;
+
+		case 0x8: case 0x9: case 0xb: case 0xc: case 0xd:
+			if ((op & 0x00c0) == 0x00c0) {												// div, mul, adda, suba, cmpa
+				return 2 + EaLen(nEa, (op & 0x0100) && (op >> 12) != 0x8 && (op >> 12) != 0xc ? 4 : 2);
+			}
+			if ((op & 0x0130) == 0x0100) return 2;										// abcd, sbcd, addx, subx, cmpm, exg
+			return 2 + EaLen(nEa, nSize);
+
+		case 0xe:
+			if ((op & 0x00c0) == 0x00c0) return 2 + EaLen(nEa, 2);
+			return 2;
+	}
+
+	return 0;
+}
+
+// ----------------------------------------------------------------------------
+// The recompiler
+
+enum { STUB_READ, STUB_FETCH, STUB_WRITE, STUB_EXIT };
+
+struct DrcStub {
+	Xbyak::Label lFrom, lBack;
+	INT32 nType;
+	INT32 nSize;
+	UINT32 nPPC, nPC, nIR, nPref;
+	bool bCall;
+	bool bLivePref;
+};
+
+#define CPU_OFS(f)		((INT32)offsetof(m68ki_cpu_core, f))
+#define CPU_DA(n)		dword[rbx + CPU_OFS(dar) + (n) * 4]
+#define CPU_D(n)		CPU_DA(n)
+#define CPU_A(n)		CPU_DA(8 + (n))
+#define CPU_REG(f)		dword[rbx + CPU_OFS(f)]
+
+class M68KDrc : public Xbyak::CodeGenerator
+{
+public:
+	M68KDrc(INT32 nCPU, UINT8** pMemMap, UINT32 nAddressMask);
+	~M68KDrc();
+
+	INT32 Run(INT32 nCycles);
+	void SetAddressMask(UINT32 nMask);
+	void MapChanged(UINT32 nStart, UINT32 nEnd);
+	void Verify();
+	void CheckHost(UINT8* p, INT32 nLen);
+	void Invalidate(DrcBlock* b);
+	void CodeAdded(uintptr_t nChunk);
+	void Flush();
+
+	DrcHot* pHot;
+	bool bVerifyPending;
+
+private:
+	void* Find(UINT32 nPC);
+	DrcBlock* Compile(UINT32 nPC, UINT8* pFetch);
+	void Step();
+	void EmitCommon();
+	void EmitDispatch(Xbyak::Label& lDispatch, Xbyak::Label& lMiss);
+	bool PageHasCode(INT32 nPage);
+	void ComputeCode(INT32 nFirst, INT32 nLast);
+	void Forget(DrcBlock* b);
+	void EmitCheck(DrcBlock* b, const void* pBody);
+
+	// translation
+	UINT32 Word(UINT32 nPC) { return BURN_ENDIAN_SWAP_INT16(*(UINT16*)(m_pPage + (nPC - m_nPageBase))); }
+	UINT32 Ext16() { UINT32 w = Word(m_nPC); m_nPC += 2; return w; }
+	UINT32 Ext32() { UINT32 w = Ext16() << 16; return w | Ext16(); }
+
+	INT32 CompileInsn();
+	INT32 CompileFallback();
+	INT32 CompileLine0();
+	INT32 CompileMove();
+	INT32 CompileLine4();
+	INT32 CompileLine5();
+	INT32 CompileBranch();
+	INT32 CompileArith();
+	INT32 CompileShift();
+
+	DrcStub& NewStub(INT32 nType, INT32 nSize);
+	void EmitStubs();
+	void MemRead(INT32 nSize, bool bPcRel);
+	void MemWrite(INT32 nSize);
+	void EaCalc(INT32 nEa, INT32 nSize);
+	void EaIndex(UINT32 nExt);
+	void EaLoad(INT32 nEa, INT32 nSize, bool bKeep);
+	void EaStore(INT32 nEa, INT32 nSize);
+	void LoadReg(const Xbyak::Reg32& r, INT32 nReg, INT32 nSize);
+	void StoreReg(INT32 nReg, INT32 nSize);
+	void PushLong();
+	void FlagsNZ(INT32 nSize);
+	void FlagsLogic(INT32 nSize);
+	void FlagsAdd(INT32 nSize, bool bX);
+	void FlagsSub(INT32 nSize, bool bX);
+	void FlagsNeg(INT32 nSize);
+	void Cond(INT32 nCC, Xbyak::Label& lFalse);
+	void EndInsn(INT32 nCycles);
+	void EndBranch(UINT32 nTarget, INT32 nCycles);
+	void EndJump(INT32 nCycles);
+
+	INT32 m_nCPU;
+	UINT32 m_nSekMask;							// SekSetAddressMask()
+	UINT32 m_nDataMask;							// & the cpu's address bus
+	bool m_bUsable;
+	INT32 m_nDepth;
+	bool m_bFlushPending;
+
+	void (*m_pEntry)(void*, DrcHot*);
+	Xbyak::Label* m_plExit;						// prefetch registers are as the interpreter left them
+	Xbyak::Label* m_plExitNative;				// leaving after translated code, prefetch is stale
+	Xbyak::Label* m_plDispatch;
+	Xbyak::Label* m_plDispatchPref;
+
+	std::unordered_multimap<UINT32, DrcBlock*> m_Blocks;
+	std::unordered_map<UINT32, std::vector<DrcBlock*> > m_Pages;
+	std::vector<DrcBlock*> m_Dead;
+
+	// state of the block being translated
+	UINT8* m_pPage;
+	UINT32 m_nPageBase, m_nPageEnd;
+	UINT32 m_nBlockPC, m_nCoverEnd;
+	UINT32 m_nPC, m_nInsnPC, m_nOp;
+	INT32 m_nCycles;
+	bool m_bCall;
+	bool m_bLivePref;
+	bool m_bEaConst;
+	UINT32 m_nEaConst;
+	std::deque<DrcStub> m_Stubs;
+	std::vector<std::pair<UINT32, const UINT8*> > m_Insns;
+};
+
+M68KDrc::M68KDrc(INT32 nCPU, UINT8** pMemMap, UINT32 nAddressMask) : CodeGenerator(DRC_CODE_SIZE)
+{
+	m_nCPU = nCPU;
+	m_nDepth = 0;
+	m_bFlushPending = false;
+	m_plExit = NULL;
+	m_plExitNative = NULL;
+	m_plDispatch = NULL;
+	m_plDispatchPref = NULL;
+
+	pHot = new DrcHot;
+	memset(pHot->Code, 0, sizeof(pHot->Code));
+	pHot->nBreak = 0;
+	pHot->pMemMap = pMemMap;
+	bVerifyPending = false;
+
+	SetAddressMask(nAddressMask);
+	Flush();
+}
+
+M68KDrc::~M68KDrc()
+{
+	m_bFlushPending = true;
+	m_nDepth = 0;
+	Flush();
+
+	delete m_plExit;
+	delete m_plExitNative;
+	delete m_plDispatch;
+	delete m_plDispatchPref;
+	delete pHot;
+}
+
+void M68KDrc::SetAddressMask(UINT32 nMask)
+{
+	m_nSekMask = nMask;
+	m_nDataMask = nMask & 0xffffff;				// 68000 address bus
+
+	// the page tables only work when a page is contiguous in 68000 space
+	m_bUsable = (m_nDataMask & SEK_PAGEM) == SEK_PAGEM;
+
+	m_bFlushPending = true;
+	pHot->nBreak |= DRC_BREAK_EXIT;
+}
+
+// ----------------------------------------------------------------------------
+// Block bookkeeping
+
+// ram some 68000 writes directly: dma, the other cpus and the driver can change it too,
+// and their writes don't come through the Sek handlers
+static bool DrcRamBacked(UINT8* p, INT32 nLen)
+{
+	for (INT32 n = 0; n < SEK_MAX; n++) {
+		if (DrcCPU[n] == NULL) continue;
+
+		UINT8** pMemMap = DrcCPU[n]->pHot->pMemMap;
+		for (INT32 i = 0; i < SEK_PAGE_COUNT; i++) {
+			UINT8* w = pMemMap[SEK_WADD + i];
+			if ((uintptr_t)w >= SEK_MAXHANDLER && w < p + nLen && p < w + SEK_PAGE_SIZE) return true;
+		}
+	}
+
+	return false;
+}
+
+// called from the entry check of a block whose code changed
+static void DrcStale(DrcBlock* b)
+{
+	b->pOwner->Invalidate(b);
+}
+
+void M68KDrc::Forget(DrcBlock* b)
+{
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.find(b->nPC); i != m_Blocks.end() && i->first == b->nPC; ++i) {
+		if (i->second == b) {
+			m_Blocks.erase(i);
+			break;
+		}
+	}
+
+	std::vector<DrcBlock*>& v = m_Pages[b->nPage];
+	for (UINT32 i = 0; i < v.size(); i++) {
+		if (v[i] == b) {
+			v.erase(v.begin() + i);
+			break;
+		}
+	}
+
+	for (uintptr_t k = (uintptr_t)b->pHost >> SEK_SHIFT; k <= ((uintptr_t)b->pHost + b->nLen - 1) >> SEK_SHIFT; k++) {
+		std::unordered_map<uintptr_t, std::vector<DrcBlock*> >::iterator c = DrcChunks.find(k);
+		if (c == DrcChunks.end()) continue;
+
+		for (UINT32 i = 0; i < c->second.size(); i++) {
+			if (c->second[i] == b) {
+				c->second.erase(c->second.begin() + i);
+				break;
+			}
+		}
+		if (c->second.empty()) DrcChunks.erase(c);
+	}
+
+	DrcCacheEntry& e = pHot->Cache[(b->nPC >> 1) & (DRC_CACHE_SIZE - 1)];
+	if (e.pBlock == b) {
+		e.nPC = ~0;
+		e.pFetch = (UINT8*)~(uintptr_t)0;
+		e.pBlock = NULL;
+	}
+}
+
+// The block's code is stale - it stays in the code buffer (it may be running) until the next flush
+void M68KDrc::Invalidate(DrcBlock* b)
+{
+	if (b->bDead) return;
+
+	b->bDead = true;
+	Forget(b);
+	m_Dead.push_back(b);
+
+	pHot->nBreak |= DRC_BREAK_EXIT;
+}
+
+void M68KDrc::Flush()
+{
+	if (m_nDepth > 1 || !m_bFlushPending) return;
+
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.begin(); i != m_Blocks.end(); ++i) {
+		m_Dead.push_back(i->second);
+	}
+	for (UINT32 i = 0; i < m_Dead.size(); i++) {
+		DrcBlock* b = m_Dead[i];
+		if (!b->bDead) {
+			b->bDead = true;
+			Forget(b);
+		}
+		free(b->pSource);
+		delete b;
+	}
+	m_Dead.clear();
+	m_Blocks.clear();
+	m_Pages.clear();
+
+	for (INT32 i = 0; i < DRC_CACHE_SIZE; i++) {
+		pHot->Cache[i].nPC = ~0;
+		pHot->Cache[i].pFetch = (UINT8*)~(uintptr_t)0;
+		pHot->Cache[i].pCode = NULL;
+		pHot->Cache[i].pBlock = NULL;
+	}
+
+	// not reset(): that restarts the label ids, and jumps to labels dropped by a failed
+	// translation are still waiting in xbyak's lists - a new label with their id would patch them
+	m_Stubs.clear();
+	delete m_plExit;
+	delete m_plExitNative;
+	delete m_plDispatch;
+	delete m_plDispatchPref;
+	setSize(0);
+	m_plExit = new Xbyak::Label;
+	m_plExitNative = new Xbyak::Label;
+	m_plDispatch = new Xbyak::Label;
+	m_plDispatchPref = new Xbyak::Label;
+	EmitCommon();
+
+	ComputeCode(0, SEK_PAGE_COUNT - 1);
+
+	m_bFlushPending = false;
+}
+
+// a write to this page may have to look for code: it's writable memory holding some
+// cpu's code, or a handler page whose fetch side is code
+bool M68KDrc::PageHasCode(INT32 nPage)
+{
+	UINT8* p = pHot->pMemMap[SEK_WADD + nPage];
+	INT32 nLen = SEK_PAGE_SIZE + 3;
+
+	if ((uintptr_t)p < SEK_MAXHANDLER) {
+		p = pHot->pMemMap[SEK_WADD * 2 + nPage];
+		nLen = SEK_PAGE_SIZE;
+		if ((uintptr_t)p < SEK_MAXHANDLER) return false;
+	}
+
+	for (uintptr_t k = (uintptr_t)p >> SEK_SHIFT; k <= ((uintptr_t)p + nLen - 1) >> SEK_SHIFT; k++) {
+		if (DrcChunks.count(k)) return true;
+	}
+
+	return false;
+}
+
+void M68KDrc::ComputeCode(INT32 nFirst, INT32 nLast)
+{
+	if (DrcChunks.empty()) {
+		memset(pHot->Code + nFirst, 0, nLast - nFirst + 1);
+		return;
+	}
+
+	for (INT32 i = nFirst; i <= nLast; i++) {
+		pHot->Code[i] = PageHasCode(i);
+	}
+}
+
+// a chunk of host memory got its first block - flag the pages that can write to it
+void M68KDrc::CodeAdded(uintptr_t nChunk)
+{
+	for (INT32 i = 0; i < SEK_PAGE_COUNT; i++) {
+		if (pHot->Code[i]) continue;
+
+		uintptr_t p = (uintptr_t)pHot->pMemMap[SEK_WADD + i];
+		uintptr_t nLen = SEK_PAGE_SIZE + 3;
+		if (p < SEK_MAXHANDLER) {
+			p = (uintptr_t)pHot->pMemMap[SEK_WADD * 2 + i];
+			nLen = SEK_PAGE_SIZE;
+			if (p < SEK_MAXHANDLER) continue;
+		}
+
+		if ((p >> SEK_SHIFT) <= nChunk && ((p + nLen - 1) >> SEK_SHIFT) >= nChunk) {
+			pHot->Code[i] = 1;
+		}
+	}
+}
+
+// something wrote p[0 .. nLen - 1]
+void M68KDrc::CheckHost(UINT8* p, INT32 nLen)
+{
+	for (uintptr_t k = (uintptr_t)p >> SEK_SHIFT; k <= ((uintptr_t)p + nLen - 1) >> SEK_SHIFT; k++) {
+		std::unordered_map<uintptr_t, std::vector<DrcBlock*> >::iterator c = DrcChunks.find(k);
+		if (c == DrcChunks.end()) continue;
+
+		std::vector<DrcBlock*> v = c->second;
+		for (UINT32 i = 0; i < v.size(); i++) {
+			DrcBlock* b = v[i];
+			if (b->pHost < p + nLen && p < b->pHost + b->nLen && memcmp(b->pHost, b->pSource, b->nLen)) {
+				b->pOwner->Invalidate(b);
+			}
+		}
+	}
+}
+
+void M68KDrc::MapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	INT32 nFirst = (nStart >> SEK_SHIFT) & (SEK_PAGE_COUNT - 1);
+	INT32 nLast = (nEnd >> SEK_SHIFT) & (SEK_PAGE_COUNT - 1);
+	if (nLast < nFirst) nLast = SEK_PAGE_COUNT - 1;
+
+	ComputeCode(nFirst, nLast);
+
+	// blocks in the range that match the new mapping must still match its memory
+	for (std::unordered_map<UINT32, std::vector<DrcBlock*> >::iterator i = m_Pages.begin(); i != m_Pages.end(); ++i) {
+		if ((INT32)i->first < nFirst || (INT32)i->first > nLast) continue;
+
+		std::vector<DrcBlock*> v = i->second;
+		for (UINT32 j = 0; j < v.size(); j++) {
+			DrcBlock* b = v[j];
+			if (b->pFetch == pHot->pMemMap[SEK_WADD * 2 + b->nPage] && memcmp(b->pHost, b->pSource, b->nLen)) {
+				Invalidate(b);
+			}
+		}
+	}
+
+	pHot->nBreak |= DRC_BREAK_EXIT;
+}
+
+void M68KDrc::Verify()
+{
+	bVerifyPending = false;
+
+	std::vector<DrcBlock*> v;
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.begin(); i != m_Blocks.end(); ++i) {
+		DrcBlock* b = i->second;
+		if (b->pFetch == pHot->pMemMap[SEK_WADD * 2 + b->nPage] && memcmp(b->pHost, b->pSource, b->nLen)) {
+			v.push_back(b);
+		}
+	}
+	for (UINT32 i = 0; i < v.size(); i++) {
+		Invalidate(v[i]);
+	}
+}
+
+// ----------------------------------------------------------------------------
+// Execution
+
+// entry trampoline, exit and the block to block dispatcher
+void M68KDrc::EmitCommon()
+{
+	m_pEntry = getCurr<void (*)(void*, DrcHot*)>();
+
+	push(rbx);
+	push(rbp);
+	push(r12);
+	push(r13);
+	push(r14);
+	push(r15);
+#ifdef _WIN32
+	push(rsi);
+	push(rdi);
+#endif
+	sub(rsp, 56);								// shadow space + 3 slots, keeps rsp 16 byte aligned
+
+	mov(rbx, (size_t)&m68ki_cpu);
+	mov(r13, (size_t)&m68k_ICount);
+#ifdef _WIN32
+	mov(r14, rdx);
+	mov(r12, qword[r14 + HOT_MEMMAP]);
+	jmp(rcx);
+#else
+	mov(r14, rsi);
+	mov(r12, qword[r14 + HOT_MEMMAP]);
+	jmp(rdi);
+#endif
+
+	L(*m_plExitNative);
+	mov(eax, CPU_REG(pc));
+	xor_(eax, 1);
+	mov(CPU_REG(pref_addr), eax);
+
+	L(*m_plExit);
+	add(rsp, 56);
+#ifdef _WIN32
+	pop(rdi);
+	pop(rsi);
+#endif
+	pop(r15);
+	pop(r14);
+	pop(r13);
+	pop(r12);
+	pop(rbp);
+	pop(rbx);
+	ret();
+
+	// REG_PC is set and there are cycles left: find the next block in the cache or leave
+	EmitDispatch(*m_plDispatch, *m_plExitNative);
+	EmitDispatch(*m_plDispatchPref, *m_plExit);
+}
+
+void M68KDrc::EmitDispatch(Xbyak::Label& lDispatch, Xbyak::Label& lMiss)
+{
+	align(16);
+	L(lDispatch);
+	mov(eax, CPU_REG(pc));
+	mov(edx, eax);
+	and_(edx, m_nDataMask);
+	shr(edx, SEK_SHIFT);
+	mov(r8, qword[r12 + rdx * 8 + SEK_WADD * 2 * 8]);
+	mov(ecx, eax);
+	and_(ecx, (DRC_CACHE_SIZE - 1) << 1);
+	shl(ecx, 4);
+	lea(r9, ptr[r14 + rcx + HOT_CACHE]);
+	cmp(dword[r9 + offsetof(DrcCacheEntry, nPC)], eax);
+	jne(lMiss, T_NEAR);
+	cmp(qword[r9 + offsetof(DrcCacheEntry, pFetch)], r8);
+	jne(lMiss, T_NEAR);
+	jmp(qword[r9 + offsetof(DrcCacheEntry, pCode)]);
+}
+
+void* M68KDrc::Find(UINT32 nPC)
+{
+	if ((nPC & 1) || !m_bUsable) return NULL;
+
+	UINT8* pFetch = pHot->pMemMap[SEK_WADD * 2 + ((nPC & m_nDataMask) >> SEK_SHIFT)];
+	if ((uintptr_t)pFetch < SEK_MAXHANDLER) return NULL;
+
+	// the interpreter runs an opcode it prefetched before it got overwritten, so do we
+	if (CPU_PREF_ADDR == nPC && CPU_PREF_DATA != BURN_ENDIAN_SWAP_INT16(*(UINT16*)(pFetch + (nPC & SEK_PAGEM)))) return NULL;
+
+	DrcCacheEntry& e = pHot->Cache[(nPC >> 1) & (DRC_CACHE_SIZE - 1)];
+	DrcBlock* b = NULL;
+	if (e.nPC == nPC && e.pFetch == pFetch) {
+		b = e.pBlock;
+	} else {
+		for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.find(nPC); i != m_Blocks.end() && i->first == nPC; ++i) {
+			if (i->second->pFetch == pFetch) {
+				b = i->second;
+				break;
+			}
+		}
+	}
+
+	// the entry check would leave without running anything, but Run() has to run at least one instruction
+	if (b && b->bCheck && memcmp(b->pHost, b->pSource, b->nLen)) {
+		Invalidate(b);
+		b = NULL;
+	}
+
+	if (b == NULL) {
+		if (getSize() + DRC_CODE_SLACK > DRC_CODE_SIZE) {
+			m_bFlushPending = true;
+			Flush();
+			if (m_bFlushPending) return NULL;	// nested, let the outer run flush
+		}
+
+		b = Compile(nPC, pFetch);
+		if (b == NULL) return NULL;
+	}
+
+	e.nPC = nPC;
+	e.pFetch = pFetch;
+	e.pCode = b->pCode;
+	e.pBlock = b;
+
+	return b->pCode;
+}
+
+// run a single instruction on the interpreter
+void M68KDrc::Step()
+{
+	REG_PPC = REG_PC;
+	REG_IR = m68ki_read_imm_16();
+	m68ki_instruction_jump_table[REG_IR]();
+	USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+}
+
+// m68k_execute(), block by block
+INT32 M68KDrc::Run(INT32 nCycles)
+{
+	m68ki_cpu.end_run = 0;
+	if (m68ki_cpu.sleepuntilint) {
+		return nCycles;
+	}
+
+	SET_CYCLES(nCycles);
+	m68ki_cpu.initial_cycles = nCycles;
+
+	m68ki_check_interrupts();
+
+	if (!CPU_STOPPED) {
+		m_nDepth++;
+
+		if (m_nDepth == 1) {
+			Flush();
+			if (bVerifyPending) Verify();
+		}
+
+		do {
+			pHot->nBreak = 0;
+
+			void* pCode = Find(REG_PC);
+			if (pCode) {
+				m_pEntry(pCode, pHot);
+			} else {
+				Step();
+			}
+		} while (GET_CYCLES() > 0 && !m68ki_cpu.end_run);
+
+		m_nDepth--;
+
+		REG_PPC = REG_PC;
+	} else {
+		SET_CYCLES(0);
+	}
+
+	return m68ki_cpu.initial_cycles - GET_CYCLES();
+}
+
+// ----------------------------------------------------------------------------
+// Code emitters
+
+DrcStub& M68KDrc::NewStub(INT32 nType, INT32 nSize)
+{
+	m_Stubs.emplace_back();
+	DrcStub& s = m_Stubs.back();
+
+	s.nType = nType;
+	s.nSize = nSize;
+	s.nPPC = m_nInsnPC;
+	s.nPC = m_nPC;
+	s.nIR = m_nOp;
+	s.nPref = m_nPC;
+	s.bCall = m_bCall;
+	s.bLivePref = m_bLivePref;
+
+	return s;
+}
+
+void M68KDrc::EmitStubs()
+{
+	static const void* pRead[3]  = { (void*)DrcRead8,  (void*)DrcRead16,  (void*)DrcRead32  };
+	static const void* pFetch[3] = { (void*)DrcFetch8, (void*)DrcFetch16, (void*)DrcFetch32 };
+	static const void* pWrite[3] = { (void*)DrcWrite8, (void*)DrcWrite16, (void*)DrcWrite32 };
+
+	for (std::deque<DrcStub>::iterator i = m_Stubs.begin(); i != m_Stubs.end(); ++i) {
+		DrcStub& s = *i;
+
+		L(s.lFrom);
+
+		if (s.nType == STUB_EXIT) {
+			if (s.bCall) {
+				test(byte[r14 + HOT_BREAK], DRC_BREAK_PC);
+				jnz(*m_plExitNative, T_NEAR);
+			}
+			mov(CPU_REG(pc), s.nPC);
+			// what the interpreter would have prefetched, if the block covers it
+			if (!s.bLivePref && s.nPref >= m_nBlockPC && s.nPref < m_nCoverEnd - 1) {
+				mov(CPU_REG(pref_addr), s.nPref);
+				mov(CPU_REG(pref_data), Word(s.nPref));
+			} else {
+				mov(CPU_REG(pref_addr), s.nPC ^ 1);
+			}
+			jmp(*m_plExit, T_NEAR);
+			continue;
+		}
+
+		// the handler sees the registers as the interpreter would have them
+		mov(CPU_REG(ppc), s.nPPC);
+		mov(CPU_REG(pc), s.nPC);
+		mov(CPU_REG(ir), s.nIR);
+
+		INT32 nFunc = (s.nSize == 4) ? 2 : (s.nSize - 1);
+		if (s.nType == STUB_WRITE) {
+			mov(dword[rsp + 32], eax);
+#ifdef _WIN32
+			mov(edx, eax);
+#else
+			mov(esi, eax);
+			mov(edi, ecx);
+#endif
+			mov(rax, (size_t)pWrite[nFunc]);
+			call(rax);
+			mov(eax, dword[rsp + 32]);
+		} else {
+#ifndef _WIN32
+			mov(edi, ecx);
+#endif
+			mov(rax, (size_t)((s.nType == STUB_FETCH) ? pFetch[nFunc] : pRead[nFunc]));
+			call(rax);
+		}
+
+		// a handler that moved the pc (reset, interrupt) ends the block after this instruction
+		cmp(CPU_REG(pc), s.nPC);
+		je(s.lBack, T_NEAR);
+		or_(dword[r14 + HOT_BREAK], DRC_BREAK_PC);
+		jmp(s.lBack, T_NEAR);
+	}
+
+	m_Stubs.clear();
+}
+
+// ecx = address -> eax
+void M68KDrc::MemRead(INT32 nSize, bool bPcRel)
+{
+	m_bCall = true;
+	DrcStub& s = NewStub(bPcRel ? STUB_FETCH : STUB_READ, nSize);
+
+	and_(ecx, bPcRel ? m_nSekMask : m_nDataMask);
+	mov(edx, ecx);
+	shr(edx, SEK_SHIFT);
+	mov(r8, qword[r12 + rdx * 8 + (bPcRel ? SEK_WADD * 2 * 8 : 0)]);
+	cmp(r8, SEK_MAXHANDLER);
+	jb(s.lFrom, T_NEAR);
+	if (nSize > 1 && !bPcRel) {
+		test(cl, 1);
+		jnz(s.lFrom, T_NEAR);
+	}
+	and_(ecx, SEK_PAGEM);
+
+	switch (nSize) {
+		case 1:
+			xor_(ecx, 1);
+			movzx(eax, byte[r8 + rcx]);
+			break;
+		case 2:
+			movzx(eax, word[r8 + rcx]);
+			break;
+		case 4:
+			mov(eax, dword[r8 + rcx]);
+			rol(eax, 16);
+			break;
+	}
+
+	L(s.lBack);
+}
+
+// ecx = address, eax = data (preserved)
+void M68KDrc::MemWrite(INT32 nSize)
+{
+	m_bCall = true;
+	DrcStub& s = NewStub(STUB_WRITE, nSize);
+
+	and_(ecx, m_nDataMask);
+	mov(edx, ecx);
+	shr(edx, SEK_SHIFT);
+	cmp(byte[r14 + rdx], 0);					// DrcHot::Code[]
+	jne(s.lFrom, T_NEAR);
+	mov(r8, qword[r12 + rdx * 8 + SEK_WADD * 8]);
+	cmp(r8, SEK_MAXHANDLER);
+	jb(s.lFrom, T_NEAR);
+	if (nSize > 1) {
+		test(cl, 1);
+		jnz(s.lFrom, T_NEAR);
+	}
+	and_(ecx, SEK_PAGEM);
+
+	switch (nSize) {
+		case 1:
+			xor_(ecx, 1);
+			mov(byte[r8 + rcx], al);
+			break;
+		case 2:
+			mov(word[r8 + rcx], ax);
+			break;
+		case 4:
+			mov(r9d, eax);
+			rol(r9d, 16);
+			mov(dword[r8 + rcx], r9d);
+			break;
+	}
+
+	L(s.lBack);
+}
+
+void M68KDrc::EaIndex(UINT32 nExt)
+{
+	if (nExt & 0x800) {
+		mov(edx, CPU_DA(nExt >> 12));
+	} else {
+		movsx(edx, word[rbx + CPU_OFS(dar) + (nExt >> 12) * 4]);
+	}
+	add(ecx, edx);
+	if ((INT8)nExt) add(ecx, (INT8)nExt);
+}
+
+// effective address of a memory operand -> ecx (uses edx), with (An)+ / -(An) side effects
+void M68KDrc::EaCalc(INT32 nEa, INT32 nSize)
+{
+	INT32 nReg = nEa & 7;
+	INT32 nStep = (nSize == 1 && nReg == 7) ? 2 : nSize;
+
+	m_bEaConst = false;
+
+	switch (nEa >> 3) {
+		case 2:
+			mov(ecx, CPU_A(nReg));
+			break;
+
+		case 3:
+			mov(ecx, CPU_A(nReg));
+			add(CPU_A(nReg), nStep);
+			break;
+
+		case 4:
+			mov(ecx, CPU_A(nReg));
+			sub(ecx, nStep);
+			mov(CPU_A(nReg), ecx);
+			break;
+
+		case 5: {
+			INT32 d = (INT16)Ext16();
+			mov(ecx, CPU_A(nReg));
+			if (d) add(ecx, d);
+			break;
+		}
+
+		case 6:
+			mov(ecx, CPU_A(nReg));
+			EaIndex(Ext16());
+			break;
+
+		case 7:
+			switch (nReg) {
+				case 0:
+					m_nEaConst = (INT16)Ext16();
+					m_bEaConst = true;
+					break;
+				case 1:
+					m_nEaConst = Ext32();
+					m_bEaConst = true;
+					break;
+				case 2: {
+					UINT32 nBase = m_nPC;
+					m_nEaConst = nBase + (INT16)Ext16();
+					m_bEaConst = true;
+					break;
+				}
+				case 3: {
+					UINT32 nBase = m_nPC;
+					mov(ecx, nBase);
+					EaIndex(Ext16());
+					break;
+				}
+			}
+			if (m_bEaConst) mov(ecx, m_nEaConst);
+			break;
+	}
+}
+
+void M68KDrc::LoadReg(const Xbyak::Reg32& r, INT32 nReg, INT32 nSize)
+{
+	switch (nSize) {
+		case 1: movzx(r, byte[rbx + CPU_OFS(dar) + nReg * 4]); break;
+		case 2: movzx(r, word[rbx + CPU_OFS(dar) + nReg * 4]); break;
+		case 4: mov(r, CPU_DA(nReg)); break;
+	}
+}
+
+// eax -> low bits of Dn
+void M68KDrc::StoreReg(INT32 nReg, INT32 nSize)
+{
+	switch (nSize) {
+		case 1: mov(byte[rbx + CPU_OFS(dar) + nReg * 4], al); break;
+		case 2: mov(word[rbx + CPU_OFS(dar) + nReg * 4], ax); break;
+		case 4: mov(CPU_DA(nReg), eax); break;
+	}
+}
+
+// operand -> eax (zero extended), keeping the address of a memory operand in ebp
+void M68KDrc::EaLoad(INT32 nEa, INT32 nSize, bool bKeep)
+{
+	switch (nEa >> 3) {
+		case 0:
+			LoadReg(eax, nEa & 7, nSize);
+			return;
+
+		case 1:
+			LoadReg(eax, 8 + (nEa & 7), nSize);
+			return;
+	}
+
+	if (nEa == 0x3c) {
+		UINT32 nImm = (nSize == 4) ? Ext32() : Ext16();
+		mov(eax, (nSize == 1) ? (nImm & 0xff) : nImm);
+		return;
+	}
+
+	EaCalc(nEa, nSize);
+	if (bKeep) mov(ebp, ecx);
+	MemRead(nSize, nEa == 0x3a || nEa == 0x3b);
+}
+
+// eax -> the operand EaLoad(.., true) fetched
+void M68KDrc::EaStore(INT32 nEa, INT32 nSize)
+{
+	if ((nEa >> 3) == 0) {
+		StoreReg(nEa & 7, nSize);
+		return;
+	}
+
+	mov(ecx, ebp);
+	MemWrite(nSize);
+}
+
+// eax -> -(a7)
+void M68KDrc::PushLong()
+{
+	mov(ecx, CPU_A(7));
+	sub(ecx, 4);
+	mov(CPU_A(7), ecx);
+	MemWrite(4);
+}
+
+// N and Z from the result in eax
+void M68KDrc::FlagsNZ(INT32 nSize)
+{
+	switch (nSize) {
+		case 1:
+			mov(CPU_REG(n_flag), eax);
+			movzx(edx, al);
+			mov(CPU_REG(not_z_flag), edx);
+			break;
+		case 2:
+			mov(edx, eax);
+			shr(edx, 8);
+			mov(CPU_REG(n_flag), edx);
+			movzx(edx, ax);
+			mov(CPU_REG(not_z_flag), edx);
+			break;
+		case 4:
+			mov(edx, eax);
+			shr(edx, 24);
+			mov(CPU_REG(n_flag), edx);
+			mov(CPU_REG(not_z_flag), eax);
+			break;
+	}
+}
+
+void M68KDrc::FlagsLogic(INT32 nSize)
+{
+	FlagsNZ(nSize);
+	mov(CPU_REG(v_flag), 0);
+	mov(CPU_REG(c_flag), 0);
+}
+
+// eax = r11d (dst) + r10d (src)
+void M68KDrc::FlagsAdd(INT32 nSize, bool bX)
+{
+	FlagsNZ(nSize);
+
+	mov(edx, r10d);
+	xor_(edx, eax);
+	mov(ecx, r11d);
+	xor_(ecx, eax);
+	and_(edx, ecx);
+	if (nSize == 2) shr(edx, 8);
+	if (nSize == 4) shr(edx, 24);
+	mov(CPU_REG(v_flag), edx);
+
+	switch (nSize) {
+		case 1:
+			mov(edx, eax);
+			break;
+		case 2:
+			mov(edx, eax);
+			shr(edx, 8);
+			break;
+		case 4:
+			mov(edx, r10d);
+			and_(edx, r11d);
+			mov(ecx, r10d);
+			or_(ecx, r11d);
+			mov(r8d, eax);
+			not_(r8d);
+			and_(ecx, r8d);
+			or_(edx, ecx);
+			shr(edx, 23);
+			break;
+	}
+	mov(CPU_REG(c_flag), edx);
+	if (bX) mov(CPU_REG(x_flag), edx);
+}
+
+// eax = r11d (dst) - r10d (src)
+void M68KDrc::FlagsSub(INT32 nSize, bool bX)
+{
+	FlagsNZ(nSize);
+
+	mov(edx, r10d);
+	xor_(edx, r11d);
+	mov(ecx, eax);
+	xor_(ecx, r11d);
+	and_(edx, ecx);
+	if (nSize == 2) shr(edx, 8);
+	if (nSize == 4) shr(edx, 24);
+	mov(CPU_REG(v_flag), edx);
+
+	switch (nSize) {
+		case 1:
+			mov(edx, eax);
+			break;
+		case 2:
+			mov(edx, eax);
+			shr(edx, 8);
+			break;
+		case 4:
+			mov(edx, r10d);
+			and_(edx, eax);
+			mov(ecx, r10d);
+			or_(ecx, eax);
+			mov(r8d, r11d);
+			not_(r8d);
+			and_(ecx, r8d);
+			or_(edx, ecx);
+			shr(edx, 23);
+			break;
+	}
+	mov(CPU_REG(c_flag), edx);
+	if (bX) mov(CPU_REG(x_flag), edx);
+}
+
+// eax = 0 - r10d
+void M68KDrc::FlagsNeg(INT32 nSize)
+{
+	FlagsNZ(nSize);
+
+	mov(edx, r10d);
+	and_(edx, eax);
+	if (nSize == 2) shr(edx, 8);
+	if (nSize == 4) shr(edx, 24);
+	mov(CPU_REG(v_flag), edx);
+
+	mov(edx, eax);
+	if (nSize == 2) shr(edx, 8);
+	if (nSize == 4) {
+		or_(edx, r10d);
+		shr(edx, 23);
+	}
+	mov(CPU_REG(c_flag), edx);
+	mov(CPU_REG(x_flag), edx);
+}
+
+// jump to lFalse unless condition nCC holds (uses edx only)
+void M68KDrc::Cond(INT32 nCC, Xbyak::Label& lFalse)
+{
+	Xbyak::Label lTrue;
+
+	switch (nCC) {
+		case 0x0:
+			break;
+		case 0x1:
+			jmp(lFalse, T_NEAR);
+			break;
+		case 0x2:	// hi
+			test(CPU_REG(c_flag), 0x100);
+			jnz(lFalse, T_NEAR);
+			cmp(CPU_REG(not_z_flag), 0);
+			je(lFalse, T_NEAR);
+			break;
+		case 0x3:	// ls
+			test(CPU_REG(c_flag), 0x100);
+			jnz(lTrue, T_NEAR);
+			cmp(CPU_REG(not_z_flag), 0);
+			jne(lFalse, T_NEAR);
+			break;
+		case 0x4:	// cc
+			test(CPU_REG(c_flag), 0x100);
+			jnz(lFalse, T_NEAR);
+			break;
+		case 0x5:	// cs
+			test(CPU_REG(c_flag), 0x100);
+			jz(lFalse, T_NEAR);
+			break;
+		case 0x6:	// ne
+			cmp(CPU_REG(not_z_flag), 0);
+			je(lFalse, T_NEAR);
+			break;
+		case 0x7:	// eq
+			cmp(CPU_REG(not_z_flag), 0);
+			jne(lFalse, T_NEAR);
+			break;
+		case 0x8:	// vc
+			test(CPU_REG(v_flag), 0x80);
+			jnz(lFalse, T_NEAR);
+			break;
+		case 0x9:	// vs
+			test(CPU_REG(v_flag), 0x80);
+			jz(lFalse, T_NEAR);
+			break;
+		case 0xa:	// pl
+			test(CPU_REG(n_flag), 0x80);
+			jnz(lFalse, T_NEAR);
+			break;
+		case 0xb:	// mi
+			test(CPU_REG(n_flag), 0x80);
+			jz(lFalse, T_NEAR);
+			break;
+		case 0xc:	// ge
+			mov(edx, CPU_REG(n_flag));
+			xor_(edx, CPU_REG(v_flag));
+			test(edx, 0x80);
+			jnz(lFalse, T_NEAR);
+			break;
+		case 0xd:	// lt
+			mov(edx, CPU_REG(n_flag));
+			xor_(edx, CPU_REG(v_flag));
+			test(edx, 0x80);
+			jz(lFalse, T_NEAR);
+			break;
+		case 0xe:	// gt
+			mov(edx, CPU_REG(n_flag));
+			xor_(edx, CPU_REG(v_flag));
+			test(edx, 0x80);
+			jnz(lFalse, T_NEAR);
+			cmp(CPU_REG(not_z_flag), 0);
+			je(lFalse, T_NEAR);
+			break;
+		case 0xf:	// le
+			mov(edx, CPU_REG(n_flag));
+			xor_(edx, CPU_REG(v_flag));
+			test(edx, 0x80);
+			jnz(lTrue, T_NEAR);
+			cmp(CPU_REG(not_z_flag), 0);
+			jne(lFalse, T_NEAR);
+			break;
+	}
+
+	L(lTrue);
+}
+
+// charge the instruction, leave the block when out of cycles or when a handler asked to
+void M68KDrc::EndInsn(INT32 nCycles)
+{
+	DrcStub& s = NewStub(STUB_EXIT, 0);
+
+	sub(dword[r13], nCycles);
+	jle(s.lFrom, T_NEAR);
+	if (m_bCall) {
+		cmp(dword[r14 + HOT_BREAK], 0);
+		jne(s.lFrom, T_NEAR);
+	}
+}
+
+// entry of a block in ram: run the body if its code is still what was translated, else drop
+// the block and leave (the prefetch is stale too), Run() translates the new code
+void M68KDrc::EmitCheck(DrcBlock* b, const void* pBody)
+{
+	Xbyak::Label lStale;
+
+	mov(rdx, (size_t)b->pHost);
+	for (INT32 i = 0; i < b->nLen; ) {
+		if (b->nLen - i >= 8) {
+			UINT64 d;
+			memcpy(&d, b->pSource + i, 8);
+			mov(rax, d);
+			cmp(qword[rdx + i], rax);
+			i += 8;
+		} else if (b->nLen - i >= 4) {
+			INT32 d;
+			memcpy(&d, b->pSource + i, 4);
+			cmp(dword[rdx + i], d);
+			i += 4;
+		} else {
+			INT16 d;
+			memcpy(&d, b->pSource + i, 2);
+			cmp(word[rdx + i], d);
+			i += 2;
+		}
+		jne(lStale, T_NEAR);
+	}
+	jmp(pBody, T_NEAR);
+
+	L(lStale);
+#ifdef _WIN32
+	mov(rcx, (size_t)b);
+#else
+	mov(rdi, (size_t)b);
+#endif
+	mov(rax, (size_t)DrcStale);
+	call(rax);
+	jmp(*m_plExitNative, T_NEAR);
+}
+
+// continue at a known pc: inside this block if it's an instruction we translated, else through the dispatcher
+void M68KDrc::EndBranch(UINT32 nTarget, INT32 nCycles)
+{
+	UINT32 nSaved = m_nPC;
+	m_nPC = nTarget;
+	EndInsn(nCycles);
+	m_nPC = nSaved;
+	m_Stubs.back().nPref = nSaved;	// the prefetch stays behind the branch, the target is fetched live
+
+	for (UINT32 i = 0; i < m_Insns.size(); i++) {
+		if (m_Insns[i].first == nTarget) {
+			jmp(m_Insns[i].second, T_NEAR);
+			return;
+		}
+	}
+
+	mov(CPU_REG(pc), nTarget);
+	jmp(*m_plDispatch, T_NEAR);
+}
+
+// REG_PC is already set
+void M68KDrc::EndJump(INT32 nCycles)
+{
+	sub(dword[r13], nCycles);
+	jle(*m_plExitNative, T_NEAR);
+	if (m_bCall) {
+		cmp(dword[r14 + HOT_BREAK], 0);
+		jne(*m_plExitNative, T_NEAR);
+	}
+	jmp(*m_plDispatch, T_NEAR);
+}
+
+// ----------------------------------------------------------------------------
+// Translation
+//
+// CompileX() return -1 when the instruction isn't handled (nothing emitted), 0 to carry on
+// with the block, 1 when the block ends with this instruction.
+
+INT32 M68KDrc::CompileFallback()
+{
+	UINT32 nNext = m_nInsnPC + 2;
+	INT32 nLen = InsnLength(m_nOp);
+
+	mov(CPU_REG(ppc), m_nInsnPC);
+	mov(CPU_REG(pc), nNext);
+	mov(CPU_REG(ir), m_nOp);
+	if (nNext + 2 <= m_nPageEnd) {
+		mov(CPU_REG(pref_addr), nNext);
+		mov(CPU_REG(pref_data), Word(nNext));
+	} else {
+		mov(CPU_REG(pref_addr), nNext ^ 1);
+	}
+	mov(rax, (size_t)m68ki_instruction_jump_table[m_nOp]);
+	call(rax);
+
+	// the handler left REG_PC pointing wherever execution goes next
+	sub(dword[r13], m_nCycles);
+	jle(*m_plExit, T_NEAR);
+	cmp(dword[r14 + HOT_BREAK], 0);
+	jne(*m_plExit, T_NEAR);
+
+	if (nLen == 0) {
+		m_nPC = m_nInsnPC + 2;
+		jmp(*m_plDispatchPref, T_NEAR);
+		return 1;
+	}
+
+	m_nPC = m_nInsnPC + nLen;
+	cmp(CPU_REG(pc), m_nPC);
+	jne(*m_plDispatchPref, T_NEAR);
+
+	return 0;
+}
+
+INT32 M68KDrc::CompileInsn()
+{
+	switch (m_nOp >> 12) {
+		case 0x0:
+			return CompileLine0();
+		case 0x1: case 0x2: case 0x3:
+			return CompileMove();
+		case 0x4:
+			return CompileLine4();
+		case 0x5:
+			return CompileLine5();
+		case 0x6:
+			return CompileBranch();
+		case 0x7: {
+			if (m_nOp & 0x100) return -1;
+			UINT32 nVal = (INT8)m_nOp;
+			mov(CPU_D((m_nOp >> 9) & 7), nVal);
+			mov(CPU_REG(n_flag), nVal >> 24);
+			mov(CPU_REG(not_z_flag), nVal);
+			mov(CPU_REG(v_flag), 0);
+			mov(CPU_REG(c_flag), 0);
+			EndInsn(m_nCycles);
+			return 0;
+		}
+		case 0x8: case 0x9: case 0xb: case 0xc: case 0xd:
+			return CompileArith();
+		case 0xe:
+			return CompileShift();
+	}
+
+	return -1;
+}
+
+INT32 M68KDrc::CompileMove()
+{
+	static const INT32 nSizes[4] = { 0, 1, 4, 2 };
+	INT32 nSize = nSizes[m_nOp >> 12];
+	INT32 nSrc = m_nOp & 0x3f;
+	INT32 nDst = ((m_nOp >> 9) & 7) | ((m_nOp >> 3) & 0x38);
+
+	if (!EaAllowed(nSrc, (nSize == 1) ? EA_DATA : EA_ALL)) return -1;
+
+	if ((nDst >> 3) == 1) {						// movea
+		if (nSize == 1) return -1;
+		EaLoad(nSrc, nSize, false);
+		if (nSize == 2) movsx(eax, ax);
+		mov(CPU_A(nDst & 7), eax);
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	if (!EaAllowed(nDst, EA_DALT)) return -1;
+
+	EaLoad(nSrc, nSize, false);
+
+	if ((nDst >> 3) == 0) {
+		StoreReg(nDst & 7, nSize);
+	} else if ((nDst >> 3) == 4 && nSize == 4) {
+		// long to -(An) goes out as two words, low word first
+		EaCalc(nDst, 4);
+		mov(ebp, ecx);
+		mov(r15d, eax);
+		add(ecx, 2);
+		MemWrite(2);
+		mov(ecx, ebp);
+		shr(eax, 16);
+		MemWrite(2);
+		mov(eax, r15d);
+	} else {
+		EaCalc(nDst, nSize);
+		MemWrite(nSize);
+	}
+
+	FlagsLogic(nSize);
+	EndInsn(m_nCycles);
+
+	return 0;
+}
+
+INT32 M68KDrc::CompileLine0()
+{
+	INT32 nEa = m_nOp & 0x3f;
+
+	if ((m_nOp & 0x0138) == 0x0108) return -1;	// movep
+
+	if ((m_nOp & 0x0100) || (m_nOp & 0x0f00) == 0x0800) {
+		// btst / bchg / bclr / bset
+		INT32 nType = (m_nOp >> 6) & 3;
+		bool bStatic = (m_nOp & 0x0100) == 0;
+
+		if ((nEa >> 3) == 0) {
+			INT32 nReg = nEa & 7;
+
+			if (bStatic) {
+				mov(r9d, 1 << (Ext16() & 0x1f));
+			} else {
+				mov(ecx, CPU_D((m_nOp >> 9) & 7));
+				and_(ecx, 0x1f);
+				mov(r9d, 1);
+				shl(r9d, cl);
+			}
+			mov(eax, CPU_D(nReg));
+			mov(edx, eax);
+			and_(edx, r9d);
+			mov(CPU_REG(not_z_flag), edx);
+			switch (nType) {
+				case 1: xor_(eax, r9d); break;
+				case 2: not_(r9d); and_(eax, r9d); break;
+				case 3: or_(eax, r9d); break;
+			}
+			if (nType) mov(CPU_D(nReg), eax);
+
+			EndInsn(m_nCycles);
+			return 0;
+		}
+
+		if (!EaAllowed(nEa, nType ? EA_MALT : (EA_DATA & ~(1 << EK_IMM)))) return -1;
+
+		UINT32 nBit = bStatic ? (Ext16() & 7) : 0;
+		EaLoad(nEa, 1, nType != 0);
+		if (bStatic) {
+			mov(r9d, 1 << nBit);
+		} else {
+			mov(ecx, CPU_D((m_nOp >> 9) & 7));
+			and_(ecx, 7);
+			mov(r9d, 1);
+			shl(r9d, cl);
+		}
+		mov(edx, eax);
+		and_(edx, r9d);
+		mov(CPU_REG(not_z_flag), edx);
+		if (nType) {
+			switch (nType) {
+				case 1: xor_(eax, r9d); break;
+				case 2: not_(r9d); and_(eax, r9d); break;
+				case 3: or_(eax, r9d); break;
+			}
+			EaStore(nEa, 1);
+		}
+
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	// ori / andi / subi / addi / eori / cmpi
+	INT32 nWhich = (m_nOp >> 9) & 7;
+	INT32 nSize = nSizeOf[(m_nOp >> 6) & 3];
+	if (nSize == 0 || nWhich == 4 || nWhich == 7) return -1;
+	if (!EaAllowed(nEa, EA_DALT)) return -1;
+	if (nWhich == 6 && nSize == 4 && (nEa >> 3) == 0) return -1;	// cmpi.l #,Dn calls back into the driver
+
+	UINT32 nImm = (nSize == 4) ? Ext32() : (Ext16() & ((nSize == 1) ? 0xff : 0xffff));
+
+	EaLoad(nEa, nSize, true);
+
+	switch (nWhich) {
+		case 0:
+			or_(eax, nImm);
+			FlagsLogic(nSize);
+			break;
+		case 1:
+			and_(eax, nImm);
+			FlagsLogic(nSize);
+			break;
+		case 5:
+			xor_(eax, nImm);
+			FlagsLogic(nSize);
+			break;
+		case 2:
+		case 6:
+			mov(r11d, eax);
+			mov(r10d, nImm);
+			sub(eax, r10d);
+			FlagsSub(nSize, nWhich == 2);
+			break;
+		case 3:
+			mov(r11d, eax);
+			mov(r10d, nImm);
+			add(eax, r10d);
+			FlagsAdd(nSize, true);
+			break;
+	}
+
+	if (nWhich != 6) EaStore(nEa, nSize);
+
+	EndInsn(m_nCycles);
+	return 0;
+}
+
+INT32 M68KDrc::CompileLine4()
+{
+	INT32 nEa = m_nOp & 0x3f;
+
+	switch (m_nOp) {
+		case 0x4e71:							// nop
+			EndInsn(m_nCycles);
+			return 0;
+
+		case 0x4e75:							// rts
+			mov(ecx, CPU_A(7));
+			lea(edx, ptr[rcx + 4]);
+			mov(CPU_A(7), edx);
+			MemRead(4, false);
+			mov(CPU_REG(pc), eax);
+			EndJump(m_nCycles);
+			return 1;
+	}
+
+	if ((m_nOp & 0xfff8) == 0x4e50) {			// link
+		INT32 nReg = m_nOp & 7;
+		if (nReg == 7) {
+			mov(ecx, CPU_A(7));
+			sub(ecx, 4);
+			mov(CPU_A(7), ecx);
+			mov(eax, ecx);
+			MemWrite(4);
+		} else {
+			mov(eax, CPU_A(nReg));
+			PushLong();
+			mov(eax, CPU_A(7));
+			mov(CPU_A(nReg), eax);
+		}
+		INT32 d = (INT16)Ext16();
+		if (d) add(CPU_A(7), d);
+		m_bLivePref = true;			// the interpreter pushes before it prefetches, it may see its own write
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	if ((m_nOp & 0xfff8) == 0x4e58) {			// unlk
+		INT32 nReg = m_nOp & 7;
+		if (nReg == 7) {
+			mov(ecx, CPU_A(7));
+			MemRead(4, false);
+			mov(CPU_A(7), eax);
+		} else {
+			mov(ecx, CPU_A(nReg));
+			lea(edx, ptr[rcx + 4]);
+			mov(CPU_A(7), edx);
+			MemRead(4, false);
+			mov(CPU_A(nReg), eax);
+		}
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	if ((m_nOp & 0xff80) == 0x4e80) {			// jsr / jmp
+		if (!EaAllowed(nEa, EA_CTRL)) return -1;
+		bool bJsr = (m_nOp & 0x40) == 0;
+
+		EaCalc(nEa, 4);
+		bool bConst = m_bEaConst;
+		UINT32 nTarget = m_nEaConst;
+
+		if (bJsr) {
+			mov(ebp, ecx);
+			mov(eax, m_nPC);
+			PushLong();
+			if (bConst) {
+				EndBranch(nTarget, m_nCycles);
+			} else {
+				mov(CPU_REG(pc), ebp);
+				EndJump(m_nCycles);
+			}
+			return 1;
+		}
+
+		if (bConst) {
+			if (nTarget == m_nInsnPC) mov(dword[r13], 0);
+			EndBranch(nTarget, m_nCycles);
+		} else {
+			Xbyak::Label lNotSelf;
+			mov(CPU_REG(pc), ecx);
+			cmp(ecx, m_nInsnPC);
+			jne(lNotSelf);
+			mov(dword[r13], 0);
+			L(lNotSelf);
+			EndJump(m_nCycles);
+		}
+		return 1;
+	}
+
+	if ((m_nOp & 0xffb8) == 0x4880) {			// ext
+		INT32 nReg = nEa & 7;
+		if (m_nOp & 0x40) {
+			movsx(eax, word[rbx + CPU_OFS(dar) + nReg * 4]);
+			mov(CPU_D(nReg), eax);
+			FlagsLogic(4);
+		} else {
+			movsx(eax, byte[rbx + CPU_OFS(dar) + nReg * 4]);
+			mov(word[rbx + CPU_OFS(dar) + nReg * 4], ax);
+			mov(eax, CPU_D(nReg));
+			mov(edx, eax);
+			shr(edx, 8);
+			mov(CPU_REG(n_flag), edx);
+			movzx(edx, ax);
+			mov(CPU_REG(not_z_flag), edx);
+			mov(CPU_REG(v_flag), 0);
+			mov(CPU_REG(c_flag), 0);
+		}
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	if ((m_nOp & 0xfb80) == 0x4880) {			// movem
+		bool bLoad = (m_nOp & 0x400) != 0;
+		INT32 nSize = (m_nOp & 0x40) ? 4 : 2;
+		INT32 nMode = nEa >> 3;
+		INT32 nReg = nEa & 7;
+
+		if (bLoad) {
+			if (!EaAllowed(nEa, EA_CTRL | (1 << EK_PI))) return -1;
+		} else {
+			if (!EaAllowed(nEa, (EA_CTRL & EA_ALT) | (1 << EK_PD))) return -1;
+		}
+
+		UINT32 nList = Ext16();
+		INT32 nCount = 0;
+
+		if (nMode == 4) {
+			// -(An): registers go out from a7 down to d0
+			mov(ebp, CPU_A(nReg));
+			for (INT32 i = 0; i < 16; i++) {
+				if ((nList & (1 << i)) == 0) continue;
+				sub(ebp, nSize);
+				if (nSize == 4) {
+					lea(ecx, ptr[rbp + 2]);
+					mov(eax, CPU_DA(15 - i));
+					MemWrite(2);
+					mov(ecx, ebp);
+					mov(eax, CPU_DA(15 - i));
+					shr(eax, 16);
+					MemWrite(2);
+				} else {
+					mov(ecx, ebp);
+					mov(eax, CPU_DA(15 - i));
+					MemWrite(2);
+				}
+				nCount++;
+			}
+			mov(CPU_A(nReg), ebp);
+		} else {
+			if (nMode == 3) {
+				mov(ebp, CPU_A(nReg));
+			} else {
+				EaCalc(nEa, nSize);
+				mov(ebp, ecx);
+			}
+
+			bool bPcRel = (nEa == 0x3a || nEa == 0x3b);
+			INT32 nOffset = 0;
+			for (INT32 i = 0; i < 16; i++) {
+				if ((nList & (1 << i)) == 0) continue;
+				lea(ecx, ptr[rbp + nOffset]);
+				if (bLoad) {
+					MemRead(nSize, bPcRel);
+					if (nSize == 2) movsx(eax, ax);
+					mov(CPU_DA(i), eax);
+				} else {
+					mov(eax, CPU_DA(i));
+					MemWrite(nSize);
+				}
+				nOffset += nSize;
+				nCount++;
+			}
+
+			if (nMode == 3) {
+				if (nOffset) add(ebp, nOffset);
+				mov(CPU_A(nReg), ebp);
+			}
+		}
+
+		EndInsn(m_nCycles + (nCount << ((nSize == 4) ? CYC_MOVEM_L : CYC_MOVEM_W)));
+		return 0;
+	}
+
+	if ((m_nOp & 0xfff8) == 0x4840) {			// swap
+		INT32 nReg = m_nOp & 7;
+		mov(eax, CPU_D(nReg));
+		rol(eax, 16);
+		mov(CPU_D(nReg), eax);
+		FlagsLogic(4);
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	if ((m_nOp & 0xffc0) == 0x4840) {			// pea
+		if (!EaAllowed(nEa, EA_CTRL)) return -1;
+		EaCalc(nEa, 4);
+		mov(eax, ecx);
+		PushLong();
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	if ((m_nOp & 0xf1c0) == 0x41c0) {			// lea
+		if (!EaAllowed(nEa, EA_CTRL)) return -1;
+		EaCalc(nEa, 4);
+		mov(CPU_A((m_nOp >> 9) & 7), ecx);
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	INT32 nSize = nSizeOf[(m_nOp >> 6) & 3];
+	if (nSize == 0 || !EaAllowed(nEa, EA_DALT)) return -1;
+
+	switch (m_nOp & 0xff00) {
+		case 0x4200:							// clr
+			if ((nEa >> 3) == 0) {
+				switch (nSize) {
+					case 1: mov(byte[rbx + CPU_OFS(dar) + (nEa & 7) * 4], 0); break;
+					case 2: mov(word[rbx + CPU_OFS(dar) + (nEa & 7) * 4], 0); break;
+					case 4: mov(CPU_D(nEa & 7), 0); break;
+				}
+			} else {
+				EaCalc(nEa, nSize);
+				xor_(eax, eax);
+				MemWrite(nSize);
+			}
+			mov(CPU_REG(n_flag), 0);
+			mov(CPU_REG(v_flag), 0);
+			mov(CPU_REG(c_flag), 0);
+			mov(CPU_REG(not_z_flag), 0);
+			EndInsn(m_nCycles);
+			return 0;
+
+		case 0x4400:							// neg
+			EaLoad(nEa, nSize, true);
+			mov(r10d, eax);
+			xor_(eax, eax);
+			sub(eax, r10d);
+			FlagsNeg(nSize);
+			EaStore(nEa, nSize);
+			EndInsn(m_nCycles);
+			return 0;
+
+		case 0x4600:							// not
+			EaLoad(nEa, nSize, true);
+			not_(eax);
+			if (nSize == 1) movzx(eax, al);
+			if (nSize == 2) movzx(eax, ax);
+			EaStore(nEa, nSize);
+			FlagsLogic(nSize);
+			EndInsn(m_nCycles);
+			return 0;
+
+		case 0x4a00:							// tst
+			EaLoad(nEa, nSize, false);
+			FlagsLogic(nSize);
+			EndInsn(m_nCycles);
+			return 0;
+	}
+
+	return -1;
+}
+
+INT32 M68KDrc::CompileLine5()
+{
+	INT32 nEa = m_nOp & 0x3f;
+	INT32 nCC = (m_nOp >> 8) & 0xf;
+
+	if ((m_nOp & 0xc0) != 0xc0) {				// addq / subq
+		INT32 nSize = nSizeOf[(m_nOp >> 6) & 3];
+		UINT32 nData = (((m_nOp >> 9) - 1) & 7) + 1;
+		bool bSub = (m_nOp & 0x100) != 0;
+
+		if ((nEa >> 3) == 1) {
+			if (nSize == 1) return -1;
+			if (bSub) {
+				sub(CPU_A(nEa & 7), nData);
+			} else {
+				add(CPU_A(nEa & 7), nData);
+			}
+			EndInsn(m_nCycles);
+			return 0;
+		}
+		if (!EaAllowed(nEa, EA_DALT)) return -1;
+
+		EaLoad(nEa, nSize, true);
+		mov(r11d, eax);
+		mov(r10d, nData);
+		if (bSub) {
+			sub(eax, r10d);
+			FlagsSub(nSize, true);
+		} else {
+			add(eax, r10d);
+			FlagsAdd(nSize, true);
+		}
+		EaStore(nEa, nSize);
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	if ((nEa >> 3) == 1) {						// dbcc
+		INT32 nReg = nEa & 7;
+		UINT32 nTarget = m_nInsnPC + 2 + (INT16)Ext16();
+
+		if (nCC == 0) {
+			EndInsn(m_nCycles);
+			return 0;
+		}
+
+		Xbyak::Label lSkip, lExpired;
+		if (nCC != 1) Cond(nCC ^ 1, lSkip);		// condition true: fall through
+		sub(word[rbx + CPU_OFS(dar) + nReg * 4], 1);
+		jc(lExpired, T_NEAR);
+		EndBranch(nTarget, m_nCycles + (INT32)CYC_DBCC_F_NOEXP);
+		L(lExpired);
+		if ((INT32)CYC_DBCC_F_EXP) sub(dword[r13], (INT32)CYC_DBCC_F_EXP);
+		L(lSkip);
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	if (!EaAllowed(nEa, EA_DALT)) return -1;
+
+	if ((nEa >> 3) == 0) {						// scc Dn
+		INT32 nReg = nEa & 7;
+		if (nCC == 0) {
+			or_(CPU_D(nReg), 0xff);
+		} else if (nCC == 1) {
+			and_(CPU_D(nReg), 0xffffff00);
+		} else {
+			Xbyak::Label lFalse, lDone;
+			Cond(nCC, lFalse);
+			or_(CPU_D(nReg), 0xff);
+			if ((INT32)CYC_SCC_R_TRUE) sub(dword[r13], (INT32)CYC_SCC_R_TRUE);
+			jmp(lDone, T_NEAR);
+			L(lFalse);
+			and_(CPU_D(nReg), 0xffffff00);
+			L(lDone);
+		}
+		EndInsn(m_nCycles);
+		return 0;
+	}
+
+	// scc <ea>
+	EaCalc(nEa, 1);
+	if (nCC < 2) {
+		mov(eax, nCC ? 0 : 0xff);
+	} else {
+		Xbyak::Label lFalse, lDone;
+		Cond(nCC, lFalse);
+		mov(eax, 0xff);
+		jmp(lDone, T_NEAR);
+		L(lFalse);
+		xor_(eax, eax);
+		L(lDone);
+	}
+	MemWrite(1);
+	EndInsn(m_nCycles);
+	return 0;
+}
+
+INT32 M68KDrc::CompileBranch()
+{
+	INT32 nCC = (m_nOp >> 8) & 0xf;
+	INT32 nDisp = m_nOp & 0xff;
+	UINT32 nTarget;
+	INT32 nNotTaken;
+
+	if (nDisp == 0xff) return -1;				// 68020 long branch
+
+	if (nDisp == 0) {
+		nTarget = m_nInsnPC + 2 + (INT16)Ext16();
+		nNotTaken = (INT32)CYC_BCC_NOTAKE_W;
+	} else {
+		nTarget = m_nInsnPC + 2 + (INT8)nDisp;
+		nNotTaken = (INT32)CYC_BCC_NOTAKE_B;
+	}
+
+	switch (nCC) {
+		case 0:									// bra
+			if (nTarget == m_nInsnPC) mov(dword[r13], 0);
+			EndBranch(nTarget, m_nCycles);
+			return 1;
+
+		case 1:									// bsr
+			mov(eax, m_nPC);
+			PushLong();
+			EndBranch(nTarget, m_nCycles);
+			return 1;
+	}
+
+	Xbyak::Label lNotTaken;
+	Cond(nCC, lNotTaken);
+	EndBranch(nTarget, m_nCycles);
+	L(lNotTaken);
+	EndInsn(m_nCycles + nNotTaken);
+
+	return 0;
+}
+
+INT32 M68KDrc::CompileArith()
+{
+	INT32 nLine = m_nOp >> 12;
+	INT32 nReg = (m_nOp >> 9) & 7;
+	INT32 nOpMode = (m_nOp >> 6) & 7;
+	INT32 nEa = m_nOp & 0x3f;
+
+	if (nOpMode == 3 || nOpMode == 7) {
+		INT32 nSize = (nOpMode == 3) ? 2 : 4;
+
+		switch (nLine) {
+			case 0x8:							// divu / divs
+				return -1;
+
+			case 0xc: {							// mulu / muls
+				if (!EaAllowed(nEa, EA_DATA)) return -1;
+				EaLoad(nEa, 2, false);
+				if (nOpMode == 3) {
+					movzx(edx, word[rbx + CPU_OFS(dar) + nReg * 4]);
+				} else {
+					movsx(eax, ax);
+					movsx(edx, word[rbx + CPU_OFS(dar) + nReg * 4]);
+				}
+				imul(eax, edx);
+				mov(CPU_D(nReg), eax);
+				FlagsLogic(4);
+				EndInsn(m_nCycles);
+				return 0;
+			}
+
+			case 0x9: case 0xd:					// suba / adda
+				if (!EaAllowed(nEa, EA_ALL)) return -1;
+				EaLoad(nEa, nSize, false);
+				if (nSize == 2) movsx(eax, ax);
+				if (nLine == 0x9) {
+					sub(CPU_A(nReg), eax);
+				} else {
+					add(CPU_A(nReg), eax);
+				}
+				EndInsn(m_nCycles);
+				return 0;
+
+			case 0xb:							// cmpa
+				if (!EaAllowed(nEa, EA_ALL)) return -1;
+				EaLoad(nEa, nSize, false);
+				if (nSize == 2) movsx(eax, ax);
+				mov(r10d, eax);
+				mov(r11d, CPU_A(nReg));
+				mov(eax, r11d);
+				sub(eax, r10d);
+				FlagsSub(4, false);
+				EndInsn(m_nCycles);
+				return 0;
+		}
+		return -1;
+	}
+
+	INT32 nSize = nSizeOf[nOpMode & 3];
+	bool bToEa = (nOpMode & 4) != 0;
+
+	if (bToEa && (nEa >> 3) < 2) {
+		// the register to register forms of this space are other instructions
+		if (nLine == 0xc && ((m_nOp & 0x1f8) == 0x140 || (m_nOp & 0x1f8) == 0x148 || (m_nOp & 0x1f8) == 0x188)) {
+			INT32 nX = ((m_nOp & 0x1f8) == 0x148) ? (8 + nReg) : nReg;
+			INT32 nY = ((m_nOp & 0x1f8) == 0x140) ? (nEa & 7) : (8 + (nEa & 7));
+			mov(eax, CPU_DA(nX));
+			mov(edx, CPU_DA(nY));
+			mov(CPU_DA(nX), edx);
+			mov(CPU_DA(nY), eax);
+			EndInsn(m_nCycles);
+			return 0;
+		}
+		if (nLine != 0xb || (nEa >> 3) == 1) return -1;	// abcd, sbcd, addx, subx, cmpm
+	}
+
+	switch (nLine) {
+		case 0x8:								// or
+		case 0xc:								// and
+			if (!bToEa) {
+				if (!EaAllowed(nEa, EA_DATA)) return -1;
+				EaLoad(nEa, nSize, false);
+				LoadReg(edx, nReg, nSize);
+				if (nLine == 0x8) {
+					or_(eax, edx);
+				} else {
+					and_(eax, edx);
+				}
+				StoreReg(nReg, nSize);
+				FlagsLogic(nSize);
+			} else {
+				if (!EaAllowed(nEa, EA_MALT)) return -1;
+				EaLoad(nEa, nSize, true);
+				LoadReg(edx, nReg, nSize);
+				if (nLine == 0x8) {
+					or_(eax, edx);
+				} else {
+					and_(eax, edx);
+				}
+				FlagsLogic(nSize);
+				EaStore(nEa, nSize);
+			}
+			EndInsn(m_nCycles);
+			return 0;
+
+		case 0xb:
+			if (!bToEa) {						// cmp
+				if (!EaAllowed(nEa, (nSize == 1) ? EA_DATA : EA_ALL)) return -1;
+				EaLoad(nEa, nSize, false);
+				mov(r10d, eax);
+				LoadReg(r11d, nReg, nSize);
+				mov(eax, r11d);
+				sub(eax, r10d);
+				FlagsSub(nSize, false);
+			} else {							// eor
+				if (!EaAllowed(nEa, EA_DALT)) return -1;
+				EaLoad(nEa, nSize, true);
+				LoadReg(edx, nReg, nSize);
+				xor_(eax, edx);
+				EaStore(nEa, nSize);
+				FlagsLogic(nSize);
+			}
+			EndInsn(m_nCycles);
+			return 0;
+
+		case 0x9:								// sub
+		case 0xd:								// add
+			if (!bToEa) {
+				if (!EaAllowed(nEa, (nSize == 1) ? EA_DATA : EA_ALL)) return -1;
+				EaLoad(nEa, nSize, false);
+				mov(r10d, eax);
+				LoadReg(r11d, nReg, nSize);
+			} else {
+				if (!EaAllowed(nEa, EA_MALT)) return -1;
+				EaLoad(nEa, nSize, true);
+				mov(r11d, eax);
+				LoadReg(r10d, nReg, nSize);
+			}
+			mov(eax, r11d);
+			if (nLine == 0x9) {
+				sub(eax, r10d);
+				FlagsSub(nSize, true);
+			} else {
+				add(eax, r10d);
+				FlagsAdd(nSize, true);
+			}
+			if (bToEa) {
+				EaStore(nEa, nSize);
+			} else {
+				StoreReg(nReg, nSize);
+			}
+			EndInsn(m_nCycles);
+			return 0;
+	}
+
+	return -1;
+}
+
+// shifts and rotates of a data register by an immediate count
+INT32 M68KDrc::CompileShift()
+{
+	if ((m_nOp & 0xc0) == 0xc0 || (m_nOp & 0x20)) return -1;
+
+	INT32 nType = (m_nOp >> 3) & 3;
+	if (nType == 2) return -1;					// roxl / roxr
+
+	INT32 nSize = nSizeOf[(m_nOp >> 6) & 3];
+	INT32 nShift = (((m_nOp >> 9) - 1) & 7) + 1;
+	INT32 nReg = m_nOp & 7;
+	bool bLeft = (m_nOp & 0x100) != 0;
+	INT32 nBits = nSize * 8;
+	UINT32 nMask = (nSize == 4) ? 0xffffffff : ((1 << nBits) - 1);
+
+	LoadReg(r10d, nReg, nSize);
+	mov(eax, r10d);
+	mov(edx, r10d);								// edx -> carry
+
+	if (!bLeft) {
+		switch (nType) {
+			case 0:								// asr
+				if (nSize == 1) movsx(eax, al);
+				if (nSize == 2) movsx(eax, ax);
+				sar(eax, nShift);
+				if (nSize != 4) and_(eax, nMask);
+				break;
+			case 1:								// lsr
+				shr(eax, nShift);
+				break;
+			case 3:								// ror
+				if (nSize == 1) {
+					if (nShift & 7) ror(al, nShift & 7);
+				} else if (nSize == 2) {
+					ror(ax, nShift);
+				} else {
+					ror(eax, nShift);
+				}
+				break;
+		}
+		shl(edx, 9 - nShift);
+	} else {
+		switch (nType) {
+			case 0:								// asl
+			case 1:								// lsl
+				shl(eax, nShift);
+				if (nSize != 4) and_(eax, nMask);
+				break;
+			case 3:								// rol
+				if (nSize == 1) {
+					if (nShift & 7) rol(al, nShift & 7);
+				} else if (nSize == 2) {
+					rol(ax, nShift);
+				} else {
+					rol(eax, nShift);
+				}
+				break;
+		}
+		if (nSize == 1) shl(edx, nShift);
+		if (nSize == 2 && nShift != 8) shr(edx, 8 - nShift);
+		if (nSize == 4) shr(edx, 24 - nShift);
+	}
+
+	StoreReg(nReg, nSize);
+
+	if (nType == 1 && !bLeft) {
+		mov(CPU_REG(n_flag), 0);
+	} else {
+		mov(r8d, eax);
+		if (nSize == 2) shr(r8d, 8);
+		if (nSize == 4) shr(r8d, 24);
+		mov(CPU_REG(n_flag), r8d);
+	}
+	mov(CPU_REG(not_z_flag), eax);
+	mov(CPU_REG(c_flag), edx);
+	if (nType != 3) mov(CPU_REG(x_flag), edx);
+
+	if (nType == 0 && bLeft) {
+		// overflow when the bits shifted through the sign bit weren't all the same
+		UINT32 nTest = (nSize == 1) ? m68ki_shift_8_table[nShift + 1] : ((nSize == 2) ? m68ki_shift_16_table[nShift + 1] : m68ki_shift_32_table[nShift + 1]);
+		Xbyak::Label lClear;
+		xor_(r8d, r8d);
+		and_(r10d, nTest);
+		jz(lClear);
+		if (nSize != 1 || nShift < 8) {
+			cmp(r10d, nTest);
+			je(lClear);
+		}
+		mov(r8d, 0x80);
+		L(lClear);
+		mov(CPU_REG(v_flag), r8d);
+	} else {
+		mov(CPU_REG(v_flag), 0);
+	}
+
+	EndInsn(m_nCycles + (nShift << CYC_SHIFT));
+	return 0;
+}
+
+DrcBlock* M68KDrc::Compile(UINT32 nPC, UINT8* pFetch)
+{
+	m_pPage = pFetch;
+	m_nPageBase = nPC - (nPC & m_nDataMask & SEK_PAGEM);
+	m_nPageEnd = m_nPageBase + SEK_PAGE_SIZE;
+	m_nPC = nPC;
+	m_Insns.clear();
+	m_Stubs.clear();
+
+	size_t nStart = getSize();
+	void* pCode = (void*)getCurr();
+	UINT32 nExtent = nPC;
+	bool bEnd = false;
+	DrcBlock* b = NULL;
+
+	try {
+		while (!bEnd && m_Insns.size() < DRC_MAX_INSNS && m_nPC + 2 <= m_nPageEnd) {
+			UINT32 nOp = Word(m_nPC);
+			INT32 nLen = InsnLength(nOp);
+
+			if (nLen && m_nPC + nLen > m_nPageEnd) break;
+
+			m_nInsnPC = m_nPC;
+			m_nOp = nOp;
+			m_nCycles = CYC_INSTRUCTION[nOp];
+			m_nPC += 2;
+			m_bCall = false;
+			m_bLivePref = false;
+			m_Insns.push_back(std::make_pair(m_nInsnPC, getCurr()));
+
+			INT32 r = CompileInsn();
+			if (r < 0) {
+				r = CompileFallback();
+				if (nLen == 0) nExtent = (m_nInsnPC + DRC_MAX_INSN_LEN < m_nPageEnd) ? (m_nInsnPC + DRC_MAX_INSN_LEN) : m_nPageEnd;
+			}
+#if defined FBNEO_DEBUG
+			else if (nLen && m_nPC != m_nInsnPC + nLen) {
+				bprintf(PRINT_ERROR, _T("M68K DRC: length mismatch for %04x at %06x\n"), nOp, m_nInsnPC);
+			}
+#endif
+			if (m_nPC > nExtent) nExtent = m_nPC;
+			bEnd = (r != 0);
+		}
+
+		if (m_Insns.empty()) {
+			return NULL;
+		}
+
+		if (!bEnd) {
+			mov(CPU_REG(pc), m_nPC);
+			jmp(*m_plDispatch, T_NEAR);
+		}
+
+		// the block also owns the word after its last instruction, the prefetch of an exit may hold it
+		nExtent = (nExtent + 2 < m_nPageEnd) ? (nExtent + 2) : m_nPageEnd;
+		m_nBlockPC = nPC;
+		m_nCoverEnd = nExtent;
+
+		EmitStubs();
+
+		b = new DrcBlock;
+		b->nPC = nPC;
+		b->nPage = (nPC & m_nDataMask) >> SEK_SHIFT;
+		b->nLen = nExtent - nPC;
+		b->bDead = false;
+		b->pFetch = pFetch;
+		b->pHost = pFetch + (nPC & m_nDataMask & SEK_PAGEM);
+		b->pSource = (UINT8*)malloc(b->nLen);
+		memcpy(b->pSource, b->pHost, b->nLen);
+		b->pOwner = this;
+
+		b->bCheck = DrcRamBacked(b->pHost, b->nLen);
+		if (b->bCheck) {
+			void* pBody = pCode;
+			pCode = (void*)getCurr();
+			EmitCheck(b, pBody);
+		}
+		b->pCode = pCode;
+	} catch (Xbyak::Error&) {
+		// out of code space: drop what we have and let the next run flush
+		if (b) {
+			free(b->pSource);
+			delete b;
+		}
+		m_Stubs.clear();
+		setSize(nStart);
+		m_bFlushPending = true;
+		return NULL;
+	}
+
+	m_Blocks.insert(std::make_pair(nPC, b));
+	m_Pages[b->nPage].push_back(b);
+
+	for (uintptr_t k = (uintptr_t)b->pHost >> SEK_SHIFT; k <= ((uintptr_t)b->pHost + b->nLen - 1) >> SEK_SHIFT; k++) {
+		std::vector<DrcBlock*>& v = DrcChunks[k];
+		v.push_back(b);
+		if (v.size() == 1) {
+			for (INT32 i = 0; i < SEK_MAX; i++) {
+				if (DrcCPU[i]) DrcCPU[i]->CodeAdded(k);
+			}
+		}
+	}
+
+	return b;
+}
+
+// ----------------------------------------------------------------------------
+// Interface
+
+INT32 M68KDrcInit(INT32 nCPU, UINT8** pMemMap, UINT32 nAddressMask)
+{
+	M68KDrcExit(nCPU);
+
+	try {
+		DrcCPU[nCPU] = new M68KDrc(nCPU, pMemMap, nAddressMask);
+	} catch (Xbyak::Error& e) {
+		bprintf(PRINT_ERROR, _T("M68K DRC: %S\n"), e.what());
+		DrcCPU[nCPU] = NULL;
+		return 1;
+	}
+
+	return 0;
+}
+
+void M68KDrcExit(INT32 nCPU)
+{
+	if (DrcCPU[nCPU] == NULL) return;
+
+	if (pDrcActive == DrcCPU[nCPU]) {
+		pDrcActive = NULL;
+		pM68KDrcCode = NULL;
+	}
+
+	delete DrcCPU[nCPU];
+	DrcCPU[nCPU] = NULL;
+}
+
+void M68KDrcOpen(INT32 nCPU)
+{
+	pDrcActive = (nCPU >= 0) ? DrcCPU[nCPU] : NULL;
+	pM68KDrcCode = pDrcActive ? pDrcActive->pHot->Code : NULL;
+}
+
+INT32 M68KDrcRun(INT32 nCycles)
+{
+	return pDrcActive->Run(nCycles);
+}
+
+void M68KDrcRunEnd()
+{
+	if (pDrcActive) pDrcActive->pHot->nBreak |= DRC_BREAK_EXIT;
+}
+
+void M68KDrcSetAddressMask(UINT32 nMask)
+{
+	if (pDrcActive) pDrcActive->SetAddressMask(nMask);
+}
+
+void M68KDrcMapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	if (pDrcActive) pDrcActive->MapChanged(nStart, nEnd);
+}
+
+void M68KDrcVerify()
+{
+	for (INT32 i = 0; i < SEK_MAX; i++) {
+		if (DrcCPU[i]) DrcCPU[i]->bVerifyPending = true;
+	}
+}
+
+void M68KDrcWrite(UINT32 a, INT32 nLen)
+{
+	UINT8** pMemMap = pDrcActive->pHot->pMemMap;
+	INT32 nPage = a >> SEK_SHIFT;
+	INT32 nOffset = a & SEK_PAGEM & ~1;
+
+	if (nLen == 1) nLen = 2;
+
+	UINT8* p = pMemMap[SEK_WADD + nPage];
+	if ((uintptr_t)p >= SEK_MAXHANDLER) {
+		pDrcActive->CheckHost(p + nOffset, nLen);
+	}
+
+	UINT8* f = pMemMap[SEK_WADD * 2 + nPage];
+	if ((uintptr_t)f >= SEK_MAXHANDLER && f != p) {
+		pDrcActive->CheckHost(f + nOffset, nLen);
+	}
+}
+
+void M68KDrcWriteHost(UINT8* p, INT32 nLen)
+{
+	if (!DrcChunks.empty()) pDrcActive->CheckHost(p, nLen);
+}
+
+#endif
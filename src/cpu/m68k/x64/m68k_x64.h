@@ -0,0 +1,26 @@
+// 68000 block recompiler for x86-64 hosts (Musashi context, SekExt memory map)
+
+#ifndef M68K_X64_H
+#define M68K_X64_H
+
+#ifdef M68K_X64_DRC
+
+// Per-page flags of the open cpu: non-zero where a write may hit recompiled code (NULL when not recompiling)
+extern UINT8* pM68KDrcCode;
+
+INT32 M68KDrcInit(INT32 nCPU, UINT8** pMemMap, UINT32 nAddressMask);
+void M68KDrcExit(INT32 nCPU);
+void M68KDrcOpen(INT32 nCPU);					// -1 when closing
+INT32 M68KDrcRun(INT32 nCycles);				// same contract as m68k_execute()
+void M68KDrcRunEnd();
+
+void M68KDrcSetAddressMask(UINT32 nMask);
+void M68KDrcMapChanged(UINT32 nStart, UINT32 nEnd);
+void M68KDrcVerify();							// drop blocks whose code changed behind our back (all cpus)
+
+void M68KDrcWrite(UINT32 a, INT32 nLen);		// a write through the Sek map hit a flagged page
+void M68KDrcWriteHost(UINT8* p, INT32 nLen);
+
+#endif
+
+#endif
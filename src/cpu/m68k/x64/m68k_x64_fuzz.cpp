@@ -0,0 +1,281 @@
+// Differential test for the 68000 recompiler: cpu 0 runs on Musashi, cpu 1 on the recompiler,
+// both on the same random code, and they must end every timeslice in the same state.
+//
+// Build and run from src/burner/libretro (x86-64 hosts):
+//   g++ -O2 -std=gnu++11 -DLSB_FIRST -D__LIBRETRO__ -DM68K_X64_DRC -DXBYAK_NO_OP_NAMES \
+//     -I../../burn -I../../burn/devices -I../../burn/snd -I../../burner -I../../burner/libretro \
+//     -I../../burner/libretro/libretro-common/include \
+//     -I../../cpu -I../../intf -I../../intf/input -I../../intf/cd -I../../intf/audio \
+//     -x c ../../cpu/m68k/m68kcpu.c -x c ../../cpu/m68k/m68kops.c -x c++ ../../cpu/m68000_intf.cpp \
+//     ../../cpu/m68k/x64/m68k_x64.cpp ../../cpu/m68k/x64/m68k_x64_fuzz.cpp \
+//     -no-pie -Wl,--unresolved-symbols=ignore-all -o m68k_x64_fuzz
+//   ./m68k_x64_fuzz [first seed] [seeds] [timeslices]
+//
+// Besides the cpus' own writes the test rewrites code between timeslices (as dma or another
+// cpu would) and switches a ram bank from a write handler.
+
+#include "burnint.h"
+#include "m68000_intf.h"
+#include "m68k/x64/m68k_x64.h"
+
+extern "C" {
+#include "m68k/m68k.h"
+}
+
+bool bBurnUseM68KRecompiler = false;
+bool bBurnProfile = false;
+void BurnProfileEnter(INT32) {}
+void BurnProfileLeave() {}
+UINT8 DebugCPU_SekInitted = 0;
+void CpuCheatRegister(INT32, cpu_core_config*) {}
+INT32 (__cdecl *BurnAcb) (struct BurnArea* pba) = NULL;
+
+static INT32 __cdecl FuzzPrintf(INT32, TCHAR* szFormat, ...)
+{
+	va_list vl;
+	va_start(vl, szFormat);
+	vprintf(szFormat, vl);
+	va_end(vl);
+	return 0;
+}
+
+INT32 (__cdecl *bprintf) (INT32 nStatus, TCHAR* szFormat, ...) = FuzzPrintf;
+
+#define MEM_SIZE	0x100000
+
+static UINT8* Mem[2];
+static UINT32 nHash[2];
+static UINT32 nReads[2];
+static UINT32 nSeed;
+
+static UINT32 Rand()
+{
+	nSeed = nSeed * 1103515245 + 12345;
+	return (nSeed >> 8) ^ (nSeed << 20);
+}
+
+static UINT32 HandlerRead(UINT32 a)
+{
+	nReads[nSekActive]++;
+	return (a * 2654435761u) ^ (nReads[nSekActive] * 40503);
+}
+
+static UINT8 __fastcall HandlerReadByte(UINT32 a) { return HandlerRead(a); }
+static UINT16 __fastcall HandlerReadWord(UINT32 a) { return HandlerRead(a); }
+
+static void __fastcall HandlerWriteByte(UINT32 a, UINT8 d)
+{
+	nHash[nSekActive] = nHash[nSekActive] * 31 + a * 7 + d;
+	if (a == 0x80fff1) SekRunEnd();
+}
+
+static void __fastcall HandlerWriteWord(UINT32 a, UINT16 d)
+{
+	nHash[nSekActive] = nHash[nSekActive] * 31 + a * 5 + d;
+	if (a == 0x80fff0) SekRunEnd();
+	if (a == 0x80ffe0) SekMapMemory(Mem[nSekActive] + 0x20000 + (d & 3) * 0x10000, 0xa00000, 0xa0ffff, MAP_RAM);
+}
+
+// random bits, fixed bits: mostly instructions the recompiler translates
+static const UINT16 Templates[][2] = {
+	{ 0x0fff, 0x1000 }, { 0x0fff, 0x2000 }, { 0x0fff, 0x3000 }, { 0x0eff, 0x7000 },
+	{ 0x0fff, 0xd000 }, { 0x0fff, 0x9000 }, { 0x0fff, 0xb000 }, { 0x0fff, 0xc000 }, { 0x0fff, 0x8000 },
+	{ 0x0fff, 0x5000 }, { 0x0fff, 0xe000 }, { 0x0fff, 0x0000 }, { 0x0fff, 0x4000 },
+	{ 0x0ffe, 0x6000 }, { 0x00fe, 0x6000 }, { 0x00fe, 0x6700 }, { 0x00fe, 0x6600 },
+	{ 0x0f07, 0x51c8 }, { 0x0007, 0x4e50 }, { 0x0007, 0x4e58 }, { 0x0000, 0x4e75 }, { 0x0000, 0x4e71 },
+	{ 0x003f, 0x4e80 }, { 0x003f, 0x4ec0 }, { 0x003f, 0x4840 }, { 0x0e3f, 0x41c0 },
+	{ 0x047f, 0x4880 }, { 0x0f3f, 0x0100 }, { 0x00ff, 0x0800 }, { 0x0e07, 0x4840 },
+	{ 0x0007, 0x4e73 }, { 0x000f, 0x4e40 },
+};
+
+static void Put16(UINT8* m, UINT32 a, UINT16 w)
+{
+	m[a + 0] = w & 0xff;						// LSB_FIRST: words are stored byteswapped
+	m[a + 1] = w >> 8;
+}
+
+static void Put32(UINT8* m, UINT32 a, UINT32 l)
+{
+	Put16(m, a + 0, l >> 16);
+	Put16(m, a + 2, l);
+}
+
+static void MakeCode(UINT8* m, UINT32 nStart, UINT32 nLen)
+{
+	for (UINT32 a = nStart; a < nStart + nLen; a += 2) {
+		UINT32 r = Rand();
+		UINT16 w;
+
+		if ((r & 15) == 0) {
+			w = Rand();
+		} else if ((r & 7) < 3) {
+			w = Rand() & 0x3f;					// extension words, small displacements
+			if (Rand() & 1) w |= 0x8000;
+			if (Rand() & 1) w = Rand() & 0xfe;
+		} else {
+			INT32 t = Rand() % (sizeof(Templates) / sizeof(Templates[0]));
+			w = Templates[t][1] | (Rand() & Templates[t][0]);
+		}
+
+		Put16(m, a, w);
+	}
+}
+
+static INT32 RunSeed(UINT32 nTestSeed, INT32 nSlices)
+{
+	nSeed = nTestSeed;
+
+	memset(Mem[0], 0, MEM_SIZE);
+	MakeCode(Mem[0], 0x400, 0x8000);
+	MakeCode(Mem[0], 0x60000, 0x2000);
+	for (INT32 i = 0; i < 256; i++) {
+		Put32(Mem[0], i * 4, 0x400 + (Rand() & 0x7ffe));
+	}
+	Put32(Mem[0], 0, 0xf0000);
+	Put32(Mem[0], 4, 0x400);
+	memcpy(Mem[1], Mem[0], MEM_SIZE);
+
+	for (INT32 c = 0; c < 2; c++) {
+		nHash[c] = nReads[c] = 0;
+
+		bBurnUseM68KRecompiler = (c == 1);
+		SekInit(c, 0x68000);
+		SekOpen(c);
+		SekMapMemory(Mem[c], 0x000000, 0x0fffff, MAP_RAM);
+		SekMapMemory(Mem[c], 0x100000, 0x1fffff, MAP_RAM);			// mirror
+		SekMapMemory(Mem[c] + 0x60000, 0x200000, 0x20ffff, MAP_ROM);
+		SekMapMemory(Mem[c] + 0x20000, 0xa00000, 0xa0ffff, MAP_RAM);	// banked
+		SekMapHandler(1, 0x800000, 0x80ffff, MAP_READ | MAP_WRITE);
+		SekSetReadByteHandler(1, HandlerReadByte);
+		SekSetReadWordHandler(1, HandlerReadWord);
+		SekSetWriteByteHandler(1, HandlerWriteByte);
+		SekSetWriteWordHandler(1, HandlerWriteWord);
+		SekReset();
+		SekClose();
+	}
+
+	SekOpen(1);
+	bool bRecompiling = (pM68KDrcCode != NULL);
+	SekClose();
+	if (!bRecompiling) {
+		printf("the recompiler isn't available\n");
+		SekExit();
+		return 1;
+	}
+
+	INT32 nRet = 0;
+
+	for (INT32 s = 0; s < nSlices && nRet == 0; s++) {
+		INT32 nCycles = 1 + (Rand() % 2000);
+		INT32 nIrq = Rand() % 8;
+		bool bIrq = (Rand() % 4) == 0;
+		UINT32 r[2][23];
+		INT32 nDone[2];
+
+		for (INT32 c = 0; c < 2; c++) {
+			SekOpen(c);
+			if (bIrq) SekSetIRQLine(nIrq, CPU_IRQSTATUS_AUTO);
+			nDone[c] = SekRun(nCycles);
+			for (INT32 i = 0; i < 18; i++) {
+				r[c][i] = m68k_get_reg(NULL, (m68k_register_t)(M68K_REG_D0 + i));
+			}
+			r[c][18] = m68k_get_reg(NULL, M68K_REG_USP);
+			r[c][19] = m68k_get_reg(NULL, M68K_REG_ISP);
+			r[c][20] = SekTotalCycles();
+			r[c][21] = nHash[c];
+			r[c][22] = nReads[c];
+			SekClose();
+		}
+
+		if (memcmp(r[0], r[1], sizeof(r[0])) || nDone[0] != nDone[1]) {
+			static const char* szName[23] = { "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "pc", "sr", "usp", "isp", "cycles", "writes", "reads" };
+			printf("seed %u timeslice %d: cpus differ (ran %d / %d cycles)\n", nTestSeed, s, nDone[0], nDone[1]);
+			for (INT32 i = 0; i < 23; i++) {
+				printf("  %-6s %08x %08x%s\n", szName[i], r[0][i], r[1][i], (r[0][i] != r[1][i]) ? " <<<" : "");
+			}
+			nRet = 1;
+			break;
+		}
+
+		if ((s & 63) == 63 && memcmp(Mem[0], Mem[1], MEM_SIZE)) {
+			printf("seed %u timeslice %d: memory differs\n", nTestSeed, s);
+			nRet = 1;
+			break;
+		}
+
+		if (Rand() & 1) {
+			// somewhere else in the code, with fresh registers
+			UINT32 nPC = 0x400 + (Rand() & 0x7ffe);
+			UINT32 v[16];
+			for (INT32 i = 0; i < 16; i++) {
+				UINT32 k = Rand() & 7;
+				v[i] = (k == 0) ? (0x800000 + (Rand() & 0xffff)) : ((k < 3) ? Rand() : (Rand() & 0x1ffffe));
+			}
+			v[15] = 0xe0000 + (Rand() & 0xfffe);
+
+			for (INT32 c = 0; c < 2; c++) {
+				SekOpen(c);
+				m68k_set_reg(M68K_REG_PC, nPC);
+				for (INT32 i = 0; i < 16; i++) {
+					m68k_set_reg((m68k_register_t)(M68K_REG_D0 + i), v[i]);
+				}
+				SekClose();
+			}
+		} else if (r[0][16] & 1) {
+			// no address errors here
+			for (INT32 c = 0; c < 2; c++) {
+				SekOpen(c);
+				m68k_set_reg(M68K_REG_PC, 0x400 + (r[0][16] & 0x7ffe));
+				SekClose();
+			}
+		}
+
+		if ((Rand() & 3) == 0) {
+			// code changed behind the cpus' backs
+			UINT32 a = 0x400 + (Rand() & 0x7fc0);
+			MakeCode(Mem[0], a, 0x40);
+			memcpy(Mem[1] + a, Mem[0] + a, 0x40);
+		}
+
+		if ((s % 500) == 250) {
+			for (INT32 c = 0; c < 2; c++) {
+				SekOpen(c);
+				SekNewFrame();
+				SekClose();
+			}
+		}
+	}
+
+	if (nRet == 0 && memcmp(Mem[0], Mem[1], MEM_SIZE)) {
+		printf("seed %u: memory differs\n", nTestSeed);
+		nRet = 1;
+	}
+
+	SekExit();
+
+	return nRet;
+}
+
+int main(int argc, char** argv)
+{
+	UINT32 nFirst = (argc > 1) ? atoi(argv[1]) : 1;
+	INT32 nSeeds = (argc > 2) ? atoi(argv[2]) : 20;
+	INT32 nSlices = (argc > 3) ? atoi(argv[3]) : 2000;
+
+	for (INT32 c = 0; c < 2; c++) {
+		Mem[c] = (UINT8*)malloc(MEM_SIZE);
+	}
+
+	INT32 nFailed = 0;
+	for (INT32 i = 0; i < nSeeds; i++) {
+		nFailed += RunSeed(nFirst + i, nSlices);
+	}
+
+	printf("%d of %d seeds passed\n", nSeeds - nFailed, nSeeds);
+
+	for (INT32 c = 0; c < 2; c++) {
+		free(Mem[c]);
+	}
+
+	return nFailed ? 1 : 0;
+}
@@ -111,6 +111,8 @@ void Mips3Reset()
 
 int Mips3Run(int cycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 #ifdef MIPS3_X64_DRC
     if (g_mips) {
         if (g_useRecompiler && g_mips_x64) {
@@ -618,6 +618,8 @@ INT32 VezRun(INT32 nCycles)
 	if (nOpenedCPU == -1) bprintf(PRINT_ERROR, _T("VezRun called when no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	if (nCycles <= 0) return 0;
 
 	return VezCurrentCPU->cpu_execute(nCycles);
@@ -831,6 +831,8 @@ static void pic16C5x_update_timer(int counts)
 
 int pic16c5xRun(int cycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	UINT8 T0_in;
 	slice_cycles = cycles;
 	pic16C5x_icount = cycles;
@@ -860,6 +860,8 @@ int s2650Run(int cycles)
 	if (nActiveS2650 == -1) bprintf(PRINT_ERROR, _T("s2650Run called when no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	s2650_ICount = cycles_slice = cycles;
 
 	S.end_run = 0;
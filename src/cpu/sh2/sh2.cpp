@@ -31,6 +31,8 @@
 
 #include "burnint.h"
 #include "sh2_intf.h"
+#include "sh2_core.h"
+#include "x64/sh2_x64.h"
 #include <stddef.h>
 
 int has_sh2;
@@ -38,7 +40,9 @@ INT32 cps3speedhack; // must be set _after_ Sh2Init();
 INT32 sh2_busyloop_speedhack_mode2;
 
 #define BUSY_LOOP_HACKS     1
+#ifndef FAST_OP_FETCH
 #define FAST_OP_FETCH		1
+#endif
 #define USE_JUMPTABLE		0
 
 #define SH2_INT_15			15
@@ -65,64 +69,14 @@ INT32 sh2_busyloop_speedhack_mode2;
 
 
 
-typedef struct
-{
-	INT32 irq_vector;
-	INT32 irq_priority;
-} irq_entry;
-
-typedef struct
-{
-	UINT32	ppc;
-	UINT32	pc;
-	UINT32	pr;
-	UINT32	sr;
-	UINT32	gbr, vbr;
-	UINT32	mach, macl;
-	UINT32	r[16];
-	UINT32	ea;
-	UINT32	delay;
-	UINT32	cpu_off;
-	UINT32	dvsr, dvdnth, dvdntl, dvcr;
-	UINT32	pending_irq;
-	UINT32    test_irq;
-	irq_entry     irq_queue[16];
-
-	INT8	irq_line_state[17];
-	UINT32	m[0x200];
-	INT8  nmi_line_state;
-
-	UINT16 	frc;
-	UINT16 	ocra, ocrb, icr;
-	UINT32 	frc_base;
-
-	INT32	frt_input;
-	INT32 	internal_irq_level;
-	INT32 	internal_irq_vector;
-
-//	emu_timer *timer;
-	UINT32 	timer_cycles;
-	UINT32 	timer_base;
-	INT32   timer_active;
-	
-//	emu_timer *dma_timer[2];
-	UINT32 	dma_timer_cycles[2];
-	UINT32 	dma_timer_base[2];
-	INT32   dma_timer_active[2];
-
-//	int     is_slave, cpu_number;
-	
-	UINT32	cycle_counts; // used internally for timers / sh2_GetTotalCycles()
-	UINT32	sh2_cycles_to_run;
-	INT32	sh2_icount;
-	INT32   sh2_total_cycles; // used externally (drivers/etc)
-	INT32   sh2_eat_cycles;
-	INT32   end_run;
+static SH2 * sh2;
 
-	int 	(*irq_callback)(int irqline);
-} SH2;
+static INT32 nSh2IdleCore = -1;
+static UINT32 sh2_idle_state();
+static void sh2_idle_branch(UINT32 from, UINT32 to);
 
-static SH2 * sh2;
+// short backward branches are looked at by burn_idle.cpp
+#define SH2_IDLE_BRANCH(from, to)	if (nSh2IdleCore >= 0 && (UINT32)((from) - (to)) <= BURN_IDLE_MAX_LOOP) sh2_idle_branch(from, to)
 
 static UINT32 sh2_GetTotalCycles()
 {
@@ -146,7 +100,7 @@ enum {
 #define Q	0x00000100
 #define M	0x00000200
 
-#define AM	0xc7ffffff
+#define AM	SH2_AM
 
 #define FLAGS	(M|Q|I|S|T)
 
@@ -156,34 +110,6 @@ enum {
 static UINT32 sh2_internal_r(UINT32 A, UINT32 mask);
 static void sh2_internal_w(UINT32 offset, UINT32 data, UINT32 mem_mask);
 
-//-- sh2 memory handler for Finalburn Alpha ---------------------
-
-#define SH2_BITS		(16)					// 16 = 0x10000 page size
-#define SH2_PAGE_COUNT  (1 << (32 - SH2_BITS))	// Number of pages
-#define SH2_SHIFT		(SH2_BITS)				// Shift value = page bits
-#define SH2_PAGE_SIZE	(1 << SH2_BITS)			// Page size
-#define SH2_PAGEM		(SH2_PAGE_SIZE - 1)
-#define SH2_WADD		(SH2_PAGE_COUNT)		// Value to add for write section = Number of pages
-#define SH2_MASK		(SH2_WADD - 1)
-
-#define	SH2_MAXHANDLER	(8)
-
-
-typedef struct 
-{
-	SH2	sh2;
-	unsigned char * MemMap[SH2_PAGE_COUNT * 3];
-	pSh2ReadByteHandler ReadByte[SH2_MAXHANDLER];
-	pSh2WriteByteHandler WriteByte[SH2_MAXHANDLER];
-	pSh2ReadWordHandler ReadWord[SH2_MAXHANDLER];
-	pSh2WriteWordHandler WriteWord[SH2_MAXHANDLER];
-	pSh2ReadLongHandler ReadLong[SH2_MAXHANDLER];
-	pSh2WriteLongHandler WriteLong[SH2_MAXHANDLER];
-	
-	unsigned char * opbase;
-	int suspend;
-} SH2EXT;
-
 static SH2EXT * pSh2Ext;
 static SH2EXT * Sh2Ext = NULL;
 
@@ -231,7 +157,20 @@ cpu_core_config Sh2Config =
  * 0xc0000000 ~ 0xdfffffff : extend user
  * 0xe0000000 ~ 0xffffffff : internal mem
  */
- 
+
+#if defined SH2_X64_DRC
+// blocks translated from a remapped range (and its mirrors) must still match their memory
+static void sh2_drc_map_changed(unsigned int nStart, unsigned int nEnd)
+{
+	if (pSh2DrcCode == NULL) return;
+
+	int nMirrors = (nStart < 0x08000000) ? 8 : 1;
+	for (int i = 0; i < nMirrors; i++) {
+		Sh2DrcMapChanged(nStart + i * 0x08000000, nEnd + i * 0x08000000);
+	}
+}
+#endif
+
 int Sh2MapMemory(unsigned char* pMemory, unsigned int nStart, unsigned int nEnd, int nType)
 {
 #if defined FBNEO_DEBUG
@@ -277,6 +216,11 @@ int Sh2MapMemory(unsigned char* pMemory, unsigned int nStart, unsigned int nEnd,
 			}
 		}
 	}
+
+#if defined SH2_X64_DRC
+	sh2_drc_map_changed(nStart, nEnd);
+#endif
+
 	return 0;
 }
 
@@ -325,6 +269,11 @@ int Sh2MapHandler(uintptr_t nHandler, unsigned int nStart, unsigned int nEnd, in
 		}
 		
 	}
+
+#if defined SH2_X64_DRC
+	sh2_drc_map_changed(nStart, nEnd);
+#endif
+
 	return 0;
 }
 
@@ -470,6 +419,10 @@ int Sh2Exit()
 
 	has_sh2 = 0;
 
+#if defined SH2_X64_DRC
+	Sh2DrcExit();
+#endif
+
 	if (Sh2Ext) {
 		free(Sh2Ext);
 		Sh2Ext = NULL;
@@ -535,6 +488,16 @@ int Sh2Init(int nCount)
 		CpuCheatRegister(i, &Sh2Config);
 	}
 
+	nSh2IdleCore = BurnIdleRegister(&Sh2Config, sh2_idle_state);
+
+#if defined SH2_X64_DRC && !defined FBNEO_DEBUG
+	if (bBurnUseSh2Recompiler) {
+		for (int i=0; i<nCount; i++) {
+			Sh2DrcInit(i, Sh2Ext + i);
+		}
+	}
+#endif
+
 	return 0;
 }
 
@@ -546,6 +509,10 @@ void Sh2Open(const int i)
 
 	pSh2Ext = Sh2Ext + i;
 	sh2 = & (pSh2Ext->sh2);
+
+#if defined SH2_X64_DRC
+	Sh2DrcOpen(i);
+#endif
 }
 
 void Sh2Close()
@@ -570,7 +537,9 @@ int Sh2GetActive()
 	if (!DebugCPU_SH2Initted) bprintf(PRINT_ERROR, _T("Sh2GetActive called without init\n"));
 #endif
 
-	return 0;
+	if (pSh2Ext == NULL) return -1;
+
+	return (int)(pSh2Ext - Sh2Ext);
 }
 
 void Sh2Reset(unsigned int pc, unsigned r15)
@@ -594,6 +563,10 @@ void Sh2Reset(unsigned int pc, unsigned r15)
 	change_pc(sh2->pc & AM);
 
 	sh2->internal_irq_level = -1;
+
+#if defined SH2_X64_DRC
+	Sh2DrcVerify();
+#endif
 }
 
 //----------------------------------------------------------------
@@ -645,11 +618,17 @@ SH2_INLINE unsigned short cpu_readop16(unsigned int A)
 #endif
 		return *((unsigned short *)(pr + (A & SH2_PAGEM)));
 	}
-	return pSh2Ext->ReadWord[pr](A);
+	return pSh2Ext->ReadWord[(uintptr_t)pr](A);
 }
 
 #endif
 
+#if defined SH2_X64_DRC
+ #define DRC_WRITE(a, n) if (pSh2DrcCode && pSh2DrcCode[(a) >> SH2_SHIFT]) Sh2DrcWrite(a, n)
+#else
+ #define DRC_WRITE(a, n)
+#endif
+
 // ------------------------------------------------------
 
 SH2_INLINE UINT8 RB(UINT32 A)
@@ -727,6 +706,8 @@ SH2_INLINE void WB(UINT32 A, UINT8 V)
 	if (A >= 0x40000000) return;
 	program_write_byte_32be(A & AM,V); */
 	
+	if (nSh2IdleCore >= 0) nBurnIdleWrites++;
+
 	unsigned char* pr;
 	pr = pSh2Ext->MemMap[(A >> SH2_SHIFT) + SH2_WADD];
 	if ((uintptr_t)pr >= SH2_MAXHANDLER) {
@@ -734,9 +715,11 @@ SH2_INLINE void WB(UINT32 A, UINT8 V)
 		A ^= 3;
 #endif
 		pr[A & SH2_PAGEM] = (unsigned char)V;
+		DRC_WRITE(A, 1);
 		return;
 	}
 	pSh2Ext->WriteByte[(uintptr_t)pr](A, V);
+	DRC_WRITE(A, 1);
 }
 
 SH2_INLINE void WW(UINT32 A, UINT16 V)
@@ -746,6 +729,8 @@ SH2_INLINE void WW(UINT32 A, UINT16 V)
 	if (A >= 0x40000000) return;
 	program_write_word_32be(A & AM,V); */
 
+	if (nSh2IdleCore >= 0) nBurnIdleWrites++;
+
 	unsigned char * pr;
 	pr = pSh2Ext->MemMap[(A >> SH2_SHIFT) + SH2_WADD];
 	if ((uintptr_t)pr >= SH2_MAXHANDLER) {
@@ -753,9 +738,11 @@ SH2_INLINE void WW(UINT32 A, UINT16 V)
 		A ^= 2;
 #endif
 		*((unsigned short *)(pr + (A & SH2_PAGEM))) = (unsigned short)V;
+		DRC_WRITE(A, 2);
 		return;
 	}
 	pSh2Ext->WriteWord[(uintptr_t)pr](A, V);
+	DRC_WRITE(A, 2);
 }
 
 SH2_INLINE void WL(UINT32 A, UINT32 V)
@@ -764,13 +751,17 @@ SH2_INLINE void WL(UINT32 A, UINT32 V)
 	if (A >= 0xc0000000) { program_write_dword_32be(A,V); return; }
 	if (A >= 0x40000000) return;
 	program_write_dword_32be(A & AM,V); */
+	if (nSh2IdleCore >= 0) nBurnIdleWrites++;
+
 	unsigned char * pr;
 	pr = pSh2Ext->MemMap[(A >> SH2_SHIFT) + SH2_WADD];
 	if ((uintptr_t)pr >= SH2_MAXHANDLER) {
 		*((unsigned int *)(pr + (A & SH2_PAGEM))) = (unsigned int)V;
+		DRC_WRITE(A, 4);
 		return;
 	}
 	pSh2Ext->WriteLong[(uintptr_t)pr](A, V);
+	DRC_WRITE(A, 4);
 }
 
 SH2_INLINE void sh2_exception(/*const char *message,*/ int irqline)
@@ -972,6 +963,7 @@ SH2_INLINE void BF(UINT32 d)
 	if ((sh2->sr & T) == 0)
 	{
 		INT32 disp = ((INT32)d << 24) >> 24;
+		SH2_IDLE_BRANCH(sh2->pc - 2, sh2->pc + disp * 2 + 2);
 		sh2->pc = sh2->ea = sh2->pc + disp * 2 + 2;
 		change_pc(sh2->pc & AM);
 		sh2->sh2_icount -= 2;
@@ -987,6 +979,7 @@ SH2_INLINE void BFS(UINT32 d)
 	if ((sh2->sr & T) == 0)
 	{
 		INT32 disp = ((INT32)d << 24) >> 24;
+		SH2_IDLE_BRANCH(sh2->pc - 2, sh2->pc + disp * 2 + 2);
 		sh2->delay = sh2->pc;
 		sh2->pc = sh2->ea = sh2->pc + disp * 2 + 2;
 		sh2->sh2_icount--;
@@ -1019,6 +1012,7 @@ SH2_INLINE void BRA(UINT32 d)
 		}
 	}
 #endif
+	SH2_IDLE_BRANCH(sh2->pc - 2, sh2->pc + disp * 2 + 2);
 	sh2->delay = sh2->pc;
 	sh2->pc = sh2->ea = sh2->pc + disp * 2 + 2;
 	sh2->sh2_icount--;
@@ -1070,6 +1064,7 @@ SH2_INLINE void BT(UINT32 d)
 	if ((sh2->sr & T) != 0)
 	{
 		INT32 disp = ((INT32)d << 24) >> 24;
+		SH2_IDLE_BRANCH(sh2->pc - 2, sh2->pc + disp * 2 + 2);
 		sh2->pc = sh2->ea = sh2->pc + disp * 2 + 2;
 		change_pc(sh2->pc & AM);
 		sh2->sh2_icount -= 2;
@@ -1085,6 +1080,7 @@ SH2_INLINE void BTS(UINT32 d)
 	if ((sh2->sr & T) != 0)
 	{
 		INT32 disp = ((INT32)d << 24) >> 24;
+		SH2_IDLE_BRANCH(sh2->pc - 2, sh2->pc + disp * 2 + 2);
 		sh2->delay = sh2->pc;
 		sh2->pc = sh2->ea = sh2->pc + disp * 2 + 2;
 		sh2->sh2_icount--;
@@ -3269,12 +3265,109 @@ static UINT32 sh2_internal_r(UINT32 offset, UINT32 /*mem_mask*/)
 
 // -------------------------------------------------------
 
+SH2_INLINE void sh2_execute(UINT16 opcode)
+{
+	switch (opcode & ( 15 << 12))
+	{
+		case  0<<12: op0000(opcode); break;
+		case  1<<12: op0001(opcode); break;
+		case  2<<12: op0010(opcode); break;
+		case  3<<12: op0011(opcode); break;
+		case  4<<12: op0100(opcode); break;
+		case  5<<12: op0101(opcode); break;
+		case  6<<12: op0110(opcode); break;
+		case  7<<12: op0111(opcode); break;
+		case  8<<12: op1000(opcode); break;
+		case  9<<12: op1001(opcode); break;
+		case 10<<12: op1010(opcode); break;
+		case 11<<12: op1011(opcode); break;
+		case 12<<12: op1100(opcode); break;
+		case 13<<12: op1101(opcode); break;
+		case 14<<12: op1110(opcode); break;
+		default: op1111(opcode); break;
+	}
+}
+
+// latest icount translated code or an idle loop skip may run down to before one of the dma / frt timers is due
+static INT32 sh2_timer_stop(INT32 stop, UINT32 cy, UINT32 base, UINT32 cycles)
+{
+	if ((cy - base) >= cycles) return sh2->sh2_icount;
+
+	UINT32 left = cycles - (cy - base);
+	if (sh2->sh2_icount > 0 && left < (UINT32)sh2->sh2_icount) {
+		INT32 s = sh2->sh2_icount - left;
+		if (s > stop) stop = s;
+	}
+
+	return stop;
+}
+
+static INT32 sh2_event_stop()
+{
+	UINT32 cy = sh2_GetTotalCycles();
+	INT32 stop = 0;
+
+	if (sh2->dma_timer_active[0]) stop = sh2_timer_stop(stop, cy, sh2->dma_timer_base[0], sh2->dma_timer_cycles[0]);
+	if (sh2->dma_timer_active[1]) stop = sh2_timer_stop(stop, cy, sh2->dma_timer_base[1], sh2->dma_timer_cycles[1]);
+	if (sh2->timer_active) stop = sh2_timer_stop(stop, cy, sh2->timer_base, sh2->timer_cycles);
+
+	return stop;
+}
+
+// hash of everything a wait loop could change in the registers
+static UINT32 sh2_idle_state()
+{
+	UINT32 h = sh2->sr * 31 + sh2->gbr;
+	h = h * 31 + sh2->pr;
+	h = h * 31 + sh2->mach;
+	h = h * 31 + sh2->macl;
+
+	for (INT32 i = 0; i < 16; i++) {
+		h = h * 31 + sh2->r[i];
+	}
+
+	return h;
+}
+
+static void sh2_idle_branch(UINT32 from, UINT32 to)
+{
+	if (sh2->test_irq || sh2->end_run) return;
+
+	INT32 iteration = BurnIdleBranch(nSh2IdleCore, from, to, sh2_GetTotalCycles());
+	if (iteration == 0 || sh2->sh2_cycles_to_run - sh2->sh2_icount < iteration) return;	// its loads may be from before this run
+
+	// skip whole iterations, leaving the last one to run before the slice ends or a timer is due
+	INT32 left = sh2->sh2_icount - sh2_event_stop() - 1;
+	if (left < iteration) return;
+
+	INT32 skip = left - (left % iteration);
+	sh2->sh2_icount -= skip;
+	sh2->sh2_total_cycles += skip;
+	BurnIdleSkip(skip);
+}
+
+#if defined SH2_X64_DRC
+// the interpreter as seen from translated code, for the open cpu
+UINT32 Sh2DrcReadByte(UINT32 a)				{ return RB(a); }
+UINT32 Sh2DrcReadWord(UINT32 a)				{ return RW(a); }
+UINT32 Sh2DrcReadLong(UINT32 a)				{ return RL(a); }
+void Sh2DrcWriteByte(UINT32 a, UINT32 d)	{ WB(a, d); }
+void Sh2DrcWriteWord(UINT32 a, UINT32 d)	{ WW(a, d); }
+void Sh2DrcWriteLong(UINT32 a, UINT32 d)	{ WL(a, d); }
+void Sh2DrcExecute(UINT32 opcode)			{ sh2_execute(opcode); }
+INT32 Sh2DrcIdleAllowed(UINT32 pc)			{ return BurnIdleAllowed(nSh2IdleCore, pc); }
+INT32 Sh2DrcIdleCounting()					{ return nSh2IdleCore >= 0; }
+void Sh2DrcIdleBranch(UINT32 from, UINT32 to)	{ sh2_idle_branch(from, to); }
+#endif
+
 int Sh2Run(int cycles)
 {
 #if defined FBNEO_DEBUG
 	if (!DebugCPU_SH2Initted) bprintf(PRINT_ERROR, _T("Sh2Run called without init\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	sh2->sh2_icount = cycles;
 	sh2->sh2_cycles_to_run = cycles;
 	sh2->end_run = 0;
@@ -3288,37 +3381,29 @@ int Sh2Run(int cycles)
 		}
 
 		if (pSh2Ext->suspend == 0) {
-			UINT16 opcode;
-
-			if (sh2->delay) {
-				opcode = cpu_readop16(sh2->delay & AM);
-				change_pc(sh2->pc & AM);
-				sh2->delay = 0;
-			} else {
-				opcode = cpu_readop16(sh2->pc & AM);
-				sh2->pc += 2;
-			}
+#if defined SH2_X64_DRC
+			// translated code stops with its last instruction uncharged, that's done below
+			if (pSh2DrcCode && !sh2->delay && !sh2->test_irq && Sh2DrcRun(sh2_event_stop())) {
+				UINT32 pc = sh2->pc;				// re-load the opbase for the next fetch, leaving the pc alone
+				change_pc((sh2->delay ? sh2->delay : pc) & AM);
+				sh2->pc = pc;
+			} else
+#endif
+			{
+				UINT16 opcode;
+
+				if (sh2->delay) {
+					opcode = cpu_readop16(sh2->delay & AM);
+					change_pc(sh2->pc & AM);
+					sh2->delay = 0;
+				} else {
+					opcode = cpu_readop16(sh2->pc & AM);
+					sh2->pc += 2;
+				}
 
-			sh2->ppc = sh2->pc;
+				sh2->ppc = sh2->pc;
 
-			switch (opcode & ( 15 << 12))
-			{
-				case  0<<12: op0000(opcode); break;
-				case  1<<12: op0001(opcode); break;
-				case  2<<12: op0010(opcode); break;
-				case  3<<12: op0011(opcode); break;
-				case  4<<12: op0100(opcode); break;
-				case  5<<12: op0101(opcode); break;
-				case  6<<12: op0110(opcode); break;
-				case  7<<12: op0111(opcode); break;
-				case  8<<12: op1000(opcode); break;
-				case  9<<12: op1001(opcode); break;
-				case 10<<12: op1010(opcode); break;
-				case 11<<12: op1011(opcode); break;
-				case 12<<12: op1100(opcode); break;
-				case 13<<12: op1101(opcode); break;
-				case 14<<12: op1110(opcode); break;
-			default: op1111(opcode); break;
+				sh2_execute(opcode);
 			}
 		}
 
@@ -3454,6 +3539,10 @@ void Sh2NewFrame()
 #endif
 
 	sh2->sh2_total_cycles = 0;
+
+#if defined SH2_X64_DRC
+	Sh2DrcVerify();
+#endif
 }
 
 void Sh2BurnCycles(int cycles)
@@ -3531,6 +3620,12 @@ int Sh2Scan(int nAction)
 #endif
 		}
 
+#if defined SH2_X64_DRC
+		if (nAction & ACB_WRITE) {
+			Sh2DrcVerify();
+		}
+#endif
+
 	}
 	
 	return 0;
@@ -0,0 +1,93 @@
+// SH-2 core context and memory map, shared by the interpreter (sh2.cpp) and the recompiler (x64/sh2_x64.cpp)
+
+#ifndef SH2_CORE_H
+#define SH2_CORE_H
+
+typedef struct
+{
+	INT32 irq_vector;
+	INT32 irq_priority;
+} irq_entry;
+
+typedef struct
+{
+	UINT32	ppc;
+	UINT32	pc;
+	UINT32	pr;
+	UINT32	sr;
+	UINT32	gbr, vbr;
+	UINT32	mach, macl;
+	UINT32	r[16];
+	UINT32	ea;
+	UINT32	delay;
+	UINT32	cpu_off;
+	UINT32	dvsr, dvdnth, dvdntl, dvcr;
+	UINT32	pending_irq;
+	UINT32    test_irq;
+	irq_entry     irq_queue[16];
+
+	INT8	irq_line_state[17];
+	UINT32	m[0x200];
+	INT8  nmi_line_state;
+
+	UINT16 	frc;
+	UINT16 	ocra, ocrb, icr;
+	UINT32 	frc_base;
+
+	INT32	frt_input;
+	INT32 	internal_irq_level;
+	INT32 	internal_irq_vector;
+
+//	emu_timer *timer;
+	UINT32 	timer_cycles;
+	UINT32 	timer_base;
+	INT32   timer_active;
+
+//	emu_timer *dma_timer[2];
+	UINT32 	dma_timer_cycles[2];
+	UINT32 	dma_timer_base[2];
+	INT32   dma_timer_active[2];
+
+//	int     is_slave, cpu_number;
+
+	UINT32	cycle_counts; // used internally for timers / sh2_GetTotalCycles()
+	UINT32	sh2_cycles_to_run;
+	INT32	sh2_icount;
+	INT32   sh2_total_cycles; // used externally (drivers/etc)
+	INT32   sh2_eat_cycles;
+	INT32   end_run;
+
+	int 	(*irq_callback)(int irqline);
+} SH2;
+
+//-- sh2 memory handler for Finalburn Alpha ---------------------
+
+#define SH2_BITS		(16)					// 16 = 0x10000 page size
+#define SH2_PAGE_COUNT  (1 << (32 - SH2_BITS))	// Number of pages
+#define SH2_SHIFT		(SH2_BITS)				// Shift value = page bits
+#define SH2_PAGE_SIZE	(1 << SH2_BITS)			// Page size
+#define SH2_PAGEM		(SH2_PAGE_SIZE - 1)
+#define SH2_WADD		(SH2_PAGE_COUNT)		// Value to add for write section = Number of pages
+#define SH2_MASK		(SH2_WADD - 1)
+
+#define	SH2_MAXHANDLER	(8)
+
+#define SH2_AM			0xc7ffffff				// instruction fetches ignore address bits 27-29
+
+
+typedef struct
+{
+	SH2	sh2;
+	unsigned char * MemMap[SH2_PAGE_COUNT * 3];
+	pSh2ReadByteHandler ReadByte[SH2_MAXHANDLER];
+	pSh2WriteByteHandler WriteByte[SH2_MAXHANDLER];
+	pSh2ReadWordHandler ReadWord[SH2_MAXHANDLER];
+	pSh2WriteWordHandler WriteWord[SH2_MAXHANDLER];
+	pSh2ReadLongHandler ReadLong[SH2_MAXHANDLER];
+	pSh2WriteLongHandler WriteLong[SH2_MAXHANDLER];
+
+	unsigned char * opbase;
+	int suspend;
+} SH2EXT;
+
+#endif
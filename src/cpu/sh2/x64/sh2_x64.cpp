@@ -0,0 +1,1881 @@
+// SH-2 block recompiler for x86-64 hosts
+//
+// Runs on the interpreter's context (SH2EXT), so save states, Sh2GetPC(), the speedhack
+// read handlers and the on-chip timers / dma see exactly what the interpreter would leave
+// behind.  Code is translated a block at a time out of the fetch map; memory operands go
+// straight through the MemMap page tables and drop to the Sh2 handlers for handler pages.
+// Delay slots are translated inline behind their branch.  Instructions we don't translate
+// (mac, trapa, rte, sleep, ldc sr) are run by calling the interpreter from inside the block.
+// Taken short backward branches go to the interpreter's idle loop skip (burn_idle.cpp), the
+// stores done inline are counted in DrcHot and handed to it there.
+//
+// Stale code: Sh2 writes (the cpus and their dma) to pages holding translated code invalidate
+// the blocks there, and blocks translated from ram an SH-2 can write compare their code on
+// every entry, which also catches the driver and the other cpus.  Code elsewhere (rom) is
+// checked at frame start, reset and state load.
+//
+// Sh2Run() stays in charge: it asks for a run down to the next timer event, and charges the
+// last instruction of the run itself (total_cycles, eat cycles, pending irq and timer checks).
+//
+// Register use inside generated code:
+//   rbx = &SH2, r12 = MemMap, r13d = icount to stop at, r14 = DrcHot
+//   rbp, r15 = callee saved temporaries that live across memory accesses
+//   eax = operand / result, ecx = address, edx, r8-r11 = scratch
+
+#ifdef SH2_X64_DRC
+
+#include "burnint.h"
+#include "sh2_intf.h"
+#include "../sh2_core.h"
+#include "sh2_x64.h"
+
+#include <deque>
+#include <vector>
+#include <unordered_map>
+
+#include "../../mips3/x64/xbyak/xbyak.h"
+
+#define DRC_MAX				4						// cpus
+#define DRC_CODE_SIZE		(16 * 1024 * 1024)
+#define DRC_CODE_SLACK		(256 * 1024)			// room a single block may need
+#define DRC_CACHE_SIZE		4096					// direct mapped pc -> code cache (power of 2)
+#define DRC_MAX_INSNS		128						// instructions per block
+
+#define DRC_BREAK_EXIT		1						// leave the block after this instruction
+
+#define SR_T				0x00000001
+#define SR_Q				0x00000100
+#define SR_M				0x00000200
+
+struct DrcBlock;
+
+struct DrcCacheEntry {
+	UINT32 nPC;
+	UINT32 nPad;
+	UINT8* pFetch;
+	void* pCode;
+	DrcBlock* pBlock;
+};
+
+// everything generated code touches besides the SH2 context, addressed through r14
+struct DrcHot {
+	UINT8 Code[SH2_PAGE_COUNT];					// must stay first
+	UINT32 nBreak;
+	UINT32 nWrites;								// inline stores not yet added to nBurnIdleWrites
+	DrcCacheEntry Cache[DRC_CACHE_SIZE];
+};
+
+#define HOT_BREAK			((INT32)offsetof(DrcHot, nBreak))
+#define HOT_WRITES			((INT32)offsetof(DrcHot, nWrites))
+#define HOT_CACHE			((INT32)offsetof(DrcHot, Cache))
+
+class Sh2Drc;
+
+struct DrcBlock {
+	UINT32 nPC;
+	UINT32 nPage;								// pc >> SH2_SHIFT
+	INT32 nLen;									// bytes of host memory covered
+	bool bDead;
+	bool bCheck;								// in ram: compared with pSource on every entry
+	UINT8* pFetch;								// fetch page it was translated from
+	UINT8* pHost;								// first byte of its code in host memory
+	UINT8* pSource;								// copy of that code
+	void* pCode;
+	Sh2Drc* pOwner;
+};
+
+// host address >> SH2_SHIFT -> blocks (of every cpu) whose code lives there
+static std::unordered_map<uintptr_t, std::vector<DrcBlock*> > DrcChunks;
+
+static Sh2Drc* DrcCPU[DRC_MAX] = { NULL, };
+static Sh2Drc* pDrcActive = NULL;
+UINT8* pSh2DrcCode = NULL;
+
+// ----------------------------------------------------------------------------
+// Instruction decoding helpers
+
+// instructions that change the pc (or may, like the busy loop bra $)
+static bool IsBranch(UINT32 op)
+{
+	switch (op >> 12) {
+		case 0x0:
+			switch (op & 0x3f) {
+				case 0x03: case 0x23: case 0x0b: case 0x1b: case 0x2b:			// bsrf, braf, rts, sleep, rte
+					return true;
+			}
+			return false;
+
+		case 0x4:
+			return (op & 0x3f) == 0x0b || (op & 0x3f) == 0x2b;					// jsr, jmp
+
+		case 0x8:
+			return (op & 0x0900) == 0x0900;										// bt, bf, bt/s, bf/s
+
+		case 0xa: case 0xb:														// bra, bsr
+			return true;
+
+		case 0xc:
+			return (op & 0x0f00) == 0x0300;										// trapa
+	}
+
+	return false;
+}
+
+// ----------------------------------------------------------------------------
+// The recompiler
+
+enum { STUB_READ, STUB_WRITE, STUB_EXIT, STUB_DELAY };
+
+struct DrcStub {
+	Xbyak::Label lFrom, lBack;
+	INT32 nType;
+	INT32 nSize;
+	UINT32 nPPC, nPC;
+	bool bCall;
+	bool bSlot;
+};
+
+enum { CC_Z, CC_NZ, CC_C, CC_A, CC_AE, CC_G, CC_GE, CC_O };
+
+#define CPU_OFS(f)		((INT32)offsetof(SH2, f))
+#define CPU_R(n)		dword[rbx + CPU_OFS(r) + (n) * 4]
+#define CPU_REG(f)		dword[rbx + CPU_OFS(f)]
+
+class Sh2Drc : public Xbyak::CodeGenerator
+{
+public:
+	Sh2Drc(INT32 nCPU, SH2EXT* pExt);
+	~Sh2Drc();
+
+	INT32 Run(INT32 nStop);
+	void MapChanged(UINT32 nStart, UINT32 nEnd);
+	void Verify();
+	void CheckHost(UINT8* p, INT32 nLen);
+	void Invalidate(DrcBlock* b);
+	void CodeAdded(uintptr_t nChunk);
+	void Flush();
+
+	SH2EXT* pExt;
+	DrcHot* pHot;
+	bool bVerifyPending;
+
+private:
+	void* Find(UINT32 nPC);
+	DrcBlock* Compile(UINT32 nPC, UINT8* pFetch);
+	void EmitCommon();
+	bool PageHasCode(INT32 nPage);
+	void ComputeCode(INT32 nFirst, INT32 nLast);
+	void Forget(DrcBlock* b);
+	void EmitCheck(DrcBlock* b, const void* pBody);
+
+	// translation
+	UINT32 Word(UINT32 nPC) { return *(UINT16*)(m_pPage + ((nPC ^ 2) & SH2_PAGEM)); }
+
+	INT32 CompileInsn();
+	INT32 CompileFallback();
+	INT32 Compile0000();
+	INT32 Compile0010();
+	INT32 Compile0011();
+	INT32 Compile0100();
+	INT32 Compile0110();
+	INT32 Compile1000();
+	INT32 Compile1100();
+	INT32 CompileDelayed(bool bConst, UINT32 nTarget, INT32 nCycles, bool bLink);
+	INT32 CompileDT(INT32 n);
+	INT32 CompileDIV1(INT32 m, INT32 n);
+
+	DrcStub& NewStub(INT32 nType, INT32 nSize);
+	void EmitStubs();
+	void MemRead(INT32 nSize);
+	void MemWrite(INT32 nSize);
+	void LoadPC(const Xbyak::Reg32& r);
+	void SetT(INT32 nCC);
+	void EndInsn(INT32 nCycles);
+	void EndBranch(UINT32 nTarget, INT32 nCycles);
+	void JumpTo(UINT32 nTarget);
+	void IdleBranch(UINT32 nTarget);
+
+	INT32 m_nCPU;
+	INT32 m_nDepth;
+	INT32 m_nEat;								// sh2_eat_cycles the code was translated for
+	bool m_bFlushPending;
+
+	void (*m_pEntry)(void*, DrcHot*, INT32);
+	Xbyak::Label* m_plExit;						// the interpreter loop charges the last instruction
+	Xbyak::Label* m_plExitUndo;					// ... which translated code already charged
+	Xbyak::Label* m_plDispatch;
+
+	std::unordered_multimap<UINT32, DrcBlock*> m_Blocks;
+	std::unordered_map<UINT32, std::vector<DrcBlock*> > m_Pages;
+	std::vector<DrcBlock*> m_Dead;
+
+	// state of the block being translated
+	UINT8* m_pPage;
+	UINT32 m_nPageBase, m_nPageEnd;
+	UINT32 m_nPC, m_nInsnPC, m_nOp;
+	UINT32 m_nExtent;
+	bool m_bCall;
+	bool m_bSlot;								// translating a delay slot: pc and ppc hold the branch target
+	bool m_bSlotConst;							// ... which is m_nSlotPC
+	UINT32 m_nSlotPC;
+	std::deque<DrcStub> m_Stubs;
+	std::vector<std::pair<UINT32, const UINT8*> > m_Insns;
+};
+
+// something the interpreter loop has to look at happened inside a handler, leave after this instruction
+static inline void DrcCheck(UINT32 nPC)
+{
+	SH2EXT* p = pDrcActive->pExt;
+
+	if (p->sh2.pc != nPC || p->sh2.delay || p->sh2.test_irq || p->sh2.end_run || p->suspend) {
+		pDrcActive->pHot->nBreak |= DRC_BREAK_EXIT;
+	}
+}
+
+// writes to the on-chip registers can start the dma or the frt
+static inline void DrcCheckWrite(UINT32 a)
+{
+	if ((uintptr_t)pDrcActive->pExt->MemMap[SH2_WADD + (a >> SH2_SHIFT)] == SH2_MAXHANDLER - 1) {
+		pDrcActive->pHot->nBreak |= DRC_BREAK_EXIT;
+	}
+}
+
+// the stores translated code did itself, for burn_idle.cpp (the interpreter may be about to look)
+static inline void DrcFlushWrites()
+{
+	nBurnIdleWrites += pDrcActive->pHot->nWrites;
+	pDrcActive->pHot->nWrites = 0;
+}
+
+// memory handlers and the interpreter, called from generated code
+static UINT32 DrcRead8(UINT32 a)			{ UINT32 nPC = pDrcActive->pExt->sh2.pc; UINT32 d = Sh2DrcReadByte(a); DrcCheck(nPC); return d; }
+static UINT32 DrcRead16(UINT32 a)			{ UINT32 nPC = pDrcActive->pExt->sh2.pc; UINT32 d = Sh2DrcReadWord(a); DrcCheck(nPC); return d; }
+static UINT32 DrcRead32(UINT32 a)			{ UINT32 nPC = pDrcActive->pExt->sh2.pc; UINT32 d = Sh2DrcReadLong(a); DrcCheck(nPC); return d; }
+static void DrcWrite8(UINT32 a, UINT32 d)	{ UINT32 nPC = pDrcActive->pExt->sh2.pc; Sh2DrcWriteByte(a, d); DrcCheck(nPC); DrcCheckWrite(a); }
+static void DrcWrite16(UINT32 a, UINT32 d)	{ UINT32 nPC = pDrcActive->pExt->sh2.pc; Sh2DrcWriteWord(a, d); DrcCheck(nPC); DrcCheckWrite(a); }
+static void DrcWrite32(UINT32 a, UINT32 d)	{ UINT32 nPC = pDrcActive->pExt->sh2.pc; Sh2DrcWriteLong(a, d); DrcCheck(nPC); DrcCheckWrite(a); }
+static void DrcExecute(UINT32 op)			{ UINT32 nPC = pDrcActive->pExt->sh2.pc; DrcFlushWrites(); Sh2DrcExecute(op); DrcCheck(nPC); }
+
+static void DrcIdleBranch(UINT32 nFrom, UINT32 nTo)
+{
+	DrcFlushWrites();
+	Sh2DrcIdleBranch(nFrom, nTo);
+}
+
+Sh2Drc::Sh2Drc(INT32 nCPU, SH2EXT* pSh2Ext) : CodeGenerator(DRC_CODE_SIZE)
+{
+	m_nCPU = nCPU;
+	m_nDepth = 0;
+	m_nEat = pSh2Ext->sh2.sh2_eat_cycles;
+	m_bFlushPending = true;
+	m_plExit = NULL;
+	m_plExitUndo = NULL;
+	m_plDispatch = NULL;
+	m_bSlot = false;
+
+	pExt = pSh2Ext;
+	pHot = new DrcHot;
+	memset(pHot->Code, 0, sizeof(pHot->Code));
+	pHot->nBreak = 0;
+	pHot->nWrites = 0;
+	bVerifyPending = false;
+
+	Flush();
+}
+
+Sh2Drc::~Sh2Drc()
+{
+	m_bFlushPending = true;
+	m_nDepth = 0;
+	Flush();
+
+	delete m_plExit;
+	delete m_plExitUndo;
+	delete m_plDispatch;
+	delete pHot;
+}
+
+// ----------------------------------------------------------------------------
+// Block bookkeeping
+
+// ram some SH-2 writes directly: the driver and the other cpus can change it too, and their
+// writes don't come through the Sh2 handlers
+static bool DrcRamBacked(UINT8* p, INT32 nLen)
+{
+	for (INT32 n = 0; n < DRC_MAX; n++) {
+		if (DrcCPU[n] == NULL) continue;
+
+		UINT8** pMemMap = DrcCPU[n]->pExt->MemMap;
+		for (INT32 i = 0; i < SH2_PAGE_COUNT; i++) {
+			UINT8* w = pMemMap[SH2_WADD + i];
+			if ((uintptr_t)w >= SH2_MAXHANDLER && w < p + nLen && p < w + SH2_PAGE_SIZE) return true;
+		}
+	}
+
+	return false;
+}
+
+// called from the entry check of a block whose code changed
+static void DrcStale(DrcBlock* b)
+{
+	b->pOwner->Invalidate(b);
+}
+
+void Sh2Drc::Forget(DrcBlock* b)
+{
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.find(b->nPC); i != m_Blocks.end() && i->first == b->nPC; ++i) {
+		if (i->second == b) {
+			m_Blocks.erase(i);
+			break;
+		}
+	}
+
+	std::vector<DrcBlock*>& v = m_Pages[b->nPage];
+	for (UINT32 i = 0; i < v.size(); i++) {
+		if (v[i] == b) {
+			v.erase(v.begin() + i);
+			break;
+		}
+	}
+
+	for (uintptr_t k = (uintptr_t)b->pHost >> SH2_SHIFT; k <= ((uintptr_t)b->pHost + b->nLen - 1) >> SH2_SHIFT; k++) {
+		std::unordered_map<uintptr_t, std::vector<DrcBlock*> >::iterator c = DrcChunks.find(k);
+		if (c == DrcChunks.end()) continue;
+
+		for (UINT32 i = 0; i < c->second.size(); i++) {
+			if (c->second[i] == b) {
+				c->second.erase(c->second.begin() + i);
+				break;
+			}
+		}
+		if (c->second.empty()) DrcChunks.erase(c);
+	}
+
+	DrcCacheEntry& e = pHot->Cache[(b->nPC >> 1) & (DRC_CACHE_SIZE - 1)];
+	if (e.pBlock == b) {
+		e.nPC = ~0;
+		e.pFetch = (UINT8*)~(uintptr_t)0;
+		e.pBlock = NULL;
+	}
+}
+
+// The block's code is stale - it stays in the code buffer (it may be running) until the next flush
+void Sh2Drc::Invalidate(DrcBlock* b)
+{
+	if (b->bDead) return;
+
+	b->bDead = true;
+	Forget(b);
+	m_Dead.push_back(b);
+
+	pHot->nBreak |= DRC_BREAK_EXIT;
+}
+
+void Sh2Drc::Flush()
+{
+	if (m_nDepth > 1 || !m_bFlushPending) return;
+
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.begin(); i != m_Blocks.end(); ++i) {
+		m_Dead.push_back(i->second);
+	}
+	for (UINT32 i = 0; i < m_Dead.size(); i++) {
+		DrcBlock* b = m_Dead[i];
+		if (!b->bDead) {
+			b->bDead = true;
+			Forget(b);
+		}
+		free(b->pSource);
+		delete b;
+	}
+	m_Dead.clear();
+	m_Blocks.clear();
+	m_Pages.clear();
+
+	for (INT32 i = 0; i < DRC_CACHE_SIZE; i++) {
+		pHot->Cache[i].nPC = ~0;
+		pHot->Cache[i].pFetch = (UINT8*)~(uintptr_t)0;
+		pHot->Cache[i].pCode = NULL;
+		pHot->Cache[i].pBlock = NULL;
+	}
+
+	// not reset(): that restarts the label ids, and jumps to labels dropped by a failed
+	// translation are still waiting in xbyak's lists - a new label with their id would patch them
+	m_Stubs.clear();
+	delete m_plExit;
+	delete m_plExitUndo;
+	delete m_plDispatch;
+	setSize(0);
+	m_plExit = new Xbyak::Label;
+	m_plExitUndo = new Xbyak::Label;
+	m_plDispatch = new Xbyak::Label;
+	EmitCommon();
+
+	ComputeCode(0, SH2_PAGE_COUNT - 1);
+
+	m_bFlushPending = false;
+}
+
+// a write to this page may have to look for code: it's writable memory holding some
+// cpu's code, or a handler page whose fetch side is code
+bool Sh2Drc::PageHasCode(INT32 nPage)
+{
+	UINT8* p = pExt->MemMap[SH2_WADD + nPage];
+	INT32 nLen = SH2_PAGE_SIZE + 3;
+
+	if ((uintptr_t)p < SH2_MAXHANDLER) {
+		p = pExt->MemMap[SH2_WADD * 2 + nPage];
+		nLen = SH2_PAGE_SIZE;
+		if ((uintptr_t)p < SH2_MAXHANDLER) return false;
+	}
+
+	for (uintptr_t k = (uintptr_t)p >> SH2_SHIFT; k <= ((uintptr_t)p + nLen - 1) >> SH2_SHIFT; k++) {
+		if (DrcChunks.count(k)) return true;
+	}
+
+	return false;
+}
+
+void Sh2Drc::ComputeCode(INT32 nFirst, INT32 nLast)
+{
+	if (DrcChunks.empty()) {
+		memset(pHot->Code + nFirst, 0, nLast - nFirst + 1);
+		return;
+	}
+
+	for (INT32 i = nFirst; i <= nLast; i++) {
+		pHot->Code[i] = PageHasCode(i);
+	}
+}
+
+// a chunk of host memory got its first block - flag the pages that can write to it
+void Sh2Drc::CodeAdded(uintptr_t nChunk)
+{
+	for (INT32 i = 0; i < SH2_PAGE_COUNT; i++) {
+		if (pHot->Code[i]) continue;
+
+		uintptr_t p = (uintptr_t)pExt->MemMap[SH2_WADD + i];
+		uintptr_t nLen = SH2_PAGE_SIZE + 3;
+		if (p < SH2_MAXHANDLER) {
+			p = (uintptr_t)pExt->MemMap[SH2_WADD * 2 + i];
+			nLen = SH2_PAGE_SIZE;
+			if (p < SH2_MAXHANDLER) continue;
+		}
+
+		if ((p >> SH2_SHIFT) <= nChunk && ((p + nLen - 1) >> SH2_SHIFT) >= nChunk) {
+			pHot->Code[i] = 1;
+		}
+	}
+}
+
+// something wrote p[0 .. nLen - 1]
+void Sh2Drc::CheckHost(UINT8* p, INT32 nLen)
+{
+	for (uintptr_t k = (uintptr_t)p >> SH2_SHIFT; k <= ((uintptr_t)p + nLen - 1) >> SH2_SHIFT; k++) {
+		std::unordered_map<uintptr_t, std::vector<DrcBlock*> >::iterator c = DrcChunks.find(k);
+		if (c == DrcChunks.end()) continue;
+
+		std::vector<DrcBlock*> v = c->second;
+		for (UINT32 i = 0; i < v.size(); i++) {
+			DrcBlock* b = v[i];
+			if (b->pHost < p + nLen && p < b->pHost + b->nLen && memcmp(b->pHost, b->pSource, b->nLen)) {
+				b->pOwner->Invalidate(b);
+			}
+		}
+	}
+}
+
+void Sh2Drc::MapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	INT32 nFirst = nStart >> SH2_SHIFT;
+	INT32 nLast = nEnd >> SH2_SHIFT;
+	if (nLast < nFirst) nLast = SH2_PAGE_COUNT - 1;
+
+	ComputeCode(nFirst, nLast);
+
+	// blocks in the range that match the new mapping must still match its memory
+	for (std::unordered_map<UINT32, std::vector<DrcBlock*> >::iterator i = m_Pages.begin(); i != m_Pages.end(); ++i) {
+		if ((INT32)i->first < nFirst || (INT32)i->first > nLast) continue;
+
+		std::vector<DrcBlock*> v = i->second;
+		for (UINT32 j = 0; j < v.size(); j++) {
+			DrcBlock* b = v[j];
+			if (b->pFetch == pExt->MemMap[SH2_WADD * 2 + b->nPage] && memcmp(b->pHost, b->pSource, b->nLen)) {
+				Invalidate(b);
+			}
+		}
+	}
+
+	pHot->nBreak |= DRC_BREAK_EXIT;
+}
+
+void Sh2Drc::Verify()
+{
+	bVerifyPending = false;
+
+	std::vector<DrcBlock*> v;
+	for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.begin(); i != m_Blocks.end(); ++i) {
+		DrcBlock* b = i->second;
+		if (b->pFetch == pExt->MemMap[SH2_WADD * 2 + b->nPage] && memcmp(b->pHost, b->pSource, b->nLen)) {
+			v.push_back(b);
+		}
+	}
+	for (UINT32 i = 0; i < v.size(); i++) {
+		Invalidate(v[i]);
+	}
+}
+
+// ----------------------------------------------------------------------------
+// Execution
+
+// entry trampoline, exits and the block to block dispatcher
+void Sh2Drc::EmitCommon()
+{
+	m_pEntry = getCurr<void (*)(void*, DrcHot*, INT32)>();
+
+	push(rbx);
+	push(rbp);
+	push(r12);
+	push(r13);
+	push(r14);
+	push(r15);
+#ifdef _WIN32
+	push(rsi);
+	push(rdi);
+#endif
+	sub(rsp, 56);								// shadow space + 3 slots, keeps rsp 16 byte aligned
+
+	mov(rbx, (size_t)&pExt->sh2);
+	mov(r12, (size_t)pExt->MemMap);
+#ifdef _WIN32
+	mov(r14, rdx);
+	mov(r13d, r8d);
+	jmp(rcx);
+#else
+	mov(r14, rsi);
+	mov(r13d, edx);
+	jmp(rdi);
+#endif
+
+	// hand the last instruction's accounting back to Sh2Run()
+	L(*m_plExitUndo);
+	add(CPU_REG(sh2_icount), m_nEat);
+	dec(CPU_REG(sh2_total_cycles));
+
+	L(*m_plExit);
+	add(rsp, 56);
+#ifdef _WIN32
+	pop(rdi);
+	pop(rsi);
+#endif
+	pop(r15);
+	pop(r14);
+	pop(r13);
+	pop(r12);
+	pop(rbp);
+	pop(rbx);
+	ret();
+
+	// pc is set and there are cycles left: find the next block in the cache or leave
+	align(16);
+	L(*m_plDispatch);
+	mov(eax, CPU_REG(pc));
+	mov(edx, eax);
+	shr(edx, SH2_SHIFT);
+	mov(r8, qword[r12 + rdx * 8 + SH2_WADD * 2 * 8]);
+	mov(ecx, eax);
+	and_(ecx, (DRC_CACHE_SIZE - 1) << 1);
+	shl(ecx, 4);
+	lea(r9, ptr[r14 + rcx + HOT_CACHE]);
+	cmp(dword[r9 + offsetof(DrcCacheEntry, nPC)], eax);
+	jne(*m_plExitUndo, T_NEAR);
+	cmp(qword[r9 + offsetof(DrcCacheEntry, pFetch)], r8);
+	jne(*m_plExitUndo, T_NEAR);
+	jmp(qword[r9 + offsetof(DrcCacheEntry, pCode)]);
+}
+
+void* Sh2Drc::Find(UINT32 nPC)
+{
+	// blocks are keyed by the pc the interpreter keeps, so only follow masked pcs
+	if ((nPC & 1) || nPC != (nPC & SH2_AM) || m_bFlushPending) return NULL;
+
+	UINT8* pFetch = pExt->MemMap[SH2_WADD * 2 + (nPC >> SH2_SHIFT)];
+	if ((uintptr_t)pFetch < SH2_MAXHANDLER) return NULL;
+
+	DrcCacheEntry& e = pHot->Cache[(nPC >> 1) & (DRC_CACHE_SIZE - 1)];
+	DrcBlock* b = NULL;
+	if (e.nPC == nPC && e.pFetch == pFetch) {
+		b = e.pBlock;
+	} else {
+		for (std::unordered_multimap<UINT32, DrcBlock*>::iterator i = m_Blocks.find(nPC); i != m_Blocks.end() && i->first == nPC; ++i) {
+			if (i->second->pFetch == pFetch) {
+				b = i->second;
+				break;
+			}
+		}
+	}
+
+	// the entry check would leave without running anything, but Sh2Run() takes a run as at least one instruction
+	if (b && b->bCheck && memcmp(b->pHost, b->pSource, b->nLen)) {
+		Invalidate(b);
+		b = NULL;
+	}
+
+	if (b == NULL) {
+		if (getSize() + DRC_CODE_SLACK > DRC_CODE_SIZE) {
+			m_bFlushPending = true;
+			Flush();
+			if (m_bFlushPending) return NULL;	// nested, let the outer run flush
+		}
+
+		b = Compile(nPC, pFetch);
+		if (b == NULL) return NULL;
+	}
+
+	e.nPC = nPC;
+	e.pFetch = pFetch;
+	e.pCode = b->pCode;
+	e.pBlock = b;
+
+	return b->pCode;
+}
+
+INT32 Sh2Drc::Run(INT32 nStop)
+{
+	if (pExt->sh2.sh2_eat_cycles != m_nEat) {
+		m_nEat = pExt->sh2.sh2_eat_cycles;		// charged by every instruction, so retranslate
+		m_bFlushPending = true;
+	}
+
+	m_nDepth++;
+
+	if (m_nDepth == 1) {
+		Flush();
+		if (bVerifyPending) Verify();
+	}
+
+	void* pCode = Find(pExt->sh2.pc);
+	if (pCode) {
+		UINT32 nOuter = pHot->nBreak;
+
+		pHot->nBreak = 0;
+		m_pEntry(pCode, pHot, nStop);
+		DrcFlushWrites();
+
+		// we ran from inside a handler (irq ack, Sh2SetIRQLine() with CPU_IRQSTATUS_AUTO), the outer block stops too
+		if (m_nDepth > 1) pHot->nBreak = nOuter | DRC_BREAK_EXIT;
+	}
+
+	m_nDepth--;
+
+	return pCode != NULL;
+}
+
+// ----------------------------------------------------------------------------
+// Code emitters
+
+DrcStub& Sh2Drc::NewStub(INT32 nType, INT32 nSize)
+{
+	m_Stubs.emplace_back();
+	DrcStub& s = m_Stubs.back();
+
+	s.nType = nType;
+	s.nSize = nSize;
+	s.nPPC = m_nInsnPC + 2;
+	s.nPC = m_nPC;
+	s.bCall = m_bCall;
+	s.bSlot = m_bSlot;
+
+	return s;
+}
+
+void Sh2Drc::EmitStubs()
+{
+	static const void* pRead[3]  = { (void*)DrcRead8,  (void*)DrcRead16,  (void*)DrcRead32  };
+	static const void* pWrite[3] = { (void*)DrcWrite8, (void*)DrcWrite16, (void*)DrcWrite32 };
+
+	for (std::deque<DrcStub>::iterator i = m_Stubs.begin(); i != m_Stubs.end(); ++i) {
+		DrcStub& s = *i;
+
+		L(s.lFrom);
+
+		switch (s.nType) {
+			case STUB_EXIT:
+				if (s.bCall) {
+					// a handler left things as the interpreter loop has to see them
+					cmp(dword[r14 + HOT_BREAK], 0);
+					jne(*m_plExitUndo, T_NEAR);
+				}
+				if (!s.bSlot) {
+					mov(CPU_REG(pc), s.nPC);
+					mov(CPU_REG(ppc), s.nPPC);
+				}
+				jmp(*m_plExitUndo, T_NEAR);
+				continue;
+
+			case STUB_DELAY:
+				// out of cycles between a delayed branch and its slot, pc already holds the target
+				mov(CPU_REG(ppc), s.nPPC);
+				mov(CPU_REG(delay), s.nPPC);
+				jmp(*m_plExitUndo, T_NEAR);
+				continue;
+		}
+
+		// the handler sees the registers as the interpreter would have them
+		if (!s.bSlot) {
+			mov(CPU_REG(pc), s.nPC);
+			mov(CPU_REG(ppc), s.nPPC);
+		}
+
+		INT32 nFunc = (s.nSize == 4) ? 2 : (s.nSize - 1);
+		if (s.nType == STUB_WRITE) {
+#ifdef _WIN32
+			mov(edx, eax);
+#else
+			mov(esi, eax);
+			mov(edi, ecx);
+#endif
+			mov(rax, (size_t)pWrite[nFunc]);
+		} else {
+#ifndef _WIN32
+			mov(edi, ecx);
+#endif
+			mov(rax, (size_t)pRead[nFunc]);
+		}
+		call(rax);
+		jmp(s.lBack, T_NEAR);
+	}
+
+	m_Stubs.clear();
+}
+
+// ecx = address -> eax
+void Sh2Drc::MemRead(INT32 nSize)
+{
+	m_bCall = true;
+	DrcStub& s = NewStub(STUB_READ, nSize);
+
+	mov(edx, ecx);
+	shr(edx, SH2_SHIFT);
+	mov(r8, qword[r12 + rdx * 8]);
+	cmp(r8, SH2_MAXHANDLER);
+	jb(s.lFrom, T_NEAR);
+
+	switch (nSize) {
+		case 1:
+			xor_(ecx, 3);
+			movzx(ecx, cx);
+			movzx(eax, byte[r8 + rcx]);
+			break;
+		case 2:
+			xor_(ecx, 2);
+			movzx(ecx, cx);
+			movzx(eax, word[r8 + rcx]);
+			break;
+		case 4:
+			movzx(ecx, cx);
+			mov(eax, dword[r8 + rcx]);
+			break;
+	}
+
+	L(s.lBack);
+}
+
+// ecx = address, eax = data
+void Sh2Drc::MemWrite(INT32 nSize)
+{
+	m_bCall = true;
+	DrcStub& s = NewStub(STUB_WRITE, nSize);
+
+	mov(edx, ecx);
+	shr(edx, SH2_SHIFT);
+	cmp(byte[r14 + rdx], 0);					// DrcHot::Code[]
+	jne(s.lFrom, T_NEAR);
+	mov(r8, qword[r12 + rdx * 8 + SH2_WADD * 8]);
+	cmp(r8, SH2_MAXHANDLER);
+	jb(s.lFrom, T_NEAR);
+
+	switch (nSize) {
+		case 1:
+			xor_(ecx, 3);
+			movzx(ecx, cx);
+			mov(byte[r8 + rcx], al);
+			break;
+		case 2:
+			xor_(ecx, 2);
+			movzx(ecx, cx);
+			mov(word[r8 + rcx], ax);
+			break;
+		case 4:
+			movzx(ecx, cx);
+			mov(dword[r8 + rcx], eax);
+			break;
+	}
+	if (Sh2DrcIdleCounting()) {
+		inc(dword[r14 + HOT_WRITES]);			// the handlers count their own
+	}
+
+	L(s.lBack);
+}
+
+// the pc an instruction sees (its address + 2, or the branch target inside a delay slot)
+void Sh2Drc::LoadPC(const Xbyak::Reg32& r)
+{
+	if (!m_bSlot) {
+		mov(r, m_nInsnPC + 2);
+	} else if (m_bSlotConst) {
+		mov(r, m_nSlotPC);
+	} else {
+		mov(r, CPU_REG(pc));
+	}
+}
+
+// T = condition of the last flag setting x86 instruction
+void Sh2Drc::SetT(INT32 nCC)
+{
+	switch (nCC) {
+		case CC_Z:	setz(dl);	break;
+		case CC_NZ:	setnz(dl);	break;
+		case CC_C:	setc(dl);	break;
+		case CC_A:	seta(dl);	break;
+		case CC_AE:	setae(dl);	break;
+		case CC_G:	setg(dl);	break;
+		case CC_GE:	setge(dl);	break;
+		case CC_O:	seto(dl);	break;
+	}
+	movzx(edx, dl);
+	and_(CPU_REG(sr), ~SR_T);
+	or_(CPU_REG(sr), edx);
+}
+
+// entry of a block in ram: run the body if its code is still what was translated, else drop
+// the block and leave the way a dispatcher miss does
+void Sh2Drc::EmitCheck(DrcBlock* b, const void* pBody)
+{
+	Xbyak::Label lStale;
+
+	mov(rdx, (size_t)b->pHost);
+	for (INT32 i = 0; i < b->nLen; i += 4) {
+		INT32 d;
+		memcpy(&d, b->pSource + i, 4);
+		cmp(dword[rdx + i], d);
+		jne(lStale, T_NEAR);
+	}
+	jmp(pBody, T_NEAR);
+
+	L(lStale);
+#ifdef _WIN32
+	mov(rcx, (size_t)b);
+#else
+	mov(rdi, (size_t)b);
+#endif
+	mov(rax, (size_t)DrcStale);
+	call(rax);
+	jmp(*m_plExitUndo, T_NEAR);
+}
+
+// charge the instruction, leave the block when down to the stop count or when a handler asked to
+void Sh2Drc::EndInsn(INT32 nCycles)
+{
+	DrcStub& s = NewStub(STUB_EXIT, 0);
+
+	sub(CPU_REG(sh2_icount), m_nEat + nCycles);
+	inc(CPU_REG(sh2_total_cycles));
+	cmp(CPU_REG(sh2_icount), r13d);
+	jle(s.lFrom, T_NEAR);
+	if (m_bCall) {
+		cmp(dword[r14 + HOT_BREAK], 0);
+		jne(s.lFrom, T_NEAR);
+	}
+}
+
+// continue at a known pc: inside this block if it's an instruction we translated, else through the dispatcher
+void Sh2Drc::JumpTo(UINT32 nTarget)
+{
+	for (UINT32 i = 0; i < m_Insns.size(); i++) {
+		if (m_Insns[i].first == nTarget) {
+			jmp(m_Insns[i].second, T_NEAR);
+			return;
+		}
+	}
+
+	mov(CPU_REG(pc), nTarget);
+	jmp(*m_plDispatch, T_NEAR);
+}
+
+// the interpreter's SH2_IDLE_BRANCH(), before the branch is charged; icount and the registers are all in SH2
+void Sh2Drc::IdleBranch(UINT32 nTarget)
+{
+	if ((UINT32)(m_nInsnPC - nTarget) > BURN_IDLE_MAX_LOOP || !Sh2DrcIdleAllowed(m_nInsnPC)) return;
+
+#ifdef _WIN32
+	mov(ecx, m_nInsnPC);
+	mov(edx, nTarget);
+#else
+	mov(edi, m_nInsnPC);
+	mov(esi, nTarget);
+#endif
+	mov(rax, (size_t)DrcIdleBranch);
+	call(rax);
+}
+
+void Sh2Drc::EndBranch(UINT32 nTarget, INT32 nCycles)
+{
+	UINT32 nSaved = m_nPC;
+	m_nPC = nTarget;
+	EndInsn(nCycles);
+	m_nPC = nSaved;
+
+	JumpTo(nTarget);
+}
+
+// ----------------------------------------------------------------------------
+// Translation
+//
+// CompileX() return -1 when the instruction isn't handled (nothing emitted), 0 to carry on
+// with the block, 1 when the block ends with this instruction.
+
+INT32 Sh2Drc::CompileFallback()
+{
+	if (!m_bSlot) {
+		mov(CPU_REG(pc), m_nInsnPC + 2);
+		mov(CPU_REG(ppc), m_nInsnPC + 2);
+	}
+#ifdef _WIN32
+	mov(ecx, m_nOp);
+#else
+	mov(edi, m_nOp);
+#endif
+	mov(rax, (size_t)DrcExecute);
+	call(rax);
+	m_bCall = true;
+
+	if (IsBranch(m_nOp)) {
+		// pc / delay are wherever the interpreter put them, and it charges the instruction
+		jmp(*m_plExit, T_NEAR);
+		return 1;
+	}
+
+	EndInsn(0);
+	return 0;
+}
+
+// pc (the target) is stored, translate the slot behind the branch
+INT32 Sh2Drc::CompileDelayed(bool bConst, UINT32 nTarget, INT32 nCycles, bool bLink)
+{
+	if (bLink) {
+		mov(CPU_REG(pr), m_nInsnPC + 4);
+	}
+
+	DrcStub& s = NewStub(STUB_DELAY, 0);
+	sub(CPU_REG(sh2_icount), m_nEat + nCycles);
+	inc(CPU_REG(sh2_total_cycles));
+	cmp(CPU_REG(sh2_icount), r13d);
+	jle(s.lFrom, T_NEAR);
+
+	// the slot runs with pc = ppc = target, as after the interpreter's change_pc()
+	if (bConst) {
+		mov(CPU_REG(pc), nTarget & SH2_AM);
+		mov(CPU_REG(ppc), nTarget & SH2_AM);
+	} else {
+		mov(eax, CPU_REG(pc));
+		and_(eax, SH2_AM);
+		mov(CPU_REG(pc), eax);
+		mov(CPU_REG(ppc), eax);
+	}
+
+	UINT32 nInsnPC = m_nInsnPC;
+	UINT32 nOp = m_nOp;
+	UINT32 nPC = m_nPC;
+
+	m_bSlot = true;
+	m_bSlotConst = bConst;
+	m_nSlotPC = nTarget & SH2_AM;
+	m_nInsnPC = nPC;
+	m_nOp = Word(nPC);
+	m_nPC = nPC + 2;
+	m_bCall = false;
+
+	INT32 r = CompileInsn();
+	if (r < 0) r = CompileFallback();
+
+	m_bSlot = false;
+	m_nInsnPC = nInsnPC;
+	m_nOp = nOp;
+	m_nPC = nPC;
+	m_bCall = false;
+	if (nPC + 2 > m_nExtent) m_nExtent = nPC + 2;
+
+	if (r == 0) {
+		if (bConst) {
+			JumpTo(nTarget & SH2_AM);
+		} else {
+			jmp(*m_plDispatch, T_NEAR);
+		}
+	}
+
+	return 1;
+}
+
+// dt Rn, including the interpreter's "dt Rn / bf $-2" busy loop
+INT32 Sh2Drc::CompileDT(INT32 n)
+{
+	Xbyak::Label lLoop, lDone, lStore;
+
+	sub(CPU_R(n), 1);
+	SetT(CC_Z);
+
+	if (m_bSlot) {
+		mov(ecx, CPU_REG(ppc));
+		and_(ecx, SH2_AM);
+	} else {
+		mov(ecx, (m_nInsnPC + 2) & SH2_AM);
+	}
+	MemRead(2);
+	cmp(eax, 0x8bfd);
+	jne(lDone, T_NEAR);
+
+	mov(eax, CPU_R(n));
+	L(lLoop);
+	cmp(eax, 1);
+	jbe(lStore);
+	cmp(CPU_REG(sh2_icount), 4);
+	jle(lStore);
+	dec(eax);
+	sub(CPU_REG(sh2_icount), 4);
+	add(CPU_REG(sh2_total_cycles), 4);
+	jmp(lLoop);
+	L(lStore);
+	mov(CPU_R(n), eax);
+	L(lDone);
+
+	EndInsn(0);
+	return 0;
+}
+
+// Q = old msb of Rn ^ carry out of the add / sub ^ M, T = (Q == M)
+INT32 Sh2Drc::CompileDIV1(INT32 m, INT32 n)
+{
+	Xbyak::Label lAdd, lDone;
+
+	mov(eax, CPU_R(n));
+	mov(edx, CPU_REG(sr));
+	mov(r8d, edx);
+	shr(r8d, 8);
+	and_(r8d, 1);								// old q
+	mov(r9d, edx);
+	shr(r9d, 9);
+	and_(r9d, 1);								// m
+	mov(r10d, eax);
+	shr(r10d, 31);								// msb going out
+	bt(edx, 0);
+	rcl(eax, 1);
+	cmp(r8d, r9d);
+	jne(lAdd);
+	if (m == n) sub(eax, eax); else sub(eax, CPU_R(m));		// div1 Rn,Rn works on the shifted value
+	jmp(lDone);
+	L(lAdd);
+	if (m == n) add(eax, eax); else add(eax, CPU_R(m));
+	L(lDone);
+	setc(r11b);
+	movzx(r11d, r11b);
+	mov(CPU_R(n), eax);
+
+	xor_(r10d, r11d);							// q ^ m without m: t = !(this)
+	and_(edx, ~(SR_Q | SR_T));
+	mov(r11d, r10d);
+	xor_(r11d, r9d);
+	shl(r11d, 8);
+	or_(edx, r11d);
+	xor_(r10d, 1);
+	or_(edx, r10d);
+	mov(CPU_REG(sr), edx);
+
+	EndInsn(0);
+	return 0;
+}
+
+INT32 Sh2Drc::CompileInsn()
+{
+	UINT32 op = m_nOp;
+	INT32 n = (op >> 8) & 15;
+	INT32 m = (op >> 4) & 15;
+
+	// a branch in a delay slot goes to the interpreter, like anything it does with the pc
+	if (m_bSlot && IsBranch(op)) return -1;
+
+	switch (op >> 12) {
+		case 0x0:
+			return Compile0000();
+
+		case 0x1:												// mov.l Rm,@(disp,Rn)
+			mov(ecx, CPU_R(n));
+			add(ecx, (op & 15) * 4);
+			mov(eax, CPU_R(m));
+			MemWrite(4);
+			break;
+
+		case 0x2:
+			return Compile0010();
+
+		case 0x3:
+			return Compile0011();
+
+		case 0x4:
+			return Compile0100();
+
+		case 0x5:												// mov.l @(disp,Rm),Rn
+			mov(ecx, CPU_R(m));
+			add(ecx, (op & 15) * 4);
+			MemRead(4);
+			mov(CPU_R(n), eax);
+			break;
+
+		case 0x6:
+			return Compile0110();
+
+		case 0x7:												// add #imm,Rn
+			add(CPU_R(n), (INT32)(INT8)op);
+			break;
+
+		case 0x8:
+			return Compile1000();
+
+		case 0x9:												// mov.w @(disp,pc),Rn
+			LoadPC(ecx);
+			add(ecx, (op & 0xff) * 2 + 2);
+			MemRead(2);
+			movsx(eax, ax);
+			mov(CPU_R(n), eax);
+			break;
+
+		case 0xa:												// bra
+		case 0xb: {												// bsr
+			INT32 nDisp = ((INT32)op << 20) >> 20;
+			if (nDisp == -2) return -1;							// the interpreter's "bra $ / nop" busy loop
+			if (m_nPC + 2 > m_nPageEnd) return -1;
+
+			UINT32 nTarget = m_nInsnPC + 4 + nDisp * 2;
+			if ((op >> 12) == 0xa) IdleBranch(nTarget);
+			mov(CPU_REG(pc), nTarget);
+			return CompileDelayed(true, nTarget, 1, (op >> 12) == 0xb);
+		}
+
+		case 0xc:
+			return Compile1100();
+
+		case 0xd:												// mov.l @(disp,pc),Rn
+			LoadPC(ecx);
+			add(ecx, 2);
+			and_(ecx, ~3);
+			add(ecx, (op & 0xff) * 4);
+			MemRead(4);
+			mov(CPU_R(n), eax);
+			break;
+
+		case 0xe:												// mov #imm,Rn
+			mov(CPU_R(n), (INT32)(INT8)op);
+			break;
+
+		case 0xf:
+			break;
+	}
+
+	EndInsn(0);
+	return 0;
+}
+
+INT32 Sh2Drc::Compile0000()
+{
+	UINT32 op = m_nOp;
+	INT32 n = (op >> 8) & 15;
+	INT32 m = (op >> 4) & 15;
+	INT32 nCycles = 0;
+
+	switch (op & 0x3f) {
+		case 0x02:	mov(eax, CPU_REG(sr));	mov(CPU_R(n), eax);	break;		// stc sr,Rn
+		case 0x12:	mov(eax, CPU_REG(gbr));	mov(CPU_R(n), eax);	break;		// stc gbr,Rn
+		case 0x22:	mov(eax, CPU_REG(vbr));	mov(CPU_R(n), eax);	break;		// stc vbr,Rn
+
+		case 0x03:															// bsrf Rm
+		case 0x23:															// braf Rm
+			if (m_nPC + 2 > m_nPageEnd) return -1;
+			mov(eax, CPU_R(n));
+			add(eax, m_nInsnPC + 4);
+			mov(CPU_REG(pc), eax);
+			return CompileDelayed(false, 0, 1, (op & 0x3f) == 0x03);
+
+		case 0x04: case 0x14: case 0x24: case 0x34:							// mov.b Rm,@(r0,Rn)
+		case 0x05: case 0x15: case 0x25: case 0x35:							// mov.w Rm,@(r0,Rn)
+		case 0x06: case 0x16: case 0x26: case 0x36:							// mov.l Rm,@(r0,Rn)
+			mov(ecx, CPU_R(n));
+			add(ecx, CPU_R(0));
+			mov(eax, CPU_R(m));
+			MemWrite(1 << (op & 3));
+			break;
+
+		case 0x07: case 0x17: case 0x27: case 0x37:							// mul.l Rm,Rn
+			mov(eax, CPU_R(n));
+			imul(eax, CPU_R(m));
+			mov(CPU_REG(macl), eax);
+			nCycles = 1;
+			break;
+
+		case 0x08:	and_(CPU_REG(sr), ~SR_T);	break;						// clrt
+		case 0x18:	or_(CPU_REG(sr), SR_T);		break;						// sett
+		case 0x19:	and_(CPU_REG(sr), ~(SR_M | SR_Q | SR_T));	break;		// div0u
+		case 0x28:															// clrmac
+			mov(CPU_REG(mach), 0);
+			mov(CPU_REG(macl), 0);
+			break;
+
+		case 0x29:															// movt Rn
+			mov(eax, CPU_REG(sr));
+			and_(eax, SR_T);
+			mov(CPU_R(n), eax);
+			break;
+
+		case 0x0a:	mov(eax, CPU_REG(mach));	mov(CPU_R(n), eax);	break;	// sts mach,Rn
+		case 0x1a:	mov(eax, CPU_REG(macl));	mov(CPU_R(n), eax);	break;	// sts macl,Rn
+		case 0x2a:	mov(eax, CPU_REG(pr));		mov(CPU_R(n), eax);	break;	// sts pr,Rn
+
+		case 0x0b:															// rts
+			if (m_nPC + 2 > m_nPageEnd) return -1;
+			mov(eax, CPU_REG(pr));
+			mov(CPU_REG(pc), eax);
+			return CompileDelayed(false, 0, 1, false);
+
+		case 0x0c: case 0x1c: case 0x2c: case 0x3c:							// mov.b @(r0,Rm),Rn
+			mov(ecx, CPU_R(m));
+			add(ecx, CPU_R(0));
+			MemRead(1);
+			movsx(eax, al);
+			mov(CPU_R(n), eax);
+			break;
+
+		case 0x0d: case 0x1d: case 0x2d: case 0x3d:							// mov.w @(r0,Rm),Rn
+			mov(ecx, CPU_R(m));
+			add(ecx, CPU_R(0));
+			MemRead(2);
+			movsx(eax, ax);
+			mov(CPU_R(n), eax);
+			break;
+
+		case 0x0e: case 0x1e: case 0x2e: case 0x3e:							// mov.l @(r0,Rm),Rn
+			mov(ecx, CPU_R(m));
+			add(ecx, CPU_R(0));
+			MemRead(4);
+			mov(CPU_R(n), eax);
+			break;
+
+		case 0x0f: case 0x1f: case 0x2f: case 0x3f:							// mac.l
+		case 0x1b:															// sleep
+		case 0x2b:															// rte
+			return -1;
+	}
+
+	EndInsn(nCycles);
+	return 0;
+}
+
+INT32 Sh2Drc::Compile0010()
+{
+	UINT32 op = m_nOp;
+	INT32 n = (op >> 8) & 15;
+	INT32 m = (op >> 4) & 15;
+
+	switch (op & 15) {
+		case 0: case 1: case 2:												// mov.x Rm,@Rn
+			mov(ecx, CPU_R(n));
+			mov(eax, CPU_R(m));
+			MemWrite(1 << (op & 3));
+			break;
+
+		case 4: case 5: case 6:												// mov.x Rm,@-Rn
+			mov(eax, CPU_R(m));
+			sub(CPU_R(n), 1 << (op & 3));
+			mov(ecx, CPU_R(n));
+			MemWrite(1 << (op & 3));
+			break;
+
+		case 7:																// div0s Rm,Rn
+			mov(eax, CPU_R(n));
+			shr(eax, 31);
+			mov(edx, CPU_R(m));
+			shr(edx, 31);
+			mov(ecx, CPU_REG(sr));
+			and_(ecx, ~(SR_M | SR_Q | SR_T));
+			mov(r8d, eax);
+			shl(r8d, 8);
+			or_(ecx, r8d);
+			mov(r8d, edx);
+			shl(r8d, 9);
+			or_(ecx, r8d);
+			xor_(eax, edx);
+			or_(ecx, eax);
+			mov(CPU_REG(sr), ecx);
+			break;
+
+		case 8:																// tst Rm,Rn
+			mov(eax, CPU_R(n));
+			test(CPU_R(m), eax);
+			SetT(CC_Z);
+			break;
+
+		case 9:		mov(eax, CPU_R(m));	and_(CPU_R(n), eax);	break;		// and Rm,Rn
+		case 10:	mov(eax, CPU_R(m));	xor_(CPU_R(n), eax);	break;		// xor Rm,Rn
+		case 11:	mov(eax, CPU_R(m));	or_(CPU_R(n), eax);		break;		// or Rm,Rn
+
+		case 12:															// cmp/str Rm,Rn: some byte equal
+			mov(eax, CPU_R(n));
+			xor_(eax, CPU_R(m));
+			lea(edx, ptr[eax - 0x01010101]);
+			not_(eax);
+			and_(eax, edx);
+			test(eax, 0x80808080);
+			SetT(CC_NZ);
+			break;
+
+		case 13:															// xtrct Rm,Rn
+			mov(eax, CPU_R(n));
+			shr(eax, 16);
+			mov(edx, CPU_R(m));
+			shl(edx, 16);
+			or_(eax, edx);
+			mov(CPU_R(n), eax);
+			break;
+
+		case 14:															// mulu.w Rm,Rn
+			movzx(eax, word[rbx + CPU_OFS(r) + n * 4]);
+			movzx(edx, word[rbx + CPU_OFS(r) + m * 4]);
+			imul(eax, edx);
+			mov(CPU_REG(macl), eax);
+			break;
+
+		case 15:															// muls.w Rm,Rn
+			movsx(eax, word[rbx + CPU_OFS(r) + n * 4]);
+			movsx(edx, word[rbx + CPU_OFS(r) + m * 4]);
+			imul(eax, edx);
+			mov(CPU_REG(macl), eax);
+			break;
+	}
+
+	EndInsn(0);
+	return 0;
+}
+
+INT32 Sh2Drc::Compile0011()
+{
+	UINT32 op = m_nOp;
+	INT32 n = (op >> 8) & 15;
+	INT32 m = (op >> 4) & 15;
+	INT32 nCycles = 0;
+
+	switch (op & 15) {
+		case 0:		mov(eax, CPU_R(n));	cmp(eax, CPU_R(m));	SetT(CC_Z);		break;	// cmp/eq
+		case 2:		mov(eax, CPU_R(n));	cmp(eax, CPU_R(m));	SetT(CC_AE);	break;	// cmp/hs
+		case 3:		mov(eax, CPU_R(n));	cmp(eax, CPU_R(m));	SetT(CC_GE);	break;	// cmp/ge
+		case 6:		mov(eax, CPU_R(n));	cmp(eax, CPU_R(m));	SetT(CC_A);		break;	// cmp/hi
+		case 7:		mov(eax, CPU_R(n));	cmp(eax, CPU_R(m));	SetT(CC_G);		break;	// cmp/gt
+
+		case 4:
+			return CompileDIV1(m, n);
+
+		case 5:																// dmulu.l Rm,Rn
+		case 13:															// dmuls.l Rm,Rn
+			mov(eax, CPU_R(n));
+			if (op & 8) imul(CPU_R(m)); else mul(CPU_R(m));
+			mov(CPU_REG(mach), edx);
+			mov(CPU_REG(macl), eax);
+			nCycles = 1;
+			break;
+
+		case 8:		mov(eax, CPU_R(m));	sub(CPU_R(n), eax);	break;			// sub Rm,Rn
+		case 12:	mov(eax, CPU_R(m));	add(CPU_R(n), eax);	break;			// add Rm,Rn
+
+		case 10:															// subc Rm,Rn
+		case 14:															// addc Rm,Rn
+			mov(eax, CPU_R(m));
+			bt(CPU_REG(sr), 0);
+			if (op & 4) adc(CPU_R(n), eax); else sbb(CPU_R(n), eax);
+			SetT(CC_C);
+			break;
+
+		case 11:															// subv Rm,Rn
+		case 15:															// addv Rm,Rn
+			mov(eax, CPU_R(m));
+			if (op & 4) add(CPU_R(n), eax); else sub(CPU_R(n), eax);
+			SetT(CC_O);
+			break;
+	}
+
+	EndInsn(nCycles);
+	return 0;
+}
+
+INT32 Sh2Drc::Compile0100()
+{
+	UINT32 op = m_nOp;
+	INT32 n = (op >> 8) & 15;
+	INT32 nCycles = 0;
+
+	switch (op & 0x3f) {
+		case 0x00:	shl(CPU_R(n), 1);	SetT(CC_C);	break;					// shll
+		case 0x20:	shl(CPU_R(n), 1);	SetT(CC_C);	break;					// shal
+		case 0x01:	shr(CPU_R(n), 1);	SetT(CC_C);	break;					// shlr
+		case 0x21:	sar(CPU_R(n), 1);	SetT(CC_C);	break;					// shar
+		case 0x04:	rol(CPU_R(n), 1);	SetT(CC_C);	break;					// rotl
+		case 0x05:	ror(CPU_R(n), 1);	SetT(CC_C);	break;					// rotr
+
+		case 0x24:															// rotcl
+		case 0x25:															// rotcr
+			bt(CPU_REG(sr), 0);
+			if (op & 1) rcr(CPU_R(n), 1); else rcl(CPU_R(n), 1);
+			SetT(CC_C);
+			break;
+
+		case 0x08:	shl(CPU_R(n), 2);	break;								// shll2
+		case 0x18:	shl(CPU_R(n), 8);	break;								// shll8
+		case 0x28:	shl(CPU_R(n), 16);	break;								// shll16
+		case 0x09:	shr(CPU_R(n), 2);	break;								// shlr2
+		case 0x19:	shr(CPU_R(n), 8);	break;								// shlr8
+		case 0x29:	shr(CPU_R(n), 16);	break;								// shlr16
+
+		case 0x02:															// sts.l mach,@-Rn
+		case 0x12:															// sts.l macl,@-Rn
+		case 0x22:															// sts.l pr,@-Rn
+		case 0x03:															// stc.l sr,@-Rn
+		case 0x13:															// stc.l gbr,@-Rn
+		case 0x23: {														// stc.l vbr,@-Rn
+			static const INT32 nSts[3] = { CPU_OFS(mach), CPU_OFS(macl), CPU_OFS(pr) };
+			static const INT32 nStc[3] = { CPU_OFS(sr), CPU_OFS(gbr), CPU_OFS(vbr) };
+			sub(CPU_R(n), 4);
+			mov(ecx, CPU_R(n));
+			mov(eax, dword[rbx + ((op & 1) ? nStc : nSts)[(op >> 4) & 3]]);
+			MemWrite(4);
+			if (op & 1) nCycles = 1;
+			break;
+		}
+
+		case 0x06:															// lds.l @Rm+,mach
+		case 0x16:															// lds.l @Rm+,macl
+		case 0x26:															// lds.l @Rm+,pr
+		case 0x17:															// ldc.l @Rm+,gbr
+		case 0x27: {														// ldc.l @Rm+,vbr
+			static const INT32 nLds[3] = { CPU_OFS(mach), CPU_OFS(macl), CPU_OFS(pr) };
+			static const INT32 nLdc[3] = { CPU_OFS(sr), CPU_OFS(gbr), CPU_OFS(vbr) };
+			mov(ecx, CPU_R(n));
+			MemRead(4);
+			mov(dword[rbx + ((op & 1) ? nLdc : nLds)[(op >> 4) & 3]], eax);
+			add(CPU_R(n), 4);
+			if (op & 1) nCycles = 2;
+			break;
+		}
+
+		case 0x0a:	mov(eax, CPU_R(n));	mov(CPU_REG(mach), eax);	break;	// lds Rm,mach
+		case 0x1a:	mov(eax, CPU_R(n));	mov(CPU_REG(macl), eax);	break;	// lds Rm,macl
+		case 0x2a:	mov(eax, CPU_R(n));	mov(CPU_REG(pr), eax);		break;	// lds Rm,pr
+		case 0x1e:	mov(eax, CPU_R(n));	mov(CPU_REG(gbr), eax);		break;	// ldc Rm,gbr
+		case 0x2e:	mov(eax, CPU_R(n));	mov(CPU_REG(vbr), eax);		break;	// ldc Rm,vbr
+
+		case 0x0b:															// jsr @Rm
+		case 0x2b:															// jmp @Rm
+			if (m_nPC + 2 > m_nPageEnd) return -1;
+			mov(eax, CPU_R(n));
+			mov(CPU_REG(pc), eax);
+			return CompileDelayed(false, 0, (op & 0x20) ? 0 : 1, (op & 0x20) == 0);
+
+		case 0x10:
+			return CompileDT(n);
+
+		case 0x11:	cmp(CPU_R(n), 0);	SetT(CC_GE);	break;				// cmp/pz
+		case 0x15:	cmp(CPU_R(n), 0);	SetT(CC_G);		break;				// cmp/pl
+
+		case 0x1b:															// tas.b @Rn
+			mov(ecx, CPU_R(n));
+			mov(ebp, ecx);
+			MemRead(1);
+			test(al, al);
+			SetT(CC_Z);
+			or_(eax, 0x80);
+			mov(ecx, ebp);
+			MemWrite(1);
+			nCycles = 3;
+			break;
+
+		case 0x07:															// ldc.l @Rm+,sr
+		case 0x0e:															// ldc Rm,sr
+		case 0x0f: case 0x1f: case 0x2f: case 0x3f:							// mac.w
+			return -1;
+	}
+
+	EndInsn(nCycles);
+	return 0;
+}
+
+INT32 Sh2Drc::Compile0110()
+{
+	UINT32 op = m_nOp;
+	INT32 n = (op >> 8) & 15;
+	INT32 m = (op >> 4) & 15;
+
+	switch (op & 15) {
+		case 0:																// mov.b @Rm,Rn
+		case 4:																// mov.b @Rm+,Rn
+			mov(ecx, CPU_R(m));
+			MemRead(1);
+			movsx(eax, al);
+			mov(CPU_R(n), eax);
+			if ((op & 4) && n != m) add(CPU_R(m), 1);
+			break;
+
+		case 1:																// mov.w @Rm,Rn
+		case 5:																// mov.w @Rm+,Rn
+			mov(ecx, CPU_R(m));
+			MemRead(2);
+			movsx(eax, ax);
+			mov(CPU_R(n), eax);
+			if ((op & 4) && n != m) add(CPU_R(m), 2);
+			break;
+
+		case 2:																// mov.l @Rm,Rn
+		case 6:																// mov.l @Rm+,Rn
+			mov(ecx, CPU_R(m));
+			MemRead(4);
+			mov(CPU_R(n), eax);
+			if ((op & 4) && n != m) add(CPU_R(m), 4);
+			break;
+
+		case 3:		mov(eax, CPU_R(m));	mov(CPU_R(n), eax);	break;							// mov Rm,Rn
+		case 7:		mov(eax, CPU_R(m));	not_(eax);	mov(CPU_R(n), eax);	break;				// not Rm,Rn
+		case 8:		mov(eax, CPU_R(m));	rol(ax, 8);	mov(CPU_R(n), eax);	break;				// swap.b Rm,Rn
+		case 9:		mov(eax, CPU_R(m));	rol(eax, 16);	mov(CPU_R(n), eax);	break;			// swap.w Rm,Rn
+		case 11:	mov(eax, CPU_R(m));	neg(eax);	mov(CPU_R(n), eax);	break;				// neg Rm,Rn
+
+		case 10:															// negc Rm,Rn
+			xor_(eax, eax);
+			bt(CPU_REG(sr), 0);
+			sbb(eax, CPU_R(m));
+			mov(CPU_R(n), eax);
+			SetT(CC_C);
+			break;
+
+		case 12:	movzx(eax, byte[rbx + CPU_OFS(r) + m * 4]);	mov(CPU_R(n), eax);	break;	// extu.b
+		case 13:	movzx(eax, word[rbx + CPU_OFS(r) + m * 4]);	mov(CPU_R(n), eax);	break;	// extu.w
+		case 14:	movsx(eax, byte[rbx + CPU_OFS(r) + m * 4]);	mov(CPU_R(n), eax);	break;	// exts.b
+		case 15:	movsx(eax, word[rbx + CPU_OFS(r) + m * 4]);	mov(CPU_R(n), eax);	break;	// exts.w
+	}
+
+	EndInsn(0);
+	return 0;
+}
+
+INT32 Sh2Drc::Compile1000()
+{
+	UINT32 op = m_nOp;
+	INT32 m = (op >> 4) & 15;
+	INT32 nDisp = op & 15;
+
+	switch ((op >> 8) & 15) {
+		case 0:																// mov.b r0,@(disp,Rm)
+			mov(ecx, CPU_R(m));
+			add(ecx, nDisp);
+			mov(eax, CPU_R(0));
+			MemWrite(1);
+			break;
+
+		case 1:																// mov.w r0,@(disp,Rm)
+			mov(ecx, CPU_R(m));
+			add(ecx, nDisp * 2);
+			mov(eax, CPU_R(0));
+			MemWrite(2);
+			break;
+
+		case 4:																// mov.b @(disp,Rm),r0
+			mov(ecx, CPU_R(m));
+			add(ecx, nDisp);
+			MemRead(1);
+			movsx(eax, al);
+			mov(CPU_R(0), eax);
+			break;
+
+		case 5:																// mov.w @(disp,Rm),r0
+			mov(ecx, CPU_R(m));
+			add(ecx, nDisp * 2);
+			MemRead(2);
+			movsx(eax, ax);
+			mov(CPU_R(0), eax);
+			break;
+
+		case 8:																// cmp/eq #imm,r0
+			cmp(CPU_R(0), (INT32)(INT8)op);
+			SetT(CC_Z);
+			break;
+
+		case 9:																// bt
+		case 11: {															// bf
+			Xbyak::Label lNot;
+			UINT32 nTarget = (m_nInsnPC + 4 + (INT8)op * 2) & SH2_AM;
+
+			test(CPU_REG(sr), SR_T);
+			if (op & 0x0200) jnz(lNot, T_NEAR); else jz(lNot, T_NEAR);
+			IdleBranch(nTarget);
+			EndBranch(nTarget, 2);
+			L(lNot);
+			break;
+		}
+
+		case 13:															// bt/s
+		case 15: {															// bf/s
+			if (m_nPC + 2 > m_nPageEnd) return -1;
+
+			Xbyak::Label lNot;
+			UINT32 nTarget = m_nInsnPC + 4 + (INT8)op * 2;
+
+			test(CPU_REG(sr), SR_T);
+			if (op & 0x0200) jnz(lNot, T_NEAR); else jz(lNot, T_NEAR);
+			IdleBranch(nTarget);
+			mov(CPU_REG(pc), nTarget);
+			CompileDelayed(true, nTarget, 1, false);
+			L(lNot);
+			break;
+		}
+	}
+
+	EndInsn(0);
+	return 0;
+}
+
+INT32 Sh2Drc::Compile1100()
+{
+	UINT32 op = m_nOp;
+	UINT32 nImm = op & 0xff;
+	INT32 nCycles = 0;
+
+	switch ((op >> 8) & 15) {
+		case 0: case 1: case 2: {											// mov.x r0,@(disp,gbr)
+			INT32 nSize = 1 << ((op >> 8) & 3);
+			mov(ecx, CPU_REG(gbr));
+			add(ecx, nImm * nSize);
+			mov(eax, CPU_R(0));
+			MemWrite(nSize);
+			break;
+		}
+
+		case 4: case 5: case 6: {											// mov.x @(disp,gbr),r0
+			INT32 nSize = 1 << ((op >> 8) & 3);
+			mov(ecx, CPU_REG(gbr));
+			add(ecx, nImm * nSize);
+			MemRead(nSize);
+			if (nSize == 1) movsx(eax, al);
+			if (nSize == 2) movsx(eax, ax);
+			mov(CPU_R(0), eax);
+			break;
+		}
+
+		case 3:																// trapa
+			return -1;
+
+		case 7:																// mova @(disp,pc),r0
+			LoadPC(eax);
+			add(eax, 2);
+			and_(eax, ~3);
+			add(eax, nImm * 4);
+			mov(CPU_R(0), eax);
+			break;
+
+		case 8:		test(CPU_R(0), nImm);	SetT(CC_Z);	break;				// tst #imm,r0
+		case 9:		and_(CPU_R(0), nImm);	break;							// and #imm,r0
+		case 10:	xor_(CPU_R(0), nImm);	break;							// xor #imm,r0
+		case 11:	or_(CPU_R(0), nImm);	break;							// or #imm,r0
+
+		case 12:															// tst.b #imm,@(r0,gbr)
+			mov(ecx, CPU_REG(gbr));
+			add(ecx, CPU_R(0));
+			MemRead(1);
+			test(eax, nImm);
+			SetT(CC_Z);
+			nCycles = 2;
+			break;
+
+		case 13:															// and.b #imm,@(r0,gbr)
+		case 14:															// xor.b #imm,@(r0,gbr)
+		case 15:															// or.b #imm,@(r0,gbr)
+			mov(ecx, CPU_REG(gbr));
+			add(ecx, CPU_R(0));
+			mov(ebp, ecx);
+			MemRead(1);
+			switch ((op >> 8) & 15) {
+				case 13: and_(eax, nImm); break;
+				case 14: xor_(eax, nImm); break;
+				case 15: or_(eax, nImm); break;
+			}
+			mov(ecx, ebp);
+			MemWrite(1);
+			nCycles = 2;
+			break;
+	}
+
+	EndInsn(nCycles);
+	return 0;
+}
+
+DrcBlock* Sh2Drc::Compile(UINT32 nPC, UINT8* pFetch)
+{
+	m_pPage = pFetch;
+	m_nPageBase = nPC & ~SH2_PAGEM;
+	m_nPageEnd = m_nPageBase + SH2_PAGE_SIZE;
+	m_nPC = nPC;
+	m_nExtent = nPC;
+	m_bSlot = false;
+	m_Insns.clear();
+	m_Stubs.clear();
+
+	size_t nStart = getSize();
+	void* pCode = (void*)getCurr();
+	bool bEnd = false;
+	DrcBlock* b = NULL;
+
+	try {
+		while (!bEnd && m_Insns.size() < DRC_MAX_INSNS && m_nPC + 2 <= m_nPageEnd) {
+			m_nInsnPC = m_nPC;
+			m_nOp = Word(m_nPC);
+			m_nPC += 2;
+			m_bCall = false;
+			m_Insns.push_back(std::make_pair(m_nInsnPC, getCurr()));
+
+			INT32 r = CompileInsn();
+			if (r < 0) r = CompileFallback();
+
+			if (m_nPC > m_nExtent) m_nExtent = m_nPC;
+			bEnd = (r != 0);
+		}
+
+		if (!bEnd) {
+			mov(CPU_REG(pc), m_nPC);
+			jmp(*m_plDispatch, T_NEAR);
+		}
+
+		EmitStubs();
+
+		// host memory holds the code as 32-bit words, cover whole ones
+		UINT32 nFirst = nPC & ~3;
+		UINT32 nLast = (m_nExtent + 3) & ~3;
+
+		b = new DrcBlock;
+		b->nPC = nPC;
+		b->nPage = nPC >> SH2_SHIFT;
+		b->nLen = nLast - nFirst;
+		b->bDead = false;
+		b->pFetch = pFetch;
+		b->pHost = pFetch + (nFirst & SH2_PAGEM);
+		b->pSource = (UINT8*)malloc(b->nLen);
+		memcpy(b->pSource, b->pHost, b->nLen);
+		b->pOwner = this;
+
+		b->bCheck = DrcRamBacked(b->pHost, b->nLen);
+		if (b->bCheck) {
+			void* pBody = pCode;
+			pCode = (void*)getCurr();
+			EmitCheck(b, pBody);
+		}
+		b->pCode = pCode;
+	} catch (Xbyak::Error&) {
+		// out of code space: drop what we have and let the next run flush
+		if (b) {
+			free(b->pSource);
+			delete b;
+		}
+		m_Stubs.clear();
+		setSize(nStart);
+		m_bFlushPending = true;
+		return NULL;
+	}
+
+	m_Blocks.insert(std::make_pair(nPC, b));
+	m_Pages[b->nPage].push_back(b);
+
+	for (uintptr_t k = (uintptr_t)b->pHost >> SH2_SHIFT; k <= ((uintptr_t)b->pHost + b->nLen - 1) >> SH2_SHIFT; k++) {
+		std::vector<DrcBlock*>& v = DrcChunks[k];
+		v.push_back(b);
+		if (v.size() == 1) {
+			for (INT32 i = 0; i < DRC_MAX; i++) {
+				if (DrcCPU[i]) DrcCPU[i]->CodeAdded(k);
+			}
+		}
+	}
+
+	return b;
+}
+
+// ----------------------------------------------------------------------------
+// Interface
+
+INT32 Sh2DrcInit(INT32 nCPU, SH2EXT* pExt)
+{
+	if (nCPU >= DRC_MAX) return 1;
+
+	try {
+		DrcCPU[nCPU] = new Sh2Drc(nCPU, pExt);
+	} catch (Xbyak::Error& e) {
+		bprintf(PRINT_ERROR, _T("SH2 DRC: %S\n"), e.what());
+		DrcCPU[nCPU] = NULL;
+		return 1;
+	}
+
+	return 0;
+}
+
+void Sh2DrcExit()
+{
+	pDrcActive = NULL;
+	pSh2DrcCode = NULL;
+
+	for (INT32 i = 0; i < DRC_MAX; i++) {
+		delete DrcCPU[i];
+		DrcCPU[i] = NULL;
+	}
+}
+
+void Sh2DrcOpen(INT32 nCPU)
+{
+	pDrcActive = (nCPU >= 0 && nCPU < DRC_MAX) ? DrcCPU[nCPU] : NULL;
+	pSh2DrcCode = pDrcActive ? pDrcActive->pHot->Code : NULL;
+}
+
+INT32 Sh2DrcRun(INT32 nStop)
+{
+	return pDrcActive->Run(nStop);
+}
+
+void Sh2DrcMapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	if (pDrcActive) pDrcActive->MapChanged(nStart, nEnd);
+}
+
+void Sh2DrcVerify()
+{
+	for (INT32 i = 0; i < DRC_MAX; i++) {
+		if (DrcCPU[i]) DrcCPU[i]->bVerifyPending = true;
+	}
+}
+
+void Sh2DrcWrite(UINT32 a, INT32 nLen)
+{
+	UINT8** pMemMap = pDrcActive->pExt->MemMap;
+	INT32 nPage = a >> SH2_SHIFT;
+	INT32 nOffset = a & SH2_PAGEM & ~3;
+
+	nLen = ((a & 3) + nLen + 3) & ~3;
+
+	UINT8* p = pMemMap[SH2_WADD + nPage];
+	if ((uintptr_t)p >= SH2_MAXHANDLER) {
+		pDrcActive->CheckHost(p + nOffset, nLen);
+	}
+
+	UINT8* f = pMemMap[SH2_WADD * 2 + nPage];
+	if ((uintptr_t)f >= SH2_MAXHANDLER && f != p) {
+		pDrcActive->CheckHost(f + nOffset, nLen);
+	}
+}
+
+#endif
@@ -0,0 +1,35 @@
+// SH-2 block recompiler for x86-64 hosts (SH2EXT context and memory map)
+
+#ifndef SH2_X64_H
+#define SH2_X64_H
+
+#ifdef SH2_X64_DRC
+
+// Per-page flags of the open cpu: non-zero where a write may hit recompiled code (NULL when not recompiling)
+extern UINT8* pSh2DrcCode;
+
+INT32 Sh2DrcInit(INT32 nCPU, SH2EXT* pExt);
+void Sh2DrcExit();
+void Sh2DrcOpen(INT32 nCPU);
+INT32 Sh2DrcRun(INT32 nStop);					// run blocks from sh2->pc while icount > nStop, 0 if there was nothing to run
+
+void Sh2DrcMapChanged(UINT32 nStart, UINT32 nEnd);
+void Sh2DrcVerify();							// drop blocks whose code changed behind our back (all cpus)
+
+void Sh2DrcWrite(UINT32 a, INT32 nLen);			// a write through the Sh2 map hit a flagged page
+
+// sh2.cpp, the interpreter's memory access and opcode dispatch for the open cpu
+UINT32 Sh2DrcReadByte(UINT32 a);
+UINT32 Sh2DrcReadWord(UINT32 a);
+UINT32 Sh2DrcReadLong(UINT32 a);
+void Sh2DrcWriteByte(UINT32 a, UINT32 d);
+void Sh2DrcWriteWord(UINT32 a, UINT32 d);
+void Sh2DrcWriteLong(UINT32 a, UINT32 d);
+void Sh2DrcExecute(UINT32 opcode);
+INT32 Sh2DrcIdleAllowed(UINT32 pc);				// BurnIdleAllowed() for the open cpu
+INT32 Sh2DrcIdleCounting();						// non-zero if writes are counted in nBurnIdleWrites
+void Sh2DrcIdleBranch(UINT32 from, UINT32 to);	// a taken short backward branch, may skip idle iterations
+
+#endif
+
+#endif
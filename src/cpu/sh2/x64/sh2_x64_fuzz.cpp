@@ -0,0 +1,387 @@
+// Differential test for the SH-2 recompiler: cpus 0 and 2 run on the interpreter and share
+// one memory, cpus 1 and 3 run on the recompiler and share a copy of it, all on the same
+// random code, and the two sides must end every timeslice in the same state.
+//
+// Build and run from src/burner/libretro (x86-64 hosts):
+//   g++ -O2 -std=gnu++11 -DLSB_FIRST -D__LIBRETRO__ -DSH2_X64_DRC -DXBYAK_NO_OP_NAMES \
+//     -I../../burn -I../../burn/devices -I../../burn/snd -I../../burner -I../../burner/libretro \
+//     -I../../burner/libretro/libretro-common/include \
+//     -I../../cpu -I../../intf -I../../intf/input -I../../intf/cd -I../../intf/audio \
+//     ../../cpu/sh2/x64/sh2_x64.cpp ../../cpu/sh2/x64/sh2_x64_fuzz.cpp ../../burn/burn_idle.cpp \
+//     -no-pie -Wl,--unresolved-symbols=ignore-all -o sh2_x64_fuzz
+//   ./sh2_x64_fuzz [first seed] [seeds] [timeslices]
+//
+// Code in ram is changed under the recompiled cpu by everything that isn't its own store:
+// the second cpu, the on-chip dma, a write handler poking the host memory, and the test itself
+// between timeslices.  A write handler also switches a code bank.
+
+// the interpreter, fetching every opcode through the memory map: the fast fetch runs on
+// past the end of a page into whatever follows it in host memory
+#define FAST_OP_FETCH	0
+#include "../sh2.cpp"
+
+bool bBurnUseSh2Recompiler = true;
+bool bBurnProfile = false;
+void BurnProfileEnter(INT32) {}
+void BurnProfileLeave() {}
+UINT8 DebugCPU_SH2Initted = 0;
+void CpuCheatRegister(INT32, cpu_core_config*) {}
+INT32 (__cdecl *BurnAcb) (struct BurnArea* pba) = NULL;
+
+char* BurnDrvGetTextA(UINT32)
+{
+	static char szName[] = "sh2_x64_fuzz";
+	return szName;
+}
+
+static INT32 __cdecl FuzzPrintf(INT32, TCHAR* szFormat, ...)
+{
+	va_list vl;
+	va_start(vl, szFormat);
+	vprintf(szFormat, vl);
+	va_end(vl);
+	return 0;
+}
+
+INT32 (__cdecl *bprintf) (INT32 nStatus, TCHAR* szFormat, ...) = FuzzPrintf;
+
+#define MEM_SIZE	0x200000			// ram at 0x06000000, then the rom at 0
+#define BANK_SIZE	0x40000
+#define CODE_START	0x400
+#define CODE_LEN	0x4000
+
+static UINT8* Mem[2];					// per side: interpreter, recompiler
+static UINT8* Bank[2];
+static UINT32 nHash[2];
+static UINT32 nReads[2];
+static UINT32 nSeed;
+
+static INT32 Side()
+{
+	return Sh2GetActive() & 1;
+}
+
+static UINT32 Rand()
+{
+	nSeed = nSeed * 1103515245 + 12345;
+	return (nSeed >> 8) ^ (nSeed << 20);
+}
+
+static void Put16(UINT8* m, UINT32 a, UINT16 w)
+{
+	*(UINT16*)(m + (a ^ 2)) = w;		// LSB_FIRST: the halves of a long are swapped
+}
+
+static void Put32(UINT8* m, UINT32 a, UINT32 l)
+{
+	*(UINT32*)(m + a) = l;
+}
+
+static void StartDma(UINT32 nSrc, UINT32 nDst, INT32 nLongs)
+{
+	WL(0xffffffb0, 1);					// dmaor: dma on
+	WL(0xffffff80, nSrc);
+	WL(0xffffff84, nDst);
+	WL(0xffffff88, nLongs);
+	WL(0xffffff8c, (1 << 14) | (1 << 12) | (2 << 10) | 1);	// chcr0: both incrementing, longs, start
+}
+
+// random bits, fixed bits: mostly instructions the recompiler translates
+static const UINT16 Templates[][2] = {
+	{ 0x0fff, 0x0000 }, { 0x0fff, 0x1000 }, { 0x0fff, 0x2000 }, { 0x0fff, 0x3000 }, { 0x0fff, 0x4000 },
+	{ 0x0fff, 0x5000 }, { 0x0fff, 0x6000 }, { 0x0fff, 0x7000 }, { 0x0fff, 0x8000 }, { 0x0fff, 0x9000 },
+	{ 0x0fff, 0xc000 }, { 0x0fff, 0xd000 }, { 0x0fff, 0xe000 },
+	{ 0x00ff, 0x8900 }, { 0x00ff, 0x8b00 }, { 0x00ff, 0x8d00 }, { 0x00ff, 0x8f00 },
+	{ 0x001f, 0xa000 }, { 0x001f, 0xafe0 }, { 0x001f, 0xb000 },
+	{ 0x0f00, 0x400b }, { 0x0f00, 0x402b }, { 0x0000, 0x000b }, { 0x0000, 0x0009 }, { 0x0f00, 0x0023 }, { 0x0f00, 0x0003 },
+	{ 0x0ff0, 0x3004 }, { 0x0ff0, 0x2007 }, { 0x0f00, 0x4010 }, { 0x0ff0, 0x300e }, { 0x0ff0, 0x300a },
+	{ 0x0ff0, 0x6004 }, { 0x0ff0, 0x6005 }, { 0x0ff0, 0x6006 }, { 0x0ff0, 0x2004 }, { 0x0ff0, 0x2005 }, { 0x0ff0, 0x2006 },
+	{ 0x00ff, 0xcd00 }, { 0x00ff, 0xcc00 }, { 0x0f00, 0x401b },
+};
+
+static UINT16 MakeOp()
+{
+	INT32 t = Rand() % (sizeof(Templates) / sizeof(Templates[0]));
+	return Templates[t][1] | (Rand() & Templates[t][0]);
+}
+
+static void MakeCode(UINT8* m, UINT32 nStart, UINT32 nLen)
+{
+	for (UINT32 a = nStart; a < nStart + nLen; a += 2) {
+		UINT32 r = Rand();
+		UINT16 w;
+
+		if ((r & 15) == 0) {
+			w = Rand();
+		} else if ((r & 63) == 1 && a + 4 <= nStart + nLen) {
+			Put16(m, a, 0xaffe);				// bra $ / nop
+			a += 2;
+			w = 0x0009;
+		} else if ((r & 63) == 2 && a + 4 <= nStart + nLen) {
+			Put16(m, a, 0x4010 | ((Rand() & 15) << 8));	// dt / bf $-2
+			a += 2;
+			w = 0x8bfd;
+		} else {
+			w = MakeOp();
+		}
+
+		Put16(m, a, w);
+	}
+}
+
+// register values: mostly addresses the code can use
+static UINT32 MakeValue()
+{
+	UINT32 k = Rand() & 15;
+	if (k < 5) return 0x06000000 + (Rand() & 0xffffc) + (((Rand() & 3) == 0) ? (Rand() & 3) : 0);
+	if (k < 7) return 0x06000000 + CODE_START + (Rand() & (CODE_LEN - 4));
+	if (k < 8) return 0x26000000 + (Rand() & 0xffffc);
+	if (k < 10) return 0x02000000 + (Rand() & 0xfffc);
+	if (k < 11) return 0xfffffe00 + (Rand() & 0x1fc);
+	if (k < 13) return Rand() & 0xff;
+	return Rand();
+}
+
+static UINT32 HandlerRead(UINT32 a)
+{
+	INT32 s = Side();
+	nReads[s]++;
+	nHash[s] = nHash[s] * 31 + Sh2GetPC(0) * 3 + Sh2TotalCycles();
+	return (a * 2654435761u) ^ (nReads[s] * 40503);
+}
+
+static void HandlerWrite(UINT32 a, UINT32 d)
+{
+	INT32 s = Side();
+	nHash[s] = nHash[s] * 31 + a * 7 + d + Sh2GetPC(0) * 3 + Sh2TotalCycles() * 11;
+
+	if ((a & 0xf0) == 0x60) {
+		// the driver writing code into ram, past the Sh2 map (not into the block that's running,
+		// the recompiler only looks at its code when it enters a block)
+		UINT32 nAddress = CODE_START + ((a * 40503 + d) & (CODE_LEN - 4));
+		UINT32 nDistance = 0x06000000 + nAddress - (sh2->pc & 0x07ffffff) + 0x200;
+		if (nDistance >= 0x400) {
+			Put32(Mem[s], nAddress, (a * 2654435761u) ^ d);
+		}
+	}
+
+	switch (a & 0xfff0) {
+		case 0x0010:
+			Sh2StopRun();
+			break;
+		case 0x0020:
+			Sh2MapMemory(Bank[s] + (d & 3) * 0x10000, 0x06080000, 0x0608ffff, MAP_RAM);
+			break;
+		case 0x0030:
+			Sh2SetIRQLine(d & 15, (d & 0x100) ? CPU_IRQSTATUS_NONE : CPU_IRQSTATUS_ACK);
+			break;
+		case 0x0040:
+			Sh2BurnUntilInt(0);
+			break;
+		case 0x0050:
+			Sh2BurnCycles(d & 63);
+			break;
+	}
+}
+
+static UINT8 __fastcall HandlerReadByte(UINT32 a) { return HandlerRead(a); }
+static UINT16 __fastcall HandlerReadWord(UINT32 a) { return HandlerRead(a); }
+static UINT32 __fastcall HandlerReadLong(UINT32 a) { return HandlerRead(a); }
+static void __fastcall HandlerWriteByte(UINT32 a, UINT8 d) { HandlerWrite(a, d); }
+static void __fastcall HandlerWriteWord(UINT32 a, UINT16 d) { HandlerWrite(a, d); }
+static void __fastcall HandlerWriteLong(UINT32 a, UINT32 d) { HandlerWrite(a, d); }
+
+static void OpenCpu(INT32 c)
+{
+	Sh2Open(c);
+	if ((c & 1) == 0) Sh2DrcOpen(-1);		// the interpreter's side
+}
+
+static INT32 RunSeed(UINT32 nTestSeed, INT32 nSlices)
+{
+	nSeed = nTestSeed;
+
+	memset(Mem[0], 0, MEM_SIZE);
+	MakeCode(Mem[0], 0x100000, 0x10000);
+	MakeCode(Mem[0], CODE_START, CODE_LEN);
+	for (INT32 i = 0; i < 256; i++) {
+		Put32(Mem[0], i * 4, 0x06000000 + CODE_START + (Rand() & (CODE_LEN - 2)));
+	}
+	memcpy(Mem[0] + 0x100000, Mem[0], 0x400);		// the rom at 0 holds a copy of the vectors
+	memcpy(Mem[1], Mem[0], MEM_SIZE);
+	memset(Bank[0], 0, BANK_SIZE);
+	MakeCode(Bank[0], 0, BANK_SIZE);
+	memcpy(Bank[1], Bank[0], BANK_SIZE);
+
+	Sh2Init(4);
+	for (INT32 c = 0; c < 4; c++) {
+		Sh2Open(c);
+		Sh2MapMemory(Mem[c & 1] + 0x100000, 0x00000000, 0x0000ffff, MAP_ROM);
+		Sh2MapMemory(Mem[c & 1], 0x06000000, 0x060fffff, MAP_RAM);
+		Sh2MapMemory(Bank[c & 1], 0x06080000, 0x0608ffff, MAP_RAM);
+		Sh2MapHandler(1, 0x02000000, 0x0200ffff, MAP_READ | MAP_WRITE);
+		for (INT32 h = 0; h < 2; h++) {					// 0: everything unmapped
+			Sh2SetReadByteHandler(h, HandlerReadByte);
+			Sh2SetReadWordHandler(h, HandlerReadWord);
+			Sh2SetReadLongHandler(h, HandlerReadLong);
+			Sh2SetWriteByteHandler(h, HandlerWriteByte);
+			Sh2SetWriteWordHandler(h, HandlerWriteWord);
+			Sh2SetWriteLongHandler(h, HandlerWriteLong);
+		}
+		Sh2Reset(0x06000000 + CODE_START + (c >> 1) * 0x2000, 0x060ffff0 - (c >> 1) * 0x8000);
+		Sh2Close();
+	}
+
+	Sh2Open(1);
+	bool bRecompiling = (pSh2DrcCode != NULL);
+	Sh2Close();
+	if (!bRecompiling) {
+		printf("the recompiler isn't available\n");
+		Sh2Exit();
+		return 1;
+	}
+
+	for (INT32 s = 0; s < 2; s++) {
+		nHash[s] = nReads[s] = 0;
+	}
+
+	INT32 nRet = 0;
+
+	for (INT32 n = 0; n < nSlices && nRet == 0; n++) {
+		INT32 nCycles[2];
+		INT32 nIrq[2];
+		bool bIrq[2];
+		INT32 nEat = ((Rand() % 50) == 0) ? (1 + (Rand() % 4)) : 0;
+		INT32 nDone[4];
+
+		for (INT32 i = 0; i < 2; i++) {
+			nCycles[i] = 1 + (Rand() % 2000);
+			nIrq[i] = Rand() % 16;
+			bIrq[i] = (Rand() % 4) == 0;
+		}
+
+		// both sides run in the same order, each cpu with its partner's timeslice
+		for (INT32 c = 0; c < 4; c++) {
+			OpenCpu(c);
+			if (nEat) Sh2SetEatCycles(nEat);
+			if (bIrq[c >> 1]) Sh2SetIRQLine(nIrq[c >> 1], CPU_IRQSTATUS_AUTO);
+			nDone[c] = Sh2Run(nCycles[c >> 1]);
+			Sh2Close();
+		}
+
+		for (INT32 c = 0; c < 4 && nRet == 0; c += 2) {
+			SH2 a = Sh2Ext[c].sh2, b = Sh2Ext[c + 1].sh2;
+			a.ea = b.ea = 0;							// a scratch value, left behind differently
+
+			if (memcmp(&a, &b, sizeof(SH2)) || nDone[c] != nDone[c + 1] || Sh2Ext[c].suspend != Sh2Ext[c + 1].suspend) {
+				printf("seed %u timeslice %d: cpus %d and %d differ (ran %d / %d cycles)\n", nTestSeed, n, c, c + 1, nDone[c], nDone[c + 1]);
+				printf("  pc     %08x %08x\n  delay  %08x %08x\n  pr     %08x %08x\n  sr     %08x %08x\n  gbr    %08x %08x\n  mach   %08x %08x\n  macl   %08x %08x\n  cycles %08x %08x\n",
+					a.pc, b.pc, a.delay, b.delay, a.pr, b.pr, a.sr, b.sr, a.gbr, b.gbr, a.mach, b.mach, a.macl, b.macl, a.sh2_total_cycles, b.sh2_total_cycles);
+				for (INT32 i = 0; i < 16; i++) {
+					printf("  r%-5d %08x %08x%s\n", i, a.r[i], b.r[i], (a.r[i] != b.r[i]) ? " <<<" : "");
+				}
+				nRet = 1;
+			}
+		}
+
+		if (nRet == 0 && (nHash[0] != nHash[1] || nReads[0] != nReads[1])) {
+			printf("seed %u timeslice %d: handler accesses differ\n", nTestSeed, n);
+			nRet = 1;
+		}
+
+		if (nRet == 0 && (n & 63) == 63 && (memcmp(Mem[0], Mem[1], MEM_SIZE) || memcmp(Bank[0], Bank[1], BANK_SIZE))) {
+			printf("seed %u timeslice %d: memory differs\n", nTestSeed, n);
+			nRet = 1;
+		}
+
+		if (nRet) break;
+
+		if (Rand() & 1) {
+			// somewhere else in the code, with fresh registers
+			INT32 nCpu = Rand() & 2;
+			UINT32 nPC = 0x06000000 + CODE_START + (Rand() & (CODE_LEN - 2));
+			if (Rand() & 1) nPC = 0x06080000 + (Rand() & 0xfffe);
+			UINT32 v[16];
+			for (INT32 i = 0; i < 16; i++) {
+				v[i] = MakeValue();
+			}
+			v[15] = 0x060f0000 - nCpu * 0x4000 + (Rand() & 0x3ffc);
+			UINT32 nGBR = MakeValue(), nSR = Rand() & 0x3f3, nPR = 0x06000000 + CODE_START + (Rand() & (CODE_LEN - 2));
+
+			for (INT32 c = nCpu; c < nCpu + 2; c++) {
+				OpenCpu(c);
+				sh2->pc = nPC;
+				sh2->delay = 0;
+				for (INT32 i = 0; i < 16; i++) {
+					sh2->r[i] = v[i];
+				}
+				sh2->gbr = nGBR;
+				sh2->pr = nPR;
+				sh2->sr = nSR;
+				pSh2Ext->suspend = 0;
+				Sh2Close();
+			}
+		}
+
+		if ((Rand() & 3) == 0) {
+			// code changed behind the cpus' backs
+			UINT32 a = CODE_START + (Rand() & (CODE_LEN - 0x40));
+			MakeCode(Mem[0], a, 0x40);
+			memcpy(Mem[1] + a, Mem[0] + a, 0x40);
+		}
+
+		if ((Rand() & 7) == 0) {
+			// dma copies code from the bank
+			INT32 nCpu = Rand() & 2;
+			UINT32 d = Rand();
+			for (INT32 c = nCpu; c < nCpu + 2; c++) {
+				OpenCpu(c);
+				StartDma(0x06080000 + (d & 0xfffc), 0x06000000 + CODE_START + ((d >> 8) & (CODE_LEN - 0x40)), 0x10);
+				Sh2Close();
+			}
+		}
+
+		if ((n % 500) == 250) {
+			for (INT32 c = 0; c < 4; c++) {
+				OpenCpu(c);
+				Sh2NewFrame();
+				Sh2Close();
+			}
+		}
+	}
+
+	if (nRet == 0 && (memcmp(Mem[0], Mem[1], MEM_SIZE) || memcmp(Bank[0], Bank[1], BANK_SIZE))) {
+		printf("seed %u: memory differs\n", nTestSeed);
+		nRet = 1;
+	}
+
+	Sh2Exit();
+
+	return nRet;
+}
+
+int main(int argc, char** argv)
+{
+	UINT32 nFirst = (argc > 1) ? atoi(argv[1]) : 1;
+	INT32 nSeeds = (argc > 2) ? atoi(argv[2]) : 20;
+	INT32 nSlices = (argc > 3) ? atoi(argv[3]) : 2000;
+
+	for (INT32 s = 0; s < 2; s++) {
+		Mem[s] = (UINT8*)malloc(MEM_SIZE);
+		Bank[s] = (UINT8*)malloc(BANK_SIZE);
+	}
+
+	INT32 nFailed = 0;
+	for (INT32 i = 0; i < nSeeds; i++) {
+		nFailed += RunSeed(nFirst + i, nSlices);
+	}
+
+	printf("%d of %d seeds passed\n", nSeeds - nFailed, nSeeds);
+
+	for (INT32 s = 0; s < 2; s++) {
+		free(Mem[s]);
+		free(Bank[s]);
+	}
+
+	return nFailed ? 1 : 0;
+}
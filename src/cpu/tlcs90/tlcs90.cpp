@@ -1397,6 +1397,8 @@ INLINE void Cyc_f(t90_Regs *cpustate)   {   cpustate->icount -= cpustate->cyc_f;
 
 INT32 tlcs90Run(INT32 nCycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	t90_Regs *cpustate = &tlcs90_data[0]; //get_safe_token(device);
 	UINT8    a8,b8;
 	UINT16   a16,b16;
@@ -1042,6 +1042,8 @@ inline void tlcs900_handle_timers( tlcs900_state *cpustate )
 
 INT32 tlcs900Run(INT32 nCycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	tlcs900_state *cpustate = &sCpu;
 
 	cpustate->current_cycles = nCycles;
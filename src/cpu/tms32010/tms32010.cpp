@@ -867,6 +867,8 @@ static INT32 end_run = 0;
  ****************************************************************************/
 int tms32010Run(int cycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	tms32010_icount = cycles;
 	tms32010_current_cycles = cycles;
 
@@ -56,6 +56,8 @@ void TMS34010Init()
 
 int TMS34010Run(int cycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
     return tms::run(&tms34010, cycles);
 }
 
@@ -1887,6 +1887,8 @@ static int run_end = 0;
 
 INT32 upd7810Run(INT32 cycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	upd7810_current_cycles = cycles;
 	upd7810_icount = cycles;
 
@@ -955,6 +955,8 @@ static void set_irq_line(int irqline, int state)
 
 INT32 v60Run(int cycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	UINT32 inc;
 
 	v60.cycles = cycles;
@@ -183,6 +183,8 @@ void Z180Close()
 
 INT32 Z180Run(INT32 cycles)
 {
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	if (cycles <= 0) return 0;
 
 #if defined FBNEO_DEBUG
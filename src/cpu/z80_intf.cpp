@@ -376,6 +376,8 @@ INT32 ZetRun(INT32 nCycles)
 	if (nOpenedCPU == -1) bprintf(PRINT_ERROR, _T("ZetRun called when no CPU open\n"));
 #endif
 
+	BURN_PROFILE(BURN_PROFILE_CPU);
+
 	if (nCycles <= 0) return 0;
 
 	INT32 nDelayed = 0;  // handle delayed cycle counts (from nmi / irq)
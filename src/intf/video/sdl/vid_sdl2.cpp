@@ -21,6 +21,8 @@ static SDL_Rect dest_title_texture_rect;
 
 static int screenh, screenw;
 
+static int nDirtyFirst = 0, nDirtyLast = -1;	// rows of pVidImage not yet uploaded to sdlTexture
+
 void RenderMessage()
 {
 	// First render anything that is key-held based
@@ -47,6 +49,8 @@ static int Exit()
 	SDL_DestroyRenderer(sdlRenderer);
 	SDL_DestroyWindow(sdlWindow);
 
+	bBurnDirtyRows = false;
+
 	free(VidMem);
 	return 0;
 }
@@ -233,6 +237,12 @@ static int Init()
 	{
 		memset(VidMem, 0, nMemLen);
 		pVidImage = VidMem;
+
+		// VidMem is kept between frames, so only the rows that changed need converting and uploading
+		bBurnDirtyRows = true;
+		nDirtyFirst = 0;
+		nDirtyLast = nVidImageHeight - 1;
+
 		printf("Malloc for video Ok %d\n", nMemLen);
 		return 0;
 	}
@@ -278,6 +288,30 @@ static int Frame(bool bRedraw)                                          // bRedr
 		{
 			pVidTransCallback();
 		}
+
+		int nFirst, nLast;
+		if (BurnTransferGetDirtyRows(&nFirst, &nLast, NULL))
+		{
+			nFirst = 0;
+			nLast = nVidImageHeight - 1;
+		}
+		if (nLast >= nVidImageHeight)
+		{
+			nLast = nVidImageHeight - 1;
+		}
+		if (nFirst <= nLast)
+		{
+			if (nDirtyFirst > nDirtyLast)
+			{
+				nDirtyFirst = nFirst;
+				nDirtyLast = nLast;
+			}
+			else
+			{
+				if (nFirst < nDirtyFirst) nDirtyFirst = nFirst;
+				if (nLast > nDirtyLast) nDirtyLast = nLast;
+			}
+		}
 	}
 	return 0;
 }
@@ -285,14 +319,19 @@ static int Frame(bool bRedraw)                                          // bRedr
 // Paint the BlitFX surface onto the primary surface
 static int Paint(int bValidate)
 {
-	void* pixels;
-	int   pitch;
-
 	SDL_RenderClear(sdlRenderer);
 
+	// only upload the rows that changed since the last paint
+	if (nDirtyFirst <= nDirtyLast)
+	{
+		SDL_Rect rect = { 0, nDirtyFirst, nVidImageWidth, nDirtyLast - nDirtyFirst + 1 };
+		SDL_UpdateTexture(sdlTexture, &rect, pVidImage + nDirtyFirst * nVidImagePitch, nVidImagePitch);
+		nDirtyFirst = 0;
+		nDirtyLast = -1;
+	}
+
 	if (nRotateGame)
 	{
-		SDL_UpdateTexture(sdlTexture, NULL, pVidImage, nVidImagePitch);
 		if (nRotateGame && bFlipped)
 		{
 			SDL_RenderCopyEx(sdlRenderer, sdlTexture, NULL, &dstrect, 90, NULL, SDL_FLIP_NONE);
@@ -304,9 +343,6 @@ static int Paint(int bValidate)
 	}
 	else
 	{
-		SDL_LockTexture(sdlTexture, NULL, &pixels, &pitch);
-		memcpy(pixels, pVidImage, nVidImagePitch * nVidImageHeight);
-		SDL_UnlockTexture(sdlTexture);
 		SDL_RenderCopy(sdlRenderer, sdlTexture, NULL, &dstrect);
 	}
 